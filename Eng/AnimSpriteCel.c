@@ -1,43 +1,222 @@
 
 #include "AnimSpriteCel.h"
 
+// AnimSpriteCelSystemUnregister(), AnimSpriteCelSystemSchedule(), AnimSpriteCelSystemTriggerPush(), AnimSpriteCelSystemOutboxPush(), AnimSpriteCelSystemEventPush()
+#include "AnimSpriteCelSystem.h"
+// ANIMSPRITECEL_TRACE_EVENT(), ANIMSPRITECEL_TRACE_COUNTERS(), animSpriteCelTrace
+#include "AnimSpriteCelTrace.h"
 // UNDEFINED, LIST_START, LIST_END
 #include "DefinitionsArguments.h"
 // AllocMem(), FreeMem(), MEMTYPE_DRAM
 #include "mem.h"
 // CloneCel()
 #include "celutils.h"
-// GetRandomValue()
+// GetRandomValue(), GetRandomXorshift(), GetRandomRangeValue()
 #include "Mathematical.h"
 // memset()
 #include "string.h"
 // printf()
 #include "stdio.h"
 
-// Initialization of an AnimSpriteCel
-AnimSpriteCel *AnimSpriteCelInitialization(SpriteCel *spriteCel, AnimSpriteCelLoop loop, AnimSpriteCelRange range, uint32 iterations, int32 direction, uint32 stepIndex, uint32 stepsCount) {
+// Resolves and caches the CCB descriptor of a SpriteCel frame
+void AnimSpriteCelFrameResolve(SpriteCel *spriteCel, AnimSpriteCelFrame *frames, uint32 frameIndex) {
 
-    // AnimSpriteCel instance
-    AnimSpriteCel *animSpriteCel = NULL;
-        
-    if (DEBUG_ANIMSPRITECEL_INIT == 1) { printf("*AnimSpriteCelInitialization()*\n"); }
+    // Frame descriptor displayed by the SpriteCel
+    uint32 spritePRE0 = 0;
+    uint32 spritePRE1 = 0;
+    CelData *spriteSourcePtr = NULL;
 
-    // If the sprite sheet doesn't exist
-    if (spriteCel == NULL) {
-        // Display error message
-        printf("Error: SpriteCel unknown.\n");
-        return NULL;
+    // Save the frame currently displayed by the shared SpriteCel
+    spritePRE0 = spriteCel->cel->ccb_PRE0;
+    spritePRE1 = spriteCel->cel->ccb_PRE1;
+    spriteSourcePtr = spriteCel->cel->ccb_SourcePtr;
+
+    // Let the SpriteCel compute the descriptor of the frame
+    SpriteCelSetFrame(spriteCel, frameIndex);
+
+    // Cache it in the table, for all the steps displaying the frame
+    frames[frameIndex].ccbPRE0 = spriteCel->cel->ccb_PRE0;
+    frames[frameIndex].ccbPRE1 = spriteCel->cel->ccb_PRE1;
+    frames[frameIndex].ccbSourcePtr = spriteCel->cel->ccb_SourcePtr;
+
+    // Give the SpriteCel its frame back
+    spriteCel->cel->ccb_PRE0 = spritePRE0;
+    spriteCel->cel->ccb_PRE1 = spritePRE1;
+    spriteCel->cel->ccb_SourcePtr = spriteSourcePtr;
+}
+
+// Grows a frame descriptor table to hold a frame index
+int32 AnimSpriteCelFramesReserve(AnimSpriteCelFrame **frames, uint32 *framesCount, uint32 frameIndex) {
+
+    // Grown table
+    AnimSpriteCelFrame *grownFrames = NULL;
+
+    // If the table already holds the frame
+    if (frameIndex < *framesCount) {
+        return 1;
     }
 
-    // Allocate memory for AnimSpriteCel
-    animSpriteCel = (AnimSpriteCel *)AllocMem(sizeof(AnimSpriteCel), MEMTYPE_DRAM);
+    // If the frame can't be indexed on 16 bits
+    if (frameIndex >= 0x10000) {
+        // Return error
+        printf("Error: AnimSpriteCel frameIndex %u out of bounds (65536 frames at most).\n", frameIndex);
+        return -1;
+    }
+
+    // Allocate memory for the frames up to the new one
+    grownFrames = (AnimSpriteCelFrame *)AllocMem((frameIndex + 1) * sizeof(AnimSpriteCelFrame), MEMTYPE_DRAM);
     // If allocation fails
-    if (animSpriteCel == NULL) {
-        // Display error message
-        printf("Error: Failed to allocate memory for AnimSpriteCel.\n");
-        return NULL;
+    if (grownFrames == NULL) {
+        // Return error
+        printf("Error: Failed to allocate memory for AnimSpriteCel frames.\n");
+        return -1;
+    }
+
+    // Keep the frames already resolved, the new ones are resolved by their steps
+    if (*frames != NULL) {
+        memcpy(grownFrames, *frames, (size_t)*framesCount * sizeof(AnimSpriteCelFrame));
+        FreeMem(*frames, *framesCount * sizeof(AnimSpriteCelFrame));
+    }
+    *frames = grownFrames;
+    *framesCount = frameIndex + 1;
+
+    // Return success
+    return 1;
+}
+
+// Resolves the CCB frame descriptors of the SpriteCel frames
+void AnimSpriteCelFramesResolve(SpriteCel *spriteCel, AnimSpriteCelFrame *frames, uint32 framesCount) {
+
+    // Frame index
+    uint32 frameIndex = 0;
+    // Frame descriptor displayed by the SpriteCel
+    uint32 spritePRE0 = 0;
+    uint32 spritePRE1 = 0;
+    CelData *spriteSourcePtr = NULL;
+
+    // Save the frame currently displayed by the shared SpriteCel
+    spritePRE0 = spriteCel->cel->ccb_PRE0;
+    spritePRE1 = spriteCel->cel->ccb_PRE1;
+    spriteSourcePtr = spriteCel->cel->ccb_SourcePtr;
+
+    // Resolve the descriptor of each frame once, for all the steps displaying it
+    for (frameIndex = 0; frameIndex < framesCount; frameIndex++) {
+        SpriteCelSetFrame(spriteCel, frameIndex);
+        frames[frameIndex].ccbPRE0 = spriteCel->cel->ccb_PRE0;
+        frames[frameIndex].ccbPRE1 = spriteCel->cel->ccb_PRE1;
+        frames[frameIndex].ccbSourcePtr = spriteCel->cel->ccb_SourcePtr;
+    }
+
+    // Give the SpriteCel its frame back
+    spriteCel->cel->ccb_PRE0 = spritePRE0;
+    spriteCel->cel->ccb_PRE1 = spritePRE1;
+    spriteCel->cel->ccb_SourcePtr = spriteSourcePtr;
+}
+
+// Writes the frame of the current step in the CCB (normal layout), returns 1 if the CCB changed
+static uint32 AnimSpriteCelStepDisplay(AnimSpriteCel *animSpriteCel) {
+
+    // Cached descriptor of the step frame
+    AnimSpriteCelFrame *frame = &animSpriteCel->frames[animSpriteCel->steps[animSpriteCel->stepIndex].frameIndex];
+
+    // If the CCB already shows this frame, nothing to write
+    if ((animSpriteCel->cel->ccb_SourcePtr == frame->ccbSourcePtr) && (animSpriteCel->cel->ccb_PRE0 == frame->ccbPRE0) && (animSpriteCel->cel->ccb_PRE1 == frame->ccbPRE1)) {
+        return 0;
+    }
+
+    // Copy the cached frame descriptor of the step
+    animSpriteCel->cel->ccb_PRE0 = frame->ccbPRE0;
+    animSpriteCel->cel->ccb_PRE1 = frame->ccbPRE1;
+    animSpriteCel->cel->ccb_SourcePtr = frame->ccbSourcePtr;
+    return 1;
+}
+
+// Writes the frame of the current step in the CCB (packed layout), returns 1 if the CCB changed
+static uint32 AnimSpriteCelPackedStepDisplay(AnimSpriteCel *animSpriteCel) {
+
+    // Packed steps share the descriptor of their frame
+    AnimSpriteCelFrame *frame = &animSpriteCel->frames[animSpriteCel->packedSteps[animSpriteCel->stepIndex].frameIndex];
+
+    // If the CCB already shows this frame, nothing to write
+    if ((animSpriteCel->cel->ccb_SourcePtr == frame->ccbSourcePtr) && (animSpriteCel->cel->ccb_PRE0 == frame->ccbPRE0) && (animSpriteCel->cel->ccb_PRE1 == frame->ccbPRE1)) {
+        return 0;
+    }
+
+    animSpriteCel->cel->ccb_PRE0 = frame->ccbPRE0;
+    animSpriteCel->cel->ccb_PRE1 = frame->ccbPRE1;
+    animSpriteCel->cel->ccb_SourcePtr = frame->ccbSourcePtr;
+    return 1;
+}
+
+// Moves the step index forward (NORMAL), returns 1 at the end of a cycle
+static uint32 AnimSpriteCelStepMoveNormal(AnimSpriteCel *animSpriteCel) {
+
+    // Advance
+    animSpriteCel->stepIndex++;
+
+    // If step exceeds bounds
+    if (animSpriteCel->stepIndex >= (int32)animSpriteCel->stepsCount) {
+        // Wrap around to beginning
+        animSpriteCel->stepIndex = 0;
+        // Flag cycle completion
+        return 1;
+    }
+
+    return 0;
+}
+
+// Moves the step index backward (REVERSE), returns 1 at the end of a cycle
+static uint32 AnimSpriteCelStepMoveReverse(AnimSpriteCel *animSpriteCel) {
+
+    // Rewind
+    animSpriteCel->stepIndex--;
+
+    // If step index drops below zero
+    if (animSpriteCel->stepIndex < 0) {
+        // Wrap to last step
+        animSpriteCel->stepIndex = animSpriteCel->stepsCount - 1;
+        // Flag cycle completion
+        return 1;
+    }
+
+    return 0;
+}
+
+// Moves the step index forward or backward (ALTERNATE), returns 1 at the end of a cycle
+static uint32 AnimSpriteCelStepMoveAlternate(AnimSpriteCel *animSpriteCel) {
+
+    // Move forward or backward based on direction
+    animSpriteCel->stepIndex += animSpriteCel->direction;
+
+    // If step exceeds bounds
+    if (animSpriteCel->stepIndex >= (int32)animSpriteCel->stepsCount) {
+        // Bounce back before the last step
+        animSpriteCel->stepIndex = animSpriteCel->stepsCount - 2;
+        // Reverse direction
+        animSpriteCel->direction = -1;
+        // Flag cycle completion
+        return 1;
+    }
+
+    // If step index drops below zero
+    if (animSpriteCel->stepIndex < 0) {
+        // Bounce back after the first step
+        animSpriteCel->stepIndex = 1;
+        // Reverse direction
+        animSpriteCel->direction = 1;
+        // Flag cycle completion
+        return 1;
     }
 
+    return 0;
+}
+
+// Initialization of an AnimSpriteCel whose CCB, steps and timeline are already allocated
+void AnimSpriteCelSetup(AnimSpriteCel *animSpriteCel, SpriteCel *spriteCel, AnimSpriteCelLoop loop, AnimSpriteCelRange range, uint32 iterations, int32 direction, uint32 stepIndex, uint32 stepsCount) {
+
+    // Index of an unconfigured step
+    uint32 unconfiguredIndex = 0;
+
     // Parameter corrections
     // → Minimum number of steps = 2
     stepsCount = (stepsCount > 1) ? stepsCount : 2;
@@ -50,6 +229,20 @@ AnimSpriteCel *AnimSpriteCelInitialization(SpriteCel *spriteCel, AnimSpriteCelLo
     animSpriteCel->spriteCel = spriteCel;
     // Animation loop type
     animSpriteCel->loop = loop;
+    // Step move of the loop mode, chosen once instead of on every step change
+    switch (loop) {
+        case REVERSE:
+            animSpriteCel->stepMove = AnimSpriteCelStepMoveReverse;
+            break;
+        case ALTERNATE:
+            animSpriteCel->stepMove = AnimSpriteCelStepMoveAlternate;
+            break;
+        default:
+            animSpriteCel->stepMove = AnimSpriteCelStepMoveNormal;
+            break;
+    }
+    // Frame display of the step layout
+    animSpriteCel->stepDisplay = (animSpriteCel->packedSteps != NULL) ? AnimSpriteCelPackedStepDisplay : AnimSpriteCelStepDisplay;
     // Random range configuration
     animSpriteCel->range = range;
     // Remaining cycles before next step
@@ -62,12 +255,107 @@ AnimSpriteCel *AnimSpriteCelInitialization(SpriteCel *spriteCel, AnimSpriteCelLo
     animSpriteCel->stepIndex = stepIndex;
     // Total number of steps
     animSpriteCel->stepsCount = stepsCount;
+    // Starting state of the timeline
+    animSpriteCel->originStepIndex = stepIndex;
+    animSpriteCel->originDirection = direction;
+    animSpriteCel->originIterations = iterations;
+    // Hardware random numbers until seeded
+    animSpriteCel->randomState = 0;
+    animSpriteCel->originRandomState = 0;
+    // Normal speed, nothing carried
+    animSpriteCel->speed = ANIMSPRITECEL_SPEED_NORMAL;
+    animSpriteCel->speedAccumulator = 0;
+    // Durations in display cycles
+    animSpriteCel->timeBase = CYCLES;
+    // Timeline built on the first seek
+    animSpriteCel->timelineLength = 0;
+    animSpriteCel->timelineDirty = 1;
+    // Not registered in a system yet
+    animSpriteCel->system = NULL;
+    animSpriteCel->systemIndex = 0;
+    animSpriteCel->expiryTick = 0;
+    animSpriteCel->wheelSlot = NULL;
+    animSpriteCel->wheelPrevious = NULL;
+    animSpriteCel->wheelNext = NULL;
+    animSpriteCel->systemActive = 0;
+    animSpriteCel->stateHash = 0;
+    // Visible, drawn once registered in a system with a draw list
+    animSpriteCel->visible = 1;
+    animSpriteCel->drawPrevious = NULL;
+    animSpriteCel->drawNext = NULL;
+    animSpriteCel->drawGroup = 0;
+    // Identifier and counters of the trace
+#if ANIMSPRITECEL_TRACE == 1
+    animSpriteCel->traceId = animSpriteCelTrace.nextId++;
+    animSpriteCel->traceSteps = 0;
+    animSpriteCel->traceIdleCycles = 0;
+    animSpriteCel->traceTriggersSent = 0;
+    animSpriteCel->traceTriggersReceived = 0;
+#endif
+    ANIMSPRITECEL_TRACE_EVENT(TRACE_INIT, animSpriteCel, stepsCount);
 
-    // Clone the SpriteCel CCB (Command Control Block)
-    animSpriteCel->cel = CloneCel(animSpriteCel->spriteCel->cel, CLONECEL_CCB_ONLY);
     // Enable preamble parsing on the cloned CCB
     animSpriteCel->cel->ccb_Flags |= CCB_CCBPRE;
 
+    // Packed steps of a file or a table are already configured
+    if ((animSpriteCel->file != NULL) || (animSpriteCel->table != NULL)) {
+        return;
+    }
+
+    // Unconfigured packed steps display the first frame and wait
+    if (animSpriteCel->packedSteps != NULL) {
+        for (unconfiguredIndex = 0; unconfiguredIndex < stepsCount; unconfiguredIndex++) {
+            animSpriteCel->packedSteps[unconfiguredIndex].frameIndex = 0;
+            animSpriteCel->packedSteps[unconfiguredIndex].frameDuration = 0;
+            animSpriteCel->packedSteps[unconfiguredIndex].receiverIndex = ANIMSPRITECEL_RECEIVER_NONE;
+            animSpriteCel->packedSteps[unconfiguredIndex].eventId = ANIMSPRITECEL_EVENT_NONE;
+        }
+    // Steps shared by a sequence are already configured
+    } else if (animSpriteCel->sequence == NULL) {
+        // Unconfigured steps display the first frame and wait
+        memset(animSpriteCel->steps, 0, (size_t)stepsCount * sizeof(AnimSpriteCelStep));
+        AnimSpriteCelFrameResolve(spriteCel, animSpriteCel->frames, 0);
+    }
+}
+
+// Initialization of an AnimSpriteCel
+AnimSpriteCel *AnimSpriteCelInitialization(SpriteCel *spriteCel, AnimSpriteCelLoop loop, AnimSpriteCelRange range, uint32 iterations, int32 direction, uint32 stepIndex, uint32 stepsCount) {
+
+    // AnimSpriteCel instance
+    AnimSpriteCel *animSpriteCel = NULL;
+        
+    // If the sprite sheet doesn't exist
+    if (spriteCel == NULL) {
+        // Display error message
+        printf("Error: SpriteCel unknown.\n");
+        return NULL;
+    }
+
+    // Minimum number of steps = 2
+    stepsCount = (stepsCount > 1) ? stepsCount : 2;
+
+    // Allocate memory for AnimSpriteCel
+    animSpriteCel = (AnimSpriteCel *)AllocMem(sizeof(AnimSpriteCel), MEMTYPE_DRAM);
+    // If allocation fails
+    if (animSpriteCel == NULL) {
+        // Display error message
+        printf("Error: Failed to allocate memory for AnimSpriteCel.\n");
+        return NULL;
+    }
+
+    // Not taken from a pool, steps of its own
+    animSpriteCel->pool = NULL;
+    animSpriteCel->sequence = NULL;
+    animSpriteCel->file = NULL;
+    animSpriteCel->table = NULL;
+    animSpriteCel->release = NULL;
+    animSpriteCel->packedSteps = NULL;
+    // Frame descriptors, grown by the step configurations
+    animSpriteCel->framesCount = 1;
+
+    // Clone the SpriteCel CCB (Command Control Block)
+    animSpriteCel->cel = CloneCel(spriteCel->cel, CLONECEL_CCB_ONLY);
+
     // Allocate memory for the step array
     animSpriteCel->steps = (AnimSpriteCelStep *)AllocMem(stepsCount * sizeof(AnimSpriteCelStep), MEMTYPE_DRAM);
     // If step allocation fails
@@ -79,8 +367,33 @@ AnimSpriteCel *AnimSpriteCelInitialization(SpriteCel *spriteCel, AnimSpriteCelLo
         return NULL;
     }
 
-    // Initialize step data to zero
-    memset(animSpriteCel->steps, 0, (size_t)stepsCount * sizeof(AnimSpriteCelStep));
+    // Allocate memory for the descriptor of the first frame
+    animSpriteCel->frames = (AnimSpriteCelFrame *)AllocMem(sizeof(AnimSpriteCelFrame), MEMTYPE_DRAM);
+    // If frame allocation fails
+    if (animSpriteCel->frames == NULL) {
+        // Free previously allocated steps and AnimSpriteCel
+        FreeMem(animSpriteCel->steps, stepsCount * sizeof(AnimSpriteCelStep));
+        FreeMem(animSpriteCel, sizeof(AnimSpriteCel));
+        // Display error message
+        printf("Error: Failed to allocate memory for AnimSpriteCel frames.\n");
+        return NULL;
+    }
+
+    // Allocate memory for the cumulative durations (up to 2 * stepsCount - 2 positions in ALTERNATE)
+    animSpriteCel->timeline = (uint32 *)AllocMem(((2 * stepsCount) - 1) * sizeof(uint32), MEMTYPE_DRAM);
+    // If timeline allocation fails
+    if (animSpriteCel->timeline == NULL) {
+        // Free previously allocated frames, steps and AnimSpriteCel
+        FreeMem(animSpriteCel->frames, sizeof(AnimSpriteCelFrame));
+        FreeMem(animSpriteCel->steps, stepsCount * sizeof(AnimSpriteCelStep));
+        FreeMem(animSpriteCel, sizeof(AnimSpriteCel));
+        // Display error message
+        printf("Error: Failed to allocate memory for AnimSpriteCel timeline.\n");
+        return NULL;
+    }
+
+    // Initialize the animation in the allocated memory
+    AnimSpriteCelSetup(animSpriteCel, spriteCel, loop, range, iterations, direction, stepIndex, stepsCount);
 
     // Return the newly created AnimSpriteCel
     return animSpriteCel;
@@ -89,8 +402,6 @@ AnimSpriteCel *AnimSpriteCelInitialization(SpriteCel *spriteCel, AnimSpriteCelLo
 // Configuration of a step in an AnimSpriteCel
 int32 AnimSpriteCelStepConfiguration(AnimSpriteCel *animSpriteCel, uint32 stepIndex, uint32 frameIndex, int32 frameDuration, AnimSpriteCel *animSpriteCelReceiver) {
     
-    if (DEBUG_ANIMSPRITECEL_SETUP == 1) { printf("*AnimSpriteCelStepConfiguration()*\n"); }
-
     // If the AnimSpriteCel is undefined
     if (animSpriteCel == NULL){
         // Return error
@@ -105,6 +416,17 @@ int32 AnimSpriteCelStepConfiguration(AnimSpriteCel *animSpriteCel, uint32 stepIn
         return -1;  
     }
     
+    // If the steps are packed
+    if (animSpriteCel->packedSteps != NULL){
+        // A packed step designates its receiver by index
+        if (animSpriteCelReceiver == NULL){
+            return AnimSpriteCelPackedStepConfiguration(animSpriteCel, stepIndex, frameIndex, frameDuration, ANIMSPRITECEL_RECEIVER_NONE);
+        }
+        // Return error
+        printf("Error: AnimSpriteCel packed steps take a receiver index.\n");
+        return -1;
+    }
+
     // If the steps array is undefined
     if (animSpriteCel->steps == NULL){
         // Return error
@@ -119,6 +441,13 @@ int32 AnimSpriteCelStepConfiguration(AnimSpriteCel *animSpriteCel, uint32 stepIn
         return -1;
     }
 
+    // If the steps belong to a shared sequence
+    if (animSpriteCel->sequence != NULL){
+        // Return error
+        printf("Error: AnimSpriteCel steps are shared by an AnimSpriteCelSequence.\n");
+        return -1;
+    }
+
     // Clamp stepIndex if out of bounds
     if (stepIndex >= animSpriteCel->stepsCount) { 
         // Display warning
@@ -126,19 +455,38 @@ int32 AnimSpriteCelStepConfiguration(AnimSpriteCel *animSpriteCel, uint32 stepIn
         // Adjust to the last valid index
         stepIndex = animSpriteCel->stepsCount - 1; 
     }
+
+    // If the frame descriptors of a pool slot can't hold the frame
+    if ((animSpriteCel->pool != NULL) && (frameIndex >= animSpriteCel->framesCount)) {
+        // Return error
+        printf("Error: AnimSpriteCelPool slots hold %u frames at most.\n", animSpriteCel->framesCount);
+        return -1;
+    }
+
+    // Make room for the frame descriptor
+    if (AnimSpriteCelFramesReserve(&animSpriteCel->frames, &animSpriteCel->framesCount, frameIndex) < 0) {
+        // Return error
+        printf("Error <- AnimSpriteCelFramesReserve()\n");
+        return -1;
+    }
     
     // Configure the animation step
     animSpriteCel->steps[stepIndex].frameIndex = frameIndex;
     animSpriteCel->steps[stepIndex].frameDuration = frameDuration;
     animSpriteCel->steps[stepIndex].animSpriteCelReceiver = animSpriteCelReceiver;
-    
-    if (DEBUG_ANIMSPRITECEL_SETUP == 1) {
-        printf("animSpriteCel->cel : %p\n", animSpriteCel->cel);
-        printf("animSpriteCel->steps[%u].frameIndex : %u\n", stepIndex, animSpriteCel->steps[stepIndex].frameIndex);
-        printf("animSpriteCel->steps[%u].frameDuration : %d\n", stepIndex, animSpriteCel->steps[stepIndex].frameDuration);
-        printf("animSpriteCel->steps[%u].animSpriteCelReceiver : %p\n", stepIndex, animSpriteCel->steps[stepIndex].animSpriteCelReceiver);
+    // Resolve the frame descriptor once, for all the steps displaying it
+    AnimSpriteCelFrameResolve(animSpriteCel->spriteCel, animSpriteCel->frames, frameIndex);
+    // The cumulative durations must be rebuilt
+    animSpriteCel->timelineDirty = 1;
+
+    // The analyses of the system no longer match its triggers
+    if (animSpriteCel->system != NULL) {
+        animSpriteCel->system->generation++;
     }
     
+    // Trace the configured step
+    ANIMSPRITECEL_TRACE_EVENT(TRACE_CONFIGURATION, animSpriteCel, stepIndex);
+    
     // If the configured step is currently displayed
     if (stepIndex == animSpriteCel->stepIndex){
         // Update the main CCB of the AnimSpriteCel
@@ -161,8 +509,6 @@ int32 AnimSpriteCelStepsConfiguration(AnimSpriteCel *animSpriteCel, int32 start,
     int32 frameDuration = 1;
     AnimSpriteCel *animSpriteCelReceiver = NULL;
 
-    if (DEBUG_ANIMSPRITECEL_SETUP == 1) { printf("*AnimSpriteCelStepsConfiguration()*\n"); }
-
     // Begin reading arguments
     va_start(args, start);
 
@@ -184,9 +530,6 @@ int32 AnimSpriteCelStepsConfiguration(AnimSpriteCel *animSpriteCel, int32 start,
         animSpriteCelReceiver = va_arg(args, AnimSpriteCel *);
 
         // Step configuration
-        if (DEBUG_ANIMSPRITECEL_SETUP == 1) {
-            printf("-> AnimSpriteCelStepConfiguration(%p, %u, %u, %d, %p)\n", animSpriteCel, stepIndex, frameIndex, frameDuration, animSpriteCelReceiver);
-        }
         if (AnimSpriteCelStepConfiguration(animSpriteCel, stepIndex, frameIndex, frameDuration, animSpriteCelReceiver) < 0) {
             // End argument processing
             va_end(args);
@@ -203,161 +546,562 @@ int32 AnimSpriteCelStepsConfiguration(AnimSpriteCel *animSpriteCel, int32 start,
     return 1;
 }
 
-// Updates the display of an AnimSpriteCel
-void AnimSpriteCelUpdate(AnimSpriteCel *animSpriteCel) {
-    
-    // Maximum value for the random range
-    uint32 randomRangeMax = 0;
-    
-    if (DEBUG_ANIMSPRITECEL_FUNCT == 1) { printf("*AnimSpriteCelUpdate()*\n"); }
-
-    // Set the current frame in the SpriteCel CCB
-    SpriteCelSetFrame(animSpriteCel->spriteCel, animSpriteCel->steps[animSpriteCel->stepIndex].frameIndex); 
-    
-    // Copy CCB data from SpriteCel to AnimSpriteCel
-    animSpriteCel->cel->ccb_PRE0 = animSpriteCel->spriteCel->cel->ccb_PRE0;
-    animSpriteCel->cel->ccb_PRE1 = animSpriteCel->spriteCel->cel->ccb_PRE1;
-    animSpriteCel->cel->ccb_SourcePtr = animSpriteCel->spriteCel->cel->ccb_SourcePtr;
+// Initialization of an AnimSpriteCel with packed steps
+AnimSpriteCel *AnimSpriteCelPackedInitialization(SpriteCel *spriteCel, AnimSpriteCelLoop loop, AnimSpriteCelRange range, uint32 iterations, int32 direction, uint32 stepIndex, uint32 stepsCount, uint32 framesCount) {
 
-    // If frame duration is positive (> 1)
-    if (animSpriteCel->steps[animSpriteCel->stepIndex].frameDuration > 1) {
-        // Use specified duration
-        animSpriteCel->remainingCycles = animSpriteCel->steps[animSpriteCel->stepIndex].frameDuration;
+    // AnimSpriteCel instance
+    AnimSpriteCel *animSpriteCel = NULL;
 
-    // If frame duration is negative (< 0)
-    } else if (animSpriteCel->steps[animSpriteCel->stepIndex].frameDuration < 1) {
-        // Convert to positive max range
-        randomRangeMax = 0 - animSpriteCel->steps[animSpriteCel->stepIndex].frameDuration;
+    // If the sprite sheet doesn't exist
+    if (spriteCel == NULL) {
+        // Display error message
+        printf("Error: SpriteCel unknown.\n");
+        return NULL;
+    }
 
-        // Choose random value depending on configured range
-        switch (animSpriteCel->range) {
-            // Range between 1 and max
-            case FULL:    
-                animSpriteCel->remainingCycles = GetRandomValue(1, randomRangeMax); 
-                break;
-            // Range between (max / 2) and max
-            case HALF:    
-                animSpriteCel->remainingCycles = GetRandomValue(randomRangeMax / 2, randomRangeMax);  
-                break;
-            // Range between (max * 3/4) and max
-            case QUARTER: 
-                animSpriteCel->remainingCycles = GetRandomValue(randomRangeMax - (randomRangeMax / 4), randomRangeMax);
-                break;
-        }
+    // If the frames can't be indexed on 16 bits
+    if ((framesCount == 0) || (framesCount > 0x10000)) {
+        // Display error message
+        printf("Error: AnimSpriteCel packed steps index 1 to 65536 frames (%u).\n", framesCount);
+        return NULL;
+    }
 
-    // Otherwise, duration is zero — waiting for trigger
-    } else {
-        animSpriteCel->remainingCycles = 0;
-    }   
-}
+    // Minimum number of steps = 2
+    stepsCount = (stepsCount > 1) ? stepsCount : 2;
 
-// Advances to the next step in the animation
-void AnimSpriteCelNextStep(AnimSpriteCel *animSpriteCel) {
-    
-    // End-of-cycle flag
-    uint32 cycleEnd = 0;
+    // Allocate memory for AnimSpriteCel
+    animSpriteCel = (AnimSpriteCel *)AllocMem(sizeof(AnimSpriteCel), MEMTYPE_DRAM);
+    // If allocation fails
+    if (animSpriteCel == NULL) {
+        // Display error message
+        printf("Error: Failed to allocate memory for AnimSpriteCel.\n");
+        return NULL;
+    }
 
-    if (DEBUG_ANIMSPRITECEL_FUNCT == 1) { printf("*AnimSpriteCelNextStep()*\n"); }
+    // Not taken from a pool, packed steps of its own
+    animSpriteCel->pool = NULL;
+    animSpriteCel->sequence = NULL;
+    animSpriteCel->file = NULL;
+    animSpriteCel->table = NULL;
+    animSpriteCel->release = NULL;
+    animSpriteCel->steps = NULL;
+    animSpriteCel->framesCount = framesCount;
 
-    // Based on loop mode
-    switch (animSpriteCel->loop) {
-        
-        // Animation plays forward each cycle
-        case NORMAL:
-            // Advance
-            animSpriteCel->stepIndex++;
-            // If step exceeds bounds
-            if (animSpriteCel->stepIndex >= animSpriteCel->stepsCount) {
-                // Wrap around to beginning
-                animSpriteCel->stepIndex = 0;
-                // Flag cycle completion
-                cycleEnd = 1;
-            }
-            break;
+    // Allocate memory for the packed step array
+    animSpriteCel->packedSteps = (AnimSpriteCelPackedStep *)AllocMem(stepsCount * sizeof(AnimSpriteCelPackedStep), MEMTYPE_DRAM);
+    // If step allocation fails
+    if (animSpriteCel->packedSteps == NULL) {
+        // Free previously allocated AnimSpriteCel
+        FreeMem(animSpriteCel, sizeof(AnimSpriteCel));
+        // Display error message
+        printf("Error: Failed to allocate memory for AnimSpriteCel packed steps.\n");
+        return NULL;
+    }
 
-        // Animation plays backward each cycle
-        case REVERSE:
-            // Rewind
-            animSpriteCel->stepIndex--;
-            // If step index drops below zero
-            if (animSpriteCel->stepIndex < 0) {
-                // Wrap to last step
-                animSpriteCel->stepIndex = animSpriteCel->stepsCount - 1;
-                // Flag cycle completion
-                cycleEnd = 1;
-            }
-            break;
+    // Allocate memory for the frame descriptors
+    animSpriteCel->frames = (AnimSpriteCelFrame *)AllocMem(framesCount * sizeof(AnimSpriteCelFrame), MEMTYPE_DRAM);
+    // If frame allocation fails
+    if (animSpriteCel->frames == NULL) {
+        // Free previously allocated steps and AnimSpriteCel
+        FreeMem(animSpriteCel->packedSteps, stepsCount * sizeof(AnimSpriteCelPackedStep));
+        FreeMem(animSpriteCel, sizeof(AnimSpriteCel));
+        // Display error message
+        printf("Error: Failed to allocate memory for AnimSpriteCel frames.\n");
+        return NULL;
+    }
 
-        // Animation alternates forward and backward each cycle
-        case ALTERNATE:
-            // Move forward or backward based on direction
-            animSpriteCel->stepIndex += animSpriteCel->direction;
-
-            // If step exceeds bounds
-            if (animSpriteCel->stepIndex >= animSpriteCel->stepsCount) {
-                // Reset to start
-                animSpriteCel->stepIndex = 0;
-                // Reverse direction
-                animSpriteCel->direction *= -1;
-                // Flag cycle completion
-                cycleEnd = 1;
-            }
-            // If step index drops below zero
-            else if (animSpriteCel->stepIndex < 0) {
-                // Wrap to last step
-                animSpriteCel->stepIndex = animSpriteCel->stepsCount - 1;
-                // Reverse direction
-                animSpriteCel->direction *= -1;
-                // Flag cycle completion
-                cycleEnd = 1;
-            }
-            break;
+    // Allocate memory for the cumulative durations (up to 2 * stepsCount - 2 positions in ALTERNATE)
+    animSpriteCel->timeline = (uint32 *)AllocMem(((2 * stepsCount) - 1) * sizeof(uint32), MEMTYPE_DRAM);
+    // If timeline allocation fails
+    if (animSpriteCel->timeline == NULL) {
+        // Free previously allocated frames, steps and AnimSpriteCel
+        FreeMem(animSpriteCel->frames, framesCount * sizeof(AnimSpriteCelFrame));
+        FreeMem(animSpriteCel->packedSteps, stepsCount * sizeof(AnimSpriteCelPackedStep));
+        FreeMem(animSpriteCel, sizeof(AnimSpriteCel));
+        // Display error message
+        printf("Error: Failed to allocate memory for AnimSpriteCel timeline.\n");
+        return NULL;
     }
 
-    // Update main CCB of the AnimSpriteCel
-    AnimSpriteCelUpdate(animSpriteCel);
+    // Resolve the descriptor of each frame once
+    AnimSpriteCelFramesResolve(spriteCel, animSpriteCel->frames, framesCount);
 
-    // If cycle ended and animation is not infinite
-    if ((cycleEnd == 1) && (animSpriteCel->iterationsCount != INFINITE)) {
-        // Decrement remaining cycle count
-        animSpriteCel->iterationsCount--;
-    }
+    // Clone the SpriteCel CCB (Command Control Block)
+    animSpriteCel->cel = CloneCel(spriteCel->cel, CLONECEL_CCB_ONLY);
 
-    // If this step controls another animation
-    if (animSpriteCel->steps[animSpriteCel->stepIndex].animSpriteCelReceiver != NULL) {
-        // Trigger next step on receiver
-        AnimSpriteCelTrigger(animSpriteCel->steps[animSpriteCel->stepIndex].animSpriteCelReceiver);
-    }
-}
+    // Initialize the animation in the allocated memory
+    AnimSpriteCelSetup(animSpriteCel, spriteCel, loop, range, iterations, direction, stepIndex, stepsCount);
 
-// Executes the animation
-void AnimSpriteCelRun(AnimSpriteCel *animSpriteCel) {
+    // Return the newly created AnimSpriteCel
+    return animSpriteCel;
+}
 
-    if (DEBUG_ANIMSPRITECEL_FUNCT == 1) { printf("*AnimSpriteCelRun()*\n"); }
+// Configuration of a packed step in an AnimSpriteCel
+int32 AnimSpriteCelPackedStepConfiguration(AnimSpriteCel *animSpriteCel, uint32 stepIndex, uint32 frameIndex, int32 frameDuration, uint32 receiverIndex) {
 
-    // If the animation is undefined
+    // If the AnimSpriteCel is undefined
     if (animSpriteCel == NULL) {
-        // Log error
+        // Return error
         printf("Error: AnimSpriteCel unknown.\n");
-        return;
+        return -1;
     }
 
-    // If the SpriteCel is undefined
-    if (animSpriteCel->spriteCel == NULL) {
-        // Log error
-        printf("Error: AnimSpriteCel SpriteCel unknown.\n");
+    // If the steps are not packed
+    if (animSpriteCel->packedSteps == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCel steps are not packed.\n");
+        return -1;
+    }
+
+    // If the steps are read from a file
+    if (animSpriteCel->file != NULL) {
+        // Return error
+        printf("Error: AnimSpriteCel steps belong to an AnimSpriteCelFile.\n");
+        return -1;
+    }
+
+    // If the steps are read from a generated table
+    if (animSpriteCel->table != NULL) {
+        // Return error
+        printf("Error: AnimSpriteCel steps belong to an AnimSpriteCelTable.\n");
+        return -1;
+    }
+
+    // If the step doesn't exist
+    if (stepIndex >= animSpriteCel->stepsCount) {
+        // Return error
+        printf("Error: AnimSpriteCel stepIndex %u out of bounds (%u steps).\n", stepIndex, animSpriteCel->stepsCount);
+        return -1;
+    }
+
+    // If the frame has no descriptor
+    if (frameIndex >= animSpriteCel->framesCount) {
+        // Return error
+        printf("Error: AnimSpriteCel frameIndex %u out of bounds (%u frames).\n", frameIndex, animSpriteCel->framesCount);
+        return -1;
+    }
+
+    // If the duration doesn't fit on 16 bits
+    if ((frameDuration < -32768) || (frameDuration > 32767)) {
+        // Return error
+        printf("Error: AnimSpriteCel frameDuration %d out of the packed range (-32768 to 32767).\n", frameDuration);
+        return -1;
+    }
+
+    // If the receiver index doesn't fit on 16 bits
+    if ((receiverIndex > ANIMSPRITECEL_RECEIVER_NONE) || ((receiverIndex != ANIMSPRITECEL_RECEIVER_NONE) && (animSpriteCel->system != NULL) && (receiverIndex >= animSpriteCel->system->animSpriteCelsMax))) {
+        // Return error
+        printf("Error: AnimSpriteCel receiverIndex %u out of bounds.\n", receiverIndex);
+        return -1;
+    }
+
+    // Configure the packed step
+    animSpriteCel->packedSteps[stepIndex].frameIndex = (uint16)frameIndex;
+    animSpriteCel->packedSteps[stepIndex].frameDuration = (int16)frameDuration;
+    animSpriteCel->packedSteps[stepIndex].receiverIndex = (uint16)receiverIndex;
+    // The cumulative durations must be rebuilt
+    animSpriteCel->timelineDirty = 1;
+
+    // The analyses of the system no longer match its triggers
+    if (animSpriteCel->system != NULL) {
+        animSpriteCel->system->generation++;
+    }
+
+    // Trace the configured step
+    ANIMSPRITECEL_TRACE_EVENT(TRACE_CONFIGURATION, animSpriteCel, stepIndex);
+
+    // If the configured step is currently displayed
+    if (stepIndex == (uint32)animSpriteCel->stepIndex) {
+        // Update the main CCB of the AnimSpriteCel
+        AnimSpriteCelUpdate(animSpriteCel);
+    }
+
+    // Return success
+    return 1;
+}
+
+// Sets the event a step sends to the system when it starts
+int32 AnimSpriteCelStepEvent(AnimSpriteCel *animSpriteCel, uint32 stepIndex, uint32 eventId) {
+
+    // If the AnimSpriteCel is undefined
+    if (animSpriteCel == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCel unknown.\n");
+        return -1;
+    }
+
+    // If the steps array is undefined
+    if ((animSpriteCel->steps == NULL) && (animSpriteCel->packedSteps == NULL)) {
+        // Return error
+        printf("Error: AnimSpriteCel steps unknown.\n");
+        return -1;
+    }
+
+    // If the step doesn't exist
+    if (stepIndex >= animSpriteCel->stepsCount) {
+        // Return error
+        printf("Error: AnimSpriteCel stepIndex %u out of bounds (%u steps).\n", stepIndex, animSpriteCel->stepsCount);
+        return -1;
+    }
+
+    // If the steps belong to a shared sequence
+    if (animSpriteCel->sequence != NULL) {
+        // Return error
+        printf("Error: AnimSpriteCel steps are shared by an AnimSpriteCelSequence.\n");
+        return -1;
+    }
+
+    // If the steps are read from a file
+    if (animSpriteCel->file != NULL) {
+        // Return error
+        printf("Error: AnimSpriteCel steps belong to an AnimSpriteCelFile.\n");
+        return -1;
+    }
+
+    // If the steps are read from a generated table
+    if (animSpriteCel->table != NULL) {
+        // Return error
+        printf("Error: AnimSpriteCel steps belong to an AnimSpriteCelTable.\n");
+        return -1;
+    }
+
+    // If the steps are packed
+    if (animSpriteCel->packedSteps != NULL) {
+        // If the event doesn't fit on 16 bits
+        if (eventId > 0xFFFF) {
+            // Return error
+            printf("Error: AnimSpriteCel eventId %u out of the packed range (0 to 65535).\n", eventId);
+            return -1;
+        }
+        animSpriteCel->packedSteps[stepIndex].eventId = (uint16)eventId;
+    } else {
+        animSpriteCel->steps[stepIndex].eventId = eventId;
+    }
+
+    // Trace the configured step
+    ANIMSPRITECEL_TRACE_EVENT(TRACE_CONFIGURATION, animSpriteCel, stepIndex);
+
+    // Return success
+    return 1;
+}
+
+// Gives the receiver of a step in either layout (NULL if none)
+AnimSpriteCel *AnimSpriteCelStepReceiver(AnimSpriteCel *animSpriteCel, uint32 stepIndex) {
+
+    // Receiver index of the packed step
+    uint32 receiverIndex = 0;
+
+    // Normal layout: the step points to its receiver
+    if (animSpriteCel->packedSteps == NULL) {
+        return animSpriteCel->steps[stepIndex].animSpriteCelReceiver;
+    }
+
+    receiverIndex = animSpriteCel->packedSteps[stepIndex].receiverIndex;
+
+    // No receiver, or no system to find it in
+    if ((receiverIndex == ANIMSPRITECEL_RECEIVER_NONE) || (animSpriteCel->system == NULL) || (receiverIndex >= animSpriteCel->system->animSpriteCelsCount)) {
+        return NULL;
+    }
+
+    // AnimSpriteCel registered at that index
+    return animSpriteCel->system->animSpriteCels[receiverIndex];
+}
+
+// Sets the remaining cycles of the current step
+static void AnimSpriteCelStepDuration(AnimSpriteCel *animSpriteCel) {
+
+    // Minimum and maximum values for the random range
+    uint32 randomRangeMin = 0;
+    uint32 randomRangeMax = 0;
+    // Duration of the step
+    int32 frameDuration = ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex);
+
+    // If frame duration is positive (> 1)
+    if (frameDuration > 1) {
+        // Use specified duration
+        animSpriteCel->remainingCycles = frameDuration;
+
+    // If frame duration is negative (< 0)
+    } else if (frameDuration < 0) {
+        // Convert to positive max range
+        randomRangeMax = 0 - frameDuration;
+
+        // Choose the lowest value depending on configured range
+        switch (animSpriteCel->range) {
+            // Range between 1 and max
+            case FULL:    
+                randomRangeMin = 1; 
+                break;
+            // Range between (max / 2) and max
+            case HALF:    
+                randomRangeMin = randomRangeMax / 2;  
+                break;
+            // Range between (max * 3/4) and max
+            case QUARTER: 
+                randomRangeMin = randomRangeMax - (randomRangeMax / 4);
+                break;
+        }
+
+        // If the animation has its own generator
+        if (animSpriteCel->randomState != 0) {
+            // Reproducible value
+            animSpriteCel->remainingCycles = GetRandomRangeValue(GetRandomXorshift(&animSpriteCel->randomState), randomRangeMin, randomRangeMax);
+        } else {
+            // Hardware random value
+            animSpriteCel->remainingCycles = GetRandomValue(randomRangeMin, randomRangeMax);
+        }
+
+    // Otherwise, duration is zero (waiting for trigger) or one (immediate switch)
+    } else {
+        animSpriteCel->remainingCycles = 0;
+    }   
+
+    // In microseconds, the unit that leaves the step is part of its duration
+    if ((animSpriteCel->timeBase == MICROSECONDS) && (animSpriteCel->remainingCycles > 0)) {
+        animSpriteCel->remainingCycles--;
+    }
+}
+
+// Gives the AnimSpriteCel its own random generator
+int32 AnimSpriteCelRandomSeed(AnimSpriteCel *animSpriteCel, uint32 seed) {
+
+    // If the AnimSpriteCel is undefined
+    if (animSpriteCel == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCel unknown.\n");
+        return -1;
+    }
+
+    // If the steps array is undefined
+    if ((animSpriteCel->steps == NULL) && (animSpriteCel->packedSteps == NULL)) {
+        // Return error
+        printf("Error: AnimSpriteCel steps unknown.\n");
+        return -1;
+    }
+
+    // The random sequence starts again from the seed (0 = hardware random numbers)
+    animSpriteCel->randomState = seed;
+    animSpriteCel->originRandomState = seed;
+
+    // If the current step is random, roll it from the seed
+    if (ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) < 0) {
+        AnimSpriteCelStepDuration(animSpriteCel);
+        // The end of the step moved
+        if (animSpriteCel->system != NULL) {
+            AnimSpriteCelSystemSchedule(animSpriteCel->system, animSpriteCel);
+        }
+    }
+
+    // Return success
+    return 1;
+}
+
+// Sets the playback speed of the AnimSpriteCel
+int32 AnimSpriteCelSpeed(AnimSpriteCel *animSpriteCel, uint32 speed) {
+
+    // If the AnimSpriteCel is undefined
+    if (animSpriteCel == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCel unknown.\n");
+        return -1;
+    }
+
+    // Clamp the speed so that the accumulator can't overflow
+    if (speed > ANIMSPRITECEL_SPEED_MAX) {
+        // Display warning
+        printf("Warning: AnimSpriteCel speed 0x%08X too high. Clamped to 0x%08X.\n", speed, ANIMSPRITECEL_SPEED_MAX);
+        // Adjust to the highest speed
+        speed = ANIMSPRITECEL_SPEED_MAX;
+    }
+
+    // A timing wheel keys the end of a step in ticks when the step starts
+    if ((speed != ANIMSPRITECEL_SPEED_NORMAL) && (animSpriteCel->system != NULL) && (animSpriteCel->system->schedule == WHEEL)) {
+        // Return error
+        printf("Error: AnimSpriteCel speed doesn't apply in WHEEL schedule.\n");
+        return -1;
+    }
+
+    // Taken into account from the next run, the carried fraction is kept
+    animSpriteCel->speed = speed;
+
+    // Return success
+    return 1;
+}
+
+// Sets the unit of the step durations
+int32 AnimSpriteCelTimeBaseConfiguration(AnimSpriteCel *animSpriteCel, AnimSpriteCelTimeBase timeBase) {
+
+    // If the AnimSpriteCel is undefined
+    if (animSpriteCel == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCel unknown.\n");
+        return -1;
+    }
+
+    // If the steps array is undefined
+    if ((animSpriteCel->steps == NULL) && (animSpriteCel->packedSteps == NULL)) {
+        // Return error
+        printf("Error: AnimSpriteCel steps unknown.\n");
+        return -1;
+    }
+
+    // If the steps belong to a shared sequence, its timeline is shared too
+    if (animSpriteCel->sequence != NULL) {
+        // Return error
+        printf("Error: AnimSpriteCel steps are shared by an AnimSpriteCelSequence.\n");
+        return -1;
+    }
+
+    // If the steps are read from a file
+    if (animSpriteCel->file != NULL) {
+        // Return error
+        printf("Error: AnimSpriteCel steps belong to an AnimSpriteCelFile.\n");
+        return -1;
+    }
+
+    // If the steps are read from a generated table
+    if (animSpriteCel->table != NULL) {
+        // Return error
+        printf("Error: AnimSpriteCel steps belong to an AnimSpriteCelTable.\n");
+        return -1;
+    }
+
+    // If registered, the system counts the AnimSpriteCels in MICROSECONDS
+    if (animSpriteCel->system != NULL) {
+        if (animSpriteCel->timeBase == MICROSECONDS) {
+            animSpriteCel->system->microsecondsCount--;
+        }
+        if (timeBase == MICROSECONDS) {
+            animSpriteCel->system->microsecondsCount++;
+        }
+    }
+
+    // The cumulative durations change with the unit
+    animSpriteCel->timeBase = timeBase;
+    animSpriteCel->timelineDirty = 1;
+
+    // The current step starts again in the new unit
+    AnimSpriteCelStepDuration(animSpriteCel);
+    if (animSpriteCel->system != NULL) {
+        AnimSpriteCelSystemSchedule(animSpriteCel->system, animSpriteCel);
+    }
+
+    // Return success
+    return 1;
+}
+
+// Updates the display of an AnimSpriteCel
+void AnimSpriteCelUpdate(AnimSpriteCel *animSpriteCel) {
+    
+    // Frame of the step, a changed CCB is noted by the system tracking them
+    if ((animSpriteCel->stepDisplay(animSpriteCel) == 1) && (animSpriteCel->system != NULL) && (animSpriteCel->system->dirty != NULL)) {
+        AnimSpriteCelSystemDirty(animSpriteCel->system, animSpriteCel);
+    }
+
+    // Duration of the step
+    AnimSpriteCelStepDuration(animSpriteCel);
+}
+
+// Triggers the receiver of the current step, through the system queue when triggers are deferred
+static void AnimSpriteCelTriggerReceiver(AnimSpriteCel *animSpriteCel, AnimSpriteCel *animSpriteCelReceiver) {
+
+    // Trace the trigger sent
+    ANIMSPRITECEL_TRACE_COUNT(animSpriteCel->traceTriggersSent, 1);
+    ANIMSPRITECEL_TRACE_EVENT(TRACE_TRIGGER_SENT, animSpriteCel, animSpriteCelReceiver->traceId);
+
+    // If the system delivers the triggers later
+    if ((animSpriteCel->system != NULL) && (animSpriteCel->system->delivery != IMMEDIATE)) {
+        // Queue the trigger (in the outbox of the sender's partition during a partitioned tick)
+        if (animSpriteCel->system->partitioned == 1) {
+            AnimSpriteCelSystemOutboxPush(animSpriteCel->system, animSpriteCel, animSpriteCelReceiver);
+        } else {
+            AnimSpriteCelSystemTriggerPush(animSpriteCel->system, animSpriteCelReceiver);
+        }
+        return;
+    }
+
+    // Trigger next step on receiver at once
+    AnimSpriteCelTrigger(animSpriteCelReceiver);
+}
+
+// Advances to the next step in the animation
+void AnimSpriteCelNextStep(AnimSpriteCel *animSpriteCel) {
+    
+    // End-of-cycle flag
+    uint32 cycleEnd = 0;
+    // Event of the new step
+    uint32 eventId = 0;
+    // Receiver of the new step
+    AnimSpriteCel *animSpriteCelReceiver = NULL;
+
+    // Move to the next step
+    cycleEnd = animSpriteCel->stepMove(animSpriteCel);
+
+    // Update main CCB of the AnimSpriteCel
+    AnimSpriteCelUpdate(animSpriteCel);
+    // Trace the new step and the cycles it holds
+    ANIMSPRITECEL_TRACE_COUNT(animSpriteCel->traceSteps, 1);
+    ANIMSPRITECEL_TRACE_COUNT(animSpriteCel->traceIdleCycles, animSpriteCel->remainingCycles);
+    ANIMSPRITECEL_TRACE_EVENT(TRACE_STEP, animSpriteCel, animSpriteCel->remainingCycles);
+
+    // If cycle ended and animation is not infinite
+    if ((cycleEnd == 1) && (animSpriteCel->iterationsCount != INFINITE)) {
+        // Decrement remaining cycle count
+        animSpriteCel->iterationsCount--;
+    }
+
+    // Trace the end of the cycle
+    if (cycleEnd == 1) {
+        ANIMSPRITECEL_TRACE_EVENT(TRACE_ITERATION_END, animSpriteCel, animSpriteCel->iterationsCount);
+    }
+
+    // If the animation belongs to a system
+    if (animSpriteCel->system != NULL) {
+        // Schedule the end of the new step
+        AnimSpriteCelSystemSchedule(animSpriteCel->system, animSpriteCel);
+        // Send the event of the new step if the system collects them
+        if (animSpriteCel->system->events != NULL) {
+            eventId = ANIMSPRITECEL_STEP_EVENT(animSpriteCel, animSpriteCel->stepIndex);
+            if (eventId != ANIMSPRITECEL_EVENT_NONE) {
+                AnimSpriteCelSystemEventPush(animSpriteCel->system, animSpriteCel, eventId);
+            }
+        }
+    }
+
+    // If this step controls another animation
+    animSpriteCelReceiver = AnimSpriteCelStepReceiver(animSpriteCel, animSpriteCel->stepIndex);
+    if (animSpriteCelReceiver != NULL) {
+        // Trigger next step on receiver
+        AnimSpriteCelTriggerReceiver(animSpriteCel, animSpriteCelReceiver);
+    }
+}
+
+// Executes the animation
+void AnimSpriteCelRun(AnimSpriteCel *animSpriteCel) {
+
+    // If the animation is undefined
+    if (animSpriteCel == NULL) {
+        // Log error
+        printf("Error: AnimSpriteCel unknown.\n");
+        return;
+    }
+
+    // If the SpriteCel is undefined
+    if (animSpriteCel->spriteCel == NULL) {
+        // Log error
+        printf("Error: AnimSpriteCel SpriteCel unknown.\n");
         return;
     }
 
     // If the steps array is undefined
-    if (animSpriteCel->steps == NULL) {
+    if ((animSpriteCel->steps == NULL) && (animSpriteCel->packedSteps == NULL)) {
         // Log error
         printf("Error: AnimSpriteCel steps unknown.\n");
         return;
     }
 
     // If the animation is waiting for a trigger
-    if (animSpriteCel->steps[animSpriteCel->stepIndex].frameDuration == 0) {
+    if (ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) == 0) {
         // Exit early
         return;
     }
@@ -368,6 +1112,13 @@ void AnimSpriteCelRun(AnimSpriteCel *animSpriteCel) {
         return;
     }
 
+    // If the animation runs at another speed, its cycles come from the accumulator
+    if (animSpriteCel->speed != ANIMSPRITECEL_SPEED_NORMAL) {
+        AnimSpriteCelSpeedRun(animSpriteCel);
+        // Exit early
+        return;
+    }
+
     // If it's not time to change steps yet
     if (animSpriteCel->remainingCycles > 0) {
         // Decrement the remaining display cycles
@@ -380,32 +1131,614 @@ void AnimSpriteCelRun(AnimSpriteCel *animSpriteCel) {
     AnimSpriteCelNextStep(animSpriteCel);
 }
 
+// Runs a display cycle at the speed of the animation
+void AnimSpriteCelSpeedRun(AnimSpriteCel *animSpriteCel) {
+
+    // Whole display cycles reached by the accumulator
+    uint32 cycles = 0;
+
+    // Add the speed: the whole cycles are played, the fraction is carried
+    animSpriteCel->speedAccumulator += animSpriteCel->speed;
+    cycles = animSpriteCel->speedAccumulator >> 16;
+    animSpriteCel->speedAccumulator &= 0xFFFF;
+
+    // If the step doesn't end within those cycles
+    if (animSpriteCel->remainingCycles >= cycles) {
+        // Consume them
+        animSpriteCel->remainingCycles -= cycles;
+        return;
+    }
+
+    // Catch up the cycles past the end of the step as AnimSpriteCelAdvance() does, the CCB is written once
+    AnimSpriteCelAdvance(animSpriteCel, cycles);
+}
+
+// Gives the units a step of fixed duration lasts (in cycles, plus the cycle that leaves it)
+static uint32 AnimSpriteCelStepLifetime(AnimSpriteCel *animSpriteCel, int32 frameDuration) {
+
+    // An immediate switch lasts one unit, a step in microseconds lasts its duration
+    if ((frameDuration == 1) || (animSpriteCel->timeBase == MICROSECONDS)) {
+        return frameDuration;
+    }
+
+    return frameDuration + 1;
+}
+
+// Gives the duration in cycles of a loop period and the iterations it consumes (0 if the period can't be skipped)
+static uint32 AnimSpriteCelLoopPeriod(AnimSpriteCel *animSpriteCel, uint32 *iterations) {
+
+    // Step index
+    uint32 stepIndex = 0;
+    // Lifetime of a step in cycles
+    uint32 stepCycles = 0;
+    // Duration of the period
+    uint32 periodCycles = 0;
+
+    for (stepIndex = 0; stepIndex < animSpriteCel->stepsCount; stepIndex++) {
+
+        // Random or waiting steps, triggers and events must be played one by one
+        if ((ANIMSPRITECEL_STEP_DURATION(animSpriteCel, stepIndex) < 1) || (AnimSpriteCelStepReceiver(animSpriteCel, stepIndex) != NULL) || (ANIMSPRITECEL_STEP_EVENT(animSpriteCel, stepIndex) != ANIMSPRITECEL_EVENT_NONE)) {
+            return 0;
+        }
+
+        // Lifetime of the step in the time base
+        stepCycles = AnimSpriteCelStepLifetime(animSpriteCel, ANIMSPRITECEL_STEP_DURATION(animSpriteCel, stepIndex));
+        periodCycles += stepCycles;
+
+        // Inner steps are played twice per ALTERNATE period (forward and backward)
+        if ((animSpriteCel->loop == ALTERNATE) && (stepIndex > 0) && (stepIndex < animSpriteCel->stepsCount - 1)) {
+            periodCycles += stepCycles;
+        }
+    }
+
+    // A NORMAL or REVERSE period is one cycle, an ALTERNATE period is a forward and a backward cycle
+    *iterations = (animSpriteCel->loop == ALTERNATE) ? 2 : 1;
+
+    return periodCycles;
+}
+
+// Catches up a given number of display cycles
+void AnimSpriteCelAdvance(AnimSpriteCel *animSpriteCel, uint32 elapsedCycles) {
+
+    // End-of-cycle flag
+    uint32 cycleEnd = 0;
+    // Step change flag
+    uint32 stepChanged = 0;
+    // Duration of a loop period (0 = not computed or can't be skipped)
+    uint32 periodCycles = 0;
+    // Iterations consumed by a loop period
+    uint32 periodIterations = 0;
+    // Loop periods to skip
+    uint32 periodsCount = 0;
+    // Period computed flag
+    uint32 periodChecked = 0;
+    // Event of a crossed step
+    uint32 eventId = 0;
+    // Receiver of a crossed step
+    AnimSpriteCel *animSpriteCelReceiver = NULL;
+
+    // If the animation is undefined
+    if (animSpriteCel == NULL) {
+        // Log error
+        printf("Error: AnimSpriteCel unknown.\n");
+        return;
+    }
+
+    // If the SpriteCel is undefined
+    if (animSpriteCel->spriteCel == NULL) {
+        // Log error
+        printf("Error: AnimSpriteCel SpriteCel unknown.\n");
+        return;
+    }
+
+    // If the steps array is undefined
+    if ((animSpriteCel->steps == NULL) && (animSpriteCel->packedSteps == NULL)) {
+        // Log error
+        printf("Error: AnimSpriteCel steps unknown.\n");
+        return;
+    }
+
+    // If the end of the step is held by a system timing wheel
+    if (animSpriteCel->wheelSlot != NULL) {
+        // Bring the remaining cycles up to date
+        animSpriteCel->remainingCycles = animSpriteCel->expiryTick - animSpriteCel->system->tick;
+    }
+
+    while (elapsedCycles > 0) {
+
+        // If the animation is waiting for a trigger
+        if (ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) == 0) {
+            break;
+        }
+
+        // If all iterations have been completed
+        if (animSpriteCel->iterationsCount == 0) {
+            break;
+        }
+
+        // If the current step doesn't end within the elapsed cycles
+        if (animSpriteCel->remainingCycles >= elapsedCycles) {
+            animSpriteCel->remainingCycles -= elapsedCycles;
+            break;
+        }
+
+        // Consume the rest of the step and the cycle that leaves it
+        elapsedCycles -= animSpriteCel->remainingCycles + 1;
+
+        // Move to the next step without touching the CCB
+        cycleEnd = animSpriteCel->stepMove(animSpriteCel);
+        AnimSpriteCelStepDuration(animSpriteCel);
+        stepChanged = 1;
+        // Trace the new step and the cycles it holds
+        ANIMSPRITECEL_TRACE_COUNT(animSpriteCel->traceSteps, 1);
+        ANIMSPRITECEL_TRACE_COUNT(animSpriteCel->traceIdleCycles, animSpriteCel->remainingCycles);
+        ANIMSPRITECEL_TRACE_EVENT(TRACE_STEP, animSpriteCel, animSpriteCel->remainingCycles);
+
+        // If cycle ended and animation is not infinite
+        if ((cycleEnd == 1) && (animSpriteCel->iterationsCount != INFINITE)) {
+            // Decrement remaining cycle count
+            animSpriteCel->iterationsCount--;
+        }
+
+        // Trace the end of the cycle
+        if (cycleEnd == 1) {
+            ANIMSPRITECEL_TRACE_EVENT(TRACE_ITERATION_END, animSpriteCel, animSpriteCel->iterationsCount);
+        }
+
+        // Send the event of this step, in order, if the system collects them
+        if ((animSpriteCel->system != NULL) && (animSpriteCel->system->events != NULL)) {
+            eventId = ANIMSPRITECEL_STEP_EVENT(animSpriteCel, animSpriteCel->stepIndex);
+            if (eventId != ANIMSPRITECEL_EVENT_NONE) {
+                AnimSpriteCelSystemEventPush(animSpriteCel->system, animSpriteCel, eventId);
+            }
+        }
+
+        // If this step controls another animation
+        animSpriteCelReceiver = AnimSpriteCelStepReceiver(animSpriteCel, animSpriteCel->stepIndex);
+        if (animSpriteCelReceiver != NULL) {
+            // Trigger next step on receiver, in order
+            AnimSpriteCelTriggerReceiver(animSpriteCel, animSpriteCelReceiver);
+        }
+
+        // Once, look for a loop period that can be skipped in closed form
+        if (periodChecked == 0) {
+            periodCycles = AnimSpriteCelLoopPeriod(animSpriteCel, &periodIterations);
+            periodChecked = 1;
+        }
+
+        // If whole periods fit in the elapsed cycles, skip them (the step just started, the state repeats)
+        if ((periodCycles > 0) && (elapsedCycles >= periodCycles) && (animSpriteCel->iterationsCount != 0)) {
+            periodsCount = elapsedCycles / periodCycles;
+            // Keep at least one iteration so that the last period is played normally
+            if ((animSpriteCel->iterationsCount != INFINITE) && (periodsCount * periodIterations >= animSpriteCel->iterationsCount)) {
+                periodsCount = (animSpriteCel->iterationsCount - 1) / periodIterations;
+            }
+            elapsedCycles -= periodsCount * periodCycles;
+            if (animSpriteCel->iterationsCount != INFINITE) {
+                animSpriteCel->iterationsCount -= periodsCount * periodIterations;
+            }
+        }
+    }
+
+    // If the step changed
+    if (stepChanged == 1) {
+        // Write the CCB once, for the final step, a changed CCB is noted by the system tracking them
+        if ((animSpriteCel->stepDisplay(animSpriteCel) == 1) && (animSpriteCel->system != NULL) && (animSpriteCel->system->dirty != NULL)) {
+            AnimSpriteCelSystemDirty(animSpriteCel->system, animSpriteCel);
+        }
+    }
+
+    // If the animation belongs to a system
+    if (animSpriteCel->system != NULL) {
+        // Schedule the end of the current step
+        AnimSpriteCelSystemSchedule(animSpriteCel->system, animSpriteCel);
+    }
+}
+
+// Runs the animation for the time elapsed since its last run
+void AnimSpriteCelTimeRun(AnimSpriteCel *animSpriteCel, uint32 elapsedMicroseconds) {
+
+    // If the animation is undefined
+    if (animSpriteCel == NULL) {
+        // Log error
+        printf("Error: AnimSpriteCel unknown.\n");
+        return;
+    }
+
+    // If the durations are counted in display cycles
+    if (animSpriteCel->timeBase != MICROSECONDS) {
+        // Log error
+        printf("Error: AnimSpriteCel durations are not in MICROSECONDS.\n");
+        return;
+    }
+
+    // Catch up the elapsed microseconds: the time past the end of a step goes into the next one, the CCB is written once
+    AnimSpriteCelAdvance(animSpriteCel, elapsedMicroseconds);
+}
+
+// Gives the step played at a position of the timeline
+static uint32 AnimSpriteCelTimelineStep(AnimSpriteCel *animSpriteCel, uint32 position) {
+
+    // Based on loop mode
+    switch (animSpriteCel->loop) {
+        // Positions follow the steps backward
+        case REVERSE:
+            return animSpriteCel->stepsCount - 1 - position;
+        // Positions go forward to the last step, then back to the second one
+        case ALTERNATE:
+            return (position < animSpriteCel->stepsCount) ? position : (2 * animSpriteCel->stepsCount) - 2 - position;
+        // Positions follow the steps forward
+        default:
+            return position;
+    }
+}
+
+// Builds the cumulative durations of a loop period
+static void AnimSpriteCelTimelineBuild(AnimSpriteCel *animSpriteCel) {
+
+    // Position in the loop period
+    uint32 position = 0;
+    // Number of positions in the loop period
+    uint32 length = 0;
+    // Duration of the step at the position
+    int32 frameDuration = 0;
+
+    // An ALTERNATE period plays the inner steps twice
+    length = (animSpriteCel->loop == ALTERNATE) ? (2 * animSpriteCel->stepsCount) - 2 : animSpriteCel->stepsCount;
+
+    // The period starts at 0
+    animSpriteCel->timeline[0] = 0;
+    // The table is up to date once built
+    animSpriteCel->timelineDirty = 0;
+
+    for (position = 0; position < length; position++) {
+
+        frameDuration = ANIMSPRITECEL_STEP_DURATION(animSpriteCel, AnimSpriteCelTimelineStep(animSpriteCel, position));
+
+        // Random or waiting steps have no fixed position in time
+        if (frameDuration < 1) {
+            animSpriteCel->timelineLength = 0;
+            return;
+        }
+
+        // Lifetime of the step in the time base
+        animSpriteCel->timeline[position + 1] = animSpriteCel->timeline[position] + AnimSpriteCelStepLifetime(animSpriteCel, frameDuration);
+    }
+
+    animSpriteCel->timelineLength = length;
+}
+
+// Sets the animation to a given display cycle of its timeline
+int32 AnimSpriteCelSeek(AnimSpriteCel *animSpriteCel, uint32 tick) {
+
+    // Number of positions in the loop period
+    uint32 length = 0;
+    // Duration of the loop period
+    uint32 periodCycles = 0;
+    // Whole periods and remaining cycles in the tick
+    uint32 periodsCount = 0;
+    uint32 restCycles = 0;
+    // Position and time of the starting state in the period
+    uint32 originPosition = 0;
+    uint32 originTime = 0;
+    // Cycle end exits in the first period (relative time and position left)
+    uint32 exitTimes[2];
+    uint32 exitPositions[2];
+    uint32 exitsCount = 0;
+    // First exit that doesn't end a cycle (ALTERNATE started on a bound, moving inward)
+    uint32 exitsSkipped = 0;
+    // Cycle ends crossed up to the tick
+    uint32 cycleEnds = 0;
+    // Index of the cycle end that stops the animation
+    uint32 stopIndex = 0;
+    // Position reached and its time in the period
+    uint32 position = 0;
+    uint32 time = 0;
+    // Binary search bounds
+    uint32 low = 0;
+    uint32 high = 0;
+    // Swap values
+    uint32 swap = 0;
+    // End-of-cycle flag (replay)
+    uint32 cycleEnd = 0;
+
+    // If the animation is undefined
+    if (animSpriteCel == NULL) {
+        // Log error
+        printf("Error: AnimSpriteCel unknown.\n");
+        return -1;
+    }
+
+    // If the SpriteCel is undefined
+    if (animSpriteCel->spriteCel == NULL) {
+        // Log error
+        printf("Error: AnimSpriteCel SpriteCel unknown.\n");
+        return -1;
+    }
+
+    // If the steps array is undefined
+    if ((animSpriteCel->steps == NULL) && (animSpriteCel->packedSteps == NULL)) {
+        // Log error
+        printf("Error: AnimSpriteCel steps unknown.\n");
+        return -1;
+    }
+
+    // Rebuild the cumulative durations after a step configuration
+    if (animSpriteCel->timelineDirty == 1) {
+        AnimSpriteCelTimelineBuild(animSpriteCel);
+    }
+
+    // Back to the starting state of the timeline
+    animSpriteCel->stepIndex = animSpriteCel->originStepIndex;
+    animSpriteCel->direction = animSpriteCel->originDirection;
+    animSpriteCel->iterationsCount = animSpriteCel->originIterations;
+    animSpriteCel->randomState = animSpriteCel->originRandomState;
+
+    // If durations are random or waiting, replay the timeline from the start
+    if (animSpriteCel->timelineLength == 0) {
+
+        // Duration of the starting step (random durations are rolled again)
+        AnimSpriteCelStepDuration(animSpriteCel);
+
+        while (tick > 0) {
+
+            // Stop on a waiting step or once all iterations are completed
+            if ((ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) == 0) || (animSpriteCel->iterationsCount == 0)) {
+                break;
+            }
+
+            // If the current step doesn't end within the remaining cycles
+            if (animSpriteCel->remainingCycles >= tick) {
+                animSpriteCel->remainingCycles -= tick;
+                break;
+            }
+
+            // Consume the rest of the step and the cycle that leaves it
+            tick -= animSpriteCel->remainingCycles + 1;
+
+            // Move to the next step
+            cycleEnd = animSpriteCel->stepMove(animSpriteCel);
+            AnimSpriteCelStepDuration(animSpriteCel);
+
+            // If cycle ended and animation is not infinite
+            if ((cycleEnd == 1) && (animSpriteCel->iterationsCount != INFINITE)) {
+                // Decrement remaining cycle count
+                animSpriteCel->iterationsCount--;
+            }
+        }
+
+    } else {
+
+        length = animSpriteCel->timelineLength;
+        periodCycles = animSpriteCel->timeline[length];
+
+        // Position of the starting state
+        switch (animSpriteCel->loop) {
+            case REVERSE:
+                originPosition = animSpriteCel->stepsCount - 1 - animSpriteCel->originStepIndex;
+                break;
+            case ALTERNATE:
+                originPosition = ((animSpriteCel->originDirection == 1) || (animSpriteCel->originStepIndex == 0)) ? (uint32)animSpriteCel->originStepIndex : (2 * animSpriteCel->stepsCount) - 2 - animSpriteCel->originStepIndex;
+                // Started on a bound and moving inward, the first bound doesn't end a cycle
+                if (((animSpriteCel->originStepIndex == 0) && (animSpriteCel->originDirection == 1)) || ((animSpriteCel->originStepIndex == (int32)animSpriteCel->stepsCount - 1) && (animSpriteCel->originDirection == -1))) {
+                    exitsSkipped = 1;
+                }
+                break;
+            default:
+                originPosition = animSpriteCel->originStepIndex;
+                break;
+        }
+        originTime = animSpriteCel->timeline[originPosition];
+
+        // If the starting step isn't left yet (or the animation doesn't run)
+        if ((animSpriteCel->iterationsCount == 0) || (tick < animSpriteCel->timeline[originPosition + 1] - originTime)) {
+            position = originPosition;
+            time = originTime + ((animSpriteCel->iterationsCount == 0) ? 0 : tick);
+
+        } else {
+
+            // Positions whose exit ends a cycle: the bounds in ALTERNATE, the last one otherwise
+            if (animSpriteCel->loop == ALTERNATE) {
+                exitPositions[exitsCount++] = animSpriteCel->stepsCount - 1;
+                exitPositions[exitsCount++] = 0;
+            } else {
+                exitPositions[exitsCount++] = length - 1;
+            }
+
+            // Time of each exit after the start, sorted
+            for (low = 0; low < exitsCount; low++) {
+                time = animSpriteCel->timeline[exitPositions[low] + 1];
+                exitTimes[low] = (time > originTime) ? time - originTime : time + periodCycles - originTime;
+            }
+            if ((exitsCount == 2) && (exitTimes[1] < exitTimes[0])) {
+                swap = exitTimes[0]; exitTimes[0] = exitTimes[1]; exitTimes[1] = swap;
+                swap = exitPositions[0]; exitPositions[0] = exitPositions[1]; exitPositions[1] = swap;
+            }
+
+            // Count the cycle ends crossed
+            periodsCount = tick / periodCycles;
+            restCycles = tick % periodCycles;
+            for (low = 0; low < exitsCount; low++) {
+                cycleEnds += periodsCount + ((exitTimes[low] <= restCycles) ? 1 : 0);
+            }
+            cycleEnds -= exitsSkipped;
+
+            // If the last iteration ends before the tick
+            if ((animSpriteCel->iterationsCount != INFINITE) && (cycleEnds >= animSpriteCel->iterationsCount)) {
+                // The animation stops on the step entered by the last cycle end
+                stopIndex = animSpriteCel->iterationsCount - 1 + exitsSkipped;
+                position = (exitPositions[stopIndex % exitsCount] + 1) % length;
+                time = animSpriteCel->timeline[position];
+                animSpriteCel->iterationsCount = 0;
+
+            } else {
+                // Time in the period
+                time = originTime + restCycles;
+                if (time >= periodCycles) {
+                    time -= periodCycles;
+                }
+
+                // Last position starting at or before that time
+                low = 0;
+                high = length - 1;
+                while (low < high) {
+                    position = (low + high + 1) / 2;
+                    if (animSpriteCel->timeline[position] <= time) {
+                        low = position;
+                    } else {
+                        high = position - 1;
+                    }
+                }
+                position = low;
+
+                // Remaining iterations
+                if (animSpriteCel->iterationsCount != INFINITE) {
+                    animSpriteCel->iterationsCount -= cycleEnds;
+                }
+            }
+
+            // Step and direction at the position
+            animSpriteCel->stepIndex = AnimSpriteCelTimelineStep(animSpriteCel, position);
+            if (animSpriteCel->loop == ALTERNATE) {
+                animSpriteCel->direction = ((position > 0) && (position < animSpriteCel->stepsCount)) ? 1 : -1;
+            }
+        }
+
+        // Cycles left before the end of the step
+        animSpriteCel->remainingCycles = animSpriteCel->timeline[position + 1] - 1 - time;
+    }
+
+    // Write the CCB once, a changed CCB is noted by the system tracking them
+    if ((animSpriteCel->stepDisplay(animSpriteCel) == 1) && (animSpriteCel->system != NULL) && (animSpriteCel->system->dirty != NULL)) {
+        AnimSpriteCelSystemDirty(animSpriteCel->system, animSpriteCel);
+    }
+
+    // If the animation belongs to a system
+    if (animSpriteCel->system != NULL) {
+        // Schedule the end of the current step
+        AnimSpriteCelSystemSchedule(animSpriteCel->system, animSpriteCel);
+    }
+
+    // Return success
+    return 1;
+}
+
+// Triggers a waiting animation
+void AnimSpriteCelTrigger(AnimSpriteCel *animSpriteCel) {
+
+    // If the animation is undefined
+    if (animSpriteCel == NULL) {
+        // Log error
+        printf("Error: AnimSpriteCel unknown.\n");
+        return;
+    }
+
+    // If the SpriteCel is undefined
+    if (animSpriteCel->spriteCel == NULL) {
+        // Log error
+        printf("Error: AnimSpriteCel SpriteCel unknown.\n");
+        return;
+    }
+
+    // If the steps array is undefined
+    if ((animSpriteCel->steps == NULL) && (animSpriteCel->packedSteps == NULL)) {
+        // Log error
+        printf("Error: AnimSpriteCel steps unknown.\n");
+        return;
+    }
+
+    // Trace the trigger received (1 if it starts the next step)
+    ANIMSPRITECEL_TRACE_COUNT(animSpriteCel->traceTriggersReceived, 1);
+    ANIMSPRITECEL_TRACE_EVENT(TRACE_TRIGGER_RECEIVED, animSpriteCel, (ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) == 0) && (animSpriteCel->iterationsCount != 0));
+
+    // If the animation is not waiting for a trigger
+    if (ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) != 0) {
+        // Exit early
+        return;
+    }
+
+    // If all iterations have been completed
+    if (animSpriteCel->iterationsCount == 0) {
+        // Exit early
+        return;
+    }
+
+    // Advance to the next animation step
+    AnimSpriteCelNextStep(animSpriteCel);
+}
+
 // Deletes the AnimSpriteCel
 int32 AnimSpriteCelCleanup(AnimSpriteCel *animSpriteCel) {
 
-    if (DEBUG_ANIMSPRITECEL_CLEAN == 1) { printf("*AnimSpriteCelCleanup()*\n"); }
-
     // If the AnimSpriteCel is undefined
     if (animSpriteCel == NULL) {
         printf("Error: AnimSpriteCel unknown.\n");
         return -1;
     }
 
+    // Trace its counters and its end
+    ANIMSPRITECEL_TRACE_COUNTERS(animSpriteCel);
+    ANIMSPRITECEL_TRACE_EVENT(TRACE_CLEANUP, animSpriteCel, 0);
+
+    // If it was taken from a pool, its callback gives the whole slot back
+    if (animSpriteCel->pool != NULL) {
+        return animSpriteCel->release(animSpriteCel);
+    }
+
+    // Remove it from its system if registered, it is kept if packed receivers would be retargeted
+    if ((animSpriteCel->system != NULL) && (AnimSpriteCelSystemUnregister(animSpriteCel->system, animSpriteCel) < 0)) {
+        // Return error
+        printf("Error <- AnimSpriteCelSystemUnregister()\n");
+        return -1;
+    }
+
     // Free the Cel if present
     if (animSpriteCel->cel != NULL) {
         DeleteCel(animSpriteCel->cel);
         animSpriteCel->cel = NULL;
     }
 
+    // If the steps belong to a shared sequence or file
+    if (animSpriteCel->release != NULL) {
+        // Its callback drops the reference instead of freeing them
+        animSpriteCel->release(animSpriteCel);
+        animSpriteCel->release = NULL;
+    }
+
+    // If the packed steps are read from a generated table
+    if (animSpriteCel->table != NULL) {
+        // Constant steps, shared frames and timeline: nothing to free
+        animSpriteCel->table = NULL;
+        animSpriteCel->packedSteps = NULL;
+        animSpriteCel->frames = NULL;
+        animSpriteCel->timeline = NULL;
+    }
+
     // Free the step array if present
     if (animSpriteCel->steps != NULL) {
         FreeMem(animSpriteCel->steps, animSpriteCel->stepsCount * sizeof(AnimSpriteCelStep));
         animSpriteCel->steps = NULL;
     }
 
+    // Free the packed step array and the frame descriptors if present
+    if (animSpriteCel->packedSteps != NULL) {
+        FreeMem(animSpriteCel->packedSteps, animSpriteCel->stepsCount * sizeof(AnimSpriteCelPackedStep));
+        animSpriteCel->packedSteps = NULL;
+    }
+    if (animSpriteCel->frames != NULL) {
+        FreeMem(animSpriteCel->frames, animSpriteCel->framesCount * sizeof(AnimSpriteCelFrame));
+        animSpriteCel->frames = NULL;
+    }
+
+    // Free the timeline if present
+    if (animSpriteCel->timeline != NULL) {
+        FreeMem(animSpriteCel->timeline, ((2 * animSpriteCel->stepsCount) - 1) * sizeof(uint32));
+        animSpriteCel->timeline = NULL;
+    }
+
     // Free the AnimSpriteCel structure itself
-    FreeMem(animSpriteCel, sizeof(AnimSpriteCel));
     animSpriteCel->spriteCel = NULL;
+    FreeMem(animSpriteCel, sizeof(AnimSpriteCel));
 
     // Finalize cleanup
     animSpriteCel = NULL;
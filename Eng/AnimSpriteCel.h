@@ -32,16 +32,109 @@
 **
 **  Important Notes:
 **
-**    - The display of the used SpriteCel is directly affected by AnimSpriteCel,
-**      as it changes the current frame. If a SpriteCel needs to be displayed
-**      independently, it’s recommended to clone it solely for AnimSpriteCel.
-**      Another solution is to store the current frame during execution and
-**      call SpriteCelSetFrame() to restore the correct one after AnimSpriteCelRun().
+**    - The frame descriptor (PRE0, PRE1, SourcePtr) of each displayed frame is
+**      resolved through the SpriteCel once, when a step showing it is
+**      configured, and the frame displayed by the SpriteCel is given back right
+**      after. The descriptors are kept in a table indexed by frame, shared by
+**      all the steps showing the same frame. A step change then only copies
+**      the cached descriptor into the CCB: the used SpriteCel is never changed
+**      while the animation runs and can be displayed independently. If the
+**      SpriteCel frames are changed, the steps must be configured again.
 **
 **    - A single SpriteCel can be used for multiple AnimSpriteCels with their
 **      own animation sequences. There’s no need to create a SpriteCel for
 **      every AnimSpriteCel.
 **
+**    - In ALTERNATE loop, the animation bounces on the first and last steps
+**      without playing them twice (0, 1, 2, 1, 0, 1, ...). Each bounce ends
+**      a cycle.
+**
+**    - The loop mode and the step layout are fixed by AnimSpriteCelSetup(),
+**      which picks the step move and the frame display written for them
+**      ("stepMove", "stepDisplay"). A step change then doesn't test the loop
+**      mode or the layout again.
+**
+**    - The frame display only writes "ccb_PRE0", "ccb_PRE1" and
+**      "ccb_SourcePtr" when the new step shows another frame. A step that
+**      repeats the frame leaves the CCB untouched, and only a CCB actually
+**      written is marked as changed in a system tracking them.
+**
+**    - AnimSpriteCelAdvance() catches up many display cycles at once (after a
+**      pause, a skipped frame or a headless simulation). It gives the same state
+**      as calling AnimSpriteCelRun() as many times, delivers the triggers of the
+**      crossed steps in order and writes the CCB only once. When no step is
+**      random, waiting or triggering, whole loop periods are skipped in closed
+**      form.
+**
+**    - AnimSpriteCelSeek() sets the animation to a display cycle of its timeline,
+**      counted from the starting step, direction and iterations given to
+**      AnimSpriteCelInitialization(). The state is the one reached after as
+**      many AnimSpriteCelRun() calls. The cumulative durations of a loop period
+**      (forward and backward pass in ALTERNATE) are built on the first seek after
+**      a step configuration, then the step is found by binary search. If a
+**      duration is random or waiting, the timeline is replayed from the start
+**      instead: random durations are rolled again, and a waiting step stops the
+**      replay. Seeking never sends triggers.
+**
+**    - Random durations come from the hardware random number generator, unless
+**      AnimSpriteCelRandomSeed() gives the AnimSpriteCel its own xorshift
+**      generator. Runs then draw the same durations for the same seed, and
+**      AnimSpriteCelSeek() replays exactly the durations drawn since the seed.
+**      An AnimSpriteCelSystem can seed all its AnimSpriteCels at once.
+**
+**    - AnimSpriteCelSpeed() sets the playback speed of the AnimSpriteCel in
+**      16.16 fixed point (0x10000 = 1.0, 0x8000 = half speed, 0x18000 = 1.5,
+**      0 = paused), without touching its steps. Each run adds the speed to an
+**      accumulator: its whole display cycles are taken from the step, the
+**      fraction is kept for the next run. No floating point and no division
+**      are involved, and at 1.0 the accumulator is not used at all. The cycles
+**      past the end of a step are carried into the next ones as
+**      AnimSpriteCelAdvance() does: a fast run can cross several steps, their
+**      triggers are sent in order and the CCB shows the last one.
+**      AnimSpriteCelAdvance() and AnimSpriteCelSeek() count cycles of the
+**      animation itself, the speed doesn't apply to them. The speed is
+**      refused in a system of WHEEL schedule.
+**
+**    - AnimSpriteCelTimeBaseConfiguration() can count the durations of the
+**      steps in MICROSECONDS instead of display cycles (CYCLES, default). Such
+**      an AnimSpriteCel is run by AnimSpriteCelTimeRun() with the time elapsed
+**      since its last run, so its speed no longer follows the display rate. A
+**      step of a fixed duration then lasts exactly that many microseconds, and
+**      the time that goes past the end of a step is carried into the next one
+**      in whole microseconds: nothing is rounded, so there is no drift. The
+**      steps crossed in one run send their triggers in order and the CCB is
+**      written once, for the last one, as in AnimSpriteCelAdvance().
+**      AnimSpriteCelAdvance(), AnimSpriteCelSeek() and the other functions
+**      count in microseconds too. Packed durations hold 32767 microseconds
+**      at most. The unit is refused on steps shared by an
+**      AnimSpriteCelSequence, an AnimSpriteCelFile or an AnimSpriteCelTable:
+**      their timeline is shared, so every instance counts in cycles.
+**
+**    - Long step tables (cutscenes) can use the packed layout given by
+**      AnimSpriteCelPackedInitialization(): 8 bytes per step (16-bit frame
+**      index, duration, receiver index and event ID) instead of 16, with the
+**      same frame descriptor table. The receiver of a packed step is the
+**      AnimSpriteCel registered at that index of the owning
+**      AnimSpriteCelSystem, so it is only triggered once the sender is
+**      registered, and an AnimSpriteCel it could retarget by shifting the
+**      array can't be unregistered. Values that don't fit are refused by
+**      AnimSpriteCelPackedStepConfiguration(). All the other functions work
+**      the same on both layouts.
+**
+**    - A step can carry an event ID (AnimSpriteCelStepEvent()) for the game:
+**      a sound cue, a hit frame, a particle spawn. When the step starts, the
+**      AnimSpriteCelSystem the AnimSpriteCel is registered in appends the
+**      AnimSpriteCel, the event and the tick to its event buffer, which the
+**      game drains once per frame instead of polling "stepIndex". The steps
+**      crossed by AnimSpriteCelAdvance() send their events in order,
+**      AnimSpriteCelSeek() sends none, and neither does an AnimSpriteCel
+**      outside a system. Packed event IDs hold 65535 at most.
+**
+**    - The step changes, triggers and cycle ends are recorded as binary
+**      events by AnimSpriteCelTrace when the game is compiled with
+**      ANIMSPRITECEL_TRACE at 1. At 0 (default), the trace adds no code and
+**      no field.
+**
 **    - Once an AnimSpriteCel is initialized, it should be cleaned up using AnimSpriteCelCleanup().
 **      The associated SpriteCel should be deleted separately.
 **
@@ -49,30 +142,94 @@
 **
 **    AnimSpriteCelStep
 **      - frameIndex: index of the SpriteCel frame to display
-**      - frameDuration: display duration in cycles (int32)
+**      - frameDuration: display duration in cycles or microseconds (int32)
 **                        > 1 -> fixed duration
 **                        = 1 -> immediate switch
 **                        = 0 -> awaiting trigger
 **                        < 0 -> random duration (between 1 and abs(value)), weighted by "range"
 **      - animSpriteCelReceiver: pointer to another AnimSpriteCel to trigger the next step if paused
+**      - eventId: event sent to the system when the step starts (ANIMSPRITECEL_EVENT_NONE = no event)
+**
+**    AnimSpriteCelPackedStep
+**      - frameIndex: index of the SpriteCel frame to display (uint16)
+**      - frameDuration: display duration in cycles or microseconds (int16), same meaning as above
+**      - receiverIndex: index of the receiver in the owning AnimSpriteCelSystem
+**        (ANIMSPRITECEL_RECEIVER_NONE = no receiver)
+**      - eventId: event sent to the system when the step starts (uint16), same meaning as above
+**
+**    AnimSpriteCelFrame
+**      - ccbPRE0, ccbPRE1, ccbSourcePtr: CCB descriptor of a SpriteCel frame,
+**        shared by the steps displaying it (both layouts)
 **
 **    AnimSpriteCel
 **      - cel: animated CCB (copy of SpriteCel)
 **      - spriteCel: reference to source SpriteCel (frame array)
 **      - loop: loop type (NORMAL, REVERSE, ALTERNATE)
 **      - range: value range for randomness (FULL, HALF, QUARTER)
+**      - stepMove: step move of the loop mode
+**      - stepDisplay: frame display of the step layout
 **      - remainingCycles: executions of AnimSpriteCelRun() before next step
 **      - iterationsCount: number of cycle repetitions (unlimited = INFINITE)
 **      - direction: animation direction (1 = forward, -1 = backward)
 **      - stepIndex: current step in the "steps" array
 **      - stepsCount: total number of animation steps
-**      - steps: dynamic array of "AnimSpriteCelStep"
+**      - steps: dynamic array of "AnimSpriteCelStep" (NULL in packed layout)
+**      - packedSteps: dynamic array of "AnimSpriteCelPackedStep" (NULL in normal layout)
+**      - frames: frame descriptors of the steps, indexed by frame
+**      - framesCount: number of frame descriptors
+**      - timeline: cumulative step durations over a loop period (AnimSpriteCelSeek())
+**      - timelineLength: positions in a loop period (0 = random or waiting durations)
+**      - timelineDirty: timeline to rebuild after a step configuration
+**      - originStepIndex, originDirection, originIterations: start of the timeline
+**      - randomState: xorshift generator state (0 = hardware random numbers)
+**      - originRandomState: generator state at the start of the timeline
+**      - speed: playback speed in 16.16 fixed point (ANIMSPRITECEL_SPEED_NORMAL = 1.0)
+**      - speedAccumulator: fraction of display cycle carried to the next run
+**      - timeBase: unit of the step durations (CYCLES, MICROSECONDS)
+**      - pool: AnimSpriteCelPool the animation was taken from (or NULL)
+**      - sequence: AnimSpriteCelSequence sharing its steps (or NULL)
+**      - file: AnimSpriteCelFile holding its packed steps (or NULL)
+**      - table: AnimSpriteCelTable holding its packed steps (or NULL)
+**      - release: callback installed by the pool, sequence or file the
+**        animation comes from, called by AnimSpriteCelCleanup() (or NULL)
+**      - system: AnimSpriteCelSystem the animation is registered in (or NULL)
+**      - systemIndex: position in the AnimSpriteCelSystem array
+**      - expiryTick: system tick at which the current step ends (WHEEL schedule)
+**      - wheelSlot, wheelPrevious, wheelNext: links in the system timing wheel
+**      - systemActive: in the active set of the system, or woken (ACTIVE schedule)
+**      - stateHash: term of the AnimSpriteCel in the state hash of the system
+**      - visible: drawn by the draw list of the system
+**      - drawPrevious, drawNext, drawGroup: links and group in the draw list
+**      - traceId: identifier in the trace (ANIMSPRITECEL_TRACE at 1)
+**      - traceSteps, traceIdleCycles, traceTriggersSent, traceTriggersReceived:
+**        counters of the trace (ANIMSPRITECEL_TRACE at 1)
 **
 **  Main Functions:
 **
 **    AnimSpriteCelInitialization()
 **      -> Initializes animation, clones CCB, prepares steps array.
 **
+**    AnimSpriteCelSetup()
+**      -> Internal function to initialize an AnimSpriteCel whose CCB, steps
+**         and timeline are already allocated. Called by
+**         AnimSpriteCelInitialization(), AnimSpriteCelPoolAcquire() and
+**         AnimSpriteCelSequenceInstance().
+**
+**    AnimSpriteCelFrameResolve()
+**      -> Internal function to resolve and cache the CCB descriptor of the
+**         frame a step displays. Called by AnimSpriteCelStepConfiguration()
+**         and AnimSpriteCelSequenceStepConfiguration().
+**
+**    AnimSpriteCelFramesReserve()
+**      -> Internal function to grow a frame descriptor table up to a frame
+**         index. Called by AnimSpriteCelStepConfiguration() and
+**         AnimSpriteCelSequenceStepConfiguration().
+**
+**    AnimSpriteCelFramesResolve()
+**      -> Internal function to resolve the CCB descriptors of the SpriteCel
+**         frames. Called by AnimSpriteCelPackedInitialization(),
+**         AnimSpriteCelFileInstance() and AnimSpriteCelTableInstance().
+**
 **    AnimSpriteCelStepConfiguration()
 **      -> Defines an animation step: frame to display, duration, and pointer
 **         to another AnimSpriteCel
@@ -80,6 +237,36 @@
 **    AnimSpriteCelStepsConfiguration()
 **      -> Defines multiple steps in one pass with variadic arguments.
 **
+**    AnimSpriteCelStepEvent()
+**      -> Sets the event a step sends to the system when it starts, in
+**         either layout.
+**
+**    AnimSpriteCelPackedInitialization()
+**      -> Initializes an animation with packed steps and resolves the
+**         descriptors of the SpriteCel frames.
+**
+**    AnimSpriteCelPackedStepConfiguration()
+**      -> Defines a packed step: frame to display, duration and index of the
+**         receiver in the system. Refuses values that don't fit.
+**
+**    AnimSpriteCelRandomSeed()
+**      -> Gives the AnimSpriteCel its own random generator (0 = hardware) and
+**         rolls the current random step again.
+**
+**    AnimSpriteCelSpeed()
+**      -> Sets the playback speed of the AnimSpriteCel (16.16 fixed point).
+**
+**    AnimSpriteCelSpeedRun()
+**      -> Internal function running a display cycle at a speed other than 1.0.
+**         Called by AnimSpriteCelRun() and the visits of AnimSpriteCelSystem.
+**
+**    AnimSpriteCelTimeBaseConfiguration()
+**      -> Counts the step durations in display cycles or in microseconds.
+**
+**    AnimSpriteCelTimeRun()
+**      -> Run function of an AnimSpriteCel counted in microseconds, given the
+**         time elapsed since its last run.
+**
 **    AnimSpriteCelUpdate()
 **      -> Internal function to update display.
 **         Called by AnimSpriteCelNextStep() when needed.
@@ -93,12 +280,20 @@
 **      -> Evolution function to call on each display cycle.
 **         Manages transition to next step.
 **
+**    AnimSpriteCelAdvance()
+**      -> Same as a given number of AnimateSpriteCelRun() calls at normal
+**         speed, in a number of operations bounded by the crossed steps.
+**
+**    AnimSpriteCelSeek()
+**      -> Sets the animation to a display cycle of its timeline.
+**
 **    AnimSpriteCelTrigger()
 **      -> Internal function to trigger the next step in another
 **         waiting AnimSpriteCel.
 **
 **    AnimSpriteCelCleanup()
-**      -> Frees memory used by the AnimSpriteCel structure
+**      -> Frees memory used by the AnimSpriteCel structure, or gives it back
+**         to its AnimSpriteCelPool
 **
 ******************************************************************************/
 
@@ -109,11 +304,25 @@
 // SpriteCel
 #include "SpriteCel.h"
 
-// Debug
-#define DEBUG_ANIMSPRITECEL_INIT 0
-#define DEBUG_ANIMSPRITECEL_SETUP 0
-#define DEBUG_ANIMSPRITECEL_FUNCT 0
-#define DEBUG_ANIMSPRITECEL_CLEAN 0
+// Trace (AnimSpriteCelTrace): 1 = events and counters recorded, 0 = no trace code
+#ifndef ANIMSPRITECEL_TRACE
+#define ANIMSPRITECEL_TRACE 0
+#endif
+
+// Receiver index of a packed step without receiver
+#define ANIMSPRITECEL_RECEIVER_NONE 0xFFFF
+
+// Event ID of a step without event
+#define ANIMSPRITECEL_EVENT_NONE 0
+
+// Playback speeds in 16.16 fixed point
+#define ANIMSPRITECEL_SPEED_NORMAL 0x00010000
+#define ANIMSPRITECEL_SPEED_MAX 0x01000000
+
+// Duration of a step in either layout
+#define ANIMSPRITECEL_STEP_DURATION(animSpriteCel, index) (((animSpriteCel)->packedSteps != NULL) ? (int32)(animSpriteCel)->packedSteps[(index)].frameDuration : (animSpriteCel)->steps[(index)].frameDuration)
+// Event of a step in either layout
+#define ANIMSPRITECEL_STEP_EVENT(animSpriteCel, index) (((animSpriteCel)->packedSteps != NULL) ? (uint32)(animSpriteCel)->packedSteps[(index)].eventId : (animSpriteCel)->steps[(index)].eventId)
 
 // Enumeration of interactive zone types
 typedef enum {
@@ -135,7 +344,20 @@ typedef enum {
     QUARTER
 } AnimSpriteCelRange;
 
+// Unit of the step durations
+typedef enum {
+    // Durations in display cycles, one per AnimSpriteCelRun()
+    CYCLES,
+    // Durations in microseconds, given to AnimSpriteCelTimeRun()
+    MICROSECONDS
+} AnimSpriteCelTimeBase;
+
 typedef struct AnimSpriteCel AnimSpriteCel;
+typedef struct AnimSpriteCelSystem AnimSpriteCelSystem;
+typedef struct AnimSpriteCelPool AnimSpriteCelPool;
+typedef struct AnimSpriteCelSequence AnimSpriteCelSequence;
+typedef struct AnimSpriteCelFile AnimSpriteCelFile;
+typedef struct AnimSpriteCelTable AnimSpriteCelTable;
 
 typedef struct {
     // Displayed frame
@@ -145,9 +367,29 @@ typedef struct {
     int32 frameDuration;
     // Target AnimSpriteCel for trigger dispatch
     AnimSpriteCel *animSpriteCelReceiver;
-    // Animation loop type
+    // Event sent to the system when the step starts (ANIMSPRITECEL_EVENT_NONE = no event)
+    uint32 eventId;
 } AnimSpriteCelStep;
 
+typedef struct {
+    // Displayed frame
+    uint16 frameIndex;
+    // Frame duration
+    // (A negative value indicates random duration)
+    int16 frameDuration;
+    // Index of the target AnimSpriteCel in the owning system
+    uint16 receiverIndex;
+    // Event sent to the system when the step starts (ANIMSPRITECEL_EVENT_NONE = no event)
+    uint16 eventId;
+} AnimSpriteCelPackedStep;
+
+typedef struct {
+    // CCB frame descriptor (resolved at configuration)
+    uint32 ccbPRE0;
+    uint32 ccbPRE1;
+    CelData *ccbSourcePtr;
+} AnimSpriteCelFrame;
+
 struct AnimSpriteCel {
     // Main CCB of the animated sprite
     CCB *cel;
@@ -157,6 +399,10 @@ struct AnimSpriteCel {
     AnimSpriteCelLoop loop;
     // Range of random value usage
     AnimSpriteCelRange range;
+    // Step move of the loop mode, returns 1 at the end of a cycle
+    uint32 (*stepMove)(AnimSpriteCel *animSpriteCel);
+    // Frame display of the step layout, returns 1 if the CCB changed
+    uint32 (*stepDisplay)(AnimSpriteCel *animSpriteCel);
     // Remaining cycles before next change
     uint32 remainingCycles;
     // Number of animation cycle repetitions
@@ -169,23 +415,123 @@ struct AnimSpriteCel {
     uint32 stepsCount;
     // Array of animation steps
     AnimSpriteCelStep *steps;
+    // Array of packed animation steps (packed layout)
+    AnimSpriteCelPackedStep *packedSteps;
+    // Frame descriptors of the steps, indexed by frame
+    AnimSpriteCelFrame *frames;
+    // Number of frame descriptors
+    uint32 framesCount;
+    // Cumulative step durations over a loop period
+    uint32 *timeline;
+    // Number of positions in a loop period (0 if a duration is random or waiting)
+    uint32 timelineLength;
+    // Timeline to rebuild after a step configuration
+    uint32 timelineDirty;
+    // Starting step, direction and iterations of the timeline
+    int32 originStepIndex;
+    int32 originDirection;
+    uint32 originIterations;
+    // Xorshift generator state (0 = hardware random numbers)
+    uint32 randomState;
+    // Generator state at the start of the timeline
+    uint32 originRandomState;
+    // Playback speed in 16.16 fixed point (0x10000 = 1.0)
+    uint32 speed;
+    // Fraction of display cycle carried to the next run
+    uint32 speedAccumulator;
+    // Unit of the step durations
+    AnimSpriteCelTimeBase timeBase;
+    // Pool the AnimSpriteCel was taken from (NULL if allocated on its own)
+    AnimSpriteCelPool *pool;
+    // Shared sequence holding the steps (NULL if the steps are its own)
+    AnimSpriteCelSequence *sequence;
+    // Animation file holding the packed steps (NULL if the steps are its own)
+    AnimSpriteCelFile *file;
+    // Generated table holding the packed steps (NULL if the steps are its own)
+    AnimSpriteCelTable *table;
+    // Gives back what the pool, sequence or file lent (NULL if nothing was lent)
+    int32 (*release)(AnimSpriteCel *animSpriteCel);
+    // Owning system (NULL if not registered)
+    AnimSpriteCelSystem *system;
+    // Index in the owning system
+    uint32 systemIndex;
+    // System tick at which the current step ends
+    uint32 expiryTick;
+    // Timing wheel slot holding the AnimSpriteCel (NULL if not scheduled)
+    AnimSpriteCel **wheelSlot;
+    // Previous AnimSpriteCel in the slot (the head points to the tail)
+    AnimSpriteCel *wheelPrevious;
+    // Next AnimSpriteCel in the slot
+    AnimSpriteCel *wheelNext;
+    // In the active set of the system, or woken to join it (ACTIVE schedule)
+    uint32 systemActive;
+    // Term of the AnimSpriteCel in the state hash of the system
+    uint32 stateHash;
+    // Drawn by the draw list of the system
+    uint32 visible;
+    // Previous and next AnimSpriteCels in the draw list
+    AnimSpriteCel *drawPrevious;
+    AnimSpriteCel *drawNext;
+    // Group of the draw list (SOURCE_ORDER)
+    uint32 drawGroup;
+#if ANIMSPRITECEL_TRACE == 1
+    // Identifier in the trace
+    uint32 traceId;
+    // Steps advanced
+    uint32 traceSteps;
+    // Display cycles spent on the steps before leaving them
+    uint32 traceIdleCycles;
+    // Triggers sent and received
+    uint32 traceTriggersSent;
+    uint32 traceTriggersReceived;
+#endif
 };
 
 // Reference to the global context
 extern AnimSpriteCel animSpriteCel;
 
+// Resolves and caches the CCB descriptor of a SpriteCel frame
+void AnimSpriteCelFrameResolve(SpriteCel *spriteCel, AnimSpriteCelFrame *frames, uint32 frameIndex);
+// Grows a frame descriptor table to hold a frame index
+int32 AnimSpriteCelFramesReserve(AnimSpriteCelFrame **frames, uint32 *framesCount, uint32 frameIndex);
+// Resolves the CCB frame descriptors of the SpriteCel frames
+void AnimSpriteCelFramesResolve(SpriteCel *spriteCel, AnimSpriteCelFrame *frames, uint32 framesCount);
+// Initialization of an AnimSpriteCel whose CCB, steps and timeline are already allocated
+void AnimSpriteCelSetup(AnimSpriteCel *animSpriteCel, SpriteCel *spriteCel, AnimSpriteCelLoop loop, AnimSpriteCelRange range, uint32 iterations, int32 direction, uint32 stepIndex, uint32 stepsCount);
 // Initialization of an AnimSpriteCel
 AnimSpriteCel *AnimSpriteCelInitialization(SpriteCel *spriteCel, AnimSpriteCelLoop loop, AnimSpriteCelRange range, uint32 iterations, int32 direction, uint32 stepIndex, uint32 stepsCount);
 // Configuration of a single AnimSpriteCel step
 int32 AnimSpriteCelStepConfiguration(AnimSpriteCel *animSpriteCel, uint32 stepIndex, uint32 frameIndex, int32 frameDuration, AnimSpriteCel *animSpriteCelReceiver);
 // Configuration of multiple AnimSpriteCel steps
 int32 AnimSpriteCelStepsConfiguration(AnimSpriteCel *spriteCel, int32 start, ...);
+// Sets the event a step sends to the system when it starts
+int32 AnimSpriteCelStepEvent(AnimSpriteCel *animSpriteCel, uint32 stepIndex, uint32 eventId);
+// Initialization of an AnimSpriteCel with packed steps
+AnimSpriteCel *AnimSpriteCelPackedInitialization(SpriteCel *spriteCel, AnimSpriteCelLoop loop, AnimSpriteCelRange range, uint32 iterations, int32 direction, uint32 stepIndex, uint32 stepsCount, uint32 framesCount);
+// Configuration of a packed AnimSpriteCel step
+int32 AnimSpriteCelPackedStepConfiguration(AnimSpriteCel *animSpriteCel, uint32 stepIndex, uint32 frameIndex, int32 frameDuration, uint32 receiverIndex);
+// Gives the AnimSpriteCel its own random generator
+int32 AnimSpriteCelRandomSeed(AnimSpriteCel *animSpriteCel, uint32 seed);
+// Sets the playback speed of the AnimSpriteCel
+int32 AnimSpriteCelSpeed(AnimSpriteCel *animSpriteCel, uint32 speed);
+// Sets the unit of the step durations
+int32 AnimSpriteCelTimeBaseConfiguration(AnimSpriteCel *animSpriteCel, AnimSpriteCelTimeBase timeBase);
+// Gives the receiver of a step in either layout (NULL if none)
+AnimSpriteCel *AnimSpriteCelStepReceiver(AnimSpriteCel *animSpriteCel, uint32 stepIndex);
 // Updates the display of an AnimSpriteCel
 void AnimSpriteCelUpdate(AnimSpriteCel *animSpriteCel);
 // Advances to the next step in the animation
 void AnimSpriteCelNextStep(AnimSpriteCel *animSpriteCel);
 // Runs the animation
 void AnimSpriteCelRun(AnimSpriteCel *animSpriteCel);
+// Runs a display cycle at the speed of the animation
+void AnimSpriteCelSpeedRun(AnimSpriteCel *animSpriteCel);
+// Runs the animation for the time elapsed since its last run
+void AnimSpriteCelTimeRun(AnimSpriteCel *animSpriteCel, uint32 elapsedMicroseconds);
+// Catches up a number of display cycles
+void AnimSpriteCelAdvance(AnimSpriteCel *animSpriteCel, uint32 elapsedCycles);
+// Sets the animation to a display cycle of its timeline
+int32 AnimSpriteCelSeek(AnimSpriteCel *animSpriteCel, uint32 tick);
 // Triggers a waiting animation
 void AnimSpriteCelTrigger(AnimSpriteCel *animSpriteCel);
 // Cleans up the AnimSpriteCel
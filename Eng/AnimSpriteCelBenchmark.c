@@ -0,0 +1,370 @@
+/******************************************************************************
+**
+**  AnimSpriteCelBenchmark - Throughput of AnimSpriteCelRun() (host program)
+**
+**  Author: Christophe Geoffroy (Topper) - MIT License
+**  Last Updated: 2026-10-17
+**
+**  Measures AnimSpriteCel on a development computer, with the stand-ins of
+**  the Host directory in place of the 3DO SDK. Built and run from this
+**  directory:
+**
+**    gcc -O2 -pthread -I Host -I . -o AnimSpriteCelBenchmark AnimSpriteCelBenchmark.c
+**        AnimSpriteCel.c AnimSpriteCelSystem.c AnimSpriteCelPool.c
+**        AnimSpriteCelSequence.c AnimSpriteCelFile.c AnimSpriteCelTable.c
+**        AnimSpriteCelTrace.c AnimSpriteCelParallel.c Mathematical.c Host/Host.c
+**    ./AnimSpriteCelBenchmark [maximum number of animations] [maximum number of workers]
+**
+**  Adding -DANIMSPRITECEL_TRACE=1 measures the same runs with the trace
+**  recording (ring buffer of 65 536 events).
+**  Each scenario creates 1 000, 100 000 and 1 000 000 animations of 4 steps
+**  (up to the given maximum) and calls AnimSpriteCelRun() on each of them for
+**  a number of ticks (10 000 000 runs per measure). It reports:
+**
+**    - ns/anim/tick: time of one AnimSpriteCelRun() call
+**    - allocs/anim, bytes/anim: AllocMem() calls and bytes per animation
+**    - events/anim/tick: trace events recorded per run (0 without trace)
+**
+**  Scenarios:
+**
+**    - NORMAL, REVERSE, ALTERNATE: fixed durations (2, 3, 1, 4)
+**    - random: random durations (-4, -6, -2, -8), FULL range
+**    - packed: NORMAL with fixed durations in the packed layout
+**    - trigger chain: groups of 8 animations, the first one changes step on
+**      every tick and each step change triggers the next animation of the
+**      group, whose steps wait for a trigger (8 step changes per group)
+**    - speed 1.5: NORMAL with fixed durations, played at speed 0x18000
+**
+**  The trigger chains of the largest number of animations are then
+**  registered in a system with SAME_TICK delivery and run for 100 ticks with
+**  AnimSpriteCelSystemRun(), in POLLING and in ACTIVE schedule. The
+**  followers of the chains only wait, so the active set holds one animation
+**  out of 8.
+**
+**  With a maximum number of workers, the POLLING run is then repeated with
+**  AnimSpriteCelParallelRun() on 1, 2, 4... workers (partitions of 4 096
+**  AnimSpriteCels). Each run reports its wall time per animation and tick,
+**  its speedup over the POLLING run of AnimSpriteCelSystemRun(), and whether
+**  its final states are the same. The speedup of the workers is bounded by
+**  the cores of the computer.
+**
+**  The host timings only compare versions of the code with each other: the
+**  3DO ARM60 has no cache and a much slower memory, so absolute values differ.
+**
+******************************************************************************/
+
+// printf()
+#include <stdio.h>
+// malloc(), free(), atol()
+#include <stdlib.h>
+// memset()
+#include <string.h>
+// clock(), clock_gettime()
+#include <time.h>
+
+// AnimSpriteCel
+#include "AnimSpriteCel.h"
+// AnimSpriteCelSystemInitialization(), AnimSpriteCelSystemRun()
+#include "AnimSpriteCelSystem.h"
+// AnimSpriteCelParallelInitialization(), AnimSpriteCelParallelRun()
+#include "AnimSpriteCelParallel.h"
+// INFINITE
+#include "DefinitionsArguments.h"
+// AnimSpriteCelTraceInitialization(), animSpriteCelTrace
+#include "AnimSpriteCelTrace.h"
+// hostAllocationsCount, hostAllocatedBytes
+#include "mem.h"
+
+// Runs per measure
+#define BENCHMARK_RUNS 10000000UL
+// Steps of each animation
+#define BENCHMARK_STEPS 4
+// Frames of the SpriteCel
+#define BENCHMARK_FRAMES 8
+// Animations per trigger chain
+#define BENCHMARK_CHAIN 8
+// Events of the trace ring buffer
+#define BENCHMARK_TRACE_EVENTS 65536
+// AnimSpriteCels per partition of the parallel runs
+#define BENCHMARK_PARTITION 4096
+// Ticks of the system runs
+#define BENCHMARK_SYSTEM_TICKS 100
+
+// Scenario of the benchmark
+typedef struct {
+    // Name displayed
+    const char *name;
+    // Loop mode
+    AnimSpriteCelLoop loop;
+    // Durations of the steps
+    int32 durations[BENCHMARK_STEPS];
+    // Packed layout
+    int packed;
+    // Trigger chains
+    int chain;
+    // Playback speed (16.16 fixed point)
+    uint32 speed;
+} BenchmarkScenario;
+
+static const BenchmarkScenario benchmarkScenarios[] = {
+    { "NORMAL",        NORMAL,    {  2,  3,  1,  4 }, 0, 0, ANIMSPRITECEL_SPEED_NORMAL },
+    { "REVERSE",       REVERSE,   {  2,  3,  1,  4 }, 0, 0, ANIMSPRITECEL_SPEED_NORMAL },
+    { "ALTERNATE",     ALTERNATE, {  2,  3,  1,  4 }, 0, 0, ANIMSPRITECEL_SPEED_NORMAL },
+    { "random",        NORMAL,    { -4, -6, -2, -8 }, 0, 0, ANIMSPRITECEL_SPEED_NORMAL },
+    { "packed",        NORMAL,    {  2,  3,  1,  4 }, 1, 0, ANIMSPRITECEL_SPEED_NORMAL },
+    { "trigger chain", NORMAL,    {  1,  1,  1,  1 }, 0, 1, ANIMSPRITECEL_SPEED_NORMAL },
+    { "speed 1.5",     NORMAL,    {  2,  3,  1,  4 }, 0, 0, 0x00018000 }
+};
+
+// Creates the animations of a scenario, returns 0 on error
+static int BenchmarkCreate(const BenchmarkScenario *scenario, SpriteCel *spriteCel, AnimSpriteCel **animSpriteCels, unsigned long count) {
+
+    // Animation and step index
+    unsigned long index = 0;
+    uint32 stepIndex = 0;
+    // Duration and receiver of a step
+    int32 frameDuration = 0;
+    AnimSpriteCel *animSpriteCelReceiver = NULL;
+
+    for (index = 0; index < count; index++) {
+        if (scenario->packed == 1) {
+            animSpriteCels[index] = AnimSpriteCelPackedInitialization(spriteCel, scenario->loop, FULL, INFINITE, 1, 0, BENCHMARK_STEPS, BENCHMARK_FRAMES);
+        } else {
+            animSpriteCels[index] = AnimSpriteCelInitialization(spriteCel, scenario->loop, FULL, INFINITE, 1, 0, BENCHMARK_STEPS);
+        }
+        if (animSpriteCels[index] == NULL) {
+            printf("Error: %lu animations can't be created.\n", count);
+            return 0;
+        }
+    }
+
+    for (index = 0; index < count; index++) {
+        for (stepIndex = 0; stepIndex < BENCHMARK_STEPS; stepIndex++) {
+
+            frameDuration = scenario->durations[stepIndex];
+            animSpriteCelReceiver = NULL;
+
+            // In a chain, the followers wait and every step triggers the next animation
+            if (scenario->chain == 1) {
+                frameDuration = ((index % BENCHMARK_CHAIN) == 0) ? frameDuration : 0;
+                if (((index % BENCHMARK_CHAIN) != BENCHMARK_CHAIN - 1) && (index + 1 < count)) {
+                    animSpriteCelReceiver = animSpriteCels[index + 1];
+                }
+            }
+
+            if (scenario->packed == 1) {
+                AnimSpriteCelPackedStepConfiguration(animSpriteCels[index], stepIndex, stepIndex * 2, frameDuration, ANIMSPRITECEL_RECEIVER_NONE);
+            } else {
+                AnimSpriteCelStepConfiguration(animSpriteCels[index], stepIndex, stepIndex * 2, frameDuration, animSpriteCelReceiver);
+            }
+        }
+        // Display the starting step with its duration, at the speed of the scenario
+        AnimSpriteCelUpdate(animSpriteCels[index]);
+        AnimSpriteCelSpeed(animSpriteCels[index], scenario->speed);
+    }
+
+    return 1;
+}
+
+// Measures a scenario with a given number of animations
+static void BenchmarkMeasure(const BenchmarkScenario *scenario, SpriteCel *spriteCel, AnimSpriteCel **animSpriteCels, unsigned long count) {
+
+    // Animation index and tick
+    unsigned long index = 0;
+    unsigned long tick = 0;
+    unsigned long ticksCount = 0;
+    // Allocations before the creation
+    uint32 allocationsCount = hostAllocationsCount;
+    uint32 allocatedBytes = hostAllocatedBytes;
+    // Time of the runs
+    clock_t start = 0;
+    double seconds = 0.0;
+    // Trace events before the runs
+    uint32 eventsWritten = 0;
+
+    // Create and configure the animations
+    if (BenchmarkCreate(scenario, spriteCel, animSpriteCels, count) == 0) {
+        return;
+    }
+    allocationsCount = hostAllocationsCount - allocationsCount;
+    allocatedBytes = hostAllocatedBytes - allocatedBytes;
+
+    // Same number of runs whatever the number of animations
+    ticksCount = (BENCHMARK_RUNS / count > 0) ? BENCHMARK_RUNS / count : 1;
+
+    eventsWritten = animSpriteCelTrace.eventsWritten;
+    start = clock();
+    for (tick = 0; tick < ticksCount; tick++) {
+        for (index = 0; index < count; index++) {
+            AnimSpriteCelRun(animSpriteCels[index]);
+        }
+    }
+    seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    eventsWritten = animSpriteCelTrace.eventsWritten - eventsWritten;
+
+    printf("%-14s %10lu %7lu %13.2f %12.1f %11.1f %17.3f\n", scenario->name, count, ticksCount,
+        (seconds * 1.0e9) / ((double)count * (double)ticksCount),
+        (double)allocationsCount / (double)count, (double)allocatedBytes / (double)count,
+        (double)eventsWritten / ((double)count * (double)ticksCount));
+
+    for (index = 0; index < count; index++) {
+        AnimSpriteCelCleanup(animSpriteCels[index]);
+    }
+}
+
+// Runs the trigger chains of a system alone (no worker) or on workers, gives the wall time and a digest of the final states
+static int BenchmarkSystem(SpriteCel *spriteCel, AnimSpriteCel **animSpriteCels, unsigned long count, AnimSpriteCelSchedule schedule, uint32 workersCount, double *seconds, unsigned long *digest) {
+
+    // Animation index and tick
+    unsigned long index = 0;
+    unsigned long tick = 0;
+    // System run and its workers
+    AnimSpriteCelSystem *animSpriteCelSystem = NULL;
+    AnimSpriteCelParallel *animSpriteCelParallel = NULL;
+    // Wall time of the runs (clock() would add up the threads)
+    struct timespec start;
+    struct timespec end;
+
+    // Trigger chains delivered on the same tick, seeded for the workers
+    if (BenchmarkCreate(&benchmarkScenarios[5], spriteCel, animSpriteCels, count) == 0) {
+        return 0;
+    }
+    animSpriteCelSystem = AnimSpriteCelSystemInitialization(count, schedule);
+    if (animSpriteCelSystem == NULL) {
+        return 0;
+    }
+    for (index = 0; index < count; index++) {
+        AnimSpriteCelSystemRegister(animSpriteCelSystem, animSpriteCels[index]);
+    }
+    AnimSpriteCelSystemTriggerConfiguration(animSpriteCelSystem, SAME_TICK, count, 0);
+    AnimSpriteCelSystemSeed(animSpriteCelSystem, 1);
+
+    // Workers of the parallel run
+    if (workersCount > 0) {
+        AnimSpriteCelSystemPartitionConfiguration(animSpriteCelSystem, BENCHMARK_PARTITION);
+        animSpriteCelParallel = AnimSpriteCelParallelInitialization(animSpriteCelSystem, workersCount);
+        if (animSpriteCelParallel == NULL) {
+            AnimSpriteCelSystemCleanup(animSpriteCelSystem);
+            return 0;
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (tick = 0; tick < BENCHMARK_SYSTEM_TICKS; tick++) {
+        if (animSpriteCelParallel != NULL) {
+            AnimSpriteCelParallelRun(animSpriteCelParallel);
+        } else {
+            AnimSpriteCelSystemRun(animSpriteCelSystem);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    *seconds = (double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) * 1.0e-9;
+
+    // Digest of the final states, the same for every run
+    *digest = 0;
+    for (index = 0; index < count; index++) {
+        *digest = *digest * 31 + (unsigned long)animSpriteCels[index]->stepIndex * 7 + (unsigned long)animSpriteCels[index]->remainingCycles;
+    }
+
+    // The system cleans up its AnimSpriteCels
+    if (animSpriteCelParallel != NULL) {
+        AnimSpriteCelParallelCleanup(animSpriteCelParallel);
+    }
+    AnimSpriteCelSystemCleanup(animSpriteCelSystem);
+    return 1;
+}
+
+// Compares the POLLING run of AnimSpriteCelSystemRun() with the ACTIVE one, then with AnimSpriteCelParallelRun() on 1, 2, 4... workers
+static void BenchmarkSystems(SpriteCel *spriteCel, AnimSpriteCel **animSpriteCels, unsigned long count, uint32 workersMax) {
+
+    // Number of workers
+    uint32 workersCount = 0;
+    // Wall time and digest of the single-threaded run, then of a parallel run
+    double systemSeconds = 0.0;
+    unsigned long systemDigest = 0;
+    double seconds = 0.0;
+    unsigned long digest = 0;
+
+    printf("\n%-14s %10s %7s %13s %8s %7s\n", "run", "animations", "ticks", "ns/anim/tick", "speedup", "states");
+
+    if (BenchmarkSystem(spriteCel, animSpriteCels, count, POLLING, 0, &systemSeconds, &systemDigest) == 0) {
+        return;
+    }
+    printf("%-14s %10lu %7lu %13.2f %8.2f %7s\n", "system POLLING", count, (unsigned long)BENCHMARK_SYSTEM_TICKS,
+        (systemSeconds * 1.0e9) / ((double)count * BENCHMARK_SYSTEM_TICKS), 1.0, "-");
+
+    if (BenchmarkSystem(spriteCel, animSpriteCels, count, ACTIVE, 0, &seconds, &digest) == 0) {
+        return;
+    }
+    printf("%-14s %10lu %7lu %13.2f %8.2f %7s\n", "system ACTIVE", count, (unsigned long)BENCHMARK_SYSTEM_TICKS,
+        (seconds * 1.0e9) / ((double)count * BENCHMARK_SYSTEM_TICKS), systemSeconds / seconds, (digest == systemDigest) ? "same" : "DIFFER");
+
+    for (workersCount = 1; workersCount <= workersMax; workersCount *= 2) {
+        if (BenchmarkSystem(spriteCel, animSpriteCels, count, POLLING, workersCount, &seconds, &digest) == 0) {
+            return;
+        }
+        printf("parallel %-5u %10lu %7lu %13.2f %8.2f %7s\n", workersCount, count, (unsigned long)BENCHMARK_SYSTEM_TICKS,
+            (seconds * 1.0e9) / ((double)count * BENCHMARK_SYSTEM_TICKS), systemSeconds / seconds, (digest == systemDigest) ? "same" : "DIFFER");
+    }
+}
+
+int main(int argc, char *argv[]) {
+
+    // Numbers of animations measured
+    static const unsigned long counts[] = { 1000UL, 100000UL, 1000000UL };
+    unsigned long countIndex = 0;
+    unsigned long countMax = 1000000UL;
+    // Scenario index
+    unsigned long scenarioIndex = 0;
+    // Sprite sheet shared by the animations
+    CCB cel;
+    SpriteCel *spriteCel = NULL;
+    // Animations measured
+    AnimSpriteCel **animSpriteCels = NULL;
+    // Maximum number of workers of the parallel runs (0 = not measured)
+    uint32 workersMax = 0;
+
+    // Optional maximum number of animations and of workers
+    if (argc > 1) {
+        countMax = (unsigned long)atol(argv[1]);
+    }
+    if (argc > 2) {
+        workersMax = (uint32)atol(argv[2]);
+    }
+
+    memset(&cel, 0, sizeof(CCB));
+    spriteCel = SpriteCelInitialization(&cel, 16, 16, BENCHMARK_FRAMES);
+    animSpriteCels = (AnimSpriteCel **)malloc(countMax * sizeof(AnimSpriteCel *));
+    if ((spriteCel == NULL) || (animSpriteCels == NULL)) {
+        printf("Error: out of memory.\n");
+        return 1;
+    }
+
+    printf("sizeof(AnimSpriteCel) %u, sizeof(AnimSpriteCelStep) %u, sizeof(AnimSpriteCelPackedStep) %u, sizeof(CCB) %u\n\n",
+        (unsigned int)sizeof(AnimSpriteCel), (unsigned int)sizeof(AnimSpriteCelStep), (unsigned int)sizeof(AnimSpriteCelPackedStep), (unsigned int)sizeof(CCB));
+    // Record the runs in a traced build
+    if ((ANIMSPRITECEL_TRACE == 1) && (AnimSpriteCelTraceInitialization(BENCHMARK_TRACE_EVENTS) < 0)) {
+        return 1;
+    }
+
+    printf("%-14s %10s %7s %13s %12s %11s %17s\n", "scenario", "animations", "ticks", "ns/anim/tick", "allocs/anim", "bytes/anim", "events/anim/tick");
+
+    for (scenarioIndex = 0; scenarioIndex < sizeof(benchmarkScenarios) / sizeof(benchmarkScenarios[0]); scenarioIndex++) {
+        for (countIndex = 0; countIndex < sizeof(counts) / sizeof(counts[0]); countIndex++) {
+            if (counts[countIndex] <= countMax) {
+                BenchmarkMeasure(&benchmarkScenarios[scenarioIndex], spriteCel, animSpriteCels, counts[countIndex]);
+            }
+        }
+    }
+
+    if (ANIMSPRITECEL_TRACE == 1) {
+        AnimSpriteCelTraceCleanup();
+    }
+
+    // The workers need the trace stopped
+    BenchmarkSystems(spriteCel, animSpriteCels, countMax, workersMax);
+
+    free(animSpriteCels);
+    SpriteCelCleanup(spriteCel);
+    return 0;
+}
@@ -0,0 +1,521 @@
+/******************************************************************************
+**
+**  AnimSpriteCelCompiler - Generates constant step tables (host tool)
+**
+**  Author: Christophe Geoffroy (Topper) - MIT License
+**  Last Updated: 2026-10-17
+**
+**  Build step, run on the development computer before compiling the game.
+**  It is built with any C compiler (it doesn't use the 3DO SDK):
+**
+**    cc -o AnimSpriteCelCompiler AnimSpriteCelCompiler.c
+**    AnimSpriteCelCompiler animations.txt animations.h
+**
+**  The input is a text file with one command per line:
+**
+**    # comment
+**    spritecel name framesCount
+**    animation name spritecel loop range iterations
+**    step frameIndex frameDuration [receiver] [event eventId]
+**
+**    - spritecel: declares a sprite sheet and its number of frames
+**    - loop: NORMAL, REVERSE or ALTERNATE
+**    - range: FULL, HALF or QUARTER
+**    - iterations: a number or INFINITE
+**    - the steps follow their animation, at least two per animation
+**    - receiver: label of the animation to trigger (declared before or after)
+**    - eventId: event sent to the system when an instance reaches the step
+**
+**  Every value is checked before anything is written: frame index below the
+**  frame count of the SpriteCel, duration from -32768 to 32767, known
+**  receiver label, event ID up to 65535. On error the line is reported and the program returns 1,
+**  which stops the build.
+**
+**  The generated header holds, for each animation "name":
+**
+**    NAME_INDEX            registration index in the system (receiver index)
+**    nameSteps[]           constant AnimSpriteCelPackedStep array
+**    nameFrames[]          frame descriptors shared by the instances
+**    nameTimeline[]        cumulative durations shared by the instances
+**    nameTable             AnimSpriteCelTable given to AnimSpriteCelTableInstance()
+**
+**  and NAME_FRAMES for each SpriteCel. The animations must be registered in
+**  the system first, in the order of the text.
+**
+******************************************************************************/
+
+// printf(), fopen()
+#include <stdio.h>
+// malloc(), realloc(), free(), strtol()
+#include <stdlib.h>
+// strcmp(), strtok(), strlen()
+#include <string.h>
+// isalpha(), isalnum(), toupper()
+#include <ctype.h>
+
+// Longest name
+#define COMPILER_NAME_SIZE 64
+// Values of AnimSpriteCel.h
+#define COMPILER_RECEIVER_NONE 0xFFFFUL
+#define COMPILER_EVENT_MAX 0xFFFFUL
+
+// Sprite sheet declared in the text
+typedef struct {
+    char name[COMPILER_NAME_SIZE];
+    unsigned long framesCount;
+} CompilerSpriteCel;
+
+// Step read from the text
+typedef struct {
+    unsigned long frameIndex;
+    long frameDuration;
+    // Receiver label (empty if none) and its resolved index
+    char receiver[COMPILER_NAME_SIZE];
+    unsigned long receiverIndex;
+    // Event ID (0 if none)
+    unsigned long eventId;
+    unsigned long lineNumber;
+} CompilerStep;
+
+// Animation read from the text
+typedef struct {
+    char name[COMPILER_NAME_SIZE];
+    CompilerSpriteCel *spriteCel;
+    const char *loop;
+    const char *range;
+    unsigned long iterations;
+    unsigned long stepsCount;
+    unsigned long stepsMax;
+    CompilerStep *steps;
+} CompilerAnimation;
+
+// Declarations read from the text
+static CompilerSpriteCel *compilerSpriteCels = NULL;
+static unsigned long compilerSpriteCelsCount = 0;
+static CompilerAnimation *compilerAnimations = NULL;
+static unsigned long compilerAnimationsCount = 0;
+
+// Reads an unsigned number, returns 0 if the token isn't one
+static int CompilerNumber(char *token, unsigned long *value) {
+
+    // End of the number
+    char *end = NULL;
+
+    // If the token is missing
+    if (token == NULL) {
+        return 0;
+    }
+
+    *value = (unsigned long)strtol(token, &end, 0);
+    return ((*end == '\0') && (token[0] != '-')) ? 1 : 0;
+}
+
+// Copies a C identifier, returns 0 if the token isn't one
+static int CompilerName(char *token, char *name) {
+
+    // Character index
+    size_t index = 0;
+
+    // If the token is missing, too long or doesn't start like an identifier
+    if ((token == NULL) || (strlen(token) >= COMPILER_NAME_SIZE) || ((isalpha((unsigned char)token[0]) == 0) && (token[0] != '_'))) {
+        return 0;
+    }
+
+    for (index = 0; token[index] != '\0'; index++) {
+        if ((isalnum((unsigned char)token[index]) == 0) && (token[index] != '_')) {
+            return 0;
+        }
+    }
+
+    strcpy(name, token);
+    return 1;
+}
+
+// Returns 1 if a SpriteCel or an animation already has the name
+static int CompilerNameUsed(const char *name) {
+
+    // Declaration index
+    unsigned long index = 0;
+
+    for (index = 0; index < compilerSpriteCelsCount; index++) {
+        if (strcmp(compilerSpriteCels[index].name, name) == 0) { return 1; }
+    }
+    for (index = 0; index < compilerAnimationsCount; index++) {
+        if (strcmp(compilerAnimations[index].name, name) == 0) { return 1; }
+    }
+    return 0;
+}
+
+// Writes a name in upper case, for the macros
+static void CompilerWriteUpper(FILE *output, const char *name) {
+
+    while (*name != '\0') {
+        fputc(toupper((unsigned char)*name), output);
+        name++;
+    }
+}
+
+// Reads the text description, returns 0 on error
+static int CompilerRead(FILE *input) {
+
+    // Line of the text
+    char line[256];
+    unsigned long lineNumber = 0;
+    // Token of the line
+    char *token = NULL;
+    // End of a signed number
+    char *end = NULL;
+    // Name read
+    char name[COMPILER_NAME_SIZE];
+    // Table sizes
+    unsigned long spriteCelsMax = 0;
+    unsigned long animationsMax = 0;
+    // Declaration index
+    unsigned long index = 0;
+    // Animation and step being read
+    CompilerAnimation *animation = NULL;
+    CompilerStep *step = NULL;
+
+    while (fgets(line, sizeof(line), input) != NULL) {
+
+        lineNumber++;
+        token = strtok(line, " \t\r\n");
+
+        // Empty line or comment
+        if ((token == NULL) || (token[0] == '#')) {
+            continue;
+        }
+
+        // New sprite sheet
+        if (strcmp(token, "spritecel") == 0) {
+
+            // Name
+            if ((CompilerName(strtok(NULL, " \t\r\n"), name) == 0) || (CompilerNameUsed(name) == 1)) {
+                printf("Error: line %lu: spritecel needs a new C identifier as name.\n", lineNumber);
+                return 0;
+            }
+
+            // Grow the table of sprite sheets
+            if (compilerSpriteCelsCount == spriteCelsMax) {
+                spriteCelsMax = (spriteCelsMax == 0) ? 16 : spriteCelsMax * 2;
+                compilerSpriteCels = (CompilerSpriteCel *)realloc(compilerSpriteCels, (size_t)spriteCelsMax * sizeof(CompilerSpriteCel));
+                if (compilerSpriteCels == NULL) {
+                    printf("Error: out of memory.\n");
+                    return 0;
+                }
+            }
+            strcpy(compilerSpriteCels[compilerSpriteCelsCount].name, name);
+
+            // Number of frames
+            if ((CompilerNumber(strtok(NULL, " \t\r\n"), &compilerSpriteCels[compilerSpriteCelsCount].framesCount) == 0) || (compilerSpriteCels[compilerSpriteCelsCount].framesCount == 0) || (compilerSpriteCels[compilerSpriteCelsCount].framesCount > 0x10000UL)) {
+                printf("Error: line %lu: spritecel needs 1 to 65536 frames.\n", lineNumber);
+                return 0;
+            }
+            compilerSpriteCelsCount++;
+            continue;
+        }
+
+        // New animation
+        if (strcmp(token, "animation") == 0) {
+
+            // Name
+            if ((CompilerName(strtok(NULL, " \t\r\n"), name) == 0) || (CompilerNameUsed(name) == 1)) {
+                printf("Error: line %lu: animation needs a new C identifier as name.\n", lineNumber);
+                return 0;
+            }
+
+            // Grow the table of animations
+            if (compilerAnimationsCount == animationsMax) {
+                animationsMax = (animationsMax == 0) ? 16 : animationsMax * 2;
+                compilerAnimations = (CompilerAnimation *)realloc(compilerAnimations, (size_t)animationsMax * sizeof(CompilerAnimation));
+                if (compilerAnimations == NULL) {
+                    printf("Error: out of memory.\n");
+                    return 0;
+                }
+            }
+            animation = &compilerAnimations[compilerAnimationsCount++];
+            memset(animation, 0, sizeof(CompilerAnimation));
+            strcpy(animation->name, name);
+
+            // Sprite sheet, declared before
+            token = strtok(NULL, " \t\r\n");
+            for (index = 0; (token != NULL) && (index < compilerSpriteCelsCount); index++) {
+                if (strcmp(compilerSpriteCels[index].name, token) == 0) {
+                    animation->spriteCel = &compilerSpriteCels[index];
+                }
+            }
+            if (animation->spriteCel == NULL) {
+                printf("Error: line %lu: animation needs a declared spritecel.\n", lineNumber);
+                return 0;
+            }
+
+            // Loop mode
+            token = strtok(NULL, " \t\r\n");
+            if ((token != NULL) && (strcmp(token, "NORMAL") == 0)) { animation->loop = "NORMAL"; }
+            else if ((token != NULL) && (strcmp(token, "REVERSE") == 0)) { animation->loop = "REVERSE"; }
+            else if ((token != NULL) && (strcmp(token, "ALTERNATE") == 0)) { animation->loop = "ALTERNATE"; }
+            else {
+                printf("Error: line %lu: loop must be NORMAL, REVERSE or ALTERNATE.\n", lineNumber);
+                return 0;
+            }
+
+            // Random range
+            token = strtok(NULL, " \t\r\n");
+            if ((token != NULL) && (strcmp(token, "FULL") == 0)) { animation->range = "FULL"; }
+            else if ((token != NULL) && (strcmp(token, "HALF") == 0)) { animation->range = "HALF"; }
+            else if ((token != NULL) && (strcmp(token, "QUARTER") == 0)) { animation->range = "QUARTER"; }
+            else {
+                printf("Error: line %lu: range must be FULL, HALF or QUARTER.\n", lineNumber);
+                return 0;
+            }
+
+            // Iterations (0 stands for INFINITE in the output)
+            token = strtok(NULL, " \t\r\n");
+            if ((token != NULL) && (strcmp(token, "INFINITE") == 0)) {
+                animation->iterations = 0;
+            } else if ((CompilerNumber(token, &animation->iterations) == 0) || (animation->iterations == 0) || (animation->iterations >= 2147483647UL)) {
+                printf("Error: line %lu: iterations must be a positive number or INFINITE.\n", lineNumber);
+                return 0;
+            }
+            continue;
+        }
+
+        // Step of the current animation
+        if (strcmp(token, "step") == 0) {
+
+            // If no animation is open
+            if (animation == NULL) {
+                printf("Error: line %lu: step before any animation.\n", lineNumber);
+                return 0;
+            }
+
+            // Grow the steps of the animation
+            if (animation->stepsCount == animation->stepsMax) {
+                animation->stepsMax = (animation->stepsMax == 0) ? 64 : animation->stepsMax * 2;
+                animation->steps = (CompilerStep *)realloc(animation->steps, (size_t)animation->stepsMax * sizeof(CompilerStep));
+                if (animation->steps == NULL) {
+                    printf("Error: out of memory.\n");
+                    return 0;
+                }
+            }
+            step = &animation->steps[animation->stepsCount++];
+            step->lineNumber = lineNumber;
+
+            // Frame, checked against the SpriteCel
+            if ((CompilerNumber(strtok(NULL, " \t\r\n"), &step->frameIndex) == 0) || (step->frameIndex >= animation->spriteCel->framesCount)) {
+                printf("Error: line %lu: frame index must be below %lu (frames of %s).\n", lineNumber, animation->spriteCel->framesCount, animation->spriteCel->name);
+                return 0;
+            }
+
+            // Duration
+            token = strtok(NULL, " \t\r\n");
+            step->frameDuration = (token != NULL) ? strtol(token, &end, 0) : 0;
+            if ((token == NULL) || (*end != '\0') || (step->frameDuration < -32768L) || (step->frameDuration > 32767L)) {
+                printf("Error: line %lu: duration must be from -32768 to 32767.\n", lineNumber);
+                return 0;
+            }
+
+            // Optional receiver, resolved once every animation is declared
+            token = strtok(NULL, " \t\r\n");
+            step->receiver[0] = '\0';
+            if ((token != NULL) && (strcmp(token, "event") != 0)) {
+                if (CompilerName(token, step->receiver) == 0) {
+                    printf("Error: line %lu: receiver must be an animation label.\n", lineNumber);
+                    return 0;
+                }
+                token = strtok(NULL, " \t\r\n");
+            }
+
+            // Optional event
+            step->eventId = 0;
+            if ((token != NULL) && ((strcmp(token, "event") != 0) || (CompilerNumber(strtok(NULL, " \t\r\n"), &step->eventId) == 0) || (step->eventId > COMPILER_EVENT_MAX))) {
+                printf("Error: line %lu: event ID must be from 0 to 65535.\n", lineNumber);
+                return 0;
+            }
+            continue;
+        }
+
+        // Unknown command
+        printf("Error: line %lu: unknown command %s.\n", lineNumber, token);
+        return 0;
+    }
+
+    // Return success
+    return 1;
+}
+
+// Checks the animations and resolves the receiver labels, returns 0 on error
+static int CompilerResolve(void) {
+
+    // Animation, step and receiver index
+    unsigned long animationIndex = 0;
+    unsigned long stepIndex = 0;
+    unsigned long receiverIndex = 0;
+    // Step being resolved
+    CompilerStep *step = NULL;
+
+    // If the receiver indexes don't fit in a packed step
+    if ((compilerAnimationsCount == 0) || (compilerAnimationsCount >= COMPILER_RECEIVER_NONE)) {
+        printf("Error: 1 to 65534 animations needed.\n");
+        return 0;
+    }
+
+    for (animationIndex = 0; animationIndex < compilerAnimationsCount; animationIndex++) {
+
+        // Each animation needs two steps
+        if (compilerAnimations[animationIndex].stepsCount < 2) {
+            printf("Error: animation %s needs at least two steps.\n", compilerAnimations[animationIndex].name);
+            return 0;
+        }
+
+        for (stepIndex = 0; stepIndex < compilerAnimations[animationIndex].stepsCount; stepIndex++) {
+
+            step = &compilerAnimations[animationIndex].steps[stepIndex];
+            step->receiverIndex = COMPILER_RECEIVER_NONE;
+
+            // Step without receiver
+            if (step->receiver[0] == '\0') {
+                continue;
+            }
+
+            // The receiver is the animation with that label
+            for (receiverIndex = 0; receiverIndex < compilerAnimationsCount; receiverIndex++) {
+                if (strcmp(compilerAnimations[receiverIndex].name, step->receiver) == 0) {
+                    step->receiverIndex = receiverIndex;
+                }
+            }
+
+            // If no animation has the label
+            if (step->receiverIndex == COMPILER_RECEIVER_NONE) {
+                printf("Error: line %lu: unknown receiver %s.\n", step->lineNumber, step->receiver);
+                return 0;
+            }
+        }
+    }
+
+    // Return success
+    return 1;
+}
+
+// Writes the generated header
+static void CompilerWrite(FILE *output, const char *inputName) {
+
+    // Declaration and step index
+    unsigned long index = 0;
+    unsigned long stepIndex = 0;
+    // Animation being written
+    CompilerAnimation *animation = NULL;
+    CompilerStep *step = NULL;
+
+    fprintf(output, "// Generated by AnimSpriteCelCompiler from %s: do not edit\n", inputName);
+    fprintf(output, "// Defines data: include it in a single C file\n\n");
+    fprintf(output, "// AnimSpriteCelTable, AnimSpriteCelPackedStep\n#include \"AnimSpriteCelTable.h\"\n");
+    fprintf(output, "// INFINITE\n#include \"DefinitionsArguments.h\"\n\n");
+
+    // Frames of each SpriteCel
+    fprintf(output, "// Frames of each SpriteCel\n");
+    for (index = 0; index < compilerSpriteCelsCount; index++) {
+        fprintf(output, "#define ");
+        CompilerWriteUpper(output, compilerSpriteCels[index].name);
+        fprintf(output, "_FRAMES %lu\n", compilerSpriteCels[index].framesCount);
+    }
+
+    // Registration index of each animation
+    fprintf(output, "\n// Registration index of each animation in the system\n");
+    for (index = 0; index < compilerAnimationsCount; index++) {
+        fprintf(output, "#define ");
+        CompilerWriteUpper(output, compilerAnimations[index].name);
+        fprintf(output, "_INDEX %lu\n", index);
+    }
+
+    // Steps, shared data and table of each animation
+    for (index = 0; index < compilerAnimationsCount; index++) {
+
+        animation = &compilerAnimations[index];
+
+        fprintf(output, "\n// %s: %lu steps of %s\n", animation->name, animation->stepsCount, animation->spriteCel->name);
+        fprintf(output, "static const AnimSpriteCelPackedStep %sSteps[%lu] = {\n", animation->name, animation->stepsCount);
+        for (stepIndex = 0; stepIndex < animation->stepsCount; stepIndex++) {
+            step = &animation->steps[stepIndex];
+            fprintf(output, "    { %lu, %ld, ", step->frameIndex, step->frameDuration);
+            if (step->receiverIndex == COMPILER_RECEIVER_NONE) {
+                fprintf(output, "ANIMSPRITECEL_RECEIVER_NONE");
+            } else {
+                CompilerWriteUpper(output, step->receiver);
+                fprintf(output, "_INDEX");
+            }
+            if (step->eventId == 0) {
+                fprintf(output, ", ANIMSPRITECEL_EVENT_NONE");
+            } else {
+                fprintf(output, ", %lu", step->eventId);
+            }
+            fprintf(output, " }%s\n", (stepIndex + 1 < animation->stepsCount) ? "," : "");
+        }
+        fprintf(output, "};\n");
+
+        // Shared frame descriptors and cumulative durations (up to 2 * stepsCount - 2 positions in ALTERNATE)
+        fprintf(output, "static AnimSpriteCelFrame %sFrames[", animation->name);
+        CompilerWriteUpper(output, animation->spriteCel->name);
+        fprintf(output, "_FRAMES];\n");
+        fprintf(output, "static uint32 %sTimeline[%lu];\n", animation->name, (2 * animation->stepsCount) - 1);
+
+        // Table
+        fprintf(output, "static AnimSpriteCelTable %sTable = { %sSteps, %lu, ", animation->name, animation->name, animation->stepsCount);
+        CompilerWriteUpper(output, animation->spriteCel->name);
+        fprintf(output, "_FRAMES, %s, %s, ", animation->loop, animation->range);
+        if (animation->iterations == 0) {
+            fprintf(output, "INFINITE");
+        } else {
+            fprintf(output, "%lu", animation->iterations);
+        }
+        fprintf(output, ", %sFrames, %sTimeline, NULL };\n", animation->name, animation->name);
+    }
+}
+
+int main(int argc, char *argv[]) {
+
+    // Files
+    FILE *input = NULL;
+    FILE *output = NULL;
+    // Animation index
+    unsigned long index = 0;
+    // Result of the reading
+    int read = 0;
+
+    // If the files are missing
+    if (argc != 3) {
+        printf("Usage: AnimSpriteCelCompiler input.txt output.h\n");
+        return 1;
+    }
+
+    // Read and check the text description
+    input = fopen(argv[1], "r");
+    if (input == NULL) {
+        printf("Error: can't open %s.\n", argv[1]);
+        return 1;
+    }
+    read = CompilerRead(input);
+    fclose(input);
+    if ((read == 0) || (CompilerResolve() == 0)) {
+        printf("Error: %s not written.\n", argv[2]);
+        return 1;
+    }
+
+    // Write the header only once everything is valid
+    output = fopen(argv[2], "w");
+    if (output == NULL) {
+        printf("Error: can't create %s.\n", argv[2]);
+        return 1;
+    }
+    CompilerWrite(output, argv[1]);
+    fclose(output);
+
+    printf("%lu animations written to %s.\n", compilerAnimationsCount, argv[2]);
+
+    for (index = 0; index < compilerAnimationsCount; index++) {
+        free(compilerAnimations[index].steps);
+    }
+    free(compilerAnimations);
+    free(compilerSpriteCels);
+    return 0;
+}
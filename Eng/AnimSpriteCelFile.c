@@ -0,0 +1,312 @@
+#include "AnimSpriteCelFile.h"
+
+// AllocMem(), FreeMem(), MEMTYPE_DRAM
+#include "mem.h"
+// CloneCel()
+#include "celutils.h"
+// LoadFile(), UnloadFile()
+#include "utils3do.h"
+// memset()
+#include "string.h"
+// printf()
+#include "stdio.h"
+
+// Checks the header and the sequence table of a loaded file
+static int32 AnimSpriteCelFileCheck(uint8 *buffer, int32 bufferSize) {
+
+    // Header of the file
+    AnimSpriteCelFileHeader *header = (AnimSpriteCelFileHeader *)buffer;
+    // Sequence table of the file
+    AnimSpriteCelFileSequence *sequences = (AnimSpriteCelFileSequence *)(header + 1);
+    // Sequence index
+    uint32 sequenceIndex = 0;
+
+    // If the file can't hold a header
+    if (bufferSize < (int32)sizeof(AnimSpriteCelFileHeader)) {
+        printf("Error: AnimSpriteCelFile too short.\n");
+        return -1;
+    }
+
+    // If the file is not an animation file
+    if (header->magic != ANIMSPRITECELFILE_MAGIC) {
+        // Written for a target of the other byte order
+        if (header->magic == 0x4D494E41) {
+            printf("Error: AnimSpriteCelFile written in the wrong byte order.\n");
+        } else {
+            printf("Error: Not an AnimSpriteCelFile.\n");
+        }
+        return -1;
+    }
+
+    // If the layout is not the one of this code
+    if (header->version != ANIMSPRITECELFILE_VERSION) {
+        printf("Error: AnimSpriteCelFile version %u unsupported (expected %u).\n", header->version, ANIMSPRITECELFILE_VERSION);
+        return -1;
+    }
+
+    // If the packed steps don't match the structure of the target
+    if (header->stepSize != sizeof(AnimSpriteCelPackedStep)) {
+        printf("Error: AnimSpriteCelFile steps of %u bytes (expected %u).\n", header->stepSize, (uint32)sizeof(AnimSpriteCelPackedStep));
+        return -1;
+    }
+
+    // If the sequence table is empty or doesn't fit in the file
+    if ((header->sequencesCount == 0) || (header->sequencesCount > ((uint32)bufferSize - sizeof(AnimSpriteCelFileHeader)) / sizeof(AnimSpriteCelFileSequence))) {
+        printf("Error: AnimSpriteCelFile sequence table invalid (%u sequences).\n", header->sequencesCount);
+        return -1;
+    }
+
+    // Check each sequence once, its steps are used as they are
+    for (sequenceIndex = 0; sequenceIndex < header->sequencesCount; sequenceIndex++) {
+
+        // If the steps are misplaced or don't fit in the file
+        if (((sequences[sequenceIndex].stepsOffset & 3) != 0) || (sequences[sequenceIndex].stepsOffset > (uint32)bufferSize) || (sequences[sequenceIndex].stepsCount < 2) || (sequences[sequenceIndex].stepsCount > ((uint32)bufferSize - sequences[sequenceIndex].stepsOffset) / sizeof(AnimSpriteCelPackedStep))) {
+            printf("Error: AnimSpriteCelFile sequence %u steps invalid.\n", sequenceIndex);
+            return -1;
+        }
+
+        // If the parameters are out of range
+        if ((sequences[sequenceIndex].framesCount == 0) || (sequences[sequenceIndex].framesCount > 0x10000) || (sequences[sequenceIndex].loop > ALTERNATE) || (sequences[sequenceIndex].range > QUARTER)) {
+            printf("Error: AnimSpriteCelFile sequence %u parameters invalid.\n", sequenceIndex);
+            return -1;
+        }
+    }
+
+    // Return success
+    return 1;
+}
+
+// Loads an animation file
+AnimSpriteCelFile *AnimSpriteCelFileLoad(char *fileName) {
+
+    // AnimSpriteCelFile instance
+    AnimSpriteCelFile *animSpriteCelFile = NULL;
+    // Loaded file
+    uint8 *buffer = NULL;
+    int32 bufferSize = 0;
+    // Number of sequences
+    uint32 sequencesCount = 0;
+
+    // Read the whole file in one block
+    buffer = (uint8 *)LoadFile(fileName, &bufferSize, MEMTYPE_DRAM);
+    // If loading fails
+    if (buffer == NULL) {
+        // Display error message
+        printf("Error: Failed to load AnimSpriteCelFile %s.\n", fileName);
+        return NULL;
+    }
+
+    // If the header or the sequence table is invalid
+    if (AnimSpriteCelFileCheck(buffer, bufferSize) < 0) {
+        // Unload the file
+        UnloadFile(buffer);
+        // Display error message
+        printf("Error <- AnimSpriteCelFileCheck(%s)\n", fileName);
+        return NULL;
+    }
+    sequencesCount = ((AnimSpriteCelFileHeader *)buffer)->sequencesCount;
+
+    // Allocate memory for AnimSpriteCelFile
+    animSpriteCelFile = (AnimSpriteCelFile *)AllocMem(sizeof(AnimSpriteCelFile), MEMTYPE_DRAM);
+    // If allocation fails
+    if (animSpriteCelFile == NULL) {
+        // Unload the file
+        UnloadFile(buffer);
+        // Display error message
+        printf("Error: Failed to allocate memory for AnimSpriteCelFile.\n");
+        return NULL;
+    }
+
+    // Allocate the shared data of the sequences
+    animSpriteCelFile->spriteCels = (SpriteCel **)AllocMem(sequencesCount * sizeof(SpriteCel *), MEMTYPE_DRAM);
+    animSpriteCelFile->frames = (AnimSpriteCelFrame **)AllocMem(sequencesCount * sizeof(AnimSpriteCelFrame *), MEMTYPE_DRAM);
+    animSpriteCelFile->timelines = (uint32 **)AllocMem(sequencesCount * sizeof(uint32 *), MEMTYPE_DRAM);
+    // If an allocation fails
+    if ((animSpriteCelFile->spriteCels == NULL) || (animSpriteCelFile->frames == NULL) || (animSpriteCelFile->timelines == NULL)) {
+        // Free the allocated tables, the AnimSpriteCelFile and the file
+        if (animSpriteCelFile->spriteCels != NULL) { FreeMem(animSpriteCelFile->spriteCels, sequencesCount * sizeof(SpriteCel *)); }
+        if (animSpriteCelFile->frames != NULL) { FreeMem(animSpriteCelFile->frames, sequencesCount * sizeof(AnimSpriteCelFrame *)); }
+        if (animSpriteCelFile->timelines != NULL) { FreeMem(animSpriteCelFile->timelines, sequencesCount * sizeof(uint32 *)); }
+        FreeMem(animSpriteCelFile, sizeof(AnimSpriteCelFile));
+        UnloadFile(buffer);
+        // Display error message
+        printf("Error: Failed to allocate memory for AnimSpriteCelFile sequences.\n");
+        return NULL;
+    }
+
+    // No sequence has an instance yet
+    memset(animSpriteCelFile->spriteCels, 0, (size_t)sequencesCount * sizeof(SpriteCel *));
+    memset(animSpriteCelFile->frames, 0, (size_t)sequencesCount * sizeof(AnimSpriteCelFrame *));
+    memset(animSpriteCelFile->timelines, 0, (size_t)sequencesCount * sizeof(uint32 *));
+
+    // The header and the sequences are read in place
+    animSpriteCelFile->buffer = buffer;
+    animSpriteCelFile->bufferSize = bufferSize;
+    animSpriteCelFile->header = (AnimSpriteCelFileHeader *)buffer;
+    animSpriteCelFile->sequences = (AnimSpriteCelFileSequence *)(animSpriteCelFile->header + 1);
+    // Reference of the caller
+    animSpriteCelFile->referencesCount = 1;
+
+    // Return the newly loaded AnimSpriteCelFile
+    return animSpriteCelFile;
+}
+
+// Drops the reference of an instance from AnimSpriteCelCleanup()
+static int32 AnimSpriteCelFileInstanceRelease(AnimSpriteCel *animSpriteCel) {
+
+    // Drop the reference instead of freeing the shared steps
+    AnimSpriteCelFileCleanup(animSpriteCel->file);
+    animSpriteCel->file = NULL;
+    animSpriteCel->packedSteps = NULL;
+    animSpriteCel->frames = NULL;
+    animSpriteCel->timeline = NULL;
+
+    // Return success
+    return 1;
+}
+
+// Creates an AnimSpriteCel playing a sequence of the file
+AnimSpriteCel *AnimSpriteCelFileInstance(AnimSpriteCelFile *animSpriteCelFile, uint32 sequenceIndex, SpriteCel *spriteCel, int32 direction, uint32 stepIndex) {
+
+    // AnimSpriteCel instance
+    AnimSpriteCel *animSpriteCel = NULL;
+    // Sequence played
+    AnimSpriteCelFileSequence *sequence = NULL;
+
+    // If the AnimSpriteCelFile is undefined
+    if (animSpriteCelFile == NULL) {
+        // Display error message
+        printf("Error: AnimSpriteCelFile unknown.\n");
+        return NULL;
+    }
+
+    // If the sequence doesn't exist
+    if (sequenceIndex >= animSpriteCelFile->header->sequencesCount) {
+        // Display error message
+        printf("Error: AnimSpriteCelFile sequence %u out of bounds (%u sequences).\n", sequenceIndex, animSpriteCelFile->header->sequencesCount);
+        return NULL;
+    }
+
+    // If the sprite sheet doesn't exist
+    if (spriteCel == NULL) {
+        // Display error message
+        printf("Error: SpriteCel unknown.\n");
+        return NULL;
+    }
+
+    // If the sequence already plays another sprite sheet
+    if ((animSpriteCelFile->spriteCels[sequenceIndex] != NULL) && (animSpriteCelFile->spriteCels[sequenceIndex] != spriteCel)) {
+        // Display error message
+        printf("Error: AnimSpriteCelFile sequence %u already uses another SpriteCel.\n", sequenceIndex);
+        return NULL;
+    }
+
+    sequence = &animSpriteCelFile->sequences[sequenceIndex];
+
+    // On the first instance, make the shared data of the sequence
+    if (animSpriteCelFile->spriteCels[sequenceIndex] == NULL) {
+
+        // Allocate the frame descriptors and the cumulative durations (up to 2 * stepsCount - 2 positions in ALTERNATE)
+        animSpriteCelFile->frames[sequenceIndex] = (AnimSpriteCelFrame *)AllocMem(sequence->framesCount * sizeof(AnimSpriteCelFrame), MEMTYPE_DRAM);
+        animSpriteCelFile->timelines[sequenceIndex] = (uint32 *)AllocMem(((2 * sequence->stepsCount) - 1) * sizeof(uint32), MEMTYPE_DRAM);
+        // If an allocation fails
+        if ((animSpriteCelFile->frames[sequenceIndex] == NULL) || (animSpriteCelFile->timelines[sequenceIndex] == NULL)) {
+            // Free the allocated data
+            if (animSpriteCelFile->frames[sequenceIndex] != NULL) { FreeMem(animSpriteCelFile->frames[sequenceIndex], sequence->framesCount * sizeof(AnimSpriteCelFrame)); }
+            if (animSpriteCelFile->timelines[sequenceIndex] != NULL) { FreeMem(animSpriteCelFile->timelines[sequenceIndex], ((2 * sequence->stepsCount) - 1) * sizeof(uint32)); }
+            animSpriteCelFile->frames[sequenceIndex] = NULL;
+            animSpriteCelFile->timelines[sequenceIndex] = NULL;
+            // Display error message
+            printf("Error: Failed to allocate memory for AnimSpriteCelFile sequence %u.\n", sequenceIndex);
+            return NULL;
+        }
+
+        // Resolve the descriptor of each frame once for all the instances
+        AnimSpriteCelFramesResolve(spriteCel, animSpriteCelFile->frames[sequenceIndex], sequence->framesCount);
+        animSpriteCelFile->spriteCels[sequenceIndex] = spriteCel;
+    }
+
+    // Allocate memory for AnimSpriteCel (the steps, the frames and the timeline are shared)
+    animSpriteCel = (AnimSpriteCel *)AllocMem(sizeof(AnimSpriteCel), MEMTYPE_DRAM);
+    // If allocation fails
+    if (animSpriteCel == NULL) {
+        // Display error message
+        printf("Error: Failed to allocate memory for AnimSpriteCel.\n");
+        return NULL;
+    }
+
+    // Not taken from a pool, packed steps in the file
+    animSpriteCel->pool = NULL;
+    animSpriteCel->sequence = NULL;
+    animSpriteCel->file = animSpriteCelFile;
+    animSpriteCel->table = NULL;
+    animSpriteCel->release = AnimSpriteCelFileInstanceRelease;
+    animSpriteCel->steps = NULL;
+    animSpriteCel->packedSteps = (AnimSpriteCelPackedStep *)(animSpriteCelFile->buffer + sequence->stepsOffset);
+    animSpriteCel->frames = animSpriteCelFile->frames[sequenceIndex];
+    animSpriteCel->framesCount = sequence->framesCount;
+    animSpriteCel->timeline = animSpriteCelFile->timelines[sequenceIndex];
+
+    // Clone the SpriteCel CCB (Command Control Block)
+    animSpriteCel->cel = CloneCel(spriteCel->cel, CLONECEL_CCB_ONLY);
+
+    // Initialize the playhead, the steps are left untouched
+    AnimSpriteCelSetup(animSpriteCel, spriteCel, (AnimSpriteCelLoop)sequence->loop, (AnimSpriteCelRange)sequence->range, sequence->iterations, direction, stepIndex, sequence->stepsCount);
+    // Display the starting step
+    AnimSpriteCelUpdate(animSpriteCel);
+
+    // Reference of the instance
+    animSpriteCelFile->referencesCount++;
+
+    // Return the newly created AnimSpriteCel
+    return animSpriteCel;
+}
+
+// Drops a reference to the AnimSpriteCelFile
+int32 AnimSpriteCelFileCleanup(AnimSpriteCelFile *animSpriteCelFile) {
+
+    // Sequence index
+    uint32 sequenceIndex = 0;
+    // Number of sequences
+    uint32 sequencesCount = 0;
+
+    // If the AnimSpriteCelFile is undefined
+    if (animSpriteCelFile == NULL) {
+        printf("Error: AnimSpriteCelFile unknown.\n");
+        return -1;
+    }
+
+    // Drop the reference
+    animSpriteCelFile->referencesCount--;
+
+    // If instances still play the file
+    if (animSpriteCelFile->referencesCount > 0) {
+        // Keep it
+        return 1;
+    }
+
+    sequencesCount = animSpriteCelFile->header->sequencesCount;
+
+    // Free the shared data of the sequences that had instances
+    for (sequenceIndex = 0; sequenceIndex < sequencesCount; sequenceIndex++) {
+        if (animSpriteCelFile->spriteCels[sequenceIndex] != NULL) {
+            FreeMem(animSpriteCelFile->frames[sequenceIndex], animSpriteCelFile->sequences[sequenceIndex].framesCount * sizeof(AnimSpriteCelFrame));
+            FreeMem(animSpriteCelFile->timelines[sequenceIndex], ((2 * animSpriteCelFile->sequences[sequenceIndex].stepsCount) - 1) * sizeof(uint32));
+        }
+    }
+
+    // Free the tables of the sequences
+    FreeMem(animSpriteCelFile->spriteCels, sequencesCount * sizeof(SpriteCel *));
+    FreeMem(animSpriteCelFile->frames, sequencesCount * sizeof(AnimSpriteCelFrame *));
+    FreeMem(animSpriteCelFile->timelines, sequencesCount * sizeof(uint32 *));
+
+    // Unload the file
+    UnloadFile(animSpriteCelFile->buffer);
+    animSpriteCelFile->buffer = NULL;
+
+    // Free the AnimSpriteCelFile structure itself
+    FreeMem(animSpriteCelFile, sizeof(AnimSpriteCelFile));
+
+    // Return success
+    return 1;
+}
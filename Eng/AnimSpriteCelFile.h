@@ -0,0 +1,149 @@
+#ifndef ANIMSPRITECELFILE_H
+#define ANIMSPRITECELFILE_H
+
+/******************************************************************************
+**
+**  AnimSpriteCelFile - Binary animation files (3DO Cel Engine)
+**
+**  Author: Christophe Geoffroy (Topper) - MIT License
+**  Last Updated: 2026-10-17
+**
+**  Steps configured with AnimSpriteCelStepsConfiguration() are written in the
+**  C code and rebuilt on every boot, one call per step. An ".anim" file holds
+**  ready-made sequences instead: loop mode, random range, iterations, SpriteCel
+**  reference and packed steps ("AnimSpriteCelPackedStep"), in the memory
+**  layout of the target.
+**
+**  AnimSpriteCelFileLoad() reads the file into memory in one block and checks
+**  the header and the sequence table. AnimSpriteCelFileInstance() creates an
+**  AnimSpriteCel whose packed steps point straight into the loaded bytes: no
+**  step is parsed or copied, so loading a level costs the same whatever the
+**  number of steps.
+**
+**  The files are written offline by AnimSpriteCelFileTool (host program, see
+**  AnimSpriteCelFileTool.c) from a text description.
+**
+**  File layout (byte order and step size of the target):
+**
+**    AnimSpriteCelFileHeader
+**    AnimSpriteCelFileSequence[sequencesCount]
+**    packed steps of each sequence, each array aligned on 4 bytes
+**
+**  Important Notes:
+**
+**    - The steps of a file are read-only: AnimSpriteCelPackedStepConfiguration()
+**      and AnimSpriteCelStepEvent() are refused on an instance.
+**
+**    - The event ID of a step takes the 2 bytes of padding the ARM compiler
+**      left after the receiver index: the files written before the events
+**      keep version 1 and send no event.
+**
+**    - The frame descriptors and the timeline of a sequence are made once, at
+**      its first instance, and shared by the next ones. All the instances of a
+**      sequence must therefore use the same SpriteCel.
+**
+**    - The frame indexes of the steps are checked by the tool, not at load
+**      time. Only files written by the tool should be loaded.
+**
+**    - The file is reference counted: the caller holds one reference, each
+**      instance holds one more. AnimSpriteCelFileCleanup() and the cleanup of
+**      an instance drop a reference, the file is unloaded with the last one.
+**
+**  Structure Roles:
+**
+**    AnimSpriteCelFileHeader
+**      - magic: ANIMSPRITECELFILE_MAGIC ("ANIM" in the byte order of the target)
+**      - version: ANIMSPRITECELFILE_VERSION
+**      - stepSize: size of a packed step on the target
+**      - sequencesCount: number of sequences
+**
+**    AnimSpriteCelFileSequence
+**      - stepsOffset: position of the packed steps from the start of the file
+**      - stepsCount: number of steps
+**      - framesCount: number of SpriteCel frames the steps may display
+**      - spriteCelIndex: SpriteCel of the sequence, numbered by the game
+**      - loop, range, iterations: as given to AnimSpriteCelInitialization()
+**
+**    AnimSpriteCelFile
+**      - buffer, bufferSize: loaded file
+**      - header, sequences: header and sequence table in the buffer
+**      - spriteCels, frames, timelines: shared data of each sequence, made at
+**        its first instance
+**      - referencesCount: caller reference plus one per instance
+**
+**  Main Functions:
+**
+**    AnimSpriteCelFileLoad()
+**      -> Loads an ".anim" file and checks its header and sequences.
+**
+**    AnimSpriteCelFileInstance()
+**      -> Creates an AnimSpriteCel playing a sequence of the file.
+**
+**    AnimSpriteCelFileCleanup()
+**      -> Drops a reference, unloads the file with the last one.
+**
+******************************************************************************/
+
+// int32
+#include "types.h"
+// AnimSpriteCel
+#include "AnimSpriteCel.h"
+
+// "ANIM"
+#define ANIMSPRITECELFILE_MAGIC 0x414E494D
+// Version of the file layout
+#define ANIMSPRITECELFILE_VERSION 1
+
+typedef struct {
+    // "ANIM"
+    uint32 magic;
+    // Version of the file layout
+    uint32 version;
+    // Size of a packed step on the target
+    uint32 stepSize;
+    // Number of sequences
+    uint32 sequencesCount;
+} AnimSpriteCelFileHeader;
+
+typedef struct {
+    // Position of the packed steps from the start of the file
+    uint32 stepsOffset;
+    // Number of steps
+    uint32 stepsCount;
+    // Number of SpriteCel frames
+    uint32 framesCount;
+    // SpriteCel of the sequence
+    uint32 spriteCelIndex;
+    // Loop mode
+    uint32 loop;
+    // Random duration range
+    uint32 range;
+    // Number of cycle repetitions
+    uint32 iterations;
+} AnimSpriteCelFileSequence;
+
+struct AnimSpriteCelFile {
+    // Loaded file
+    uint8 *buffer;
+    int32 bufferSize;
+    // Header and sequence table in the buffer
+    AnimSpriteCelFileHeader *header;
+    AnimSpriteCelFileSequence *sequences;
+    // SpriteCel of each sequence (NULL until its first instance)
+    SpriteCel **spriteCels;
+    // Frame descriptors of each sequence
+    AnimSpriteCelFrame **frames;
+    // Cumulative durations of each sequence
+    uint32 **timelines;
+    // Caller reference plus one per instance
+    uint32 referencesCount;
+};
+
+// Loads an animation file
+AnimSpriteCelFile *AnimSpriteCelFileLoad(char *fileName);
+// Creates an AnimSpriteCel playing a sequence of the file
+AnimSpriteCel *AnimSpriteCelFileInstance(AnimSpriteCelFile *animSpriteCelFile, uint32 sequenceIndex, SpriteCel *spriteCel, int32 direction, uint32 stepIndex);
+// Drops a reference to the AnimSpriteCelFile
+int32 AnimSpriteCelFileCleanup(AnimSpriteCelFile *animSpriteCelFile);
+
+#endif // ANIMSPRITECELFILE_H
@@ -0,0 +1,369 @@
+/******************************************************************************
+**
+**  AnimSpriteCelFileTool - Writes ".anim" files for AnimSpriteCelFile (host tool)
+**
+**  Author: Christophe Geoffroy (Topper) - MIT License
+**  Last Updated: 2026-10-17
+**
+**  Offline program, built and run on the development computer with any C
+**  compiler (it doesn't use the 3DO SDK):
+**
+**    cc -o AnimSpriteCelFileTool AnimSpriteCelFileTool.c
+**    AnimSpriteCelFileTool [-little] input.txt output.anim
+**
+**  The input is a text file with one command per line:
+**
+**    # comment
+**    sequence spriteCelIndex framesCount loop range iterations
+**    step frameIndex frameDuration [receiverIndex] [event eventId]
+**
+**    - loop: NORMAL, REVERSE or ALTERNATE
+**    - range: FULL, HALF or QUARTER
+**    - iterations: a number or INFINITE
+**    - the steps follow their sequence, at least two per sequence
+**    - receiverIndex: registration index of the receiver in the system
+**      (none if omitted)
+**    - eventId: event sent to the system when an instance reaches the step
+**      (none if omitted or 0)
+**
+**  Every value is checked against the packed step layout (frame index below
+**  framesCount, duration from -32768 to 32767, receiver index below 65535,
+**  event ID up to 65535), so the loader only checks the header and the
+**  sequence table.
+**
+**  The file is written for the 3DO by default: big-endian, packed steps of
+**  8 bytes. "-little" writes it for a little-endian host.
+**  The layout must match AnimSpriteCelFile.h.
+**
+******************************************************************************/
+
+// printf(), fopen()
+#include <stdio.h>
+// malloc(), realloc(), free(), strtol()
+#include <stdlib.h>
+// strcmp(), strtok()
+#include <string.h>
+
+// Values of AnimSpriteCelFile.h, AnimSpriteCel.h and DefinitionsArguments.h
+#define TOOL_MAGIC 0x414E494DUL
+#define TOOL_VERSION 1UL
+#define TOOL_HEADER_SIZE 16UL
+#define TOOL_SEQUENCE_SIZE 28UL
+#define TOOL_STEP_SIZE 8UL
+#define TOOL_RECEIVER_NONE 0xFFFFUL
+#define TOOL_EVENT_MAX 0xFFFFUL
+#define TOOL_INFINITE 2147483647UL
+
+// Step read from the text
+typedef struct {
+    unsigned long frameIndex;
+    long frameDuration;
+    unsigned long receiverIndex;
+    unsigned long eventId;
+} ToolStep;
+
+// Sequence read from the text
+typedef struct {
+    unsigned long spriteCelIndex;
+    unsigned long framesCount;
+    unsigned long loop;
+    unsigned long range;
+    unsigned long iterations;
+    unsigned long stepsCount;
+    unsigned long stepsMax;
+    unsigned long stepsOffset;
+    ToolStep *steps;
+} ToolSequence;
+
+// Byte order of the target
+static int toolLittleEndian = 0;
+
+// Writes a 32-bit value in the byte order of the target
+static void ToolWrite32(FILE *file, unsigned long value) {
+
+    // If the target is little-endian
+    if (toolLittleEndian == 1) {
+        fputc((int)(value & 0xFF), file);
+        fputc((int)((value >> 8) & 0xFF), file);
+        fputc((int)((value >> 16) & 0xFF), file);
+        fputc((int)((value >> 24) & 0xFF), file);
+    } else {
+        fputc((int)((value >> 24) & 0xFF), file);
+        fputc((int)((value >> 16) & 0xFF), file);
+        fputc((int)((value >> 8) & 0xFF), file);
+        fputc((int)(value & 0xFF), file);
+    }
+}
+
+// Writes a 16-bit value in the byte order of the target
+static void ToolWrite16(FILE *file, unsigned long value) {
+
+    // If the target is little-endian
+    if (toolLittleEndian == 1) {
+        fputc((int)(value & 0xFF), file);
+        fputc((int)((value >> 8) & 0xFF), file);
+    } else {
+        fputc((int)((value >> 8) & 0xFF), file);
+        fputc((int)(value & 0xFF), file);
+    }
+}
+
+// Reads an unsigned number, returns 0 if the token isn't one
+static int ToolNumber(char *token, unsigned long *value) {
+
+    // End of the number
+    char *end = NULL;
+
+    // If the token is missing
+    if (token == NULL) {
+        return 0;
+    }
+
+    *value = (unsigned long)strtol(token, &end, 0);
+    return ((*end == '\0') && (token[0] != '-')) ? 1 : 0;
+}
+
+// Reads the text description, returns the number of sequences (-1 on error)
+static long ToolRead(FILE *input, ToolSequence **sequences) {
+
+    // Line of the text
+    char line[256];
+    unsigned long lineNumber = 0;
+    // Token of the line
+    char *token = NULL;
+    // End of a signed number
+    char *end = NULL;
+    // Sequences read
+    long sequencesCount = 0;
+    long sequencesMax = 0;
+    // Sequence and step being read
+    ToolSequence *sequence = NULL;
+    ToolStep *step = NULL;
+
+    *sequences = NULL;
+
+    while (fgets(line, sizeof(line), input) != NULL) {
+
+        lineNumber++;
+        token = strtok(line, " \t\r\n");
+
+        // Empty line or comment
+        if ((token == NULL) || (token[0] == '#')) {
+            continue;
+        }
+
+        // New sequence
+        if (strcmp(token, "sequence") == 0) {
+
+            // Grow the table of sequences
+            if (sequencesCount == sequencesMax) {
+                sequencesMax = (sequencesMax == 0) ? 16 : sequencesMax * 2;
+                *sequences = (ToolSequence *)realloc(*sequences, (size_t)sequencesMax * sizeof(ToolSequence));
+                if (*sequences == NULL) {
+                    printf("Error: out of memory.\n");
+                    return -1;
+                }
+            }
+            sequence = &(*sequences)[sequencesCount++];
+            memset(sequence, 0, sizeof(ToolSequence));
+
+            // SpriteCel and number of frames
+            if ((ToolNumber(strtok(NULL, " \t\r\n"), &sequence->spriteCelIndex) == 0) || (ToolNumber(strtok(NULL, " \t\r\n"), &sequence->framesCount) == 0) || (sequence->framesCount == 0) || (sequence->framesCount > 0x10000UL)) {
+                printf("Error: line %lu: sequence needs a SpriteCel index and 1 to 65536 frames.\n", lineNumber);
+                return -1;
+            }
+
+            // Loop mode
+            token = strtok(NULL, " \t\r\n");
+            if ((token != NULL) && (strcmp(token, "NORMAL") == 0)) { sequence->loop = 0; }
+            else if ((token != NULL) && (strcmp(token, "REVERSE") == 0)) { sequence->loop = 1; }
+            else if ((token != NULL) && (strcmp(token, "ALTERNATE") == 0)) { sequence->loop = 2; }
+            else {
+                printf("Error: line %lu: loop must be NORMAL, REVERSE or ALTERNATE.\n", lineNumber);
+                return -1;
+            }
+
+            // Random range
+            token = strtok(NULL, " \t\r\n");
+            if ((token != NULL) && (strcmp(token, "FULL") == 0)) { sequence->range = 0; }
+            else if ((token != NULL) && (strcmp(token, "HALF") == 0)) { sequence->range = 1; }
+            else if ((token != NULL) && (strcmp(token, "QUARTER") == 0)) { sequence->range = 2; }
+            else {
+                printf("Error: line %lu: range must be FULL, HALF or QUARTER.\n", lineNumber);
+                return -1;
+            }
+
+            // Iterations
+            token = strtok(NULL, " \t\r\n");
+            if ((token != NULL) && (strcmp(token, "INFINITE") == 0)) {
+                sequence->iterations = TOOL_INFINITE;
+            } else if (ToolNumber(token, &sequence->iterations) == 0) {
+                printf("Error: line %lu: iterations must be a number or INFINITE.\n", lineNumber);
+                return -1;
+            }
+            continue;
+        }
+
+        // Step of the current sequence
+        if (strcmp(token, "step") == 0) {
+
+            // If no sequence is open
+            if (sequence == NULL) {
+                printf("Error: line %lu: step before any sequence.\n", lineNumber);
+                return -1;
+            }
+
+            // Grow the steps of the sequence
+            if (sequence->stepsCount == sequence->stepsMax) {
+                sequence->stepsMax = (sequence->stepsMax == 0) ? 64 : sequence->stepsMax * 2;
+                sequence->steps = (ToolStep *)realloc(sequence->steps, (size_t)sequence->stepsMax * sizeof(ToolStep));
+                if (sequence->steps == NULL) {
+                    printf("Error: out of memory.\n");
+                    return -1;
+                }
+            }
+            step = &sequence->steps[sequence->stepsCount++];
+
+            // Frame
+            if ((ToolNumber(strtok(NULL, " \t\r\n"), &step->frameIndex) == 0) || (step->frameIndex >= sequence->framesCount)) {
+                printf("Error: line %lu: frame index must be below %lu.\n", lineNumber, sequence->framesCount);
+                return -1;
+            }
+
+            // Duration
+            token = strtok(NULL, " \t\r\n");
+            step->frameDuration = (token != NULL) ? strtol(token, &end, 0) : 0;
+            if ((token == NULL) || (*end != '\0') || (step->frameDuration < -32768L) || (step->frameDuration > 32767L)) {
+                printf("Error: line %lu: duration must be from -32768 to 32767.\n", lineNumber);
+                return -1;
+            }
+
+            // Optional receiver
+            token = strtok(NULL, " \t\r\n");
+            step->receiverIndex = TOOL_RECEIVER_NONE;
+            if ((token != NULL) && (strcmp(token, "event") != 0)) {
+                if ((ToolNumber(token, &step->receiverIndex) == 0) || (step->receiverIndex >= TOOL_RECEIVER_NONE)) {
+                    printf("Error: line %lu: receiver index must be below 65535.\n", lineNumber);
+                    return -1;
+                }
+                token = strtok(NULL, " \t\r\n");
+            }
+
+            // Optional event
+            step->eventId = 0;
+            if ((token != NULL) && ((strcmp(token, "event") != 0) || (ToolNumber(strtok(NULL, " \t\r\n"), &step->eventId) == 0) || (step->eventId > TOOL_EVENT_MAX))) {
+                printf("Error: line %lu: event ID must be from 0 to 65535.\n", lineNumber);
+                return -1;
+            }
+            continue;
+        }
+
+        // Unknown command
+        printf("Error: line %lu: unknown command %s.\n", lineNumber, token);
+        return -1;
+    }
+
+    // Return the number of sequences
+    return sequencesCount;
+}
+
+int main(int argc, char *argv[]) {
+
+    // Argument index
+    int argumentIndex = 1;
+    // Files
+    FILE *input = NULL;
+    FILE *output = NULL;
+    // Sequences read
+    ToolSequence *sequences = NULL;
+    long sequencesCount = 0;
+    // Sequence and step index
+    long sequenceIndex = 0;
+    unsigned long stepIndex = 0;
+    // Position in the file
+    unsigned long offset = 0;
+
+    // Options
+    while ((argumentIndex < argc) && (argv[argumentIndex][0] == '-')) {
+        if (strcmp(argv[argumentIndex], "-little") == 0) {
+            toolLittleEndian = 1;
+        } else {
+            break;
+        }
+        argumentIndex++;
+    }
+
+    // If the files are missing
+    if (argc - argumentIndex != 2) {
+        printf("Usage: AnimSpriteCelFileTool [-little] input.txt output.anim\n");
+        return 1;
+    }
+
+    // Read the text description
+    input = fopen(argv[argumentIndex], "r");
+    if (input == NULL) {
+        printf("Error: can't open %s.\n", argv[argumentIndex]);
+        return 1;
+    }
+    sequencesCount = ToolRead(input, &sequences);
+    fclose(input);
+    if (sequencesCount <= 0) {
+        printf("Error: no sequence written.\n");
+        return 1;
+    }
+
+    // Each sequence needs two steps
+    for (sequenceIndex = 0; sequenceIndex < sequencesCount; sequenceIndex++) {
+        if (sequences[sequenceIndex].stepsCount < 2) {
+            printf("Error: sequence %ld needs at least two steps.\n", sequenceIndex);
+            return 1;
+        }
+    }
+
+    // Place the steps after the sequence table (8-byte steps keep each array on 4 bytes)
+    offset = TOOL_HEADER_SIZE + ((unsigned long)sequencesCount * TOOL_SEQUENCE_SIZE);
+    for (sequenceIndex = 0; sequenceIndex < sequencesCount; sequenceIndex++) {
+        sequences[sequenceIndex].stepsOffset = offset;
+        offset += sequences[sequenceIndex].stepsCount * TOOL_STEP_SIZE;
+    }
+
+    output = fopen(argv[argumentIndex + 1], "wb");
+    if (output == NULL) {
+        printf("Error: can't create %s.\n", argv[argumentIndex + 1]);
+        return 1;
+    }
+
+    // Header
+    ToolWrite32(output, TOOL_MAGIC);
+    ToolWrite32(output, TOOL_VERSION);
+    ToolWrite32(output, TOOL_STEP_SIZE);
+    ToolWrite32(output, (unsigned long)sequencesCount);
+
+    // Sequence table
+    for (sequenceIndex = 0; sequenceIndex < sequencesCount; sequenceIndex++) {
+        ToolWrite32(output, sequences[sequenceIndex].stepsOffset);
+        ToolWrite32(output, sequences[sequenceIndex].stepsCount);
+        ToolWrite32(output, sequences[sequenceIndex].framesCount);
+        ToolWrite32(output, sequences[sequenceIndex].spriteCelIndex);
+        ToolWrite32(output, sequences[sequenceIndex].loop);
+        ToolWrite32(output, sequences[sequenceIndex].range);
+        ToolWrite32(output, sequences[sequenceIndex].iterations);
+    }
+
+    // Packed steps, as AnimSpriteCelPackedStep
+    for (sequenceIndex = 0; sequenceIndex < sequencesCount; sequenceIndex++) {
+        for (stepIndex = 0; stepIndex < sequences[sequenceIndex].stepsCount; stepIndex++) {
+            ToolWrite16(output, sequences[sequenceIndex].steps[stepIndex].frameIndex);
+            ToolWrite16(output, (unsigned long)sequences[sequenceIndex].steps[stepIndex].frameDuration & 0xFFFFUL);
+            ToolWrite16(output, sequences[sequenceIndex].steps[stepIndex].receiverIndex);
+            ToolWrite16(output, sequences[sequenceIndex].steps[stepIndex].eventId);
+        }
+        free(sequences[sequenceIndex].steps);
+    }
+
+    fclose(output);
+    free(sequences);
+
+    printf("%ld sequences written to %s (%lu bytes).\n", sequencesCount, argv[argumentIndex + 1], offset);
+    return 0;
+}
@@ -0,0 +1,604 @@
+#include "AnimSpriteCelGraph.h"
+
+// AllocMem(), FreeMem(), MEMTYPE_DRAM
+#include "mem.h"
+// printf()
+#include "stdio.h"
+
+// AnimSpriteCel on the stack of the cycle search (working flag)
+#define ANIMSPRITECELGRAPH_STACKED 0x80
+// AnimSpriteCel not reached yet by the cycle search
+#define ANIMSPRITECELGRAPH_UNVISITED 0xFFFFFFFF
+
+// Gives the root of an AnimSpriteCel in the union-find forest, halving the path
+static uint32 AnimSpriteCelGraphRoot(uint32 *parents, uint32 index) {
+
+    while (parents[index] != index) {
+        parents[index] = parents[parents[index]];
+        index = parents[index];
+    }
+    return index;
+}
+
+// Gives the registration index of a receiver (ANIMSPRITECELGRAPH_UNVISITED if outside the system)
+static uint32 AnimSpriteCelGraphReceiverIndex(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCelReceiver) {
+
+    // If the receiver belongs to the system
+    if (animSpriteCelReceiver->system == animSpriteCelSystem) {
+        return animSpriteCelReceiver->systemIndex;
+    }
+    return ANIMSPRITECELGRAPH_UNVISITED;
+}
+
+// Finds the cycles of the trigger graph (iterative Tarjan search)
+static void AnimSpriteCelGraphCycles(AnimSpriteCelGraph *animSpriteCelGraph, uint32 *offsets, uint32 *targets, uint32 *cursors, uint32 *indexes, uint32 *lowLinks, uint32 *stack, uint32 *calls) {
+
+    // Number of AnimSpriteCels
+    uint32 count = animSpriteCelGraph->animSpriteCelsCount;
+    // Flags of the AnimSpriteCels
+    uint8 *flags = animSpriteCelGraph->flags;
+    // Next search index
+    uint32 searchIndex = 0;
+    // Sizes of the stack and of the calls
+    uint32 stackCount = 0;
+    uint32 callsCount = 0;
+    // Start of the search, visited and reached AnimSpriteCels
+    uint32 root = 0;
+    uint32 current = 0;
+    uint32 target = 0;
+    // Component popped from the stack
+    uint32 componentFirst = 0;
+    uint32 componentIndex = 0;
+    uint32 cycle = 0;
+    // Edge index
+    uint32 edgeIndex = 0;
+
+    // Nothing reached yet, every edge to follow
+    for (current = 0; current < count; current++) {
+        indexes[current] = ANIMSPRITECELGRAPH_UNVISITED;
+        cursors[current] = offsets[current];
+    }
+
+    for (root = 0; root < count; root++) {
+
+        // Already in a component
+        if (indexes[root] != ANIMSPRITECELGRAPH_UNVISITED) {
+            continue;
+        }
+
+        // Start a search
+        indexes[root] = searchIndex;
+        lowLinks[root] = searchIndex;
+        searchIndex++;
+        stack[stackCount++] = root;
+        flags[root] |= ANIMSPRITECELGRAPH_STACKED;
+        calls[callsCount++] = root;
+
+        while (callsCount > 0) {
+
+            current = calls[callsCount - 1];
+
+            // If an edge is left, follow it
+            if (cursors[current] < offsets[current + 1]) {
+                target = targets[cursors[current]];
+                cursors[current]++;
+
+                if (indexes[target] == ANIMSPRITECELGRAPH_UNVISITED) {
+                    // Go down to the receiver
+                    indexes[target] = searchIndex;
+                    lowLinks[target] = searchIndex;
+                    searchIndex++;
+                    stack[stackCount++] = target;
+                    flags[target] |= ANIMSPRITECELGRAPH_STACKED;
+                    calls[callsCount++] = target;
+                } else if ((flags[target] & ANIMSPRITECELGRAPH_STACKED) != 0) {
+                    // Back to an AnimSpriteCel of the current chain
+                    if (indexes[target] < lowLinks[current]) {
+                        lowLinks[current] = indexes[target];
+                    }
+                }
+                continue;
+            }
+
+            // Every edge followed, back to the caller
+            callsCount--;
+            if ((callsCount > 0) && (lowLinks[current] < lowLinks[calls[callsCount - 1]])) {
+                lowLinks[calls[callsCount - 1]] = lowLinks[current];
+            }
+
+            // If the AnimSpriteCel is the root of a component
+            if (lowLinks[current] != indexes[current]) {
+                continue;
+            }
+
+            // Pop the component
+            componentFirst = stackCount;
+            do {
+                componentFirst--;
+                flags[stack[componentFirst]] &= ~ANIMSPRITECELGRAPH_STACKED;
+            } while (stack[componentFirst] != current);
+
+            // A component of several AnimSpriteCels, or one triggering itself, is a cycle
+            cycle = (stackCount - componentFirst > 1) ? 1 : 0;
+            for (edgeIndex = offsets[current]; (cycle == 0) && (edgeIndex < offsets[current + 1]); edgeIndex++) {
+                if (targets[edgeIndex] == current) {
+                    cycle = 1;
+                }
+            }
+            if (cycle == 1) {
+                for (componentIndex = componentFirst; componentIndex < stackCount; componentIndex++) {
+                    flags[stack[componentIndex]] |= ANIMSPRITECELGRAPH_CYCLE;
+                }
+                animSpriteCelGraph->cyclesCount++;
+            }
+            stackCount = componentFirst;
+        }
+    }
+}
+
+// Creates the graph of a system and analyzes it
+AnimSpriteCelGraph *AnimSpriteCelGraphInitialization(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+    // Newly created graph
+    AnimSpriteCelGraph *animSpriteCelGraph = NULL;
+    // Capacity of the system
+    uint32 animSpriteCelsMax = 0;
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Display error message
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return NULL;
+    }
+    animSpriteCelsMax = animSpriteCelSystem->animSpriteCelsMax;
+
+    // Allocate memory for AnimSpriteCelGraph
+    animSpriteCelGraph = (AnimSpriteCelGraph *)AllocMem(sizeof(AnimSpriteCelGraph), MEMTYPE_DRAM);
+    // If allocation fails
+    if (animSpriteCelGraph == NULL) {
+        // Display error message
+        printf("Error: Failed to allocate memory for AnimSpriteCelGraph.\n");
+        return NULL;
+    }
+
+    // Allocate memory for the arrays, sized by the capacity of the system
+    animSpriteCelGraph->islandIndexes = (uint32 *)AllocMem(animSpriteCelsMax * sizeof(uint32), MEMTYPE_DRAM);
+    animSpriteCelGraph->members = (uint32 *)AllocMem(animSpriteCelsMax * sizeof(uint32), MEMTYPE_DRAM);
+    animSpriteCelGraph->flags = (uint8 *)AllocMem(animSpriteCelsMax * sizeof(uint8), MEMTYPE_DRAM);
+    animSpriteCelGraph->islands = (AnimSpriteCelIsland *)AllocMem(animSpriteCelsMax * sizeof(AnimSpriteCelIsland), MEMTYPE_DRAM);
+    animSpriteCelGraph->system = animSpriteCelSystem;
+    animSpriteCelGraph->animSpriteCelsMax = animSpriteCelsMax;
+    // If an allocation fails
+    if ((animSpriteCelGraph->islandIndexes == NULL) || (animSpriteCelGraph->members == NULL) || (animSpriteCelGraph->flags == NULL) || (animSpriteCelGraph->islands == NULL)) {
+        // Free what was allocated
+        AnimSpriteCelGraphCleanup(animSpriteCelGraph);
+        // Display error message
+        printf("Error: Failed to allocate memory for AnimSpriteCelGraph arrays.\n");
+        return NULL;
+    }
+
+    // Analyze the current registrations
+    if (AnimSpriteCelGraphAnalysis(animSpriteCelGraph) < 0) {
+        AnimSpriteCelGraphCleanup(animSpriteCelGraph);
+        return NULL;
+    }
+
+    // Return the newly created AnimSpriteCelGraph
+    return animSpriteCelGraph;
+}
+
+// Finds the islands, the cycles and the orphans
+int32 AnimSpriteCelGraphAnalysis(AnimSpriteCelGraph *animSpriteCelGraph) {
+
+    // Analyzed system and its AnimSpriteCels
+    AnimSpriteCelSystem *animSpriteCelSystem = NULL;
+    AnimSpriteCel *animSpriteCel = NULL;
+    AnimSpriteCel *animSpriteCelReceiver = NULL;
+    // Number of AnimSpriteCels
+    uint32 count = 0;
+    // Working arrays, in a single block
+    uint32 *block = NULL;
+    uint32 blockSize = 0;
+    uint32 *offsets = NULL;
+    uint32 *targets = NULL;
+    uint32 *roots = NULL;
+    uint32 *senders = NULL;
+    uint32 *indexes = NULL;
+    uint32 *lowLinks = NULL;
+    uint32 *stack = NULL;
+    uint32 *calls = NULL;
+    // Indexes
+    uint32 index = 0;
+    uint32 stepIndex = 0;
+    uint32 receiverIndex = 0;
+    uint32 edgeIndex = 0;
+    uint32 islandIndex = 0;
+    // Roots of the islands of a sender and of its receiver
+    uint32 senderRoot = 0;
+    uint32 receiverRoot = 0;
+    // Waiting step found
+    uint32 waiting = 0;
+    // Island being filled
+    AnimSpriteCelIsland *island = NULL;
+
+    // If the graph is undefined
+    if (animSpriteCelGraph == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelGraph unknown.\n");
+        return -1;
+    }
+    animSpriteCelSystem = animSpriteCelGraph->system;
+    count = animSpriteCelSystem->animSpriteCelsCount;
+
+    // Empty analysis of the current registrations
+    animSpriteCelGraph->animSpriteCelsCount = count;
+    animSpriteCelGraph->generation = animSpriteCelSystem->generation;
+    animSpriteCelGraph->islandsCount = 0;
+    animSpriteCelGraph->edgesCount = 0;
+    animSpriteCelGraph->cyclesCount = 0;
+    animSpriteCelGraph->orphansCount = 0;
+    animSpriteCelGraph->externalCount = 0;
+
+    // Count the triggers between registered AnimSpriteCels
+    for (index = 0; index < count; index++) {
+        animSpriteCel = animSpriteCelSystem->animSpriteCels[index];
+        for (stepIndex = 0; stepIndex < animSpriteCel->stepsCount; stepIndex++) {
+            animSpriteCelReceiver = AnimSpriteCelStepReceiver(animSpriteCel, stepIndex);
+            if ((animSpriteCelReceiver != NULL) && (AnimSpriteCelGraphReceiverIndex(animSpriteCelSystem, animSpriteCelReceiver) != ANIMSPRITECELGRAPH_UNVISITED)) {
+                animSpriteCelGraph->edgesCount++;
+            }
+        }
+    }
+
+    // Allocate memory for the working arrays: edges, roots, senders and the cycle search
+    blockSize = (count + 1 + animSpriteCelGraph->edgesCount + 6 * count) * sizeof(uint32);
+    block = (uint32 *)AllocMem(blockSize, MEMTYPE_DRAM);
+    // If allocation fails
+    if (block == NULL) {
+        // Return error
+        printf("Error: Failed to allocate memory for AnimSpriteCelGraph analysis.\n");
+        return -1;
+    }
+    offsets = block;
+    targets = offsets + count + 1;
+    roots = targets + animSpriteCelGraph->edgesCount;
+    senders = roots + count;
+    indexes = senders + count;
+    lowLinks = indexes + count;
+    stack = lowLinks + count;
+    calls = stack + count;
+
+    // Each AnimSpriteCel is its own island, without sender
+    for (index = 0; index < count; index++) {
+        roots[index] = index;
+        senders[index] = 0;
+        animSpriteCelGraph->flags[index] = 0;
+    }
+
+    // Edges of each AnimSpriteCel, in step order
+    for (index = 0; index < count; index++) {
+        animSpriteCel = animSpriteCelSystem->animSpriteCels[index];
+        offsets[index] = edgeIndex;
+        waiting = 0;
+        for (stepIndex = 0; stepIndex < animSpriteCel->stepsCount; stepIndex++) {
+
+            // Waiting step
+            if (ANIMSPRITECEL_STEP_DURATION(animSpriteCel, stepIndex) == 0) {
+                waiting = 1;
+            }
+
+            // No receiver
+            animSpriteCelReceiver = AnimSpriteCelStepReceiver(animSpriteCel, stepIndex);
+            if (animSpriteCelReceiver == NULL) {
+                continue;
+            }
+
+            // Receiver outside the system
+            receiverIndex = AnimSpriteCelGraphReceiverIndex(animSpriteCelSystem, animSpriteCelReceiver);
+            if (receiverIndex == ANIMSPRITECELGRAPH_UNVISITED) {
+                animSpriteCelGraph->flags[index] |= ANIMSPRITECELGRAPH_EXTERNAL;
+                animSpriteCelGraph->externalCount++;
+                continue;
+            }
+
+            // The sender and the receiver are in the same island, kept under its first member
+            targets[edgeIndex++] = receiverIndex;
+            senders[receiverIndex]++;
+            senderRoot = AnimSpriteCelGraphRoot(roots, index);
+            receiverRoot = AnimSpriteCelGraphRoot(roots, receiverIndex);
+            if (senderRoot < receiverRoot) {
+                roots[receiverRoot] = senderRoot;
+            } else {
+                roots[senderRoot] = receiverRoot;
+            }
+        }
+
+        // A waiting AnimSpriteCel is an orphan until a sender is found (checked below)
+        if (waiting == 1) {
+            animSpriteCelGraph->flags[index] |= ANIMSPRITECELGRAPH_ORPHAN;
+        }
+    }
+    offsets[count] = edgeIndex;
+
+    // Orphans: waiting AnimSpriteCels without any sender
+    for (index = 0; index < count; index++) {
+        if (senders[index] > 0) {
+            animSpriteCelGraph->flags[index] &= ~ANIMSPRITECELGRAPH_ORPHAN;
+        }
+        if ((animSpriteCelGraph->flags[index] & ANIMSPRITECELGRAPH_ORPHAN) != 0) {
+            animSpriteCelGraph->orphansCount++;
+        }
+    }
+
+    // Islands numbered in the order of their first member (the root has the lowest index)
+    for (index = 0; index < count; index++) {
+        roots[index] = AnimSpriteCelGraphRoot(roots, index);
+    }
+    for (index = 0; index < count; index++) {
+        if (roots[index] == index) {
+            island = &animSpriteCelGraph->islands[animSpriteCelGraph->islandsCount];
+            island->membersFirst = 0;
+            island->membersCount = 0;
+            island->flags = 0;
+            island->cycleMembersCount = 0;
+            island->orphansCount = 0;
+            island->asleep = 0;
+            animSpriteCelGraph->islandIndexes[index] = animSpriteCelGraph->islandsCount;
+            animSpriteCelGraph->islandsCount++;
+        } else {
+            animSpriteCelGraph->islandIndexes[index] = animSpriteCelGraph->islandIndexes[roots[index]];
+        }
+        animSpriteCelGraph->islands[animSpriteCelGraph->islandIndexes[index]].membersCount++;
+    }
+
+    // Cycles (the senders are no longer needed, their array holds the next edge of each AnimSpriteCel)
+    AnimSpriteCelGraphCycles(animSpriteCelGraph, offsets, targets, senders, indexes, lowLinks, stack, calls);
+
+    // Members grouped by island, in registration order
+    for (islandIndex = 1; islandIndex < animSpriteCelGraph->islandsCount; islandIndex++) {
+        animSpriteCelGraph->islands[islandIndex].membersFirst = animSpriteCelGraph->islands[islandIndex - 1].membersFirst + animSpriteCelGraph->islands[islandIndex - 1].membersCount;
+        animSpriteCelGraph->islands[islandIndex - 1].membersCount = 0;
+    }
+    if (animSpriteCelGraph->islandsCount > 0) {
+        animSpriteCelGraph->islands[animSpriteCelGraph->islandsCount - 1].membersCount = 0;
+    }
+    for (index = 0; index < count; index++) {
+        island = &animSpriteCelGraph->islands[animSpriteCelGraph->islandIndexes[index]];
+        animSpriteCelGraph->members[island->membersFirst + island->membersCount] = index;
+        island->membersCount++;
+        island->flags |= animSpriteCelGraph->flags[index];
+        if ((animSpriteCelGraph->flags[index] & ANIMSPRITECELGRAPH_CYCLE) != 0) {
+            island->cycleMembersCount++;
+        }
+        if ((animSpriteCelGraph->flags[index] & ANIMSPRITECELGRAPH_ORPHAN) != 0) {
+            island->orphansCount++;
+        }
+    }
+
+    // Free the working arrays
+    FreeMem(block, blockSize);
+
+    // Return the number of islands
+    return (int32)animSpriteCelGraph->islandsCount;
+}
+
+// Moves the system to the next tick before running its islands
+int32 AnimSpriteCelGraphBegin(AnimSpriteCelGraph *animSpriteCelGraph) {
+
+    // If the graph is undefined
+    if (animSpriteCelGraph == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelGraph unknown.\n");
+        return -1;
+    }
+
+    // If the registrations or the steps changed since the analysis
+    if (animSpriteCelGraph->generation != animSpriteCelGraph->system->generation) {
+        // Return error
+        printf("Error: AnimSpriteCelGraph analysis out of date (generation %u analyzed, %u now).\n", animSpriteCelGraph->generation, animSpriteCelGraph->system->generation);
+        return -1;
+    }
+
+    // A trigger only stays in its island when every animation is visited and the receiver is triggered at once
+    if ((animSpriteCelGraph->system->schedule != POLLING) || (animSpriteCelGraph->system->delivery != IMMEDIATE)) {
+        // Return error
+        printf("Error: AnimSpriteCelGraph islands need POLLING schedule and IMMEDIATE triggers.\n");
+        return -1;
+    }
+
+    // A tick is a display cycle, not the microseconds elapsed
+    if (animSpriteCelGraph->system->microsecondsCount > 0) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem runs AnimSpriteCels in MICROSECONDS, use AnimSpriteCelSystemTimeRun().\n");
+        return -1;
+    }
+
+    // Next display cycle
+    animSpriteCelGraph->system->tick++;
+
+    // Return the number of islands
+    return (int32)animSpriteCelGraph->islandsCount;
+}
+
+// Runs the members of an island for one display cycle
+void AnimSpriteCelGraphIslandRun(AnimSpriteCelGraph *animSpriteCelGraph, uint32 islandIndex) {
+
+    // Island being run
+    AnimSpriteCelIsland *island = NULL;
+    // Registered AnimSpriteCels
+    AnimSpriteCel **animSpriteCels = NULL;
+    // Member index
+    uint32 index = 0;
+    // Members able to progress
+    uint32 awakeCount = 0;
+
+    // If the island is unknown
+    if ((animSpriteCelGraph == NULL) || (islandIndex >= animSpriteCelGraph->islandsCount)) {
+        // Log error
+        printf("Error: AnimSpriteCelGraph island unknown.\n");
+        return;
+    }
+
+    // If nothing in the island can progress
+    island = &animSpriteCelGraph->islands[islandIndex];
+    if (island->asleep == 1) {
+        return;
+    }
+
+    // Same visit as AnimSpriteCelSystemRun(), restricted to the members
+    animSpriteCels = animSpriteCelGraph->system->animSpriteCels;
+    for (index = island->membersFirst; index < island->membersFirst + island->membersCount; index++) {
+
+        // Counts the members able to progress
+        awakeCount += AnimSpriteCelSystemVisit(animSpriteCels[animSpriteCelGraph->members[index]]);
+    }
+
+    // Without a member running, no trigger was sent: the island stays as it is until woken
+    if (awakeCount == 0) {
+        island->asleep = 1;
+    }
+}
+
+// Runs every island that is not asleep
+int32 AnimSpriteCelGraphRun(AnimSpriteCelGraph *animSpriteCelGraph) {
+
+    // Island index
+    uint32 islandIndex = 0;
+    // Islands run
+    int32 runCount = 0;
+
+    // Next tick (checks the analysis, the schedule and the delivery)
+    if (AnimSpriteCelGraphBegin(animSpriteCelGraph) < 0) {
+        return -1;
+    }
+
+    // Islands in order, the asleep ones are skipped
+    for (islandIndex = 0; islandIndex < animSpriteCelGraph->islandsCount; islandIndex++) {
+        if (animSpriteCelGraph->islands[islandIndex].asleep == 0) {
+            AnimSpriteCelGraphIslandRun(animSpriteCelGraph, islandIndex);
+            runCount++;
+        }
+    }
+
+    // Return the number of islands run
+    return runCount;
+}
+
+// Wakes the island of an AnimSpriteCel
+void AnimSpriteCelGraphWake(AnimSpriteCelGraph *animSpriteCelGraph, AnimSpriteCel *animSpriteCel) {
+
+    // If the AnimSpriteCel is not in the analysis
+    if ((animSpriteCelGraph == NULL) || (animSpriteCel == NULL) || (animSpriteCel->system != animSpriteCelGraph->system) || (animSpriteCel->systemIndex >= animSpriteCelGraph->animSpriteCelsCount)) {
+        // Log error
+        printf("Error: AnimSpriteCel not analyzed in this AnimSpriteCelGraph.\n");
+        return;
+    }
+
+    // Visited again from the next tick
+    animSpriteCelGraph->islands[animSpriteCelGraph->islandIndexes[animSpriteCel->systemIndex]].asleep = 0;
+}
+
+// Prints the analysis
+int32 AnimSpriteCelGraphDump(AnimSpriteCelGraph *animSpriteCelGraph) {
+
+    // Analyzed system and its AnimSpriteCels
+    AnimSpriteCelSystem *animSpriteCelSystem = NULL;
+    AnimSpriteCel *animSpriteCel = NULL;
+    AnimSpriteCel *animSpriteCelReceiver = NULL;
+    // Island being printed
+    AnimSpriteCelIsland *island = NULL;
+    // Indexes
+    uint32 islandIndex = 0;
+    uint32 memberIndex = 0;
+    uint32 index = 0;
+    uint32 stepIndex = 0;
+    uint32 receiverIndex = 0;
+    // Receivers printed
+    uint32 receiversCount = 0;
+    // Flags of the line
+    uint32 flags = 0;
+
+    // If the graph is undefined
+    if (animSpriteCelGraph == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelGraph unknown.\n");
+        return -1;
+    }
+    animSpriteCelSystem = animSpriteCelGraph->system;
+
+    // Whole graph
+    printf("graph animations %u islands %u edges %u cycles %u orphans %u external %u\n", animSpriteCelGraph->animSpriteCelsCount, animSpriteCelGraph->islandsCount,
+        animSpriteCelGraph->edgesCount, animSpriteCelGraph->cyclesCount, animSpriteCelGraph->orphansCount, animSpriteCelGraph->externalCount);
+
+    for (islandIndex = 0; islandIndex < animSpriteCelGraph->islandsCount; islandIndex++) {
+
+        // Island
+        island = &animSpriteCelGraph->islands[islandIndex];
+        flags = island->flags;
+        printf("island %u members %u cycleMembers %u orphans %u flags %c%c%c asleep %u\n", islandIndex, island->membersCount, island->cycleMembersCount, island->orphansCount,
+            ((flags & ANIMSPRITECELGRAPH_CYCLE) != 0) ? 'C' : '-', ((flags & ANIMSPRITECELGRAPH_ORPHAN) != 0) ? 'O' : '-', ((flags & ANIMSPRITECELGRAPH_EXTERNAL) != 0) ? 'E' : '-', island->asleep);
+
+        // Its members and the registration indexes of their receivers
+        for (memberIndex = island->membersFirst; memberIndex < island->membersFirst + island->membersCount; memberIndex++) {
+
+            index = animSpriteCelGraph->members[memberIndex];
+            animSpriteCel = animSpriteCelSystem->animSpriteCels[index];
+            flags = animSpriteCelGraph->flags[index];
+            printf("animation %u island %u flags %c%c%c receivers", index, islandIndex,
+                ((flags & ANIMSPRITECELGRAPH_CYCLE) != 0) ? 'C' : '-', ((flags & ANIMSPRITECELGRAPH_ORPHAN) != 0) ? 'O' : '-', ((flags & ANIMSPRITECELGRAPH_EXTERNAL) != 0) ? 'E' : '-');
+
+            receiversCount = 0;
+            for (stepIndex = 0; stepIndex < animSpriteCel->stepsCount; stepIndex++) {
+                animSpriteCelReceiver = AnimSpriteCelStepReceiver(animSpriteCel, stepIndex);
+                if (animSpriteCelReceiver == NULL) {
+                    continue;
+                }
+                receiverIndex = AnimSpriteCelGraphReceiverIndex(animSpriteCelSystem, animSpriteCelReceiver);
+                if (receiverIndex == ANIMSPRITECELGRAPH_UNVISITED) {
+                    printf("%cE", (receiversCount == 0) ? ' ' : ',');
+                } else {
+                    printf("%c%u", (receiversCount == 0) ? ' ' : ',', receiverIndex);
+                }
+                receiversCount++;
+            }
+            printf("%s\n", (receiversCount == 0) ? " -" : "");
+        }
+    }
+
+    // Return success
+    return 1;
+}
+
+// Frees the graph
+int32 AnimSpriteCelGraphCleanup(AnimSpriteCelGraph *animSpriteCelGraph) {
+
+    // Capacity of the arrays
+    uint32 animSpriteCelsMax = 0;
+
+    // If the graph is undefined
+    if (animSpriteCelGraph == NULL) {
+        printf("Error: AnimSpriteCelGraph unknown.\n");
+        return -1;
+    }
+    animSpriteCelsMax = animSpriteCelGraph->animSpriteCelsMax;
+
+    // Free the arrays if present
+    if (animSpriteCelGraph->islandIndexes != NULL) {
+        FreeMem(animSpriteCelGraph->islandIndexes, animSpriteCelsMax * sizeof(uint32));
+    }
+    if (animSpriteCelGraph->members != NULL) {
+        FreeMem(animSpriteCelGraph->members, animSpriteCelsMax * sizeof(uint32));
+    }
+    if (animSpriteCelGraph->flags != NULL) {
+        FreeMem(animSpriteCelGraph->flags, animSpriteCelsMax * sizeof(uint8));
+    }
+    if (animSpriteCelGraph->islands != NULL) {
+        FreeMem(animSpriteCelGraph->islands, animSpriteCelsMax * sizeof(AnimSpriteCelIsland));
+    }
+
+    // Free the AnimSpriteCelGraph structure itself
+    FreeMem(animSpriteCelGraph, sizeof(AnimSpriteCelGraph));
+
+    // Return success
+    return 1;
+}
@@ -0,0 +1,192 @@
+#ifndef ANIMSPRITECELGRAPH_H
+#define ANIMSPRITECELGRAPH_H
+
+/******************************************************************************
+**
+**  AnimSpriteCelGraph - Trigger islands of an AnimSpriteCelSystem (3DO Cel Engine)
+**
+**  Author: Christophe Geoffroy (Topper) - MIT License
+**  Last Updated: 2026-10-17
+**
+**  The receivers of the steps link the AnimSpriteCels of a system into a
+**  graph of triggers. AnimSpriteCelGraphAnalysis() walks it once and finds:
+**
+**    - the islands: groups of AnimSpriteCels linked by triggers, in either
+**      direction. An AnimSpriteCel without receiver nor sender is an island
+**      of its own. Two islands never trigger each other.
+**
+**    - the cycles: AnimSpriteCels that trigger themselves back through a
+**      chain of receivers (strongly connected components, Tarjan).
+**
+**    - the orphans: AnimSpriteCels with a waiting step (frameDuration 0)
+**      that no registered AnimSpriteCel triggers. Only the game can get
+**      them past that step.
+**
+**  The islands are scheduling units. With the POLLING schedule and the
+**  IMMEDIATE delivery, a trigger stays inside its island, so running the
+**  islands one by one, in any order, gives the result of
+**  AnimSpriteCelSystemRun(): AnimSpriteCelGraphBegin() moves to the next
+**  tick, then AnimSpriteCelGraphIslandRun() visits the members of an island
+**  in registration order. AnimSpriteCelGraphRun() does both for the whole
+**  system.
+**
+**  An island whose members were all waiting or finished during its visit is
+**  asleep: nothing inside it can send a trigger any more, so its next visits
+**  are skipped. AnimSpriteCelGraphWake() wakes it when the game triggers or
+**  restarts one of its members.
+**
+**  AnimSpriteCelGraphDump() prints the analysis, one line per island and per
+**  AnimSpriteCel, for the tools:
+**
+**    graph animations 6 islands 2 edges 4 cycles 1 orphans 1 external 0
+**    island 0 members 4 cycleMembers 2 orphans 0 flags C-- asleep 0
+**    animation 0 island 0 flags C-- receivers 1
+**    ...
+**
+**  Flags are printed as C (in a cycle), O (orphan) and E (triggers an
+**  AnimSpriteCel that is not registered in the system), "-" when not set.
+**
+**  Important Notes:
+**
+**    - The analysis is a picture of the system: it must be run again after
+**      a registration, an unregistration or a change of receivers.
+**      AnimSpriteCelGraphBegin() refuses a system whose generation changed
+**      since, which each of them and each step configuration of a registered
+**      AnimSpriteCel moves on.
+**
+**    - Distinct islands can be run from several threads between two calls
+**      to AnimSpriteCelGraphBegin(), if no member triggers an AnimSpriteCel
+**      outside the system (flag E), the random steps are seeded, the
+**      trace is not recording, the state hash is not kept (its sum is shared),
+**      the events of the steps are not collected (their buffer is shared)
+**      and the changed CCBs are not tracked (the members of an island share
+**      words of the bitset with other islands).
+**
+**    - The analysis allocates its working arrays and frees them before
+**      returning. The graph itself is sized by the capacity of the system.
+**
+**  Structure Roles:
+**
+**    AnimSpriteCelIsland
+**      - membersFirst: first member in the "members" array of the graph
+**      - membersCount: number of members
+**      - flags: union of the flags of the members
+**      - cycleMembersCount: members in a cycle
+**      - orphansCount: orphan members
+**      - asleep: no member can progress until woken by the game
+**
+**    AnimSpriteCelGraph
+**      - system: analyzed system
+**      - animSpriteCelsMax: capacity of the arrays (capacity of the system)
+**      - animSpriteCelsCount: number of AnimSpriteCels analyzed
+**      - generation: generation of the system when analyzed
+**      - islandIndexes: island of each AnimSpriteCel (by registration index)
+**      - members: registration indexes grouped by island
+**      - flags: flags of each AnimSpriteCel
+**      - islands: islands, ordered by their first member
+**      - islandsCount: number of islands
+**      - edgesCount: triggers between registered AnimSpriteCels
+**      - cyclesCount: number of cycles
+**      - orphansCount: number of orphans
+**      - externalCount: triggers to AnimSpriteCels outside the system
+**
+**  Main Functions:
+**
+**    AnimSpriteCelGraphInitialization()
+**      -> Creates the graph of a system and analyzes it.
+**
+**    AnimSpriteCelGraphAnalysis()
+**      -> Finds the islands, the cycles and the orphans.
+**
+**    AnimSpriteCelGraphBegin()
+**      -> Moves the system to the next tick before running its islands.
+**
+**    AnimSpriteCelGraphIslandRun()
+**      -> Runs the members of an island for one display cycle.
+**
+**    AnimSpriteCelGraphRun()
+**      -> Runs every island that is not asleep.
+**
+**    AnimSpriteCelGraphWake()
+**      -> Wakes the island of an AnimSpriteCel.
+**
+**    AnimSpriteCelGraphDump()
+**      -> Prints the analysis.
+**
+**    AnimSpriteCelGraphCleanup()
+**      -> Frees the graph.
+**
+******************************************************************************/
+
+// int32
+#include "types.h"
+// AnimSpriteCelSystem
+#include "AnimSpriteCelSystem.h"
+
+// Flags of the AnimSpriteCels and of the islands
+#define ANIMSPRITECELGRAPH_CYCLE 0x01
+#define ANIMSPRITECELGRAPH_ORPHAN 0x02
+#define ANIMSPRITECELGRAPH_EXTERNAL 0x04
+
+typedef struct {
+    // First member in the members array
+    uint32 membersFirst;
+    // Number of members
+    uint32 membersCount;
+    // Union of the flags of the members
+    uint32 flags;
+    // Members in a cycle
+    uint32 cycleMembersCount;
+    // Orphan members
+    uint32 orphansCount;
+    // No member can progress until woken
+    uint32 asleep;
+} AnimSpriteCelIsland;
+
+typedef struct {
+    // Analyzed system
+    AnimSpriteCelSystem *system;
+    // Capacity of the arrays
+    uint32 animSpriteCelsMax;
+    // Number of AnimSpriteCels analyzed
+    uint32 animSpriteCelsCount;
+    // Generation of the system when analyzed
+    uint32 generation;
+    // Island of each AnimSpriteCel
+    uint32 *islandIndexes;
+    // Registration indexes grouped by island
+    uint32 *members;
+    // Flags of each AnimSpriteCel
+    uint8 *flags;
+    // Islands, ordered by their first member
+    AnimSpriteCelIsland *islands;
+    // Number of islands
+    uint32 islandsCount;
+    // Triggers between registered AnimSpriteCels
+    uint32 edgesCount;
+    // Number of cycles
+    uint32 cyclesCount;
+    // Number of orphans
+    uint32 orphansCount;
+    // Triggers to AnimSpriteCels outside the system
+    uint32 externalCount;
+} AnimSpriteCelGraph;
+
+// Creates the graph of a system and analyzes it
+AnimSpriteCelGraph *AnimSpriteCelGraphInitialization(AnimSpriteCelSystem *animSpriteCelSystem);
+// Finds the islands, the cycles and the orphans
+int32 AnimSpriteCelGraphAnalysis(AnimSpriteCelGraph *animSpriteCelGraph);
+// Moves the system to the next tick before running its islands
+int32 AnimSpriteCelGraphBegin(AnimSpriteCelGraph *animSpriteCelGraph);
+// Runs the members of an island for one display cycle
+void AnimSpriteCelGraphIslandRun(AnimSpriteCelGraph *animSpriteCelGraph, uint32 islandIndex);
+// Runs every island that is not asleep
+int32 AnimSpriteCelGraphRun(AnimSpriteCelGraph *animSpriteCelGraph);
+// Wakes the island of an AnimSpriteCel
+void AnimSpriteCelGraphWake(AnimSpriteCelGraph *animSpriteCelGraph, AnimSpriteCel *animSpriteCel);
+// Prints the analysis
+int32 AnimSpriteCelGraphDump(AnimSpriteCelGraph *animSpriteCelGraph);
+// Frees the graph
+int32 AnimSpriteCelGraphCleanup(AnimSpriteCelGraph *animSpriteCelGraph);
+
+#endif // ANIMSPRITECELGRAPH_H
@@ -0,0 +1,279 @@
+/******************************************************************************
+**
+**  AnimSpriteCelHashTool - Bisects two records of the state hash (host tool)
+**
+**  Author: Christophe Geoffroy (Topper) - MIT License
+**  Last Updated: 2026-10-17
+**
+**  Offline program, built and run on the development computer with any C
+**  compiler (it doesn't use the 3DO SDK):
+**
+**    cc -o AnimSpriteCelHashTool AnimSpriteCelHashTool.c
+**    AnimSpriteCelHashTool first.bin second.bin
+**
+**  The inputs are the buffers written by AnimSpriteCelSystemHashCopy() for
+**  two runs of the same scene (two peers, or a game and its replay), saved
+**  as is. The byte order of each one is found from the magic number, so a
+**  record of the 3DO (big-endian) can be compared with one of the host
+**  (little-endian).
+**
+**  Each recorded change holds the state hash after it. As long as the runs
+**  agree, their changes are the same one by one; once an AnimSpriteCel
+**  drifts, the state hash carries the difference into every later change
+**  (until the states meet again, which a hash of 32 bits makes unlikely).
+**  The tool bisects the changes on that rule, in as many comparisons as the
+**  bits of their number, down to the first one that differs, and prints
+**  its tick, its AnimSpriteCel (registration index), the playheads of both
+**  runs and the previous change of that AnimSpriteCel:
+**
+**    first difference: change 5296, tick 159, animation 45 (14 comparisons)
+**
+**                       tick animation  step dir  remaining iterations     random       hash
+**      first.bin         159        45     2  +1          0   INFINITE 0x65C19C9E 0xCB5C835A
+**      second.bin        159        45     2  +1          0   INFINITE 0x65C19C9F 0xC83EC127
+**      previous          150        45     1  +1          8   INFINITE 0x65C19C9E 0x9C540B32
+**
+**  Here the generator of animation 45 drifted by one bit: the step it
+**  started at tick 159 has the same duration in both runs, but the next
+**  random duration will differ.
+**
+**  It exits with 0 if the records are the same, 1 if they differ and 2 if
+**  a file can't be read.
+**
+**  The layout must match AnimSpriteCelSystem.h.
+**
+******************************************************************************/
+
+// printf(), fopen()
+#include <stdio.h>
+// malloc(), free()
+#include <stdlib.h>
+
+// Values of AnimSpriteCelSystem.h and DefinitionsArguments.h
+#define TOOL_MAGIC 0x48415348UL
+#define TOOL_HEADER_SIZE 20UL
+#define TOOL_ENTRY_SIZE 28UL
+#define TOOL_BACKWARD 0x0001UL
+#define TOOL_INFINITE 2147483647UL
+
+// Recorded change
+typedef struct {
+    unsigned long tick;
+    unsigned long animationIndex;
+    unsigned long stepIndex;
+    unsigned long flags;
+    unsigned long remainingCycles;
+    unsigned long iterationsCount;
+    unsigned long randomState;
+    unsigned long stateHash;
+} ToolEntry;
+
+// Record of a run
+typedef struct {
+    // File name
+    const char *name;
+    // Header values
+    unsigned long entriesCount;
+    unsigned long entriesLost;
+    unsigned long tick;
+    unsigned long stateHash;
+    // Changes
+    ToolEntry *entries;
+} ToolRecord;
+
+// Reads a 32-bit value in the byte order of the record
+static unsigned long ToolRead32(const unsigned char *bytes, int littleEndian) {
+
+    // If the record is little-endian
+    if (littleEndian == 1) {
+        return (unsigned long)bytes[0] | ((unsigned long)bytes[1] << 8) | ((unsigned long)bytes[2] << 16) | ((unsigned long)bytes[3] << 24);
+    }
+    return ((unsigned long)bytes[0] << 24) | ((unsigned long)bytes[1] << 16) | ((unsigned long)bytes[2] << 8) | (unsigned long)bytes[3];
+}
+
+// Reads a 16-bit value in the byte order of the record
+static unsigned long ToolRead16(const unsigned char *bytes, int littleEndian) {
+
+    // If the record is little-endian
+    if (littleEndian == 1) {
+        return (unsigned long)bytes[0] | ((unsigned long)bytes[1] << 8);
+    }
+    return ((unsigned long)bytes[0] << 8) | (unsigned long)bytes[1];
+}
+
+// Loads a record, returns 0 on error
+static int ToolLoad(ToolRecord *record) {
+
+    // Record file
+    FILE *input = NULL;
+    unsigned char header[TOOL_HEADER_SIZE];
+    unsigned char entry[TOOL_ENTRY_SIZE];
+    // Byte order of the record
+    int littleEndian = 0;
+    // Change index
+    unsigned long entryIndex = 0;
+
+    // Open the record
+    input = fopen(record->name, "rb");
+    if (input == NULL) {
+        printf("Error: can't open %s.\n", record->name);
+        return 0;
+    }
+
+    // Header, in either byte order
+    if (fread(header, 1, TOOL_HEADER_SIZE, input) != TOOL_HEADER_SIZE) {
+        printf("Error: %s is not a record of the state hash.\n", record->name);
+        fclose(input);
+        return 0;
+    }
+    if (ToolRead32(header, 0) != TOOL_MAGIC) {
+        littleEndian = 1;
+    }
+    if (ToolRead32(header, littleEndian) != TOOL_MAGIC) {
+        printf("Error: %s is not a record of the state hash.\n", record->name);
+        fclose(input);
+        return 0;
+    }
+    record->entriesCount = ToolRead32(header + 4, littleEndian);
+    record->entriesLost = ToolRead32(header + 8, littleEndian);
+    record->tick = ToolRead32(header + 12, littleEndian);
+    record->stateHash = ToolRead32(header + 16, littleEndian);
+
+    // Changes (one more so that an empty record still allocates)
+    record->entries = (ToolEntry *)malloc((record->entriesCount + 1) * sizeof(ToolEntry));
+    if (record->entries == NULL) {
+        printf("Error: out of memory.\n");
+        fclose(input);
+        return 0;
+    }
+    for (entryIndex = 0; entryIndex < record->entriesCount; entryIndex++) {
+
+        if (fread(entry, 1, TOOL_ENTRY_SIZE, input) != TOOL_ENTRY_SIZE) {
+            printf("Warning: %s cut after %lu changes.\n", record->name, entryIndex);
+            record->entriesCount = entryIndex;
+            break;
+        }
+
+        record->entries[entryIndex].tick = ToolRead32(entry, littleEndian);
+        record->entries[entryIndex].animationIndex = ToolRead32(entry + 4, littleEndian);
+        record->entries[entryIndex].stepIndex = ToolRead16(entry + 8, littleEndian);
+        record->entries[entryIndex].flags = ToolRead16(entry + 10, littleEndian);
+        record->entries[entryIndex].remainingCycles = ToolRead32(entry + 12, littleEndian);
+        record->entries[entryIndex].iterationsCount = ToolRead32(entry + 16, littleEndian);
+        record->entries[entryIndex].randomState = ToolRead32(entry + 20, littleEndian);
+        record->entries[entryIndex].stateHash = ToolRead32(entry + 24, littleEndian);
+    }
+    fclose(input);
+
+    printf("%s: %lu changes (%s) from tick %lu, %lu lost once full\n", record->name, record->entriesCount, (littleEndian == 1) ? "little-endian" : "big-endian", record->tick, record->entriesLost);
+    return 1;
+}
+
+// Compares two changes, returns 1 if they are the same
+static int ToolSame(const ToolEntry *first, const ToolEntry *second) {
+    return (first->tick == second->tick) && (first->animationIndex == second->animationIndex) && (first->stepIndex == second->stepIndex) && (first->flags == second->flags)
+        && (first->remainingCycles == second->remainingCycles) && (first->iterationsCount == second->iterationsCount) && (first->randomState == second->randomState)
+        && (first->stateHash == second->stateHash);
+}
+
+// Prints a change on a line
+static void ToolPrint(const char *label, const ToolEntry *entry) {
+
+    printf("  %-12s %10lu %9lu %5lu %3s ", label, entry->tick, entry->animationIndex, entry->stepIndex, ((entry->flags & TOOL_BACKWARD) != 0) ? "-1" : "+1");
+    printf("%10lu ", entry->remainingCycles);
+    if (entry->iterationsCount == TOOL_INFINITE) {
+        printf("%10s ", "INFINITE");
+    } else {
+        printf("%10lu ", entry->iterationsCount);
+    }
+    printf("0x%08lX 0x%08lX\n", entry->randomState, entry->stateHash);
+}
+
+int main(int argc, char *argv[]) {
+
+    // Records of the two runs
+    ToolRecord records[2];
+    // Changes in both records
+    unsigned long entriesCount = 0;
+    // Bisection: the changes before "low" are the same, the one at "high" differs
+    unsigned long low = 0;
+    unsigned long high = 0;
+    unsigned long middle = 0;
+    unsigned long comparisons = 0;
+    // Previous change of the drifting AnimSpriteCel
+    unsigned long previous = 0;
+    // Result
+    int different = 0;
+
+    // If the files are missing
+    if (argc != 3) {
+        printf("Usage: AnimSpriteCelHashTool first.bin second.bin\n");
+        return 2;
+    }
+
+    // Load both records
+    records[0].name = argv[1];
+    records[0].entries = NULL;
+    records[1].name = argv[2];
+    records[1].entries = NULL;
+    if ((ToolLoad(&records[0]) == 0) || (ToolLoad(&records[1]) == 0)) {
+        free(records[0].entries);
+        free(records[1].entries);
+        return 2;
+    }
+    printf("\n");
+
+    // If the recordings didn't start from the same state
+    if ((records[0].tick != records[1].tick) || (records[0].stateHash != records[1].stateHash)) {
+        printf("The runs differ before the recordings: tick %lu hash 0x%08lX, tick %lu hash 0x%08lX.\n", records[0].tick, records[0].stateHash, records[1].tick, records[1].stateHash);
+        free(records[0].entries);
+        free(records[1].entries);
+        return 1;
+    }
+
+    // Bisect the changes both records hold
+    entriesCount = (records[0].entriesCount < records[1].entriesCount) ? records[0].entriesCount : records[1].entriesCount;
+    low = 0;
+    high = entriesCount;
+    while (low < high) {
+        middle = low + (high - low) / 2;
+        comparisons++;
+        if (ToolSame(&records[0].entries[middle], &records[1].entries[middle]) == 1) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    // If every common change is the same
+    if (low == entriesCount) {
+        if (records[0].entriesCount == records[1].entriesCount) {
+            printf("The records are the same (%lu changes, %lu comparisons).\n", entriesCount, comparisons);
+        } else {
+            different = 1;
+            printf("The records are the same for %lu changes, then %s goes on alone (%lu comparisons).\n", entriesCount, (records[0].entriesCount > records[1].entriesCount) ? records[0].name : records[1].name, comparisons);
+        }
+        if ((records[0].entriesLost != 0) || (records[1].entriesLost != 0)) {
+            printf("The changes after a full record were not compared.\n");
+        }
+        free(records[0].entries);
+        free(records[1].entries);
+        return different;
+    }
+
+    // First change that differs, and the previous one of its AnimSpriteCel in the first run
+    printf("first difference: change %lu, tick %lu, animation %lu (%lu comparisons)\n\n", low, records[0].entries[low].tick, records[0].entries[low].animationIndex, comparisons);
+    printf("  %-12s %10s %9s %5s %3s %10s %10s %10s %10s\n", "", "tick", "animation", "step", "dir", "remaining", "iterations", "random", "hash");
+    ToolPrint(records[0].name, &records[0].entries[low]);
+    ToolPrint(records[1].name, &records[1].entries[low]);
+    for (previous = low; previous > 0; previous--) {
+        if (records[0].entries[previous - 1].animationIndex == records[0].entries[low].animationIndex) {
+            ToolPrint("previous", &records[0].entries[previous - 1]);
+            break;
+        }
+    }
+
+    free(records[0].entries);
+    free(records[1].entries);
+    return 1;
+}
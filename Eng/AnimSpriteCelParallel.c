@@ -0,0 +1,260 @@
+#include "AnimSpriteCelParallel.h"
+
+// animSpriteCelTrace
+#include "AnimSpriteCelTrace.h"
+// AllocMem(), FreeMem(), MEMTYPE_DRAM
+#include "mem.h"
+// printf()
+#include "stdio.h"
+
+// Runs the partitions of a worker's range, then those left in the other ranges
+static void AnimSpriteCelParallelWork(AnimSpriteCelParallelWorker *animSpriteCelParallelWorker) {
+
+    // Parallel run
+    AnimSpriteCelParallel *animSpriteCelParallel = animSpriteCelParallelWorker->parallel;
+    // Range being emptied
+    AnimSpriteCelParallelWorker *range = NULL;
+    // Claimed partition
+    uint32 partitionIndex = 0;
+    // Ranges visited
+    uint32 rangeIndex = 0;
+
+    // Own range first, then the following ones in turn
+    for (rangeIndex = 0; rangeIndex < animSpriteCelParallel->workersCount; rangeIndex++) {
+
+        range = &animSpriteCelParallel->workers[(animSpriteCelParallelWorker->workerIndex + rangeIndex) % animSpriteCelParallel->workersCount];
+
+        // Claim the partitions one by one until the range is empty
+        while (1) {
+            partitionIndex = __sync_fetch_and_add(&range->partitionNext, 1);
+            if (partitionIndex >= range->partitionEnd) {
+                break;
+            }
+            AnimSpriteCelSystemPartitionRun(animSpriteCelParallel->system, partitionIndex);
+            animSpriteCelParallelWorker->partitionsRun++;
+            if (rangeIndex > 0) {
+                animSpriteCelParallelWorker->partitionsStolen++;
+            }
+        }
+    }
+}
+
+// Body of the worker threads: runs each new tick until stopped
+static void *AnimSpriteCelParallelThread(void *argument) {
+
+    // Worker of the thread
+    AnimSpriteCelParallelWorker *animSpriteCelParallelWorker = (AnimSpriteCelParallelWorker *)argument;
+    // Parallel run
+    AnimSpriteCelParallel *animSpriteCelParallel = animSpriteCelParallelWorker->parallel;
+    // Last tick run by the thread
+    uint32 generation = 0;
+
+    pthread_mutex_lock(&animSpriteCelParallel->mutex);
+    while (1) {
+
+        // Wait for a new tick
+        while ((animSpriteCelParallel->generation == generation) && (animSpriteCelParallel->stopping == 0)) {
+            pthread_cond_wait(&animSpriteCelParallel->started, &animSpriteCelParallel->mutex);
+        }
+        if (animSpriteCelParallel->stopping == 1) {
+            break;
+        }
+        generation = animSpriteCelParallel->generation;
+
+        // Run it without the lock
+        pthread_mutex_unlock(&animSpriteCelParallel->mutex);
+        AnimSpriteCelParallelWork(animSpriteCelParallelWorker);
+        pthread_mutex_lock(&animSpriteCelParallel->mutex);
+
+        // The last thread done wakes the calling thread
+        animSpriteCelParallel->workersRunning--;
+        if (animSpriteCelParallel->workersRunning == 0) {
+            pthread_cond_signal(&animSpriteCelParallel->finished);
+        }
+    }
+    pthread_mutex_unlock(&animSpriteCelParallel->mutex);
+
+    return NULL;
+}
+
+// Starts the worker threads of a partitioned system
+AnimSpriteCelParallel *AnimSpriteCelParallelInitialization(AnimSpriteCelSystem *animSpriteCelSystem, uint32 workersCount) {
+
+    // Newly created parallel run
+    AnimSpriteCelParallel *animSpriteCelParallel = NULL;
+    // Worker index
+    uint32 index = 0;
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Display error message
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return NULL;
+    }
+
+    // If the system is not partitioned
+    if (animSpriteCelSystem->outboxes == NULL) {
+        // Display error message
+        printf("Error: AnimSpriteCelSystem partitions not configured.\n");
+        return NULL;
+    }
+
+    // If there is no worker
+    if (workersCount == 0) {
+        // Display error message
+        printf("Error: AnimSpriteCelParallel needs at least one worker.\n");
+        return NULL;
+    }
+
+    // Allocate memory for AnimSpriteCelParallel
+    animSpriteCelParallel = (AnimSpriteCelParallel *)AllocMem(sizeof(AnimSpriteCelParallel), MEMTYPE_DRAM);
+    // If allocation fails
+    if (animSpriteCelParallel == NULL) {
+        // Display error message
+        printf("Error: Failed to allocate memory for AnimSpriteCelParallel.\n");
+        return NULL;
+    }
+
+    // Allocate memory for the workers and their threads
+    animSpriteCelParallel->workers = (AnimSpriteCelParallelWorker *)AllocMem(workersCount * sizeof(AnimSpriteCelParallelWorker), MEMTYPE_DRAM);
+    animSpriteCelParallel->threads = (pthread_t *)AllocMem(workersCount * sizeof(pthread_t), MEMTYPE_DRAM);
+    // If an allocation fails
+    if ((animSpriteCelParallel->workers == NULL) || (animSpriteCelParallel->threads == NULL)) {
+        // Free previously allocated memory
+        if (animSpriteCelParallel->workers != NULL) {
+            FreeMem(animSpriteCelParallel->workers, workersCount * sizeof(AnimSpriteCelParallelWorker));
+        }
+        if (animSpriteCelParallel->threads != NULL) {
+            FreeMem(animSpriteCelParallel->threads, workersCount * sizeof(pthread_t));
+        }
+        FreeMem(animSpriteCelParallel, sizeof(AnimSpriteCelParallel));
+        // Display error message
+        printf("Error: Failed to allocate memory for AnimSpriteCelParallel workers.\n");
+        return NULL;
+    }
+
+    // No tick started yet
+    animSpriteCelParallel->system = animSpriteCelSystem;
+    animSpriteCelParallel->workersCount = workersCount;
+    animSpriteCelParallel->workersMax = workersCount;
+    animSpriteCelParallel->generation = 0;
+    animSpriteCelParallel->workersRunning = 0;
+    animSpriteCelParallel->stopping = 0;
+    pthread_mutex_init(&animSpriteCelParallel->mutex, NULL);
+    pthread_cond_init(&animSpriteCelParallel->started, NULL);
+    pthread_cond_init(&animSpriteCelParallel->finished, NULL);
+
+    // Empty ranges
+    for (index = 0; index < workersCount; index++) {
+        animSpriteCelParallel->workers[index].parallel = animSpriteCelParallel;
+        animSpriteCelParallel->workers[index].workerIndex = index;
+        animSpriteCelParallel->workers[index].partitionNext = 0;
+        animSpriteCelParallel->workers[index].partitionEnd = 0;
+        animSpriteCelParallel->workers[index].partitionsRun = 0;
+        animSpriteCelParallel->workers[index].partitionsStolen = 0;
+    }
+
+    // Start the threads of workers 1 and up, worker 0 is the calling thread
+    for (index = 1; index < workersCount; index++) {
+        if (pthread_create(&animSpriteCelParallel->threads[index], NULL, AnimSpriteCelParallelThread, &animSpriteCelParallel->workers[index]) != 0) {
+            // Keep the threads already started
+            printf("Error: AnimSpriteCelParallel can't start worker %u, %u workers kept.\n", index, index);
+            animSpriteCelParallel->workersCount = index;
+            break;
+        }
+    }
+
+    // Return the newly created AnimSpriteCelParallel
+    return animSpriteCelParallel;
+}
+
+// Runs one tick of the system on all the workers
+int32 AnimSpriteCelParallelRun(AnimSpriteCelParallel *animSpriteCelParallel) {
+
+    // Partitions of the tick
+    int32 partitionsCount = 0;
+    // Worker index
+    uint32 index = 0;
+
+    // If the parallel run is undefined
+    if (animSpriteCelParallel == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelParallel unknown.\n");
+        return -1;
+    }
+
+#if ANIMSPRITECEL_TRACE == 1
+    // If the trace is recording
+    if (animSpriteCelTrace.events != NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelParallel can't run while AnimSpriteCelTrace is recording.\n");
+        return -1;
+    }
+#endif
+
+    // Start the tick (checks the schedule and the delivery)
+    partitionsCount = AnimSpriteCelSystemPartitionBegin(animSpriteCelParallel->system);
+    if (partitionsCount < 0) {
+        return -1;
+    }
+
+    // Share out the partitions in contiguous ranges
+    for (index = 0; index < animSpriteCelParallel->workersCount; index++) {
+        animSpriteCelParallel->workers[index].partitionNext = (uint32)partitionsCount * index / animSpriteCelParallel->workersCount;
+        animSpriteCelParallel->workers[index].partitionEnd = (uint32)partitionsCount * (index + 1) / animSpriteCelParallel->workersCount;
+    }
+
+    // Wake the threads
+    pthread_mutex_lock(&animSpriteCelParallel->mutex);
+    animSpriteCelParallel->generation++;
+    animSpriteCelParallel->workersRunning = animSpriteCelParallel->workersCount - 1;
+    pthread_cond_broadcast(&animSpriteCelParallel->started);
+    pthread_mutex_unlock(&animSpriteCelParallel->mutex);
+
+    // The calling thread is worker 0
+    AnimSpriteCelParallelWork(&animSpriteCelParallel->workers[0]);
+
+    // Wait for the other workers
+    pthread_mutex_lock(&animSpriteCelParallel->mutex);
+    while (animSpriteCelParallel->workersRunning > 0) {
+        pthread_cond_wait(&animSpriteCelParallel->finished, &animSpriteCelParallel->mutex);
+    }
+    pthread_mutex_unlock(&animSpriteCelParallel->mutex);
+
+    // Merge the outboxes and dispatch the triggers of the tick
+    return AnimSpriteCelSystemPartitionEnd(animSpriteCelParallel->system);
+}
+
+// Ends the worker threads and frees the structure
+int32 AnimSpriteCelParallelCleanup(AnimSpriteCelParallel *animSpriteCelParallel) {
+
+    // Worker index
+    uint32 index = 0;
+
+    // If the parallel run is undefined
+    if (animSpriteCelParallel == NULL) {
+        printf("Error: AnimSpriteCelParallel unknown.\n");
+        return -1;
+    }
+
+    // Stop the threads and wait for them
+    pthread_mutex_lock(&animSpriteCelParallel->mutex);
+    animSpriteCelParallel->stopping = 1;
+    pthread_cond_broadcast(&animSpriteCelParallel->started);
+    pthread_mutex_unlock(&animSpriteCelParallel->mutex);
+    for (index = 1; index < animSpriteCelParallel->workersCount; index++) {
+        pthread_join(animSpriteCelParallel->threads[index], NULL);
+    }
+
+    pthread_cond_destroy(&animSpriteCelParallel->finished);
+    pthread_cond_destroy(&animSpriteCelParallel->started);
+    pthread_mutex_destroy(&animSpriteCelParallel->mutex);
+
+    // Free the workers, their threads and the structure itself
+    FreeMem(animSpriteCelParallel->workers, animSpriteCelParallel->workersMax * sizeof(AnimSpriteCelParallelWorker));
+    FreeMem(animSpriteCelParallel->threads, animSpriteCelParallel->workersMax * sizeof(pthread_t));
+    FreeMem(animSpriteCelParallel, sizeof(AnimSpriteCelParallel));
+
+    // Return success
+    return 1;
+}
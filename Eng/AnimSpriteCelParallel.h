@@ -0,0 +1,146 @@
+#ifndef ANIMSPRITECELPARALLEL_H
+#define ANIMSPRITECELPARALLEL_H
+
+/******************************************************************************
+**
+**  AnimSpriteCelParallel - Multi-threaded run of an AnimSpriteCelSystem (host)
+**
+**  Author: Christophe Geoffroy (Topper) - MIT License
+**  Last Updated: 2026-10-17
+**
+**  The 3DO has a single ARM60, so this module is for the development
+**  computer and headless simulations: it uses POSIX threads and the atomic
+**  builtins of GCC and Clang, and is built with -pthread (see
+**  AnimSpriteCelBenchmark.c).
+**
+**  AnimSpriteCelParallelRun() runs one tick of a partitioned system (see
+**  AnimSpriteCelSystemPartitionConfiguration()) on several workers: the
+**  calling thread is worker 0, the others are threads started once by
+**  AnimSpriteCelParallelInitialization() and woken on each tick.
+**
+**  Work stealing: on each tick, the partitions are shared out in contiguous
+**  ranges, one per worker. A worker claims the partitions of its range one
+**  by one with an atomic increment of the range's next partition. Once its
+**  range is done, it claims the remaining partitions of the other ranges
+**  the same way, so a worker slowed by heavy partitions (trigger chains,
+**  random steps) is helped by the others instead of holding the tick.
+**
+**  The triggers sent by a partition go to its own outbox, merged in
+**  partition order by AnimSpriteCelSystemPartitionEnd(): the result of the
+**  tick is exactly the one of AnimSpriteCelSystemRun(), whatever the number
+**  of workers and the partitions each of them ran.
+**
+**  Important Notes:
+**
+**    - Same conditions as a partitioned tick: POLLING schedule, SAME_TICK
+**      or NEXT_TICK delivery, seeded random steps (AnimSpriteCelSystemSeed())
+**      and no trace recording (the ring buffer has a single writer). When
+**      the changed CCBs are tracked, the partition size must be a multiple
+**      of 32. The state hash can be kept, each partition adding its changes
+**      at the end of the tick, but not recorded. The events of the steps can
+**      be collected, each partition keeping them in its outbox.
+**
+**    - Partitions of a few thousand AnimSpriteCels keep the claims rare
+**      while leaving enough of them to share out: 1 000 000 AnimSpriteCels
+**      in partitions of 4 096 give 245 partitions.
+**
+**    - The system must not be run or changed by another thread during
+**      AnimSpriteCelParallelRun().
+**
+**  Structure Roles:
+**
+**    AnimSpriteCelParallelWorker
+**      - parallel: parallel run of the worker
+**      - workerIndex: index of the worker (0 = calling thread)
+**      - partitionNext: next partition of the worker's range (claimed atomically)
+**      - partitionEnd: end of the worker's range
+**      - partitionsRun, partitionsStolen: partitions run, and taken from
+**        other ranges (statistics)
+**      - padding: keeps the claim counters apart (false sharing)
+**
+**    AnimSpriteCelParallel
+**      - system: partitioned system run
+**      - workers: workers, the first one is the calling thread
+**      - workersCount: number of workers
+**      - workersMax: number of allocated workers (more than workersCount if
+**        a thread couldn't be started)
+**      - threads: threads of workers 1 and up
+**      - mutex, started, finished: wake-up of the threads and end of the tick
+**      - generation: number of ticks started (a thread runs each new one)
+**      - workersRunning: threads still running the tick
+**      - stopping: the threads must end
+**
+**  Main Functions:
+**
+**    AnimSpriteCelParallelInitialization()
+**      -> Starts the worker threads of a partitioned system.
+**
+**    AnimSpriteCelParallelRun()
+**      -> Runs one tick of the system on all the workers.
+**
+**    AnimSpriteCelParallelCleanup()
+**      -> Ends the worker threads and frees the structure.
+**
+******************************************************************************/
+
+// pthread_t, pthread_mutex_t, pthread_cond_t
+#include <pthread.h>
+
+// int32
+#include "types.h"
+// AnimSpriteCelSystem
+#include "AnimSpriteCelSystem.h"
+
+// Size of a cache line, keeps the claim counters of the workers apart
+#define ANIMSPRITECELPARALLEL_LINE 64
+
+typedef struct AnimSpriteCelParallel AnimSpriteCelParallel;
+
+typedef struct {
+    // Parallel run of the worker
+    AnimSpriteCelParallel *parallel;
+    // Index of the worker (0 = calling thread)
+    uint32 workerIndex;
+    // Next partition of the worker's range, claimed by any worker
+    volatile uint32 partitionNext;
+    // End of the worker's range
+    uint32 partitionEnd;
+    // Partitions run
+    uint32 partitionsRun;
+    // Partitions taken from the ranges of other workers
+    uint32 partitionsStolen;
+    // Keeps the claim counters of two workers on different cache lines
+    uint8 padding[ANIMSPRITECELPARALLEL_LINE];
+} AnimSpriteCelParallelWorker;
+
+struct AnimSpriteCelParallel {
+    // Partitioned system
+    AnimSpriteCelSystem *system;
+    // Workers, the first one is the calling thread
+    AnimSpriteCelParallelWorker *workers;
+    // Number of workers
+    uint32 workersCount;
+    // Number of allocated workers
+    uint32 workersMax;
+    // Threads of workers 1 and up
+    pthread_t *threads;
+    // Wake-up of the threads and end of the tick
+    pthread_mutex_t mutex;
+    pthread_cond_t started;
+    pthread_cond_t finished;
+    // Number of ticks started
+    uint32 generation;
+    // Threads still running the tick
+    uint32 workersRunning;
+    // The threads must end
+    uint32 stopping;
+};
+
+// Starts the worker threads of a partitioned system
+AnimSpriteCelParallel *AnimSpriteCelParallelInitialization(AnimSpriteCelSystem *animSpriteCelSystem, uint32 workersCount);
+// Runs one tick of the system on all the workers
+int32 AnimSpriteCelParallelRun(AnimSpriteCelParallel *animSpriteCelParallel);
+// Ends the worker threads and frees the structure
+int32 AnimSpriteCelParallelCleanup(AnimSpriteCelParallel *animSpriteCelParallel);
+
+#endif // ANIMSPRITECELPARALLEL_H
@@ -0,0 +1,249 @@
+#include "AnimSpriteCelPool.h"
+
+// AnimSpriteCelSystemUnregister()
+#include "AnimSpriteCelSystem.h"
+// AllocMem(), FreeMem(), MEMTYPE_DRAM
+#include "mem.h"
+// printf()
+#include "stdio.h"
+
+// Alignment of the slots in the slab
+#define ANIMSPRITECELPOOL_ALIGNMENT 8
+
+// Gives a slot back to its pool from AnimSpriteCelCleanup()
+static int32 AnimSpriteCelPoolSlotRelease(AnimSpriteCel *animSpriteCel) {
+    return AnimSpriteCelPoolRelease(animSpriteCel->pool, animSpriteCel);
+}
+
+// Initialization of an AnimSpriteCelPool
+AnimSpriteCelPool *AnimSpriteCelPoolInitialization(uint32 animSpriteCelsMax, uint32 stepsMax, uint32 framesMax) {
+
+    // AnimSpriteCelPool instance
+    AnimSpriteCelPool *animSpriteCelPool = NULL;
+    // Slot index
+    uint32 index = 0;
+    // AnimSpriteCel of a slot
+    AnimSpriteCel *animSpriteCel = NULL;
+
+    // If the capacity is empty
+    if (animSpriteCelsMax == 0) {
+        // Display error message
+        printf("Error: AnimSpriteCelPool needs at least one AnimSpriteCel.\n");
+        return NULL;
+    }
+
+    // Minimum number of steps = 2
+    stepsMax = (stepsMax > 1) ? stepsMax : 2;
+    // Minimum number of frames = 1, indexed on 16 bits
+    framesMax = (framesMax > 0) ? framesMax : 1;
+    framesMax = (framesMax < 0x10000) ? framesMax : 0x10000;
+
+    // Allocate memory for AnimSpriteCelPool
+    animSpriteCelPool = (AnimSpriteCelPool *)AllocMem(sizeof(AnimSpriteCelPool), MEMTYPE_DRAM);
+    // If allocation fails
+    if (animSpriteCelPool == NULL) {
+        // Display error message
+        printf("Error: Failed to allocate memory for AnimSpriteCelPool.\n");
+        return NULL;
+    }
+
+    // A slot holds the structure, the CCB, the steps, the frame descriptors and the timeline (up to 2 * stepsMax - 1 values)
+    animSpriteCelPool->slotSize = sizeof(AnimSpriteCel) + sizeof(CCB) + (stepsMax * sizeof(AnimSpriteCelStep)) + (framesMax * sizeof(AnimSpriteCelFrame)) + (((2 * stepsMax) - 1) * sizeof(uint32));
+    animSpriteCelPool->slotSize = (animSpriteCelPool->slotSize + ANIMSPRITECELPOOL_ALIGNMENT - 1) & ~(uint32)(ANIMSPRITECELPOOL_ALIGNMENT - 1);
+
+    // Allocate the slab
+    animSpriteCelPool->slab = (uint8 *)AllocMem(animSpriteCelsMax * animSpriteCelPool->slotSize, MEMTYPE_DRAM);
+    // If slab allocation fails
+    if (animSpriteCelPool->slab == NULL) {
+        // Free previously allocated AnimSpriteCelPool
+        FreeMem(animSpriteCelPool, sizeof(AnimSpriteCelPool));
+        // Display error message
+        printf("Error: Failed to allocate memory for AnimSpriteCelPool slab.\n");
+        return NULL;
+    }
+
+    // Allocate the stack of free slots
+    animSpriteCelPool->freeSlots = (AnimSpriteCel **)AllocMem(animSpriteCelsMax * sizeof(AnimSpriteCel *), MEMTYPE_DRAM);
+    // If stack allocation fails
+    if (animSpriteCelPool->freeSlots == NULL) {
+        // Free previously allocated slab and AnimSpriteCelPool
+        FreeMem(animSpriteCelPool->slab, animSpriteCelsMax * animSpriteCelPool->slotSize);
+        FreeMem(animSpriteCelPool, sizeof(AnimSpriteCelPool));
+        // Display error message
+        printf("Error: Failed to allocate memory for AnimSpriteCelPool free slots.\n");
+        return NULL;
+    }
+
+    // Capacity of the pool
+    animSpriteCelPool->animSpriteCelsMax = animSpriteCelsMax;
+    animSpriteCelPool->stepsMax = stepsMax;
+    animSpriteCelPool->framesMax = framesMax;
+    // Statistics
+    animSpriteCelPool->acquiredCount = 0;
+    animSpriteCelPool->acquiredMax = 0;
+    animSpriteCelPool->acquisitionsCount = 0;
+    animSpriteCelPool->failuresCount = 0;
+
+    // Lay out the slots once, pushed in reverse so that the first slot is taken first
+    for (index = 0; index < animSpriteCelsMax; index++) {
+        animSpriteCel = (AnimSpriteCel *)(animSpriteCelPool->slab + (index * animSpriteCelPool->slotSize));
+        animSpriteCel->cel = (CCB *)(animSpriteCel + 1);
+        animSpriteCel->steps = (AnimSpriteCelStep *)(animSpriteCel->cel + 1);
+        animSpriteCel->frames = (AnimSpriteCelFrame *)(animSpriteCel->steps + stepsMax);
+        animSpriteCel->framesCount = framesMax;
+        animSpriteCel->timeline = (uint32 *)(animSpriteCel->frames + framesMax);
+        animSpriteCel->pool = animSpriteCelPool;
+        animSpriteCel->sequence = NULL;
+        animSpriteCel->file = NULL;
+        animSpriteCel->table = NULL;
+        animSpriteCel->release = AnimSpriteCelPoolSlotRelease;
+        animSpriteCel->packedSteps = NULL;
+        // A free slot has no SpriteCel
+        animSpriteCel->spriteCel = NULL;
+        animSpriteCel->system = NULL;
+        animSpriteCelPool->freeSlots[animSpriteCelsMax - 1 - index] = animSpriteCel;
+    }
+    animSpriteCelPool->freeCount = animSpriteCelsMax;
+
+    // Return the newly created AnimSpriteCelPool
+    return animSpriteCelPool;
+}
+
+// Takes an AnimSpriteCel from the pool
+AnimSpriteCel *AnimSpriteCelPoolAcquire(AnimSpriteCelPool *animSpriteCelPool, SpriteCel *spriteCel, AnimSpriteCelLoop loop, AnimSpriteCelRange range, uint32 iterations, int32 direction, uint32 stepIndex, uint32 stepsCount) {
+
+    // AnimSpriteCel instance
+    AnimSpriteCel *animSpriteCel = NULL;
+
+    // If the pool is undefined
+    if (animSpriteCelPool == NULL) {
+        // Display error message
+        printf("Error: AnimSpriteCelPool unknown.\n");
+        return NULL;
+    }
+
+    // If the sprite sheet doesn't exist
+    if (spriteCel == NULL) {
+        // Display error message
+        printf("Error: SpriteCel unknown.\n");
+        return NULL;
+    }
+
+    // If the steps don't fit in a slot
+    if (stepsCount > animSpriteCelPool->stepsMax) {
+        animSpriteCelPool->failuresCount++;
+        // Display error message
+        printf("Error: AnimSpriteCelPool slots hold %u steps at most.\n", animSpriteCelPool->stepsMax);
+        return NULL;
+    }
+
+    // If every slot is in use
+    if (animSpriteCelPool->freeCount == 0) {
+        animSpriteCelPool->failuresCount++;
+        // Display error message
+        printf("Error: AnimSpriteCelPool empty (%u AnimSpriteCels).\n", animSpriteCelPool->animSpriteCelsMax);
+        return NULL;
+    }
+
+    // Pop a free slot
+    animSpriteCelPool->freeCount--;
+    animSpriteCel = animSpriteCelPool->freeSlots[animSpriteCelPool->freeCount];
+
+    // Copy the SpriteCel CCB in the slot
+    *animSpriteCel->cel = *spriteCel->cel;
+
+    // Initialize the animation in the slot
+    AnimSpriteCelSetup(animSpriteCel, spriteCel, loop, range, iterations, direction, stepIndex, stepsCount);
+
+    // Statistics
+    animSpriteCelPool->acquiredCount++;
+    animSpriteCelPool->acquisitionsCount++;
+    if (animSpriteCelPool->acquiredCount > animSpriteCelPool->acquiredMax) {
+        animSpriteCelPool->acquiredMax = animSpriteCelPool->acquiredCount;
+    }
+
+    // Return the AnimSpriteCel
+    return animSpriteCel;
+}
+
+// Gives an AnimSpriteCel back to the pool
+int32 AnimSpriteCelPoolRelease(AnimSpriteCelPool *animSpriteCelPool, AnimSpriteCel *animSpriteCel) {
+
+    // If the pool is undefined
+    if (animSpriteCelPool == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelPool unknown.\n");
+        return -1;
+    }
+
+    // If the AnimSpriteCel is undefined
+    if (animSpriteCel == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCel unknown.\n");
+        return -1;
+    }
+
+    // If the AnimSpriteCel comes from another pool
+    if (animSpriteCel->pool != animSpriteCelPool) {
+        // Return error
+        printf("Error: AnimSpriteCel not taken from this AnimSpriteCelPool.\n");
+        return -1;
+    }
+
+    // If the AnimSpriteCel is already free
+    if (animSpriteCel->spriteCel == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCel already released.\n");
+        return -1;
+    }
+
+    // Remove it from its system if registered, it is kept if packed receivers would be retargeted
+    if ((animSpriteCel->system != NULL) && (AnimSpriteCelSystemUnregister(animSpriteCel->system, animSpriteCel) < 0)) {
+        // Return error
+        printf("Error <- AnimSpriteCelSystemUnregister()\n");
+        return -1;
+    }
+
+    // Mark the slot as free and push it
+    animSpriteCel->spriteCel = NULL;
+    animSpriteCelPool->freeSlots[animSpriteCelPool->freeCount] = animSpriteCel;
+    animSpriteCelPool->freeCount++;
+    animSpriteCelPool->acquiredCount--;
+
+    // Return success
+    return 1;
+}
+
+// Cleans up the AnimSpriteCelPool
+int32 AnimSpriteCelPoolCleanup(AnimSpriteCelPool *animSpriteCelPool) {
+
+    // If the pool is undefined
+    if (animSpriteCelPool == NULL) {
+        printf("Error: AnimSpriteCelPool unknown.\n");
+        return -1;
+    }
+
+    // If AnimSpriteCels are still in use
+    if (animSpriteCelPool->acquiredCount > 0) {
+        // Display warning
+        printf("Warning: AnimSpriteCelPool cleaned up with %u AnimSpriteCels in use.\n", animSpriteCelPool->acquiredCount);
+    }
+
+    // Free the stack of free slots if present
+    if (animSpriteCelPool->freeSlots != NULL) {
+        FreeMem(animSpriteCelPool->freeSlots, animSpriteCelPool->animSpriteCelsMax * sizeof(AnimSpriteCel *));
+        animSpriteCelPool->freeSlots = NULL;
+    }
+
+    // Free the slab if present
+    if (animSpriteCelPool->slab != NULL) {
+        FreeMem(animSpriteCelPool->slab, animSpriteCelPool->animSpriteCelsMax * animSpriteCelPool->slotSize);
+        animSpriteCelPool->slab = NULL;
+    }
+
+    // Free the AnimSpriteCelPool structure itself
+    FreeMem(animSpriteCelPool, sizeof(AnimSpriteCelPool));
+
+    // Return success
+    return 1;
+}
\ No newline at end of file
@@ -0,0 +1,112 @@
+#ifndef ANIMSPRITECELPOOL_H
+#define ANIMSPRITECELPOOL_H
+
+/******************************************************************************
+**
+**  AnimSpriteCelPool - Fixed-capacity allocator of AnimSpriteCels (3DO Cel Engine)
+**
+**  Author: Christophe Geoffroy (Topper) - MIT License
+**  Last Updated: 2026-10-17
+**
+**  AnimSpriteCelInitialization() allocates the structure, the step array and
+**  the timeline separately, and clones the CCB of the SpriteCel. Spawning and
+**  removing effects while the game runs therefore fragments memory and costs
+**  allocator time.
+**
+**  An AnimSpriteCelPool reserves, once, a single slab able to hold a given
+**  number of AnimSpriteCels with up to a given number of steps and frames. Each
+**  slot of the slab holds the AnimSpriteCel structure, its CCB, its step
+**  array, its frame descriptors and its timeline side by side. AnimSpriteCelPoolAcquire() takes a free slot and
+**  initializes it like AnimSpriteCelInitialization(), AnimSpriteCelPoolRelease()
+**  gives it back. Both are O(1) through a stack of free slots and never call
+**  the allocator.
+**
+**  Important Notes:
+**
+**    - An AnimSpriteCel taken from a pool behaves exactly like one created by
+**      AnimSpriteCelInitialization(). AnimSpriteCelCleanup() gives it back to
+**      its pool, so it can also be owned by an AnimSpriteCelSystem.
+**
+**    - The frame descriptor table of a slot holds "framesMax" frames:
+**      AnimSpriteCelStepConfiguration() refuses a frame index beyond it
+**      instead of growing the table.
+**
+**    - The CCB of a slot is a copy of the SpriteCel CCB, as CloneCel() with
+**      CLONECEL_CCB_ONLY would give. It must not be deleted with DeleteCel().
+**
+**    - AnimSpriteCelPoolCleanup() frees the slab: every AnimSpriteCel taken
+**      from the pool must be released (or no longer used) before.
+**
+**  Structure Roles:
+**
+**    AnimSpriteCelPool
+**      - slab: memory block holding all the slots
+**      - slotSize: size of a slot in bytes
+**      - animSpriteCelsMax: number of slots
+**      - stepsMax: maximum number of steps of an AnimSpriteCel
+**      - framesMax: number of SpriteCel frames the steps of an AnimSpriteCel may display
+**      - freeSlots: stack of free AnimSpriteCels
+**      - freeCount: number of free AnimSpriteCels
+**      - acquiredCount: number of AnimSpriteCels in use
+**      - acquiredMax: high-water mark of "acquiredCount"
+**      - acquisitionsCount: total number of successful acquisitions
+**      - failuresCount: number of refused acquisitions (pool empty or too many steps)
+**
+**  Main Functions:
+**
+**    AnimSpriteCelPoolInitialization()
+**      -> Reserves the slab for a given number of AnimSpriteCels, steps and
+**         frames.
+**
+**    AnimSpriteCelPoolAcquire()
+**      -> Takes a free AnimSpriteCel and initializes it. Same parameters as
+**         AnimSpriteCelInitialization().
+**
+**    AnimSpriteCelPoolRelease()
+**      -> Gives an AnimSpriteCel back to the pool.
+**
+**    AnimSpriteCelPoolCleanup()
+**      -> Frees the slab and the pool.
+**
+******************************************************************************/
+
+// int32
+#include "types.h"
+// AnimSpriteCel
+#include "AnimSpriteCel.h"
+
+struct AnimSpriteCelPool {
+    // Memory block holding all the slots
+    uint8 *slab;
+    // Size of a slot in bytes
+    uint32 slotSize;
+    // Number of slots
+    uint32 animSpriteCelsMax;
+    // Maximum number of steps of an AnimSpriteCel
+    uint32 stepsMax;
+    // Number of SpriteCel frames the steps of an AnimSpriteCel may display
+    uint32 framesMax;
+    // Stack of free AnimSpriteCels
+    AnimSpriteCel **freeSlots;
+    // Number of free AnimSpriteCels
+    uint32 freeCount;
+    // Number of AnimSpriteCels in use
+    uint32 acquiredCount;
+    // High-water mark of AnimSpriteCels in use
+    uint32 acquiredMax;
+    // Total number of successful acquisitions
+    uint32 acquisitionsCount;
+    // Number of refused acquisitions
+    uint32 failuresCount;
+};
+
+// Initialization of an AnimSpriteCelPool
+AnimSpriteCelPool *AnimSpriteCelPoolInitialization(uint32 animSpriteCelsMax, uint32 stepsMax, uint32 framesMax);
+// Takes an AnimSpriteCel from the pool
+AnimSpriteCel *AnimSpriteCelPoolAcquire(AnimSpriteCelPool *animSpriteCelPool, SpriteCel *spriteCel, AnimSpriteCelLoop loop, AnimSpriteCelRange range, uint32 iterations, int32 direction, uint32 stepIndex, uint32 stepsCount);
+// Gives an AnimSpriteCel back to the pool
+int32 AnimSpriteCelPoolRelease(AnimSpriteCelPool *animSpriteCelPool, AnimSpriteCel *animSpriteCel);
+// Cleans up the AnimSpriteCelPool
+int32 AnimSpriteCelPoolCleanup(AnimSpriteCelPool *animSpriteCelPool);
+
+#endif // ANIMSPRITECELPOOL_H
@@ -0,0 +1,320 @@
+#include "AnimSpriteCelSequence.h"
+
+// LIST_END
+#include "DefinitionsArguments.h"
+// AllocMem(), FreeMem(), MEMTYPE_DRAM
+#include "mem.h"
+// CloneCel()
+#include "celutils.h"
+// memset()
+#include "string.h"
+// printf()
+#include "stdio.h"
+
+// Initialization of an AnimSpriteCelSequence
+AnimSpriteCelSequence *AnimSpriteCelSequenceInitialization(SpriteCel *spriteCel, AnimSpriteCelLoop loop, AnimSpriteCelRange range, uint32 stepsCount) {
+
+    // AnimSpriteCelSequence instance
+    AnimSpriteCelSequence *animSpriteCelSequence = NULL;
+
+    // If the sprite sheet doesn't exist
+    if (spriteCel == NULL) {
+        // Display error message
+        printf("Error: SpriteCel unknown.\n");
+        return NULL;
+    }
+
+    // Minimum number of steps = 2
+    stepsCount = (stepsCount > 1) ? stepsCount : 2;
+
+    // Allocate memory for AnimSpriteCelSequence
+    animSpriteCelSequence = (AnimSpriteCelSequence *)AllocMem(sizeof(AnimSpriteCelSequence), MEMTYPE_DRAM);
+    // If allocation fails
+    if (animSpriteCelSequence == NULL) {
+        // Display error message
+        printf("Error: Failed to allocate memory for AnimSpriteCelSequence.\n");
+        return NULL;
+    }
+
+    // Allocate memory for the step array
+    animSpriteCelSequence->steps = (AnimSpriteCelStep *)AllocMem(stepsCount * sizeof(AnimSpriteCelStep), MEMTYPE_DRAM);
+    // If step allocation fails
+    if (animSpriteCelSequence->steps == NULL) {
+        // Free previously allocated AnimSpriteCelSequence
+        FreeMem(animSpriteCelSequence, sizeof(AnimSpriteCelSequence));
+        // Display error message
+        printf("Error: Failed to allocate memory for AnimSpriteCelSequence steps.\n");
+        return NULL;
+    }
+
+    // Allocate memory for the descriptor of the first frame, grown by the step configurations
+    animSpriteCelSequence->frames = (AnimSpriteCelFrame *)AllocMem(sizeof(AnimSpriteCelFrame), MEMTYPE_DRAM);
+    // If frame allocation fails
+    if (animSpriteCelSequence->frames == NULL) {
+        // Free previously allocated steps and AnimSpriteCelSequence
+        FreeMem(animSpriteCelSequence->steps, stepsCount * sizeof(AnimSpriteCelStep));
+        FreeMem(animSpriteCelSequence, sizeof(AnimSpriteCelSequence));
+        // Display error message
+        printf("Error: Failed to allocate memory for AnimSpriteCelSequence frames.\n");
+        return NULL;
+    }
+
+    // Allocate memory for the cumulative durations (up to 2 * stepsCount - 2 positions in ALTERNATE)
+    animSpriteCelSequence->timeline = (uint32 *)AllocMem(((2 * stepsCount) - 1) * sizeof(uint32), MEMTYPE_DRAM);
+    // If timeline allocation fails
+    if (animSpriteCelSequence->timeline == NULL) {
+        // Free previously allocated frames, steps and AnimSpriteCelSequence
+        FreeMem(animSpriteCelSequence->frames, sizeof(AnimSpriteCelFrame));
+        FreeMem(animSpriteCelSequence->steps, stepsCount * sizeof(AnimSpriteCelStep));
+        FreeMem(animSpriteCelSequence, sizeof(AnimSpriteCelSequence));
+        // Display error message
+        printf("Error: Failed to allocate memory for AnimSpriteCelSequence timeline.\n");
+        return NULL;
+    }
+
+    // Sequence parameters
+    animSpriteCelSequence->spriteCel = spriteCel;
+    animSpriteCelSequence->loop = loop;
+    animSpriteCelSequence->range = range;
+    animSpriteCelSequence->stepsCount = stepsCount;
+    animSpriteCelSequence->framesCount = 1;
+    // Reference of the caller
+    animSpriteCelSequence->referencesCount = 1;
+
+    // Unconfigured steps display the first frame and wait
+    memset(animSpriteCelSequence->steps, 0, (size_t)stepsCount * sizeof(AnimSpriteCelStep));
+    AnimSpriteCelFrameResolve(spriteCel, animSpriteCelSequence->frames, 0);
+
+    // Return the newly created AnimSpriteCelSequence
+    return animSpriteCelSequence;
+}
+
+// Configuration of a step in an AnimSpriteCelSequence
+int32 AnimSpriteCelSequenceStepConfiguration(AnimSpriteCelSequence *animSpriteCelSequence, uint32 stepIndex, uint32 frameIndex, int32 frameDuration, AnimSpriteCel *animSpriteCelReceiver) {
+
+    // If the AnimSpriteCelSequence is undefined
+    if (animSpriteCelSequence == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSequence unknown.\n");
+        return -1;
+    }
+
+    // If instances already share the steps
+    if (animSpriteCelSequence->referencesCount > 1) {
+        // Return error
+        printf("Error: AnimSpriteCelSequence shared by %u AnimSpriteCels.\n", animSpriteCelSequence->referencesCount - 1);
+        return -1;
+    }
+
+    // Clamp stepIndex if out of bounds
+    if (stepIndex >= animSpriteCelSequence->stepsCount) {
+        // Display warning
+        printf("Warning: AnimSpriteCelSequence stepIndex %u out of bounds. Clamped to last index.\n", stepIndex);
+        // Adjust to the last valid index
+        stepIndex = animSpriteCelSequence->stepsCount - 1;
+    }
+
+    // Make room for the frame descriptor
+    if (AnimSpriteCelFramesReserve(&animSpriteCelSequence->frames, &animSpriteCelSequence->framesCount, frameIndex) < 0) {
+        // Return error
+        printf("Error <- AnimSpriteCelFramesReserve()\n");
+        return -1;
+    }
+
+    // Configure the sequence step
+    animSpriteCelSequence->steps[stepIndex].frameIndex = frameIndex;
+    animSpriteCelSequence->steps[stepIndex].frameDuration = frameDuration;
+    animSpriteCelSequence->steps[stepIndex].animSpriteCelReceiver = animSpriteCelReceiver;
+    // Resolve the frame descriptor once for all the steps and instances
+    AnimSpriteCelFrameResolve(animSpriteCelSequence->spriteCel, animSpriteCelSequence->frames, frameIndex);
+
+    // Return success
+    return 1;
+}
+
+// Configuration of multiple steps in an AnimSpriteCelSequence
+int32 AnimSpriteCelSequenceStepsConfiguration(AnimSpriteCelSequence *animSpriteCelSequence, int32 start, ...) {
+
+    // Function argument list
+    va_list args;
+    // Step index
+    uint32 stepIndex = 0;
+    // Frame data
+    uint32 frameIndex = 0;
+    int32 frameDuration = 1;
+    AnimSpriteCel *animSpriteCelReceiver = NULL;
+
+    // Begin reading arguments
+    va_start(args, start);
+
+    // Loop until sentinel value
+    while (1) {
+
+        // Retrieve step index
+        stepIndex = va_arg(args, uint32);
+
+        // End of argument list
+        if (stepIndex == LIST_END) {
+            // Exit loop
+            break;
+        }
+
+        // Retrieve remaining step parameters
+        frameIndex = va_arg(args, uint32);
+        frameDuration = va_arg(args, int32);
+        animSpriteCelReceiver = va_arg(args, AnimSpriteCel *);
+
+        // Step configuration
+        if (AnimSpriteCelSequenceStepConfiguration(animSpriteCelSequence, stepIndex, frameIndex, frameDuration, animSpriteCelReceiver) < 0) {
+            // End argument processing
+            va_end(args);
+            // Return error
+            printf("Error <- AnimSpriteCelSequenceStepConfiguration()\n");
+            return -1;
+        }
+    }
+
+    // End argument processing
+    va_end(args);
+
+    // Return success
+    return 1;
+}
+
+// Event ID of a step in an AnimSpriteCelSequence
+int32 AnimSpriteCelSequenceStepEvent(AnimSpriteCelSequence *animSpriteCelSequence, uint32 stepIndex, uint32 eventId) {
+
+    // If the AnimSpriteCelSequence is undefined
+    if (animSpriteCelSequence == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSequence unknown.\n");
+        return -1;
+    }
+
+    // If instances already share the steps
+    if (animSpriteCelSequence->referencesCount > 1) {
+        // Return error
+        printf("Error: AnimSpriteCelSequence shared by %u AnimSpriteCels.\n", animSpriteCelSequence->referencesCount - 1);
+        return -1;
+    }
+
+    // If the step doesn't exist
+    if (stepIndex >= animSpriteCelSequence->stepsCount) {
+        // Return error
+        printf("Error: AnimSpriteCelSequence stepIndex %u out of bounds (%u steps).\n", stepIndex, animSpriteCelSequence->stepsCount);
+        return -1;
+    }
+
+    // Every instance sends the event when it reaches the step
+    animSpriteCelSequence->steps[stepIndex].eventId = eventId;
+
+    // Return success
+    return 1;
+}
+
+// Drops the reference of an instance from AnimSpriteCelCleanup()
+static int32 AnimSpriteCelSequenceInstanceRelease(AnimSpriteCel *animSpriteCel) {
+
+    // Drop the reference instead of freeing the shared steps
+    AnimSpriteCelSequenceCleanup(animSpriteCel->sequence);
+    animSpriteCel->sequence = NULL;
+    animSpriteCel->steps = NULL;
+    animSpriteCel->frames = NULL;
+    animSpriteCel->timeline = NULL;
+
+    // Return success
+    return 1;
+}
+
+// Creates an AnimSpriteCel playing the sequence
+AnimSpriteCel *AnimSpriteCelSequenceInstance(AnimSpriteCelSequence *animSpriteCelSequence, uint32 iterations, int32 direction, uint32 stepIndex) {
+
+    // AnimSpriteCel instance
+    AnimSpriteCel *animSpriteCel = NULL;
+
+    // If the AnimSpriteCelSequence is undefined
+    if (animSpriteCelSequence == NULL) {
+        // Display error message
+        printf("Error: AnimSpriteCelSequence unknown.\n");
+        return NULL;
+    }
+
+    // Allocate memory for AnimSpriteCel (the steps, the frames and the timeline are shared)
+    animSpriteCel = (AnimSpriteCel *)AllocMem(sizeof(AnimSpriteCel), MEMTYPE_DRAM);
+    // If allocation fails
+    if (animSpriteCel == NULL) {
+        // Display error message
+        printf("Error: Failed to allocate memory for AnimSpriteCel.\n");
+        return NULL;
+    }
+
+    // Not taken from a pool, steps of the sequence
+    animSpriteCel->pool = NULL;
+    animSpriteCel->sequence = animSpriteCelSequence;
+    animSpriteCel->file = NULL;
+    animSpriteCel->table = NULL;
+    animSpriteCel->release = AnimSpriteCelSequenceInstanceRelease;
+    animSpriteCel->packedSteps = NULL;
+    animSpriteCel->frames = animSpriteCelSequence->frames;
+    animSpriteCel->framesCount = animSpriteCelSequence->framesCount;
+    animSpriteCel->steps = animSpriteCelSequence->steps;
+    animSpriteCel->timeline = animSpriteCelSequence->timeline;
+
+    // Clone the SpriteCel CCB (Command Control Block)
+    animSpriteCel->cel = CloneCel(animSpriteCelSequence->spriteCel->cel, CLONECEL_CCB_ONLY);
+
+    // Initialize the playhead, the steps are left untouched
+    AnimSpriteCelSetup(animSpriteCel, animSpriteCelSequence->spriteCel, animSpriteCelSequence->loop, animSpriteCelSequence->range, iterations, direction, stepIndex, animSpriteCelSequence->stepsCount);
+    // Display the starting step
+    AnimSpriteCelUpdate(animSpriteCel);
+
+    // Reference of the instance
+    animSpriteCelSequence->referencesCount++;
+
+    // Return the newly created AnimSpriteCel
+    return animSpriteCel;
+}
+
+// Drops a reference to the AnimSpriteCelSequence
+int32 AnimSpriteCelSequenceCleanup(AnimSpriteCelSequence *animSpriteCelSequence) {
+
+    // If the AnimSpriteCelSequence is undefined
+    if (animSpriteCelSequence == NULL) {
+        printf("Error: AnimSpriteCelSequence unknown.\n");
+        return -1;
+    }
+
+    // Drop the reference
+    animSpriteCelSequence->referencesCount--;
+
+    // If instances still play the sequence
+    if (animSpriteCelSequence->referencesCount > 0) {
+        // Keep it
+        return 1;
+    }
+
+    // Free the step array if present
+    if (animSpriteCelSequence->steps != NULL) {
+        FreeMem(animSpriteCelSequence->steps, animSpriteCelSequence->stepsCount * sizeof(AnimSpriteCelStep));
+        animSpriteCelSequence->steps = NULL;
+    }
+
+    // Free the frame descriptors if present
+    if (animSpriteCelSequence->frames != NULL) {
+        FreeMem(animSpriteCelSequence->frames, animSpriteCelSequence->framesCount * sizeof(AnimSpriteCelFrame));
+        animSpriteCelSequence->frames = NULL;
+    }
+
+    // Free the timeline if present
+    if (animSpriteCelSequence->timeline != NULL) {
+        FreeMem(animSpriteCelSequence->timeline, ((2 * animSpriteCelSequence->stepsCount) - 1) * sizeof(uint32));
+        animSpriteCelSequence->timeline = NULL;
+    }
+
+    // Free the AnimSpriteCelSequence structure itself
+    animSpriteCelSequence->spriteCel = NULL;
+    FreeMem(animSpriteCelSequence, sizeof(AnimSpriteCelSequence));
+
+    // Return success
+    return 1;
+}
@@ -0,0 +1,122 @@
+#ifndef ANIMSPRITECELSEQUENCE_H
+#define ANIMSPRITECELSEQUENCE_H
+
+/******************************************************************************
+**
+**  AnimSpriteCelSequence - Step sequence shared by many AnimSpriteCels (3DO Cel Engine)
+**
+**  Author: Christophe Geoffroy (Topper) - MIT License
+**  Last Updated: 2026-10-17
+**
+**  Every AnimSpriteCel created by AnimSpriteCelInitialization() holds its own
+**  copy of the steps and of the timeline. A crowd of identical effects (sparks,
+**  coins, torches...) therefore allocates and configures the same steps once
+**  per animation.
+**
+**  An AnimSpriteCelSequence holds the steps, their frame descriptors, the loop
+**  mode, the random range and the timeline once.
+**  AnimSpriteCelSequenceInstance() creates an AnimSpriteCel that only owns
+**  its CCB and its playhead (step index, direction, remaining cycles,
+**  iterations) and points to the steps of the sequence. No step
+**  configuration is needed per instance.
+**
+**  The sequence is reference counted: the caller holds one reference, each
+**  instance holds one more. AnimSpriteCelSequenceCleanup() and the cleanup
+**  of an instance drop a reference, the sequence is freed with the last one.
+**
+**  Important Notes:
+**
+**    - A sequence is immutable once shared: its steps can only be configured
+**      while no instance refers to it.
+**
+**    - AnimSpriteCelStepConfiguration() is refused on an instance. Its steps
+**      belong to the sequence.
+**
+**    - The receiver of a step is part of the sequence: every instance triggers
+**      the same receiver when it leaves that step. The event ID of a step is
+**      shared the same way.
+**
+**    - An instance behaves like any other AnimSpriteCel: it can be run,
+**      advanced, sought, triggered and registered in an AnimSpriteCelSystem.
+**      It is therefore a full AnimSpriteCel, 172 bytes on the 3DO (264 on a
+**      64-bit host), of which 16 are its playhead. It only saves its steps,
+**      frame descriptors and timeline.
+**
+**  Structure Roles:
+**
+**    AnimSpriteCelSequence
+**      - spriteCel: sprite sheet of the frames
+**      - loop: NORMAL, REVERSE, or ALTERNATE
+**      - range: FULL, HALF, or QUARTER (random durations)
+**      - stepsCount: number of steps
+**      - steps: shared animation steps
+**      - frames: shared frame descriptors of the steps, indexed by frame
+**      - framesCount: number of frame descriptors
+**      - timeline: shared cumulative durations (built by the instances)
+**      - referencesCount: caller reference plus one per instance
+**
+**  Main Functions:
+**
+**    AnimSpriteCelSequenceInitialization()
+**      -> Creates a sequence with a given number of steps.
+**
+**    AnimSpriteCelSequenceStepConfiguration()
+**      -> Defines a step of the sequence. Same parameters as
+**         AnimSpriteCelStepConfiguration().
+**
+**    AnimSpriteCelSequenceStepsConfiguration()
+**      -> Variadic function to configure multiple steps at once
+**         (LIST_START, stepIndex, frameIndex, frameDuration, receiver, ..., LIST_END).
+**
+**    AnimSpriteCelSequenceStepEvent()
+**      -> Gives a step of the sequence an event ID. Same parameters as
+**         AnimSpriteCelStepEvent().
+**
+**    AnimSpriteCelSequenceInstance()
+**      -> Creates an AnimSpriteCel playing the sequence.
+**
+**    AnimSpriteCelSequenceCleanup()
+**      -> Drops a reference, frees the sequence with the last one.
+**
+******************************************************************************/
+
+// int32
+#include "types.h"
+// AnimSpriteCel
+#include "AnimSpriteCel.h"
+
+struct AnimSpriteCelSequence {
+    // Sprite sheet of the frames
+    SpriteCel *spriteCel;
+    // Loop mode
+    AnimSpriteCelLoop loop;
+    // Random duration range
+    AnimSpriteCelRange range;
+    // Number of steps
+    uint32 stepsCount;
+    // Shared animation steps
+    AnimSpriteCelStep *steps;
+    // Shared frame descriptors of the steps
+    AnimSpriteCelFrame *frames;
+    // Number of frame descriptors
+    uint32 framesCount;
+    // Shared cumulative durations
+    uint32 *timeline;
+    // Caller reference plus one per instance
+    uint32 referencesCount;
+};
+
+// Initialization of an AnimSpriteCelSequence
+AnimSpriteCelSequence *AnimSpriteCelSequenceInitialization(SpriteCel *spriteCel, AnimSpriteCelLoop loop, AnimSpriteCelRange range, uint32 stepsCount);
+// Configuration of a step in an AnimSpriteCelSequence
+int32 AnimSpriteCelSequenceStepConfiguration(AnimSpriteCelSequence *animSpriteCelSequence, uint32 stepIndex, uint32 frameIndex, int32 frameDuration, AnimSpriteCel *animSpriteCelReceiver);
+// Configuration of multiple steps in an AnimSpriteCelSequence
+int32 AnimSpriteCelSequenceStepsConfiguration(AnimSpriteCelSequence *animSpriteCelSequence, int32 start, ...);
+// Event ID of a step in an AnimSpriteCelSequence
+int32 AnimSpriteCelSequenceStepEvent(AnimSpriteCelSequence *animSpriteCelSequence, uint32 stepIndex, uint32 eventId);
+// Creates an AnimSpriteCel playing the sequence
+AnimSpriteCel *AnimSpriteCelSequenceInstance(AnimSpriteCelSequence *animSpriteCelSequence, uint32 iterations, int32 direction, uint32 stepIndex);
+// Drops a reference to the AnimSpriteCelSequence
+int32 AnimSpriteCelSequenceCleanup(AnimSpriteCelSequence *animSpriteCelSequence);
+
+#endif // ANIMSPRITECELSEQUENCE_H
@@ -0,0 +1,2777 @@
+#include "AnimSpriteCelSystem.h"
+
+// AllocMem(), FreeMem(), MEMTYPE_DRAM
+#include "mem.h"
+// memset(), memcpy()
+#include "string.h"
+// printf()
+#include "stdio.h"
+
+// Links an AnimSpriteCel in the wheel slot matching its expiry tick
+static void AnimSpriteCelSystemWheelLink(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel) {
+
+    // Ticks before the end of the step
+    uint32 delay = animSpriteCel->expiryTick - animSpriteCelSystem->tick;
+    // Level of the wheel
+    uint32 level = 0;
+    // Target slot
+    AnimSpriteCel **slot = NULL;
+
+    // Find the first level whose range covers the delay
+    while ((level < ANIMSPRITECELSYSTEM_WHEEL_LEVELS) && (delay >= ((uint32)1 << ((level + 1) * ANIMSPRITECELSYSTEM_WHEEL_BITS)))) {
+        level++;
+    }
+
+    // If the delay is beyond the range of the wheel
+    if (level == ANIMSPRITECELSYSTEM_WHEEL_LEVELS) {
+        slot = &animSpriteCelSystem->wheelOverflow;
+    } else {
+        slot = &animSpriteCelSystem->wheel[level][(animSpriteCel->expiryTick >> (level * ANIMSPRITECELSYSTEM_WHEEL_BITS)) & (ANIMSPRITECELSYSTEM_WHEEL_SLOTS - 1)];
+    }
+
+    // Append to the slot (the head keeps a link to the tail)
+    if (*slot == NULL) {
+        *slot = animSpriteCel;
+        animSpriteCel->wheelPrevious = animSpriteCel;
+    } else {
+        (*slot)->wheelPrevious->wheelNext = animSpriteCel;
+        animSpriteCel->wheelPrevious = (*slot)->wheelPrevious;
+        (*slot)->wheelPrevious = animSpriteCel;
+    }
+    animSpriteCel->wheelNext = NULL;
+    animSpriteCel->wheelSlot = slot;
+}
+
+// Unlinks an AnimSpriteCel from its wheel slot
+static void AnimSpriteCelSystemWheelUnlink(AnimSpriteCel *animSpriteCel) {
+
+    // Slot holding the AnimSpriteCel
+    AnimSpriteCel **slot = animSpriteCel->wheelSlot;
+
+    // If it is the head of the slot
+    if (*slot == animSpriteCel) {
+        // The next one becomes the head and keeps the tail
+        *slot = animSpriteCel->wheelNext;
+        if (animSpriteCel->wheelNext != NULL) {
+            animSpriteCel->wheelNext->wheelPrevious = animSpriteCel->wheelPrevious;
+        }
+    } else {
+        animSpriteCel->wheelPrevious->wheelNext = animSpriteCel->wheelNext;
+        // If it is the tail, the head now points to the previous one
+        if (animSpriteCel->wheelNext != NULL) {
+            animSpriteCel->wheelNext->wheelPrevious = animSpriteCel->wheelPrevious;
+        } else {
+            (*slot)->wheelPrevious = animSpriteCel->wheelPrevious;
+        }
+    }
+
+    animSpriteCel->wheelSlot = NULL;
+    animSpriteCel->wheelPrevious = NULL;
+    animSpriteCel->wheelNext = NULL;
+}
+
+// Spreads the content of a slot over the lower levels
+static void AnimSpriteCelSystemWheelSpread(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel **slot) {
+
+    // Detached list of the slot
+    AnimSpriteCel *list = *slot;
+    // Current AnimSpriteCel
+    AnimSpriteCel *animSpriteCel = NULL;
+
+    // Detach the whole list so that relinking can't reach it again
+    *slot = NULL;
+
+    while (list != NULL) {
+        animSpriteCel = list;
+        list = list->wheelNext;
+        AnimSpriteCelSystemWheelLink(animSpriteCelSystem, animSpriteCel);
+    }
+}
+
+// Cascades the upper levels whose slot changed since the previous tick
+static void AnimSpriteCelSystemWheelCascade(AnimSpriteCelSystem *animSpriteCelSystem, uint32 previousTick) {
+
+    // Level of the wheel
+    int32 level = 0;
+    // Bit shift of the level
+    uint32 shift = 0;
+    // Tick reached by the wheel
+    uint32 tick = animSpriteCelSystem->tick;
+
+    // Overflow list, every 2^24 ticks
+    shift = ANIMSPRITECELSYSTEM_WHEEL_LEVELS * ANIMSPRITECELSYSTEM_WHEEL_BITS;
+    if ((previousTick >> shift) != (tick >> shift)) {
+        AnimSpriteCelSystemWheelSpread(animSpriteCelSystem, &animSpriteCelSystem->wheelOverflow);
+    }
+
+    // From the highest level down, so that each level feeds the next one
+    for (level = ANIMSPRITECELSYSTEM_WHEEL_LEVELS - 1; level > 0; level--) {
+        shift = level * ANIMSPRITECELSYSTEM_WHEEL_BITS;
+        if ((previousTick >> shift) != (tick >> shift)) {
+            AnimSpriteCelSystemWheelSpread(animSpriteCelSystem, &animSpriteCelSystem->wheel[level][(tick >> shift) & (ANIMSPRITECELSYSTEM_WHEEL_SLOTS - 1)]);
+        }
+    }
+}
+
+// Merges two lists sorted by registration order
+static AnimSpriteCel *AnimSpriteCelSystemWheelMerge(AnimSpriteCel *first, AnimSpriteCel *second) {
+
+    // Head of the merged list
+    AnimSpriteCel *head = NULL;
+    // Tail of the merged list
+    AnimSpriteCel **tail = &head;
+
+    while ((first != NULL) && (second != NULL)) {
+        if (first->systemIndex < second->systemIndex) {
+            *tail = first;
+            first = first->wheelNext;
+        } else {
+            *tail = second;
+            second = second->wheelNext;
+        }
+        tail = &(*tail)->wheelNext;
+    }
+    *tail = (first != NULL) ? first : second;
+
+    return head;
+}
+
+// Sorts a detached list by registration order
+static AnimSpriteCel *AnimSpriteCelSystemWheelSort(AnimSpriteCel *list) {
+
+    // Sorted sublists of 2^n AnimSpriteCels
+    AnimSpriteCel *sublists[32];
+    // Current AnimSpriteCel
+    AnimSpriteCel *animSpriteCel = NULL;
+    // Sublist index
+    uint32 index = 0;
+
+    memset(sublists, 0, sizeof(sublists));
+
+    // Bottom-up merge sort, without recursion
+    while (list != NULL) {
+        animSpriteCel = list;
+        list = list->wheelNext;
+        animSpriteCel->wheelNext = NULL;
+        for (index = 0; sublists[index] != NULL; index++) {
+            animSpriteCel = AnimSpriteCelSystemWheelMerge(sublists[index], animSpriteCel);
+            sublists[index] = NULL;
+        }
+        sublists[index] = animSpriteCel;
+    }
+
+    // Merge the remaining sublists
+    for (index = 0; index < 32; index++) {
+        if (sublists[index] != NULL) {
+            list = AnimSpriteCelSystemWheelMerge(sublists[index], list);
+        }
+    }
+
+    return list;
+}
+
+// Dispatches pending triggers, oldest first
+static void AnimSpriteCelSystemTriggerDispatch(AnimSpriteCelSystem *animSpriteCelSystem, uint32 triggersCount) {
+
+    // Trigger being dispatched
+    AnimSpriteCelSystemTrigger trigger;
+    // Triggers dispatched in this tick
+    uint32 dispatchedCount = 0;
+    // Queue index
+    uint32 index = 0;
+
+    while ((animSpriteCelSystem->triggersCount > 0) && (triggersCount > 0)) {
+
+        // If the budget of the tick is spent
+        if ((animSpriteCelSystem->triggersBudget != 0) && (dispatchedCount >= animSpriteCelSystem->triggersBudget)) {
+            animSpriteCelSystem->triggersDeferred += animSpriteCelSystem->triggersCount;
+            break;
+        }
+
+        // If the chain went through more triggers than there are animations, it loops
+        trigger = animSpriteCelSystem->triggers[animSpriteCelSystem->triggersFirst];
+        if ((trigger.depth > 1) && (trigger.depth > animSpriteCelSystem->animSpriteCelsCount)) {
+            // Warn once
+            if (animSpriteCelSystem->cyclesCount == 0) {
+                printf("Warning: AnimSpriteCelSystem trigger cycle, continued on the next tick.\n");
+            }
+            animSpriteCelSystem->cyclesCount++;
+            break;
+        }
+
+        // Pop the oldest trigger
+        animSpriteCelSystem->triggersFirst++;
+        if (animSpriteCelSystem->triggersFirst == animSpriteCelSystem->triggersMax) {
+            animSpriteCelSystem->triggersFirst = 0;
+        }
+        animSpriteCelSystem->triggersCount--;
+        triggersCount--;
+
+        // If the receiver was unregistered meanwhile
+        if (trigger.animSpriteCel == NULL) {
+            continue;
+        }
+
+        // Triggers sent by the receiver are one link further in the chain
+        animSpriteCelSystem->triggerDepth = trigger.depth;
+        AnimSpriteCelTrigger(trigger.animSpriteCel);
+        animSpriteCelSystem->triggerDepth = 0;
+        dispatchedCount++;
+    }
+
+    // The triggers left for the next tick start new chains
+    for (index = 0; index < animSpriteCelSystem->triggersCount; index++) {
+        animSpriteCelSystem->triggers[(animSpriteCelSystem->triggersFirst + index) % animSpriteCelSystem->triggersMax].depth = 1;
+    }
+}
+
+// Visits a registered AnimSpriteCel for one display cycle, returns 0 if it is waiting or done
+uint32 AnimSpriteCelSystemVisit(AnimSpriteCel *animSpriteCel) {
+
+    // If the animation is waiting for a trigger
+    if (ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) == 0) {
+        return 0;
+    }
+
+    // If all iterations have been completed
+    if (animSpriteCel->iterationsCount == 0) {
+        return 0;
+    }
+
+    // If the animation runs at another speed, its cycles come from the accumulator
+    if (animSpriteCel->speed != ANIMSPRITECEL_SPEED_NORMAL) {
+        AnimSpriteCelSpeedRun(animSpriteCel);
+        return 1;
+    }
+
+    // If it's not time to change steps yet
+    if (animSpriteCel->remainingCycles > 0) {
+        // Decrement the remaining display cycles
+        animSpriteCel->remainingCycles--;
+        return 1;
+    }
+
+    // Advance to the next animation step
+    AnimSpriteCelNextStep(animSpriteCel);
+    return 1;
+}
+
+// Runs the registered animations of a range of the array (POLLING schedule)
+static void AnimSpriteCelSystemRunRange(AnimSpriteCelSystem *animSpriteCelSystem, uint32 first, uint32 last) {
+
+    // Registered AnimSpriteCels
+    AnimSpriteCel **animSpriteCels = animSpriteCelSystem->animSpriteCels;
+    // Array index
+    uint32 index = 0;
+
+    // For each AnimSpriteCel of the range (already validated at registration)
+    for (index = first; index < last; index++) {
+        AnimSpriteCelSystemVisit(animSpriteCels[index]);
+    }
+}
+
+// Sorts the woken AnimSpriteCels by registration index (heap sort, in place)
+static void AnimSpriteCelSystemWokenSort(AnimSpriteCel **woken, uint32 wokenCount) {
+
+    // AnimSpriteCel being sifted down
+    AnimSpriteCel *animSpriteCel = NULL;
+    // Size of the heap
+    uint32 heapCount = wokenCount;
+    // Next parent to sift down while building the heap
+    uint32 heapFirst = wokenCount / 2;
+    // Positions in the heap
+    uint32 parent = 0;
+    uint32 child = 0;
+
+    while (heapCount > 1) {
+
+        // Build the heap from its last parent, then move its largest index to the end
+        if (heapFirst > 0) {
+            heapFirst--;
+            parent = heapFirst;
+        } else {
+            heapCount--;
+            animSpriteCel = woken[heapCount];
+            woken[heapCount] = woken[0];
+            woken[0] = animSpriteCel;
+            parent = 0;
+        }
+
+        // Sift the parent down below its larger children
+        animSpriteCel = woken[parent];
+        while (1) {
+            child = parent * 2 + 1;
+            if (child >= heapCount) {
+                break;
+            }
+            if ((child + 1 < heapCount) && (woken[child + 1]->systemIndex > woken[child]->systemIndex)) {
+                child++;
+            }
+            if (woken[child]->systemIndex <= animSpriteCel->systemIndex) {
+                break;
+            }
+            woken[parent] = woken[child];
+            parent = child;
+        }
+        woken[parent] = animSpriteCel;
+    }
+}
+
+// Merges the woken AnimSpriteCels into the active set, keeping the registration order (ACTIVE schedule)
+static void AnimSpriteCelSystemActiveMerge(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+    // Active set and woken AnimSpriteCels
+    AnimSpriteCel **active = animSpriteCelSystem->active;
+    AnimSpriteCel **woken = animSpriteCelSystem->woken;
+    // AnimSpriteCels left to place from each array
+    uint32 activeIndex = animSpriteCelSystem->activeCount;
+    uint32 wokenIndex = animSpriteCelSystem->wokenCount;
+    // Position being filled
+    uint32 index = animSpriteCelSystem->activeCount + animSpriteCelSystem->wokenCount;
+
+    // If nothing was woken
+    if (wokenIndex == 0) {
+        return;
+    }
+
+    AnimSpriteCelSystemWokenSort(woken, wokenIndex);
+
+    // From the end, the larger registration index first (the active set has room for every registered AnimSpriteCel)
+    while (wokenIndex > 0) {
+        index--;
+        if ((activeIndex > 0) && (active[activeIndex - 1]->systemIndex > woken[wokenIndex - 1]->systemIndex)) {
+            activeIndex--;
+            active[index] = active[activeIndex];
+        } else {
+            wokenIndex--;
+            active[index] = woken[wokenIndex];
+        }
+    }
+
+    animSpriteCelSystem->activeCount += animSpriteCelSystem->wokenCount;
+    animSpriteCelSystem->wokenCount = 0;
+}
+
+// Runs the active set and drops the AnimSpriteCels that can't progress any more (ACTIVE schedule)
+static void AnimSpriteCelSystemActiveRun(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+    // Active set
+    AnimSpriteCel **active = animSpriteCelSystem->active;
+    // Current AnimSpriteCel
+    AnimSpriteCel *animSpriteCel = NULL;
+    // Size of the set at the start of the visit
+    uint32 activeCount = animSpriteCelSystem->activeCount;
+    // Array index
+    uint32 index = 0;
+    // AnimSpriteCels kept, packed at the start of the array
+    uint32 keptCount = 0;
+
+    // For each AnimSpriteCel of the set, as in POLLING schedule
+    for (index = 0; index < activeCount; index++) {
+
+        animSpriteCel = active[index];
+
+        // Same visit as in POLLING schedule (it may have been stopped since its last visit)
+        AnimSpriteCelSystemVisit(animSpriteCel);
+
+        // Waiting for a trigger or done: leaves the set until woken
+        if ((ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) == 0) || (animSpriteCel->iterationsCount == 0)) {
+            animSpriteCel->systemActive = 0;
+            continue;
+        }
+        active[keptCount] = animSpriteCel;
+        keptCount++;
+    }
+
+    animSpriteCelSystem->activeCount = keptCount;
+}
+
+// Gives the AnimSpriteCels visited by the next tick outside the WHEEL schedule (every registered one, or the active set)
+static void AnimSpriteCelSystemArray(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel ***animSpriteCels, uint32 *animSpriteCelsCount) {
+
+    // If only the animations able to progress are visited
+    if (animSpriteCelSystem->schedule == ACTIVE) {
+        // The woken ones join the active set now rather than on the next tick, which changes nothing
+        AnimSpriteCelSystemActiveMerge(animSpriteCelSystem);
+        *animSpriteCels = animSpriteCelSystem->active;
+        *animSpriteCelsCount = animSpriteCelSystem->activeCount;
+        return;
+    }
+
+    *animSpriteCels = animSpriteCelSystem->animSpriteCels;
+    *animSpriteCelsCount = animSpriteCelSystem->animSpriteCelsCount;
+}
+
+// Links the CCB of an AnimSpriteCel after the one of another in the draw list (NULL = first)
+static void AnimSpriteCelSystemDrawLink(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel, AnimSpriteCel *animSpriteCelPrevious) {
+
+    // AnimSpriteCel drawn after it
+    AnimSpriteCel *animSpriteCelNext = (animSpriteCelPrevious != NULL) ? animSpriteCelPrevious->drawNext : animSpriteCelSystem->drawFirst;
+
+    animSpriteCel->drawPrevious = animSpriteCelPrevious;
+    animSpriteCel->drawNext = animSpriteCelNext;
+    // The list holds absolute pointers
+    animSpriteCel->cel->ccb_Flags |= CCB_NPABS;
+
+    // Link it to the previous CCB, or make it the first one
+    if (animSpriteCelPrevious != NULL) {
+        animSpriteCelPrevious->drawNext = animSpriteCel;
+        animSpriteCelPrevious->cel->ccb_NextPtr = animSpriteCel->cel;
+        animSpriteCelPrevious->cel->ccb_Flags &= ~CCB_LAST;
+    } else {
+        animSpriteCelSystem->drawFirst = animSpriteCel;
+    }
+
+    // Link the next CCB to it, or make it the last one
+    if (animSpriteCelNext != NULL) {
+        animSpriteCelNext->drawPrevious = animSpriteCel;
+        animSpriteCel->cel->ccb_NextPtr = animSpriteCelNext->cel;
+        animSpriteCel->cel->ccb_Flags &= ~CCB_LAST;
+    } else {
+        animSpriteCelSystem->drawLast = animSpriteCel;
+        animSpriteCel->cel->ccb_NextPtr = NULL;
+        animSpriteCel->cel->ccb_Flags |= CCB_LAST;
+    }
+
+    animSpriteCelSystem->drawCount++;
+}
+
+// Unlinks the CCB of an AnimSpriteCel from the draw list
+static void AnimSpriteCelSystemDrawUnlink(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel) {
+
+    // Neighbours in the list
+    AnimSpriteCel *animSpriteCelPrevious = animSpriteCel->drawPrevious;
+    AnimSpriteCel *animSpriteCelNext = animSpriteCel->drawNext;
+
+    // The previous CCB goes on to the next one, or ends the list
+    if (animSpriteCelPrevious != NULL) {
+        animSpriteCelPrevious->drawNext = animSpriteCelNext;
+        if (animSpriteCelNext != NULL) {
+            animSpriteCelPrevious->cel->ccb_NextPtr = animSpriteCelNext->cel;
+        } else {
+            animSpriteCelPrevious->cel->ccb_NextPtr = NULL;
+            animSpriteCelPrevious->cel->ccb_Flags |= CCB_LAST;
+        }
+    } else {
+        animSpriteCelSystem->drawFirst = animSpriteCelNext;
+    }
+    if (animSpriteCelNext != NULL) {
+        animSpriteCelNext->drawPrevious = animSpriteCelPrevious;
+    } else {
+        animSpriteCelSystem->drawLast = animSpriteCelPrevious;
+    }
+
+    // Drawn alone if the game draws it
+    animSpriteCel->drawPrevious = NULL;
+    animSpriteCel->drawNext = NULL;
+    animSpriteCel->cel->ccb_NextPtr = NULL;
+    animSpriteCel->cel->ccb_Flags |= CCB_LAST;
+
+    animSpriteCelSystem->drawCount--;
+}
+
+// Adds the CCB of a visible AnimSpriteCel to the draw list
+static void AnimSpriteCelSystemDrawShow(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel) {
+
+    // Groups of the list
+    AnimSpriteCelSystemDrawGroup *drawGroups = animSpriteCelSystem->drawGroups;
+    // Group index
+    uint32 groupIndex = 0;
+    // First free group
+    uint32 freeIndex = ANIMSPRITECELSYSTEM_DRAW_UNGROUPED;
+
+    // In SPAWN_ORDER, drawn on top of the others
+    if (animSpriteCelSystem->drawOrder == SPAWN_ORDER) {
+        AnimSpriteCelSystemDrawLink(animSpriteCelSystem, animSpriteCel, animSpriteCelSystem->drawLast);
+        return;
+    }
+
+    // Look for the group of its sheet and palette
+    for (groupIndex = 0; groupIndex < animSpriteCelSystem->drawGroupsCount; groupIndex++) {
+        if (drawGroups[groupIndex].count == 0) {
+            if (freeIndex == ANIMSPRITECELSYSTEM_DRAW_UNGROUPED) {
+                freeIndex = groupIndex;
+            }
+            continue;
+        }
+        if ((drawGroups[groupIndex].spriteCel == animSpriteCel->spriteCel) && (drawGroups[groupIndex].plutPtr == animSpriteCel->cel->ccb_PLUTPtr)) {
+            break;
+        }
+    }
+
+    // If the group exists, drawn after its last CCB
+    if (groupIndex < animSpriteCelSystem->drawGroupsCount) {
+        AnimSpriteCelSystemDrawLink(animSpriteCelSystem, animSpriteCel, drawGroups[groupIndex].last);
+        drawGroups[groupIndex].last = animSpriteCel;
+        drawGroups[groupIndex].count++;
+        animSpriteCel->drawGroup = groupIndex;
+        return;
+    }
+
+    // Otherwise a new group, at the end of the list
+    if ((freeIndex == ANIMSPRITECELSYSTEM_DRAW_UNGROUPED) && (animSpriteCelSystem->drawGroupsCount < animSpriteCelSystem->drawGroupsMax)) {
+        freeIndex = animSpriteCelSystem->drawGroupsCount;
+        animSpriteCelSystem->drawGroupsCount++;
+    }
+    AnimSpriteCelSystemDrawLink(animSpriteCelSystem, animSpriteCel, animSpriteCelSystem->drawLast);
+    animSpriteCel->drawGroup = freeIndex;
+
+    // If every group is taken, drawn at the end without group
+    if (freeIndex == ANIMSPRITECELSYSTEM_DRAW_UNGROUPED) {
+        // Warn once
+        if (animSpriteCelSystem->drawUngroupedCount == 0) {
+            printf("Warning: AnimSpriteCelSystem draw groups full (%u groups).\n", animSpriteCelSystem->drawGroupsMax);
+        }
+        animSpriteCelSystem->drawUngroupedCount++;
+        return;
+    }
+
+    drawGroups[freeIndex].spriteCel = animSpriteCel->spriteCel;
+    drawGroups[freeIndex].plutPtr = animSpriteCel->cel->ccb_PLUTPtr;
+    drawGroups[freeIndex].last = animSpriteCel;
+    drawGroups[freeIndex].count = 1;
+}
+
+// Removes the CCB of an AnimSpriteCel from the draw list
+static void AnimSpriteCelSystemDrawHide(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel) {
+
+    // Group of the AnimSpriteCel
+    AnimSpriteCelSystemDrawGroup *drawGroup = NULL;
+
+    // If it belongs to a group
+    if ((animSpriteCelSystem->drawOrder == SOURCE_ORDER) && (animSpriteCel->drawGroup != ANIMSPRITECELSYSTEM_DRAW_UNGROUPED)) {
+        drawGroup = &animSpriteCelSystem->drawGroups[animSpriteCel->drawGroup];
+        drawGroup->count--;
+        // The group is contiguous: the CCB before its last one is in the group too (unless it is now empty)
+        if (drawGroup->last == animSpriteCel) {
+            drawGroup->last = animSpriteCel->drawPrevious;
+        }
+    }
+
+    AnimSpriteCelSystemDrawUnlink(animSpriteCelSystem, animSpriteCel);
+}
+
+// Derives the generator seed of a registered AnimSpriteCel from the system seed
+static uint32 AnimSpriteCelSystemSeedMix(uint32 seed, uint32 systemIndex) {
+
+    // Spread the indices over the 32 bits (golden ratio increment)
+    seed += (systemIndex + 1) * 0x9E3779B9;
+    // Scramble the bits
+    seed ^= seed >> 16;
+    seed *= 0x85EBCA6B;
+    seed ^= seed >> 13;
+
+    // A xorshift generator can't start from 0
+    return (seed != 0) ? seed : 1;
+}
+
+// Gives the term of a registered AnimSpriteCel in the state hash
+static uint32 AnimSpriteCelSystemHashTerm(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel) {
+
+    // FNV-1a over the words of the playhead and the tick at which it is set
+    uint32 term = 0x811C9DC5;
+
+    term = (term ^ animSpriteCel->systemIndex) * 0x01000193;
+    term = (term ^ animSpriteCelSystem->tick) * 0x01000193;
+    term = (term ^ (uint32)animSpriteCel->stepIndex) * 0x01000193;
+    term = (term ^ (uint32)animSpriteCel->direction) * 0x01000193;
+    term = (term ^ animSpriteCel->remainingCycles) * 0x01000193;
+    term = (term ^ animSpriteCel->iterationsCount) * 0x01000193;
+    term = (term ^ animSpriteCel->randomState) * 0x01000193;
+
+    // Scramble the bits, so that the sum of the terms keeps them all
+    term ^= term >> 16;
+    term *= 0x85EBCA6B;
+    term ^= term >> 13;
+    term *= 0xC2B2AE35;
+    term ^= term >> 16;
+
+    return term;
+}
+
+// Replaces the term of a registered AnimSpriteCel in the state hash and records the change
+static void AnimSpriteCelSystemHashUpdate(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel) {
+
+    // New term of the AnimSpriteCel
+    uint32 term = AnimSpriteCelSystemHashTerm(animSpriteCelSystem, animSpriteCel);
+    // Recorded change
+    AnimSpriteCelSystemHashEntry *entry = NULL;
+
+    // During a partitioned tick, the change is kept by the partition and added at the end of the tick
+    if (animSpriteCelSystem->partitioned == 1) {
+        animSpriteCelSystem->outboxes[animSpriteCel->systemIndex / animSpriteCelSystem->partitionSize].stateHash += term - animSpriteCel->stateHash;
+        animSpriteCel->stateHash = term;
+        return;
+    }
+
+    // The new term replaces the old one in the sum
+    animSpriteCelSystem->stateHash += term - animSpriteCel->stateHash;
+    animSpriteCel->stateHash = term;
+
+    // If the changes are not recorded
+    if (animSpriteCelSystem->hashEntries == NULL) {
+        return;
+    }
+
+    // Once the record is full, the changes are only counted
+    if (animSpriteCelSystem->hashEntriesCount >= animSpriteCelSystem->hashEntriesMax) {
+        animSpriteCelSystem->hashEntriesLost++;
+        return;
+    }
+
+    // Append the new playhead and the state hash it gives
+    entry = &animSpriteCelSystem->hashEntries[animSpriteCelSystem->hashEntriesCount];
+    animSpriteCelSystem->hashEntriesCount++;
+    entry->tick = animSpriteCelSystem->tick;
+    entry->animationIndex = animSpriteCel->systemIndex;
+    entry->stepIndex = (uint16)animSpriteCel->stepIndex;
+    entry->flags = (animSpriteCel->direction == -1) ? ANIMSPRITECELSYSTEM_PLAYHEAD_BACKWARD : 0;
+    entry->remainingCycles = animSpriteCel->remainingCycles;
+    entry->iterationsCount = animSpriteCel->iterationsCount;
+    entry->randomState = animSpriteCel->randomState;
+    entry->stateHash = animSpriteCelSystem->stateHash;
+}
+
+// Initialization of an AnimSpriteCelSystem
+AnimSpriteCelSystem *AnimSpriteCelSystemInitialization(uint32 animSpriteCelsMax, AnimSpriteCelSchedule schedule) {
+
+    // AnimSpriteCelSystem instance
+    AnimSpriteCelSystem *animSpriteCelSystem = NULL;
+
+    // If the capacity is empty
+    if (animSpriteCelsMax == 0) {
+        // Display error message
+        printf("Error: AnimSpriteCelSystem needs at least one AnimSpriteCel.\n");
+        return NULL;
+    }
+
+    // Allocate memory for AnimSpriteCelSystem
+    animSpriteCelSystem = (AnimSpriteCelSystem *)AllocMem(sizeof(AnimSpriteCelSystem), MEMTYPE_DRAM);
+    // If allocation fails
+    if (animSpriteCelSystem == NULL) {
+        // Display error message
+        printf("Error: Failed to allocate memory for AnimSpriteCelSystem.\n");
+        return NULL;
+    }
+
+    // Allocate memory for the AnimSpriteCel array
+    animSpriteCelSystem->animSpriteCels = (AnimSpriteCel **)AllocMem(animSpriteCelsMax * sizeof(AnimSpriteCel *), MEMTYPE_DRAM);
+    // If array allocation fails
+    if (animSpriteCelSystem->animSpriteCels == NULL) {
+        // Free previously allocated AnimSpriteCelSystem
+        FreeMem(animSpriteCelSystem, sizeof(AnimSpriteCelSystem));
+        // Display error message
+        printf("Error: Failed to allocate memory for AnimSpriteCelSystem array.\n");
+        return NULL;
+    }
+
+    // Active set and woken AnimSpriteCels (ACTIVE schedule)
+    animSpriteCelSystem->active = NULL;
+    animSpriteCelSystem->activeCount = 0;
+    animSpriteCelSystem->woken = NULL;
+    animSpriteCelSystem->wokenCount = 0;
+    if (schedule == ACTIVE) {
+        // Allocate memory for both, each able to hold every registered AnimSpriteCel
+        animSpriteCelSystem->active = (AnimSpriteCel **)AllocMem(animSpriteCelsMax * sizeof(AnimSpriteCel *), MEMTYPE_DRAM);
+        animSpriteCelSystem->woken = (AnimSpriteCel **)AllocMem(animSpriteCelsMax * sizeof(AnimSpriteCel *), MEMTYPE_DRAM);
+        // If an allocation fails
+        if ((animSpriteCelSystem->active == NULL) || (animSpriteCelSystem->woken == NULL)) {
+            // Free previously allocated memory
+            if (animSpriteCelSystem->active != NULL) {
+                FreeMem(animSpriteCelSystem->active, animSpriteCelsMax * sizeof(AnimSpriteCel *));
+            }
+            if (animSpriteCelSystem->woken != NULL) {
+                FreeMem(animSpriteCelSystem->woken, animSpriteCelsMax * sizeof(AnimSpriteCel *));
+            }
+            FreeMem(animSpriteCelSystem->animSpriteCels, animSpriteCelsMax * sizeof(AnimSpriteCel *));
+            FreeMem(animSpriteCelSystem, sizeof(AnimSpriteCelSystem));
+            // Display error message
+            printf("Error: Failed to allocate memory for AnimSpriteCelSystem active set.\n");
+            return NULL;
+        }
+    }
+
+    // No AnimSpriteCel registered yet
+    animSpriteCelSystem->animSpriteCelsCount = 0;
+    // Capacity of the array
+    animSpriteCelSystem->animSpriteCelsMax = animSpriteCelsMax;
+    // No AnimSpriteCel counted in MICROSECONDS yet
+    animSpriteCelSystem->microsecondsCount = 0;
+    // No change yet
+    animSpriteCelSystem->generation = 0;
+    // Scheduling of the animations
+    animSpriteCelSystem->schedule = schedule;
+    // First display cycle
+    animSpriteCelSystem->tick = 0;
+    // Empty timing wheel
+    memset(animSpriteCelSystem->wheel, 0, sizeof(animSpriteCelSystem->wheel));
+    animSpriteCelSystem->wheelOverflow = NULL;
+    // Triggers delivered at once, no queue
+    animSpriteCelSystem->delivery = IMMEDIATE;
+    animSpriteCelSystem->triggers = NULL;
+    animSpriteCelSystem->triggersMax = 0;
+    animSpriteCelSystem->triggersFirst = 0;
+    animSpriteCelSystem->triggersCount = 0;
+    animSpriteCelSystem->triggersBudget = 0;
+    animSpriteCelSystem->triggerDepth = 0;
+    animSpriteCelSystem->triggersDeferred = 0;
+    animSpriteCelSystem->triggersDropped = 0;
+    animSpriteCelSystem->cyclesCount = 0;
+    // Hardware random numbers until seeded
+    animSpriteCelSystem->seed = 0;
+    // Not partitioned
+    animSpriteCelSystem->outboxes = NULL;
+    animSpriteCelSystem->partitionsCount = 0;
+    animSpriteCelSystem->partitionSize = 0;
+    animSpriteCelSystem->partitioned = 0;
+    // No draw list
+    animSpriteCelSystem->drawListed = 0;
+    animSpriteCelSystem->drawOrder = SPAWN_ORDER;
+    animSpriteCelSystem->drawFirst = NULL;
+    animSpriteCelSystem->drawLast = NULL;
+    animSpriteCelSystem->drawCount = 0;
+    animSpriteCelSystem->drawGroups = NULL;
+    animSpriteCelSystem->drawGroupsCount = 0;
+    animSpriteCelSystem->drawGroupsMax = 0;
+    animSpriteCelSystem->drawUngroupedCount = 0;
+    // Changes not tracked
+    animSpriteCelSystem->dirty = NULL;
+    // One tick per display cycle, nothing carried
+    animSpriteCelSystem->timeScale = ANIMSPRITECEL_SPEED_NORMAL;
+    animSpriteCelSystem->timeAccumulator = 0;
+    // State hash not kept, nothing recorded
+    animSpriteCelSystem->hashed = 0;
+    animSpriteCelSystem->stateHash = 0;
+    animSpriteCelSystem->hashEntries = NULL;
+    animSpriteCelSystem->hashEntriesMax = 0;
+    animSpriteCelSystem->hashEntriesCount = 0;
+    animSpriteCelSystem->hashEntriesLost = 0;
+    animSpriteCelSystem->hashOriginTick = 0;
+    animSpriteCelSystem->hashOrigin = 0;
+    // Events not collected
+    animSpriteCelSystem->events = NULL;
+    animSpriteCelSystem->eventsMax = 0;
+    animSpriteCelSystem->eventsCount = 0;
+    animSpriteCelSystem->eventsLost = 0;
+
+    // Return the newly created AnimSpriteCelSystem
+    return animSpriteCelSystem;
+}
+
+// Registers an AnimSpriteCel in the system
+int32 AnimSpriteCelSystemRegister(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel) {
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return -1;
+    }
+
+    // If the AnimSpriteCel is undefined
+    if (animSpriteCel == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCel unknown.\n");
+        return -1;
+    }
+
+    // If the SpriteCel is undefined
+    if (animSpriteCel->spriteCel == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCel SpriteCel unknown.\n");
+        return -1;
+    }
+
+    // If the steps array is undefined
+    if ((animSpriteCel->steps == NULL) && (animSpriteCel->packedSteps == NULL)) {
+        // Return error
+        printf("Error: AnimSpriteCel steps unknown.\n");
+        return -1;
+    }
+
+    // If the animation has fewer than two steps
+    if (animSpriteCel->stepsCount < 2) {
+        // Return error
+        printf("Error: AnimSpriteCel needs at least two steps.\n");
+        return -1;
+    }
+
+    // If the AnimSpriteCel already belongs to a system
+    if (animSpriteCel->system != NULL) {
+        // Return error
+        printf("Error: AnimSpriteCel already registered.\n");
+        return -1;
+    }
+
+    // A timing wheel keys the end of a step in ticks when the step starts
+    if ((animSpriteCelSystem->schedule == WHEEL) && (animSpriteCel->speed != ANIMSPRITECEL_SPEED_NORMAL)) {
+        // Return error
+        printf("Error: AnimSpriteCel speed doesn't apply in WHEEL schedule.\n");
+        return -1;
+    }
+
+    // If the system is full
+    if (animSpriteCelSystem->animSpriteCelsCount >= animSpriteCelSystem->animSpriteCelsMax) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem full (%u AnimSpriteCels).\n", animSpriteCelSystem->animSpriteCelsMax);
+        return -1;
+    }
+
+    // Append the AnimSpriteCel to the array
+    animSpriteCelSystem->animSpriteCels[animSpriteCelSystem->animSpriteCelsCount] = animSpriteCel;
+    // Link the AnimSpriteCel to its system
+    animSpriteCel->system = animSpriteCelSystem;
+    animSpriteCel->systemIndex = animSpriteCelSystem->animSpriteCelsCount;
+    // Its term enters the state hash when it is scheduled
+    animSpriteCel->stateHash = 0;
+    // One more registered AnimSpriteCel
+    animSpriteCelSystem->animSpriteCelsCount++;
+    // Its durations in microseconds are only run by AnimSpriteCelSystemTimeRun()
+    if (animSpriteCel->timeBase == MICROSECONDS) {
+        animSpriteCelSystem->microsecondsCount++;
+    }
+    // The analyses of the system no longer match its registrations
+    animSpriteCelSystem->generation++;
+
+    // If the system is seeded, give it its generator
+    if (animSpriteCelSystem->seed != 0) {
+        AnimSpriteCelRandomSeed(animSpriteCel, AnimSpriteCelSystemSeedMix(animSpriteCelSystem->seed, animSpriteCel->systemIndex));
+    }
+
+    // Schedule the end of the current step
+    AnimSpriteCelSystemSchedule(animSpriteCelSystem, animSpriteCel);
+
+    // If the draw list is kept, link its CCB
+    if ((animSpriteCelSystem->drawListed == 1) && (animSpriteCel->visible == 1)) {
+        AnimSpriteCelSystemDrawShow(animSpriteCelSystem, animSpriteCel);
+    }
+
+    // If the changes are tracked, its CCB is new to the game
+    if (animSpriteCelSystem->dirty != NULL) {
+        AnimSpriteCelSystemDirty(animSpriteCelSystem, animSpriteCel);
+    }
+
+    // Return the index of the AnimSpriteCel in the system
+    return (int32)animSpriteCel->systemIndex;
+}
+
+// Removes an AnimSpriteCel from the system
+int32 AnimSpriteCelSystemUnregister(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel) {
+
+    // Array index
+    uint32 index = 0;
+    // Found in the active set
+    uint32 removed = 0;
+    // Renumbered AnimSpriteCel
+    AnimSpriteCel *animSpriteCelMoved = NULL;
+    // Registered AnimSpriteCel with packed steps
+    AnimSpriteCel *animSpriteCelSender = NULL;
+    // Step index and receiver index of a packed step
+    uint32 stepIndex = 0;
+    uint32 receiverIndex = 0;
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return -1;
+    }
+
+    // If the AnimSpriteCel is undefined
+    if (animSpriteCel == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCel unknown.\n");
+        return -1;
+    }
+
+    // If the AnimSpriteCel belongs to another system
+    if (animSpriteCel->system != animSpriteCelSystem) {
+        // Return error
+        printf("Error: AnimSpriteCel not registered in this AnimSpriteCelSystem.\n");
+        return -1;
+    }
+
+    // Packed steps name their receivers by index: the shift would retarget those at or after this one
+    for (index = 0; index < animSpriteCelSystem->animSpriteCelsCount; index++) {
+        animSpriteCelSender = animSpriteCelSystem->animSpriteCels[index];
+        if ((animSpriteCelSender == animSpriteCel) || (animSpriteCelSender->packedSteps == NULL)) {
+            continue;
+        }
+        for (stepIndex = 0; stepIndex < animSpriteCelSender->stepsCount; stepIndex++) {
+            receiverIndex = animSpriteCelSender->packedSteps[stepIndex].receiverIndex;
+            if ((receiverIndex != ANIMSPRITECEL_RECEIVER_NONE) && (receiverIndex >= animSpriteCel->systemIndex)) {
+                // Return error
+                printf("Error: AnimSpriteCel %u triggers receiver index %u, unregister the packed senders first.\n", index, receiverIndex);
+                return -1;
+            }
+        }
+    }
+
+    // If the AnimSpriteCel is in the wheel
+    if (animSpriteCel->wheelSlot != NULL) {
+        // Bring the remaining cycles up to date
+        animSpriteCel->remainingCycles = animSpriteCel->expiryTick - animSpriteCelSystem->tick;
+        AnimSpriteCelSystemWheelUnlink(animSpriteCel);
+    }
+
+    // If the AnimSpriteCel is in the active set or woken
+    if (animSpriteCel->systemActive == 1) {
+        // Take it out of the active set, shifting the following ones to keep the registration order
+        for (index = 0; index < animSpriteCelSystem->activeCount; index++) {
+            if (animSpriteCelSystem->active[index] == animSpriteCel) {
+                removed = 1;
+            } else if (removed == 1) {
+                animSpriteCelSystem->active[index - 1] = animSpriteCelSystem->active[index];
+            }
+        }
+        animSpriteCelSystem->activeCount -= removed;
+        // Or out of the woken ones, whose order doesn't matter
+        for (index = 0; index < animSpriteCelSystem->wokenCount; index++) {
+            if (animSpriteCelSystem->woken[index] == animSpriteCel) {
+                animSpriteCelSystem->wokenCount--;
+                animSpriteCelSystem->woken[index] = animSpriteCelSystem->woken[animSpriteCelSystem->wokenCount];
+                break;
+            }
+        }
+        animSpriteCel->systemActive = 0;
+    }
+
+    // If its CCB is in the draw list
+    if ((animSpriteCelSystem->drawListed == 1) && (animSpriteCel->visible == 1)) {
+        AnimSpriteCelSystemDrawHide(animSpriteCelSystem, animSpriteCel);
+    }
+
+    // Drop the triggers queued for it
+    for (index = 0; index < animSpriteCelSystem->triggersCount; index++) {
+        if (animSpriteCelSystem->triggers[(animSpriteCelSystem->triggersFirst + index) % animSpriteCelSystem->triggersMax].animSpriteCel == animSpriteCel) {
+            animSpriteCelSystem->triggers[(animSpriteCelSystem->triggersFirst + index) % animSpriteCelSystem->triggersMax].animSpriteCel = NULL;
+        }
+    }
+
+    // Its events stay to be drained, without the AnimSpriteCel
+    for (index = 0; index < animSpriteCelSystem->eventsCount; index++) {
+        if (animSpriteCelSystem->events[index].animSpriteCel == animSpriteCel) {
+            animSpriteCelSystem->events[index].animSpriteCel = NULL;
+        }
+    }
+
+    // Shift the following AnimSpriteCels to keep the registration order
+    for (index = animSpriteCel->systemIndex + 1; index < animSpriteCelSystem->animSpriteCelsCount; index++) {
+        animSpriteCelSystem->animSpriteCels[index - 1] = animSpriteCelSystem->animSpriteCels[index];
+        animSpriteCelSystem->animSpriteCels[index - 1]->systemIndex = index - 1;
+    }
+
+    // If the state hash is kept, its term leaves the sum and the renumbered AnimSpriteCels take theirs again
+    if (animSpriteCelSystem->hashed == 1) {
+        animSpriteCelSystem->stateHash -= animSpriteCel->stateHash;
+        for (index = animSpriteCel->systemIndex + 1; index < animSpriteCelSystem->animSpriteCelsCount; index++) {
+            animSpriteCelMoved = animSpriteCelSystem->animSpriteCels[index - 1];
+            animSpriteCelSystem->stateHash -= animSpriteCelMoved->stateHash;
+            animSpriteCelMoved->stateHash = AnimSpriteCelSystemHashTerm(animSpriteCelSystem, animSpriteCelMoved);
+            animSpriteCelSystem->stateHash += animSpriteCelMoved->stateHash;
+        }
+    }
+
+    // If the changes are tracked, their bits follow them
+    if (animSpriteCelSystem->dirty != NULL) {
+        for (index = animSpriteCel->systemIndex + 1; index < animSpriteCelSystem->animSpriteCelsCount; index++) {
+            if ((animSpriteCelSystem->dirty[index >> 5] & (1u << (index & 31))) != 0) {
+                animSpriteCelSystem->dirty[(index - 1) >> 5] |= 1u << ((index - 1) & 31);
+            } else {
+                animSpriteCelSystem->dirty[(index - 1) >> 5] &= ~(1u << ((index - 1) & 31));
+            }
+        }
+        // The last bit is now past the registered AnimSpriteCels
+        index = animSpriteCelSystem->animSpriteCelsCount - 1;
+        animSpriteCelSystem->dirty[index >> 5] &= ~(1u << (index & 31));
+    }
+
+    // One less registered AnimSpriteCel
+    animSpriteCelSystem->animSpriteCelsCount--;
+    if (animSpriteCel->timeBase == MICROSECONDS) {
+        animSpriteCelSystem->microsecondsCount--;
+    }
+    // The analyses of the system no longer match its registrations
+    animSpriteCelSystem->generation++;
+    // Unlink the AnimSpriteCel
+    animSpriteCel->system = NULL;
+    animSpriteCel->systemIndex = 0;
+
+    // Return success
+    return 1;
+}
+
+// Configuration of the trigger delivery
+int32 AnimSpriteCelSystemTriggerConfiguration(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCelDelivery delivery, uint32 triggersMax, uint32 triggersBudget) {
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return -1;
+    }
+
+    // If triggers are still pending
+    if (animSpriteCelSystem->triggersCount > 0) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem has %u pending triggers.\n", animSpriteCelSystem->triggersCount);
+        return -1;
+    }
+
+    // If a queued delivery has no room
+    if ((delivery != IMMEDIATE) && (triggersMax == 0)) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem trigger queue needs at least one trigger.\n");
+        return -1;
+    }
+
+    // Free the previous queue if present
+    if (animSpriteCelSystem->triggers != NULL) {
+        FreeMem(animSpriteCelSystem->triggers, animSpriteCelSystem->triggersMax * sizeof(AnimSpriteCelSystemTrigger));
+        animSpriteCelSystem->triggers = NULL;
+        animSpriteCelSystem->triggersMax = 0;
+    }
+
+    // If triggers are queued
+    if (delivery != IMMEDIATE) {
+        // Allocate memory for the queue
+        animSpriteCelSystem->triggers = (AnimSpriteCelSystemTrigger *)AllocMem(triggersMax * sizeof(AnimSpriteCelSystemTrigger), MEMTYPE_DRAM);
+        // If queue allocation fails
+        if (animSpriteCelSystem->triggers == NULL) {
+            // Fall back to immediate delivery
+            animSpriteCelSystem->delivery = IMMEDIATE;
+            // Return error
+            printf("Error: Failed to allocate memory for AnimSpriteCelSystem triggers.\n");
+            return -1;
+        }
+        animSpriteCelSystem->triggersMax = triggersMax;
+    }
+
+    // Delivery parameters
+    animSpriteCelSystem->delivery = delivery;
+    animSpriteCelSystem->triggersFirst = 0;
+    animSpriteCelSystem->triggersBudget = triggersBudget;
+
+    // Return success
+    return 1;
+}
+
+// Queues a trigger sent by a registered AnimSpriteCel
+void AnimSpriteCelSystemTriggerPush(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel) {
+
+    // Queue index
+    uint32 index = 0;
+
+    // If the queue is full
+    if (animSpriteCelSystem->triggersCount == animSpriteCelSystem->triggersMax) {
+        // Warn once
+        if (animSpriteCelSystem->triggersDropped == 0) {
+            printf("Warning: AnimSpriteCelSystem trigger queue full (%u triggers).\n", animSpriteCelSystem->triggersMax);
+        }
+        animSpriteCelSystem->triggersDropped++;
+        return;
+    }
+
+    // Append after the last pending trigger
+    index = animSpriteCelSystem->triggersFirst + animSpriteCelSystem->triggersCount;
+    if (index >= animSpriteCelSystem->triggersMax) {
+        index -= animSpriteCelSystem->triggersMax;
+    }
+    animSpriteCelSystem->triggers[index].animSpriteCel = animSpriteCel;
+    // One link further than the trigger being dispatched
+    animSpriteCelSystem->triggers[index].depth = animSpriteCelSystem->triggerDepth + 1;
+    animSpriteCelSystem->triggersCount++;
+}
+
+// Seeds the random generators of the registered AnimSpriteCels
+int32 AnimSpriteCelSystemSeed(AnimSpriteCelSystem *animSpriteCelSystem, uint32 seed) {
+
+    // Array index
+    uint32 index = 0;
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return -1;
+    }
+
+    // Seed of the next registrations
+    animSpriteCelSystem->seed = seed;
+
+    // Seed every registered AnimSpriteCel and roll its current random step (0 = back to hardware)
+    for (index = 0; index < animSpriteCelSystem->animSpriteCelsCount; index++) {
+        AnimSpriteCelRandomSeed(animSpriteCelSystem->animSpriteCels[index], (seed != 0) ? AnimSpriteCelSystemSeedMix(seed, index) : 0);
+    }
+
+    // Return success
+    return 1;
+}
+
+// Schedules an AnimSpriteCel according to its current step
+void AnimSpriteCelSystemSchedule(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel) {
+
+    // If the state hash is kept, the new playhead takes its place in it
+    if (animSpriteCelSystem->hashed == 1) {
+        AnimSpriteCelSystemHashUpdate(animSpriteCelSystem, animSpriteCel);
+    }
+
+    // If only the animations able to progress are visited
+    if (animSpriteCelSystem->schedule == ACTIVE) {
+
+        // If it is already in the active set, or waits for a trigger, or is done
+        if ((animSpriteCel->systemActive == 1) || (ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) == 0) || (animSpriteCel->iterationsCount == 0)) {
+            return;
+        }
+
+        // Wake it: it joins the active set on the next tick
+        animSpriteCel->systemActive = 1;
+        animSpriteCelSystem->woken[animSpriteCelSystem->wokenCount] = animSpriteCel;
+        animSpriteCelSystem->wokenCount++;
+        return;
+    }
+
+    // Nothing to do when every animation is visited
+    if (animSpriteCelSystem->schedule != WHEEL) {
+        return;
+    }
+
+    // If the AnimSpriteCel is already in the wheel
+    if (animSpriteCel->wheelSlot != NULL) {
+        AnimSpriteCelSystemWheelUnlink(animSpriteCel);
+    }
+
+    // If the animation is waiting for a trigger
+    if (ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) == 0) {
+        // Stays out of the wheel until triggered
+        return;
+    }
+
+    // If all iterations have been completed
+    if (animSpriteCel->iterationsCount == 0) {
+        // Stays out of the wheel
+        return;
+    }
+
+    // The step ends after its remaining cycles
+    animSpriteCel->expiryTick = animSpriteCelSystem->tick + animSpriteCel->remainingCycles;
+    AnimSpriteCelSystemWheelLink(animSpriteCelSystem, animSpriteCel);
+}
+
+// Runs one tick of the registered animations
+static void AnimSpriteCelSystemTick(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+    // Current AnimSpriteCel
+    AnimSpriteCel *animSpriteCel = NULL;
+    // Display cycle being run
+    uint32 tick = 0;
+    // Wheel slot of the display cycle
+    AnimSpriteCel **slot = NULL;
+    // Detached list of the slot
+    AnimSpriteCel *list = NULL;
+
+    // Display cycle being run
+    tick = animSpriteCelSystem->tick;
+
+    // Triggers of the previous tick come first
+    if (animSpriteCelSystem->delivery == NEXT_TICK) {
+        AnimSpriteCelSystemTriggerDispatch(animSpriteCelSystem, animSpriteCelSystem->triggersCount);
+    }
+
+    // If only the ending steps are visited
+    if (animSpriteCelSystem->schedule == WHEEL) {
+
+        // Bring the steps ending on this tick down to the first level
+        AnimSpriteCelSystemWheelCascade(animSpriteCelSystem, tick - 1);
+        // New steps are counted from the next tick
+        animSpriteCelSystem->tick = tick + 1;
+
+        // Detach the slot of this tick (a step of 64 ticks started now goes back to the same slot)
+        slot = &animSpriteCelSystem->wheel[0][tick & (ANIMSPRITECELSYSTEM_WHEEL_SLOTS - 1)];
+        list = *slot;
+        *slot = NULL;
+        // Visit them in registration order, as in POLLING schedule
+        list = AnimSpriteCelSystemWheelSort(list);
+
+        // For each AnimSpriteCel whose step ends on this tick
+        while (list != NULL) {
+
+            animSpriteCel = list;
+            list = list->wheelNext;
+            animSpriteCel->wheelSlot = NULL;
+            animSpriteCel->wheelPrevious = NULL;
+            animSpriteCel->wheelNext = NULL;
+
+            // If the animation was stopped meanwhile
+            if ((ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) == 0) || (animSpriteCel->iterationsCount == 0)) {
+                continue;
+            }
+
+            // Advance to the next animation step (schedules the new one)
+            animSpriteCel->remainingCycles = 0;
+            AnimSpriteCelNextStep(animSpriteCel);
+        }
+
+        // Triggers of this tick come last, with the ones they send (bounded by the budget and the cycle check)
+        if (animSpriteCelSystem->delivery == SAME_TICK) {
+            AnimSpriteCelSystemTriggerDispatch(animSpriteCelSystem, 0xFFFFFFFF);
+        }
+        return;
+    }
+
+    // Next display cycle
+    animSpriteCelSystem->tick = tick + 1;
+
+    // If only the animations able to progress are visited
+    if (animSpriteCelSystem->schedule == ACTIVE) {
+        // The woken AnimSpriteCels join the active set, which is then run
+        AnimSpriteCelSystemActiveMerge(animSpriteCelSystem);
+        AnimSpriteCelSystemActiveRun(animSpriteCelSystem);
+    } else {
+        // For each registered AnimSpriteCel
+        AnimSpriteCelSystemRunRange(animSpriteCelSystem, 0, animSpriteCelSystem->animSpriteCelsCount);
+    }
+
+    // Triggers of this tick come last, with the ones they send (bounded by the budget and the cycle check)
+    if (animSpriteCelSystem->delivery == SAME_TICK) {
+        AnimSpriteCelSystemTriggerDispatch(animSpriteCelSystem, 0xFFFFFFFF);
+    }
+}
+
+// Runs all the registered animations
+int32 AnimSpriteCelSystemRun(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+    // Ticks of the display cycle
+    uint32 ticksCount = 0;
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return -1;
+    }
+
+    // A tick is a display cycle, not the microseconds elapsed
+    if (animSpriteCelSystem->microsecondsCount > 0) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem runs AnimSpriteCels in MICROSECONDS, use AnimSpriteCelSystemTimeRun().\n");
+        return -1;
+    }
+
+    // Ticks given by the time scale (one at normal scale)
+    ticksCount = AnimSpriteCelSystemTicks(animSpriteCelSystem);
+
+    // Run them in turn
+    while (ticksCount > 0) {
+        AnimSpriteCelSystemTick(animSpriteCelSystem);
+        ticksCount--;
+    }
+
+    // Return success
+    return 1;
+}
+
+// Sets the time scale of the system
+int32 AnimSpriteCelSystemTimeScale(AnimSpriteCelSystem *animSpriteCelSystem, uint32 timeScale) {
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return -1;
+    }
+
+    // Clamp the time scale so that a display cycle runs a bounded number of ticks
+    if (timeScale > ANIMSPRITECELSYSTEM_TIME_SCALE_MAX) {
+        // Display warning
+        printf("Warning: AnimSpriteCelSystem time scale 0x%08X too high. Clamped to 0x%08X.\n", timeScale, ANIMSPRITECELSYSTEM_TIME_SCALE_MAX);
+        // Adjust to the highest time scale
+        timeScale = ANIMSPRITECELSYSTEM_TIME_SCALE_MAX;
+    }
+
+    // Taken into account from the next display cycle, the carried fraction is kept
+    animSpriteCelSystem->timeScale = timeScale;
+
+    // Return success
+    return 1;
+}
+
+// Gives the number of ticks of a display cycle at the time scale
+uint32 AnimSpriteCelSystemTicks(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+    // Whole ticks reached by the accumulator
+    uint32 ticksCount = 0;
+
+    // At normal scale, one tick per display cycle
+    if (animSpriteCelSystem->timeScale == ANIMSPRITECEL_SPEED_NORMAL) {
+        return 1;
+    }
+
+    // Add the time scale: the whole ticks are run, the fraction is carried
+    animSpriteCelSystem->timeAccumulator += animSpriteCelSystem->timeScale;
+    ticksCount = animSpriteCelSystem->timeAccumulator >> 16;
+    animSpriteCelSystem->timeAccumulator &= 0xFFFF;
+
+    // Return the ticks to run
+    return ticksCount;
+}
+
+// Runs the registered animations for the time elapsed since the last run
+int32 AnimSpriteCelSystemTimeRun(AnimSpriteCelSystem *animSpriteCelSystem, uint32 elapsedMicroseconds) {
+
+    // Registered AnimSpriteCels
+    AnimSpriteCel **animSpriteCels = NULL;
+    // Current AnimSpriteCel
+    AnimSpriteCel *animSpriteCel = NULL;
+    // Array index
+    uint32 index = 0;
+    // Fraction of the time scale
+    uint32 fraction = 0;
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return -1;
+    }
+
+    // The steps ending are found by visiting every animation
+    if (animSpriteCelSystem->schedule != POLLING) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem time runs need POLLING schedule.\n");
+        return -1;
+    }
+
+    // If a partitioned tick is running
+    if (animSpriteCelSystem->partitioned == 1) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem partitioned tick running.\n");
+        return -1;
+    }
+
+    // Scale the elapsed time, the fraction of microsecond is carried (split in 16-bit halves to stay on 32 bits)
+    if (animSpriteCelSystem->timeScale != ANIMSPRITECEL_SPEED_NORMAL) {
+        fraction = animSpriteCelSystem->timeScale & 0xFFFF;
+        animSpriteCelSystem->timeAccumulator += (elapsedMicroseconds & 0xFFFF) * fraction;
+        elapsedMicroseconds = (elapsedMicroseconds * (animSpriteCelSystem->timeScale >> 16)) + ((elapsedMicroseconds >> 16) * fraction) + (animSpriteCelSystem->timeAccumulator >> 16);
+        animSpriteCelSystem->timeAccumulator &= 0xFFFF;
+    }
+
+    // Triggers of the previous run come first
+    if (animSpriteCelSystem->delivery == NEXT_TICK) {
+        AnimSpriteCelSystemTriggerDispatch(animSpriteCelSystem, animSpriteCelSystem->triggersCount);
+    }
+
+    // Next run
+    animSpriteCelSystem->tick++;
+
+    // For each registered AnimSpriteCel
+    animSpriteCels = animSpriteCelSystem->animSpriteCels;
+    for (index = 0; index < animSpriteCelSystem->animSpriteCelsCount; index++) {
+
+        animSpriteCel = animSpriteCels[index];
+
+        // Durations in microseconds catch up the elapsed time
+        if (animSpriteCel->timeBase == MICROSECONDS) {
+            AnimSpriteCelAdvance(animSpriteCel, elapsedMicroseconds);
+            continue;
+        }
+
+        // Durations in display cycles run one
+        AnimSpriteCelRun(animSpriteCel);
+    }
+
+    // Triggers of this run come last, with the ones they send (bounded by the budget and the cycle check)
+    if (animSpriteCelSystem->delivery == SAME_TICK) {
+        AnimSpriteCelSystemTriggerDispatch(animSpriteCelSystem, 0xFFFFFFFF);
+    }
+
+    // Return success
+    return 1;
+}
+
+// Frees the events of the outboxes if present
+static void AnimSpriteCelSystemOutboxEventsFree(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+    // Partition index
+    uint32 index = 0;
+
+    // If the outboxes don't keep events
+    if ((animSpriteCelSystem->outboxes == NULL) || (animSpriteCelSystem->outboxes[0].events == NULL)) {
+        return;
+    }
+
+    FreeMem(animSpriteCelSystem->outboxes[0].events, animSpriteCelSystem->partitionsCount * animSpriteCelSystem->partitionSize * sizeof(AnimSpriteCelSystemEvent));
+    for (index = 0; index < animSpriteCelSystem->partitionsCount; index++) {
+        animSpriteCelSystem->outboxes[index].events = NULL;
+        animSpriteCelSystem->outboxes[index].eventsCount = 0;
+    }
+}
+
+// Gives each outbox room for the events of its partition
+static int32 AnimSpriteCelSystemOutboxEventsAllocation(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+    // Partition index
+    uint32 index = 0;
+
+    // An animation changes step at most once per tick, so an outbox holds one event per AnimSpriteCel of its partition
+    animSpriteCelSystem->outboxes[0].events = (AnimSpriteCelSystemEvent *)AllocMem(animSpriteCelSystem->partitionsCount * animSpriteCelSystem->partitionSize * sizeof(AnimSpriteCelSystemEvent), MEMTYPE_DRAM);
+    // If allocation fails
+    if (animSpriteCelSystem->outboxes[0].events == NULL) {
+        // Return error
+        printf("Error: Failed to allocate memory for AnimSpriteCelSystem outbox events.\n");
+        return -1;
+    }
+
+    // Side by side in the same block
+    for (index = 0; index < animSpriteCelSystem->partitionsCount; index++) {
+        animSpriteCelSystem->outboxes[index].events = animSpriteCelSystem->outboxes[0].events + index * animSpriteCelSystem->partitionSize;
+        animSpriteCelSystem->outboxes[index].eventsCount = 0;
+    }
+
+    // Return success
+    return 1;
+}
+
+// Appends an event to the buffer of the system
+static void AnimSpriteCelSystemEventAppend(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel, uint32 eventId, uint32 tick) {
+
+    // Appended event
+    AnimSpriteCelSystemEvent *event = NULL;
+
+    // If the buffer is full
+    if (animSpriteCelSystem->eventsCount == animSpriteCelSystem->eventsMax) {
+        // Warn once
+        if (animSpriteCelSystem->eventsLost == 0) {
+            printf("Warning: AnimSpriteCelSystem event buffer full (%u events).\n", animSpriteCelSystem->eventsMax);
+        }
+        animSpriteCelSystem->eventsLost++;
+        return;
+    }
+
+    // After the last event
+    event = &animSpriteCelSystem->events[animSpriteCelSystem->eventsCount];
+    event->animSpriteCel = animSpriteCel;
+    event->eventId = eventId;
+    event->tick = tick;
+    animSpriteCelSystem->eventsCount++;
+}
+
+// Splits the registered animations into partitions run separately
+int32 AnimSpriteCelSystemPartitionConfiguration(AnimSpriteCelSystem *animSpriteCelSystem, uint32 partitionSize) {
+
+    // Number of partitions
+    uint32 partitionsCount = 0;
+    // Partition index
+    uint32 index = 0;
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return -1;
+    }
+
+    // If a partitioned tick is running
+    if (animSpriteCelSystem->partitioned == 1) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem partitioned tick running.\n");
+        return -1;
+    }
+
+    // If the partitions are empty
+    if (partitionSize == 0) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem partitions need at least one AnimSpriteCel.\n");
+        return -1;
+    }
+
+    // Free the previous outboxes if present
+    if (animSpriteCelSystem->outboxes != NULL) {
+        AnimSpriteCelSystemOutboxEventsFree(animSpriteCelSystem);
+        FreeMem(animSpriteCelSystem->outboxes[0].receivers, animSpriteCelSystem->partitionsCount * animSpriteCelSystem->partitionSize * sizeof(AnimSpriteCel *));
+        FreeMem(animSpriteCelSystem->outboxes, animSpriteCelSystem->partitionsCount * sizeof(AnimSpriteCelSystemOutbox));
+        animSpriteCelSystem->outboxes = NULL;
+        animSpriteCelSystem->partitionsCount = 0;
+        animSpriteCelSystem->partitionSize = 0;
+    }
+
+    // Enough partitions for the capacity of the array
+    partitionsCount = (animSpriteCelSystem->animSpriteCelsMax + partitionSize - 1) / partitionSize;
+
+    // Allocate memory for the outboxes
+    animSpriteCelSystem->outboxes = (AnimSpriteCelSystemOutbox *)AllocMem(partitionsCount * sizeof(AnimSpriteCelSystemOutbox), MEMTYPE_DRAM);
+    // If allocation fails
+    if (animSpriteCelSystem->outboxes == NULL) {
+        // Return error
+        printf("Error: Failed to allocate memory for AnimSpriteCelSystem outboxes.\n");
+        return -1;
+    }
+
+    // An animation changes step at most once per tick, so an outbox holds one trigger per AnimSpriteCel of its partition
+    animSpriteCelSystem->outboxes[0].receivers = (AnimSpriteCel **)AllocMem(partitionsCount * partitionSize * sizeof(AnimSpriteCel *), MEMTYPE_DRAM);
+    // If allocation fails
+    if (animSpriteCelSystem->outboxes[0].receivers == NULL) {
+        // Free previously allocated outboxes
+        FreeMem(animSpriteCelSystem->outboxes, partitionsCount * sizeof(AnimSpriteCelSystemOutbox));
+        animSpriteCelSystem->outboxes = NULL;
+        // Return error
+        printf("Error: Failed to allocate memory for AnimSpriteCelSystem outbox receivers.\n");
+        return -1;
+    }
+
+    // Empty outboxes, side by side in the same block
+    for (index = 0; index < partitionsCount; index++) {
+        animSpriteCelSystem->outboxes[index].receivers = animSpriteCelSystem->outboxes[0].receivers + index * partitionSize;
+        animSpriteCelSystem->outboxes[index].receiversCount = 0;
+        animSpriteCelSystem->outboxes[index].events = NULL;
+        animSpriteCelSystem->outboxes[index].eventsCount = 0;
+        animSpriteCelSystem->outboxes[index].stateHash = 0;
+    }
+    animSpriteCelSystem->partitionsCount = partitionsCount;
+    animSpriteCelSystem->partitionSize = partitionSize;
+
+    // If the events are collected, the outboxes keep the ones of their partition
+    if ((animSpriteCelSystem->events != NULL) && (AnimSpriteCelSystemOutboxEventsAllocation(animSpriteCelSystem) < 0)) {
+        // Free the outboxes
+        FreeMem(animSpriteCelSystem->outboxes[0].receivers, partitionsCount * partitionSize * sizeof(AnimSpriteCel *));
+        FreeMem(animSpriteCelSystem->outboxes, partitionsCount * sizeof(AnimSpriteCelSystemOutbox));
+        animSpriteCelSystem->outboxes = NULL;
+        animSpriteCelSystem->partitionsCount = 0;
+        animSpriteCelSystem->partitionSize = 0;
+        // Return error
+        return -1;
+    }
+
+    // Return success
+    return 1;
+}
+
+// Queues a trigger in the outbox of the sender's partition
+void AnimSpriteCelSystemOutboxPush(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCelSender, AnimSpriteCel *animSpriteCel) {
+
+    // Outbox of the partition running the sender
+    AnimSpriteCelSystemOutbox *outbox = &animSpriteCelSystem->outboxes[animSpriteCelSender->systemIndex / animSpriteCelSystem->partitionSize];
+
+    // Append in sending order (the sender's step changes once in the tick, there is always room)
+    outbox->receivers[outbox->receiversCount] = animSpriteCel;
+    outbox->receiversCount++;
+}
+
+// Starts a partitioned tick
+int32 AnimSpriteCelSystemPartitionBegin(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+    // Partition index
+    uint32 index = 0;
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return -1;
+    }
+
+    // If the partitions are not configured
+    if (animSpriteCelSystem->outboxes == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem partitions not configured.\n");
+        return -1;
+    }
+
+    // If a partitioned tick is already running
+    if (animSpriteCelSystem->partitioned == 1) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem partitioned tick running.\n");
+        return -1;
+    }
+
+    // The partitions can only be run apart when every animation is visited and the triggers are queued
+    if ((animSpriteCelSystem->schedule != POLLING) || (animSpriteCelSystem->delivery == IMMEDIATE)) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem partitions need POLLING schedule and queued triggers.\n");
+        return -1;
+    }
+
+    // A tick is a display cycle, not the microseconds elapsed
+    if (animSpriteCelSystem->microsecondsCount > 0) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem runs AnimSpriteCels in MICROSECONDS, use AnimSpriteCelSystemTimeRun().\n");
+        return -1;
+    }
+
+    // Two partitions must not share a word of the dirty bitset
+    if ((animSpriteCelSystem->dirty != NULL) && ((animSpriteCelSystem->partitionSize & 31) != 0)) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem partitions tracking changes need a multiple of 32 AnimSpriteCels.\n");
+        return -1;
+    }
+
+    // The changes of the partitions can't be recorded in the order of AnimSpriteCelSystemRun()
+    if (animSpriteCelSystem->hashEntries != NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem partitions can't record the state hash.\n");
+        return -1;
+    }
+
+    // Triggers of the previous tick come first
+    if (animSpriteCelSystem->delivery == NEXT_TICK) {
+        AnimSpriteCelSystemTriggerDispatch(animSpriteCelSystem, animSpriteCelSystem->triggersCount);
+    }
+
+    // Next display cycle
+    animSpriteCelSystem->tick++;
+
+    // Empty outboxes, filled by the partitions
+    for (index = 0; index < animSpriteCelSystem->partitionsCount; index++) {
+        animSpriteCelSystem->outboxes[index].receiversCount = 0;
+        animSpriteCelSystem->outboxes[index].eventsCount = 0;
+        animSpriteCelSystem->outboxes[index].stateHash = 0;
+    }
+    animSpriteCelSystem->partitioned = 1;
+
+    // Return the number of partitions holding registered AnimSpriteCels
+    return (int32)((animSpriteCelSystem->animSpriteCelsCount + animSpriteCelSystem->partitionSize - 1) / animSpriteCelSystem->partitionSize);
+}
+
+// Runs the animations of a partition
+void AnimSpriteCelSystemPartitionRun(AnimSpriteCelSystem *animSpriteCelSystem, uint32 partitionIndex) {
+
+    // Range of the partition
+    uint32 first = 0;
+    uint32 last = 0;
+
+    // If no partitioned tick is running
+    if ((animSpriteCelSystem == NULL) || (animSpriteCelSystem->partitioned == 0)) {
+        // Log error
+        printf("Error: AnimSpriteCelSystem partitioned tick not started.\n");
+        return;
+    }
+
+    // Range of the partition, the last one stops at the registered AnimSpriteCels
+    first = partitionIndex * animSpriteCelSystem->partitionSize;
+    if (first >= animSpriteCelSystem->animSpriteCelsCount) {
+        return;
+    }
+    last = first + animSpriteCelSystem->partitionSize;
+    if (last > animSpriteCelSystem->animSpriteCelsCount) {
+        last = animSpriteCelSystem->animSpriteCelsCount;
+    }
+
+    // Same visit as AnimSpriteCelSystemRun(), its triggers go to the outbox of the partition
+    AnimSpriteCelSystemRunRange(animSpriteCelSystem, first, last);
+}
+
+// Ends a partitioned tick
+int32 AnimSpriteCelSystemPartitionEnd(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+    // Outbox being merged
+    AnimSpriteCelSystemOutbox *outbox = NULL;
+    // Partition, trigger and event indexes
+    uint32 index = 0;
+    uint32 receiverIndex = 0;
+    uint32 eventIndex = 0;
+
+    // If no partitioned tick is running
+    if ((animSpriteCelSystem == NULL) || (animSpriteCelSystem->partitioned == 0)) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem partitioned tick not started.\n");
+        return -1;
+    }
+    animSpriteCelSystem->partitioned = 0;
+
+    // Partitions follow the registration order, so their outboxes in turn give the sending order of AnimSpriteCelSystemRun()
+    for (index = 0; index < animSpriteCelSystem->partitionsCount; index++) {
+        outbox = &animSpriteCelSystem->outboxes[index];
+        for (receiverIndex = 0; receiverIndex < outbox->receiversCount; receiverIndex++) {
+            AnimSpriteCelSystemTriggerPush(animSpriteCelSystem, outbox->receivers[receiverIndex]);
+        }
+        outbox->receiversCount = 0;
+        // Events of the partition, after the ones of the previous partitions
+        for (eventIndex = 0; eventIndex < outbox->eventsCount; eventIndex++) {
+            AnimSpriteCelSystemEventAppend(animSpriteCelSystem, outbox->events[eventIndex].animSpriteCel, outbox->events[eventIndex].eventId, outbox->events[eventIndex].tick);
+        }
+        outbox->eventsCount = 0;
+        // Change of the state hash made by the partition
+        animSpriteCelSystem->stateHash += outbox->stateHash;
+        outbox->stateHash = 0;
+    }
+
+    // Triggers of this tick come last, with the ones they send (bounded by the budget and the cycle check)
+    if (animSpriteCelSystem->delivery == SAME_TICK) {
+        AnimSpriteCelSystemTriggerDispatch(animSpriteCelSystem, 0xFFFFFFFF);
+    }
+
+    // Return success
+    return 1;
+}
+
+// Keeps the CCBs of the visible AnimSpriteCels in a draw list
+int32 AnimSpriteCelSystemDrawConfiguration(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCelDrawOrder drawOrder, uint32 drawGroupsMax) {
+
+    // Array index
+    uint32 index = 0;
+    // Current AnimSpriteCel
+    AnimSpriteCel *animSpriteCel = NULL;
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return -1;
+    }
+
+    // If the groups have no room
+    if ((drawOrder == SOURCE_ORDER) && (drawGroupsMax == 0)) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem SOURCE_ORDER needs at least one draw group.\n");
+        return -1;
+    }
+
+    // Unlink the previous list if present
+    while (animSpriteCelSystem->drawFirst != NULL) {
+        AnimSpriteCelSystemDrawUnlink(animSpriteCelSystem, animSpriteCelSystem->drawFirst);
+    }
+    if (animSpriteCelSystem->drawGroups != NULL) {
+        FreeMem(animSpriteCelSystem->drawGroups, animSpriteCelSystem->drawGroupsMax * sizeof(AnimSpriteCelSystemDrawGroup));
+        animSpriteCelSystem->drawGroups = NULL;
+    }
+    animSpriteCelSystem->drawListed = 0;
+    animSpriteCelSystem->drawGroupsCount = 0;
+    animSpriteCelSystem->drawGroupsMax = 0;
+    animSpriteCelSystem->drawUngroupedCount = 0;
+
+    // If the CCBs are grouped
+    if (drawOrder == SOURCE_ORDER) {
+        // Allocate memory for the groups
+        animSpriteCelSystem->drawGroups = (AnimSpriteCelSystemDrawGroup *)AllocMem(drawGroupsMax * sizeof(AnimSpriteCelSystemDrawGroup), MEMTYPE_DRAM);
+        // If groups allocation fails
+        if (animSpriteCelSystem->drawGroups == NULL) {
+            // Return error
+            printf("Error: Failed to allocate memory for AnimSpriteCelSystem draw groups.\n");
+            return -1;
+        }
+        animSpriteCelSystem->drawGroupsMax = drawGroupsMax;
+    }
+
+    // Link the visible AnimSpriteCels in registration order
+    animSpriteCelSystem->drawListed = 1;
+    animSpriteCelSystem->drawOrder = drawOrder;
+    for (index = 0; index < animSpriteCelSystem->animSpriteCelsCount; index++) {
+        animSpriteCel = animSpriteCelSystem->animSpriteCels[index];
+        if (animSpriteCel->visible == 1) {
+            AnimSpriteCelSystemDrawShow(animSpriteCelSystem, animSpriteCel);
+        }
+    }
+
+    // Return success
+    return 1;
+}
+
+// Shows or hides a registered AnimSpriteCel
+int32 AnimSpriteCelSystemVisibility(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel, uint32 visible) {
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return -1;
+    }
+
+    // If the AnimSpriteCel is undefined or belongs to another system
+    if ((animSpriteCel == NULL) || (animSpriteCel->system != animSpriteCelSystem)) {
+        // Return error
+        printf("Error: AnimSpriteCel not registered in this AnimSpriteCelSystem.\n");
+        return -1;
+    }
+
+    // Any non-zero value shows it
+    visible = (visible != 0) ? 1 : 0;
+
+    // If the visibility doesn't change, nothing to relink
+    if (animSpriteCel->visible == visible) {
+        return 1;
+    }
+    animSpriteCel->visible = visible;
+
+    // Link or unlink its CCB
+    if (animSpriteCelSystem->drawListed == 1) {
+        if (visible == 1) {
+            AnimSpriteCelSystemDrawShow(animSpriteCelSystem, animSpriteCel);
+        } else {
+            AnimSpriteCelSystemDrawHide(animSpriteCelSystem, animSpriteCel);
+        }
+    }
+
+    // Return success
+    return 1;
+}
+
+// Gives the first CCB of the draw list
+CCB *AnimSpriteCelSystemDrawList(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return NULL;
+    }
+
+    // If nothing is listed
+    if (animSpriteCelSystem->drawFirst == NULL) {
+        return NULL;
+    }
+
+    // The list goes on through ccb_NextPtr up to the CCB flagged CCB_LAST
+    return animSpriteCelSystem->drawFirst->cel;
+}
+
+// Starts or stops tracking the CCBs changed by the steps
+int32 AnimSpriteCelSystemDirtyConfiguration(AnimSpriteCelSystem *animSpriteCelSystem, uint32 tracked) {
+
+    // Words of the bitset
+    uint32 wordsCount = 0;
+    // Array index
+    uint32 index = 0;
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return -1;
+    }
+
+    // If a partitioned tick is running
+    if (animSpriteCelSystem->partitioned == 1) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem partitioned tick running.\n");
+        return -1;
+    }
+
+    // One bit per AnimSpriteCel the array can hold
+    wordsCount = ANIMSPRITECELSYSTEM_DIRTY_WORDS(animSpriteCelSystem->animSpriteCelsMax);
+
+    // If the tracking stops
+    if (tracked == 0) {
+        // Free the bitset if present
+        if (animSpriteCelSystem->dirty != NULL) {
+            FreeMem(animSpriteCelSystem->dirty, wordsCount * sizeof(uint32));
+            animSpriteCelSystem->dirty = NULL;
+        }
+        // Return success
+        return 1;
+    }
+
+    // If the changes are already tracked
+    if (animSpriteCelSystem->dirty != NULL) {
+        // Return success
+        return 1;
+    }
+
+    // Allocate memory for the bitset
+    animSpriteCelSystem->dirty = (uint32 *)AllocMem(wordsCount * sizeof(uint32), MEMTYPE_DRAM);
+    // If bitset allocation fails
+    if (animSpriteCelSystem->dirty == NULL) {
+        // Return error
+        printf("Error: Failed to allocate memory for AnimSpriteCelSystem dirty bitset.\n");
+        return -1;
+    }
+    memset(animSpriteCelSystem->dirty, 0, wordsCount * sizeof(uint32));
+
+    // The game doesn't know the current CCBs yet: every registered AnimSpriteCel is marked
+    for (index = 0; index < animSpriteCelSystem->animSpriteCelsCount; index++) {
+        animSpriteCelSystem->dirty[index >> 5] |= 1u << (index & 31);
+    }
+
+    // Return success
+    return 1;
+}
+
+// Marks the CCB of a registered AnimSpriteCel as changed
+void AnimSpriteCelSystemDirty(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel) {
+
+    // Bit of its registration index
+    animSpriteCelSystem->dirty[animSpriteCel->systemIndex >> 5] |= 1u << (animSpriteCel->systemIndex & 31);
+}
+
+// Gives the next AnimSpriteCel whose CCB changed, from a cursor
+AnimSpriteCel *AnimSpriteCelSystemChanged(AnimSpriteCelSystem *animSpriteCelSystem, uint32 *cursor) {
+
+    // Registration index
+    uint32 index = 0;
+    // Word of the bitset and its bits left to visit
+    uint32 wordIndex = 0;
+    uint32 bits = 0;
+
+    // If the system is undefined
+    if ((animSpriteCelSystem == NULL) || (cursor == NULL)) {
+        // Log error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return NULL;
+    }
+
+    // If the changes are not tracked or every AnimSpriteCel was visited
+    if ((animSpriteCelSystem->dirty == NULL) || (*cursor >= animSpriteCelSystem->animSpriteCelsCount)) {
+        return NULL;
+    }
+
+    // Bits of the word at the cursor, from the cursor
+    wordIndex = *cursor >> 5;
+    bits = animSpriteCelSystem->dirty[wordIndex] & (0xFFFFFFFF << (*cursor & 31));
+
+    // Skip the words without change, 32 AnimSpriteCels at a time
+    while (bits == 0) {
+        wordIndex++;
+        if ((wordIndex << 5) >= animSpriteCelSystem->animSpriteCelsCount) {
+            *cursor = animSpriteCelSystem->animSpriteCelsCount;
+            return NULL;
+        }
+        bits = animSpriteCelSystem->dirty[wordIndex];
+    }
+
+    // Lowest bit set in the word
+    index = wordIndex << 5;
+    while ((bits & 1) == 0) {
+        bits >>= 1;
+        index++;
+    }
+
+    // The next call starts after it
+    *cursor = index + 1;
+
+    // Return the changed AnimSpriteCel
+    return animSpriteCelSystem->animSpriteCels[index];
+}
+
+// Clears the changes, once processed
+int32 AnimSpriteCelSystemDirtyClear(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+    // Word index
+    uint32 index = 0;
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return -1;
+    }
+
+    // If the changes are not tracked
+    if (animSpriteCelSystem->dirty == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem changes not tracked.\n");
+        return -1;
+    }
+
+    // Only the words of the registered AnimSpriteCels can hold a bit
+    for (index = 0; index < ANIMSPRITECELSYSTEM_DIRTY_WORDS(animSpriteCelSystem->animSpriteCelsCount); index++) {
+        animSpriteCelSystem->dirty[index] = 0;
+    }
+
+    // Return success
+    return 1;
+}
+
+// Starts or stops collecting the events of the steps
+int32 AnimSpriteCelSystemEventConfiguration(AnimSpriteCelSystem *animSpriteCelSystem, uint32 eventsMax) {
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return -1;
+    }
+
+    // If a partitioned tick is running
+    if (animSpriteCelSystem->partitioned == 1) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem partitioned tick running.\n");
+        return -1;
+    }
+
+    // Free the previous buffer and the events of the outboxes if present
+    if (animSpriteCelSystem->events != NULL) {
+        AnimSpriteCelSystemOutboxEventsFree(animSpriteCelSystem);
+        FreeMem(animSpriteCelSystem->events, animSpriteCelSystem->eventsMax * sizeof(AnimSpriteCelSystemEvent));
+        animSpriteCelSystem->events = NULL;
+    }
+    animSpriteCelSystem->eventsMax = 0;
+    animSpriteCelSystem->eventsCount = 0;
+    animSpriteCelSystem->eventsLost = 0;
+
+    // If the events are no longer collected
+    if (eventsMax == 0) {
+        // Return success
+        return 1;
+    }
+
+    // Allocate memory for the buffer
+    animSpriteCelSystem->events = (AnimSpriteCelSystemEvent *)AllocMem(eventsMax * sizeof(AnimSpriteCelSystemEvent), MEMTYPE_DRAM);
+    // If buffer allocation fails
+    if (animSpriteCelSystem->events == NULL) {
+        // Return error
+        printf("Error: Failed to allocate memory for AnimSpriteCelSystem events.\n");
+        return -1;
+    }
+    animSpriteCelSystem->eventsMax = eventsMax;
+
+    // If the system is partitioned, the outboxes keep the events of their partition
+    if ((animSpriteCelSystem->outboxes != NULL) && (AnimSpriteCelSystemOutboxEventsAllocation(animSpriteCelSystem) < 0)) {
+        // Free the buffer
+        FreeMem(animSpriteCelSystem->events, eventsMax * sizeof(AnimSpriteCelSystemEvent));
+        animSpriteCelSystem->events = NULL;
+        animSpriteCelSystem->eventsMax = 0;
+        // Return error
+        return -1;
+    }
+
+    // Return success
+    return 1;
+}
+
+// Appends the event of the step a registered AnimSpriteCel started
+void AnimSpriteCelSystemEventPush(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel, uint32 eventId) {
+
+    // Outbox of the partition running the AnimSpriteCel
+    AnimSpriteCelSystemOutbox *outbox = NULL;
+    // Event kept by the outbox
+    AnimSpriteCelSystemEvent *event = NULL;
+
+    // If no partitioned tick is running, the event goes straight to the buffer
+    if (animSpriteCelSystem->partitioned == 0) {
+        AnimSpriteCelSystemEventAppend(animSpriteCelSystem, animSpriteCel, eventId, animSpriteCelSystem->tick);
+        return;
+    }
+
+    // Kept by the partition until the end of the tick (its step changes once in the tick, there is always room)
+    outbox = &animSpriteCelSystem->outboxes[animSpriteCel->systemIndex / animSpriteCelSystem->partitionSize];
+    event = &outbox->events[outbox->eventsCount];
+    event->animSpriteCel = animSpriteCel;
+    event->eventId = eventId;
+    event->tick = animSpriteCelSystem->tick;
+    outbox->eventsCount++;
+}
+
+// Gives the collected events and their number
+AnimSpriteCelSystemEvent *AnimSpriteCelSystemEvents(AnimSpriteCelSystem *animSpriteCelSystem, uint32 *eventsCount) {
+
+    // If the system or the count is undefined
+    if ((animSpriteCelSystem == NULL) || (eventsCount == NULL)) {
+        // Log error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return NULL;
+    }
+
+    // In step change order (NULL and 0 if the events are not collected)
+    *eventsCount = animSpriteCelSystem->eventsCount;
+    return animSpriteCelSystem->events;
+}
+
+// Empties the event buffer, once drained
+int32 AnimSpriteCelSystemEventsClear(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return -1;
+    }
+
+    // If the events are not collected
+    if (animSpriteCelSystem->events == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem events not collected.\n");
+        return -1;
+    }
+
+    // The next events start at the beginning of the buffer
+    animSpriteCelSystem->eventsCount = 0;
+
+    // Return success
+    return 1;
+}
+
+// Gives the next tick at which a step ends
+int32 AnimSpriteCelSystemNextTick(AnimSpriteCelSystem *animSpriteCelSystem, uint32 *tick) {
+
+    // AnimSpriteCels to look at and their number
+    AnimSpriteCel **animSpriteCels = NULL;
+    uint32 animSpriteCelsCount = 0;
+    // Current AnimSpriteCel
+    AnimSpriteCel *animSpriteCel = NULL;
+    // Array index
+    uint32 index = 0;
+    // Level of the wheel
+    uint32 level = 0;
+    // Slot offset from the current one
+    uint32 offset = 0;
+    // Bit shift of the level
+    uint32 shift = 0;
+    // Slot mask
+    uint32 mask = ANIMSPRITECELSYSTEM_WHEEL_SLOTS - 1;
+    // Shortest delay found
+    uint32 delay = 0;
+    // Found flag
+    uint32 found = 0;
+    // Delay of an AnimSpriteCel and the cycles it must reach
+    uint32 animSpriteCelDelay = 0;
+    uint32 cycles = 0;
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return -1;
+    }
+
+    // A tick is a display cycle, not the microseconds elapsed
+    if (animSpriteCelSystem->microsecondsCount > 0) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem runs AnimSpriteCels in MICROSECONDS, use AnimSpriteCelSystemTimeRun().\n");
+        return -1;
+    }
+
+    // If triggers are pending, the next tick dispatches them
+    if (animSpriteCelSystem->triggersCount > 0) {
+        *tick = animSpriteCelSystem->tick;
+        return 1;
+    }
+
+    // If the animations are visited from an array: all of them, or the active set
+    if (animSpriteCelSystem->schedule != WHEEL) {
+        AnimSpriteCelSystemArray(animSpriteCelSystem, &animSpriteCels, &animSpriteCelsCount);
+        // Shortest remaining cycles of the running animations
+        for (index = 0; index < animSpriteCelsCount; index++) {
+            animSpriteCel = animSpriteCels[index];
+            if ((ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) == 0) || (animSpriteCel->iterationsCount == 0) || (animSpriteCel->speed == 0)) {
+                continue;
+            }
+            // At normal speed, one cycle per tick
+            animSpriteCelDelay = animSpriteCel->remainingCycles;
+            // Otherwise, the step changes on the tick its accumulator goes past the remaining cycles (capped to stay on 32 bits, which gives an earlier tick)
+            if (animSpriteCel->speed != ANIMSPRITECEL_SPEED_NORMAL) {
+                cycles = ((animSpriteCel->remainingCycles < 0x7FFF) ? animSpriteCel->remainingCycles : 0x7FFE) + 1;
+                animSpriteCelDelay = (((cycles << 16) - animSpriteCel->speedAccumulator + animSpriteCel->speed - 1) / animSpriteCel->speed) - 1;
+            }
+            if ((found == 0) || (animSpriteCelDelay < delay)) {
+                delay = animSpriteCelDelay;
+                found = 1;
+            }
+        }
+
+    } else {
+
+        // First level: one slot per tick
+        for (offset = 0; offset < ANIMSPRITECELSYSTEM_WHEEL_SLOTS; offset++) {
+            if (animSpriteCelSystem->wheel[0][(animSpriteCelSystem->tick + offset) & mask] != NULL) {
+                delay = offset;
+                found = 1;
+                break;
+            }
+        }
+
+        // Unless it falls before the next slot of the second level, the upper levels may hold an earlier step
+        if ((found == 0) || ((animSpriteCelSystem->tick & mask) + offset >= ANIMSPRITECELSYSTEM_WHEEL_SLOTS)) {
+
+            // Upper levels: the first used slot after the current one holds the earliest steps of the level
+            for (level = 1; level < ANIMSPRITECELSYSTEM_WHEEL_LEVELS; level++) {
+                shift = level * ANIMSPRITECELSYSTEM_WHEEL_BITS;
+                for (offset = 1; offset <= ANIMSPRITECELSYSTEM_WHEEL_SLOTS; offset++) {
+                    animSpriteCel = animSpriteCelSystem->wheel[level][((animSpriteCelSystem->tick >> shift) + offset) & mask];
+                    if (animSpriteCel != NULL) {
+                        break;
+                    }
+                }
+                for (; animSpriteCel != NULL; animSpriteCel = animSpriteCel->wheelNext) {
+                    if ((found == 0) || (animSpriteCel->expiryTick - animSpriteCelSystem->tick < delay)) {
+                        delay = animSpriteCel->expiryTick - animSpriteCelSystem->tick;
+                        found = 1;
+                    }
+                }
+            }
+
+            // Overflow list
+            for (animSpriteCel = animSpriteCelSystem->wheelOverflow; animSpriteCel != NULL; animSpriteCel = animSpriteCel->wheelNext) {
+                if ((found == 0) || (animSpriteCel->expiryTick - animSpriteCelSystem->tick < delay)) {
+                    delay = animSpriteCel->expiryTick - animSpriteCelSystem->tick;
+                    found = 1;
+                }
+            }
+        }
+    }
+
+    // If no step is running
+    if (found == 0) {
+        return 0;
+    }
+
+    // Tick of the next step change
+    *tick = animSpriteCelSystem->tick + delay;
+
+    // Return success
+    return 1;
+}
+
+// Jumps to a later tick without running the empty ticks
+int32 AnimSpriteCelSystemSkip(AnimSpriteCelSystem *animSpriteCelSystem, uint32 tick) {
+
+    // AnimSpriteCels to look at and their number
+    AnimSpriteCel **animSpriteCels = NULL;
+    uint32 animSpriteCelsCount = 0;
+    // Current AnimSpriteCel
+    AnimSpriteCel *animSpriteCel = NULL;
+    // Array index
+    uint32 index = 0;
+    // Tick of the next step change
+    uint32 nextTick = 0;
+    // Skipped ticks
+    uint32 delay = 0;
+    // Last tick run
+    uint32 previousTick = 0;
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return -1;
+    }
+
+    // A tick is a display cycle, not the microseconds elapsed
+    if (animSpriteCelSystem->microsecondsCount > 0) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem runs AnimSpriteCels in MICROSECONDS, use AnimSpriteCelSystemTimeRun().\n");
+        return -1;
+    }
+
+    // Skipped ticks
+    delay = tick - animSpriteCelSystem->tick;
+
+    // Never jump over a step change
+    if (AnimSpriteCelSystemNextTick(animSpriteCelSystem, &nextTick) == 1) {
+        if (nextTick - animSpriteCelSystem->tick < delay) {
+            delay = nextTick - animSpriteCelSystem->tick;
+        }
+    }
+
+    // If there is nothing to skip
+    if (delay == 0) {
+        return 1;
+    }
+
+    // If the animations are visited from an array: all of them, or the active set
+    if (animSpriteCelSystem->schedule != WHEEL) {
+        AnimSpriteCelSystemArray(animSpriteCelSystem, &animSpriteCels, &animSpriteCelsCount);
+        // Consume the skipped ticks on the running animations
+        for (index = 0; index < animSpriteCelsCount; index++) {
+            animSpriteCel = animSpriteCels[index];
+            if ((ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) == 0) || (animSpriteCel->iterationsCount == 0)) {
+                continue;
+            }
+            // At another speed, the skipped ticks go through the accumulator (below the next step change, so on 32 bits)
+            if (animSpriteCel->speed != ANIMSPRITECEL_SPEED_NORMAL) {
+                animSpriteCel->speedAccumulator += delay * animSpriteCel->speed;
+                animSpriteCel->remainingCycles -= animSpriteCel->speedAccumulator >> 16;
+                animSpriteCel->speedAccumulator &= 0xFFFF;
+                continue;
+            }
+            animSpriteCel->remainingCycles -= delay;
+        }
+        animSpriteCelSystem->tick += delay;
+
+    } else {
+        // Move the wheel and cascade the slots of the reached tick
+        previousTick = animSpriteCelSystem->tick - 1;
+        animSpriteCelSystem->tick += delay;
+        AnimSpriteCelSystemWheelCascade(animSpriteCelSystem, previousTick);
+    }
+
+    // Return success
+    return 1;
+}
+
+// Gives the size of the buffer of a snapshot
+uint32 AnimSpriteCelSystemSnapshotSize(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return 0;
+    }
+
+    // Header, playheads, and room for a full trigger queue
+    return sizeof(AnimSpriteCelSystemSnapshotHeader) + (animSpriteCelSystem->animSpriteCelsCount * sizeof(AnimSpriteCelSystemPlayhead)) + (animSpriteCelSystem->triggersMax * sizeof(AnimSpriteCelSystemSnapshotTrigger));
+}
+
+// Copies the playheads of the registered AnimSpriteCels into a buffer
+int32 AnimSpriteCelSystemSnapshot(AnimSpriteCelSystem *animSpriteCelSystem, void *buffer, uint32 bufferSize) {
+
+    // Parts of the buffer
+    AnimSpriteCelSystemSnapshotHeader *header = NULL;
+    AnimSpriteCelSystemPlayhead *playheads = NULL;
+    AnimSpriteCelSystemSnapshotTrigger *triggers = NULL;
+    // Current AnimSpriteCel
+    AnimSpriteCel *animSpriteCel = NULL;
+    // Bytes written
+    uint32 size = 0;
+    // Array index
+    uint32 index = 0;
+    // Queue index
+    uint32 queueIndex = 0;
+    // Pending trigger
+    AnimSpriteCelSystemTrigger *trigger = NULL;
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return -1;
+    }
+
+    // If the buffer is undefined
+    if (buffer == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem snapshot buffer unknown.\n");
+        return -1;
+    }
+
+    // If a partitioned tick is running
+    if (animSpriteCelSystem->partitioned == 1) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem partitioned tick running.\n");
+        return -1;
+    }
+
+    // Header, playheads and the triggers actually pending
+    size = sizeof(AnimSpriteCelSystemSnapshotHeader) + (animSpriteCelSystem->animSpriteCelsCount * sizeof(AnimSpriteCelSystemPlayhead)) + (animSpriteCelSystem->triggersCount * sizeof(AnimSpriteCelSystemSnapshotTrigger));
+
+    // If the buffer is too small
+    if (bufferSize < size) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem snapshot needs %u bytes (%u given).\n", size, bufferSize);
+        return -1;
+    }
+
+    header = (AnimSpriteCelSystemSnapshotHeader *)buffer;
+    playheads = (AnimSpriteCelSystemPlayhead *)(header + 1);
+    triggers = (AnimSpriteCelSystemSnapshotTrigger *)(playheads + animSpriteCelSystem->animSpriteCelsCount);
+
+    // Pending triggers from the oldest, the receivers named by their registration index
+    queueIndex = animSpriteCelSystem->triggersFirst;
+    for (index = 0; index < animSpriteCelSystem->triggersCount; index++) {
+
+        trigger = &animSpriteCelSystem->triggers[queueIndex];
+        queueIndex++;
+        if (queueIndex == animSpriteCelSystem->triggersMax) {
+            queueIndex = 0;
+        }
+
+        // If the receiver was unregistered meanwhile
+        if (trigger->animSpriteCel == NULL) {
+            triggers[index].receiverIndex = ANIMSPRITECELSYSTEM_SNAPSHOT_NONE;
+        // If the receiver can't be named by an index
+        } else if (trigger->animSpriteCel->system != animSpriteCelSystem) {
+            // Return error
+            printf("Error: AnimSpriteCelSystem pending trigger to an AnimSpriteCel outside the system.\n");
+            return -1;
+        } else {
+            triggers[index].receiverIndex = trigger->animSpriteCel->systemIndex;
+        }
+        triggers[index].depth = trigger->depth;
+    }
+
+    // State of the system
+    header->magic = ANIMSPRITECELSYSTEM_SNAPSHOT_MAGIC;
+    header->animSpriteCelsCount = animSpriteCelSystem->animSpriteCelsCount;
+    header->triggersCount = animSpriteCelSystem->triggersCount;
+    header->tick = animSpriteCelSystem->tick;
+    header->timeAccumulator = animSpriteCelSystem->timeAccumulator;
+
+    // For each registered AnimSpriteCel
+    for (index = 0; index < animSpriteCelSystem->animSpriteCelsCount; index++) {
+
+        animSpriteCel = animSpriteCelSystem->animSpriteCels[index];
+
+        playheads[index].stepIndex = (uint32)animSpriteCel->stepIndex;
+        playheads[index].remainingCycles = animSpriteCel->remainingCycles;
+        playheads[index].iterationsCount = animSpriteCel->iterationsCount;
+        playheads[index].randomState = animSpriteCel->randomState;
+        playheads[index].stateHash = animSpriteCel->stateHash;
+        playheads[index].speedAccumulator = (uint16)animSpriteCel->speedAccumulator;
+        playheads[index].flags = (animSpriteCel->direction == -1) ? ANIMSPRITECELSYSTEM_PLAYHEAD_BACKWARD : 0;
+
+        // The schedule fields are only read by their schedule
+        if (animSpriteCelSystem->schedule == WHEEL) {
+            // The end of a step held by the wheel is counted from the next tick
+            if (animSpriteCel->wheelSlot != NULL) {
+                playheads[index].remainingCycles = animSpriteCel->expiryTick - animSpriteCelSystem->tick;
+            }
+        } else if ((animSpriteCelSystem->schedule == ACTIVE) && (animSpriteCel->systemActive == 1)) {
+            playheads[index].flags |= ANIMSPRITECELSYSTEM_PLAYHEAD_ACTIVE;
+        }
+    }
+
+    // Return the bytes written
+    return (int32)size;
+}
+
+// Writes the playheads of a snapshot back
+int32 AnimSpriteCelSystemRestore(AnimSpriteCelSystem *animSpriteCelSystem, const void *buffer, uint32 bufferSize) {
+
+    // Parts of the buffer
+    const AnimSpriteCelSystemSnapshotHeader *header = NULL;
+    const AnimSpriteCelSystemPlayhead *playheads = NULL;
+    const AnimSpriteCelSystemSnapshotTrigger *triggers = NULL;
+    // Current AnimSpriteCel
+    AnimSpriteCel *animSpriteCel = NULL;
+    // Bytes to read
+    uint32 size = 0;
+    // Array and queue index
+    uint32 index = 0;
+    // State hash kept
+    uint32 hashed = 0;
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return -1;
+    }
+
+    // If the buffer is undefined
+    if (buffer == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem snapshot buffer unknown.\n");
+        return -1;
+    }
+
+    // If a partitioned tick is running
+    if (animSpriteCelSystem->partitioned == 1) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem partitioned tick running.\n");
+        return -1;
+    }
+
+    // If the buffer can't hold a header or doesn't start with one
+    header = (const AnimSpriteCelSystemSnapshotHeader *)buffer;
+    if ((bufferSize < sizeof(AnimSpriteCelSystemSnapshotHeader)) || (header->magic != ANIMSPRITECELSYSTEM_SNAPSHOT_MAGIC)) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem snapshot invalid.\n");
+        return -1;
+    }
+
+    // If the registrations changed
+    if (header->animSpriteCelsCount != animSpriteCelSystem->animSpriteCelsCount) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem snapshot of %u AnimSpriteCels (%u registered).\n", header->animSpriteCelsCount, animSpriteCelSystem->animSpriteCelsCount);
+        return -1;
+    }
+
+    // If the pending triggers don't fit in the queue
+    if (header->triggersCount > animSpriteCelSystem->triggersMax) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem snapshot holds %u triggers (queue of %u).\n", header->triggersCount, animSpriteCelSystem->triggersMax);
+        return -1;
+    }
+
+    // If the buffer is shorter than the snapshot
+    size = sizeof(AnimSpriteCelSystemSnapshotHeader) + (header->animSpriteCelsCount * sizeof(AnimSpriteCelSystemPlayhead)) + (header->triggersCount * sizeof(AnimSpriteCelSystemSnapshotTrigger));
+    if (bufferSize < size) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem snapshot invalid.\n");
+        return -1;
+    }
+
+    playheads = (const AnimSpriteCelSystemPlayhead *)(header + 1);
+    triggers = (const AnimSpriteCelSystemSnapshotTrigger *)(playheads + header->animSpriteCelsCount);
+
+    // Check every index before changing anything, so that a bad snapshot leaves the system as it was
+    for (index = 0; index < header->animSpriteCelsCount; index++) {
+        if (playheads[index].stepIndex >= animSpriteCelSystem->animSpriteCels[index]->stepsCount) {
+            // Return error
+            printf("Error: AnimSpriteCelSystem snapshot invalid.\n");
+            return -1;
+        }
+    }
+    for (index = 0; index < header->triggersCount; index++) {
+        if ((triggers[index].receiverIndex != ANIMSPRITECELSYSTEM_SNAPSHOT_NONE) && (triggers[index].receiverIndex >= header->animSpriteCelsCount)) {
+            // Return error
+            printf("Error: AnimSpriteCelSystem snapshot invalid.\n");
+            return -1;
+        }
+    }
+
+    // State of the system (the steps are scheduled from this tick)
+    animSpriteCelSystem->tick = header->tick;
+    animSpriteCelSystem->timeAccumulator = header->timeAccumulator;
+
+    // The active set is rebuilt in registration order
+    animSpriteCelSystem->activeCount = 0;
+    animSpriteCelSystem->wokenCount = 0;
+
+    // The terms come back with the playheads, the wheel relinks them without taking them again
+    hashed = animSpriteCelSystem->hashed;
+    animSpriteCelSystem->hashed = 0;
+    animSpriteCelSystem->stateHash = 0;
+
+    // For each registered AnimSpriteCel
+    for (index = 0; index < header->animSpriteCelsCount; index++) {
+
+        animSpriteCel = animSpriteCelSystem->animSpriteCels[index];
+
+        animSpriteCel->stepIndex = (int32)playheads[index].stepIndex;
+        animSpriteCel->direction = ((playheads[index].flags & ANIMSPRITECELSYSTEM_PLAYHEAD_BACKWARD) != 0) ? -1 : 1;
+        animSpriteCel->remainingCycles = playheads[index].remainingCycles;
+        animSpriteCel->iterationsCount = playheads[index].iterationsCount;
+        animSpriteCel->randomState = playheads[index].randomState;
+        animSpriteCel->speedAccumulator = playheads[index].speedAccumulator;
+        animSpriteCel->stateHash = playheads[index].stateHash;
+        animSpriteCelSystem->stateHash += animSpriteCel->stateHash;
+
+        // Frame of the step, a changed CCB is noted by the system tracking them
+        if ((animSpriteCel->stepDisplay(animSpriteCel) == 1) && (animSpriteCelSystem->dirty != NULL)) {
+            AnimSpriteCelSystemDirty(animSpriteCelSystem, animSpriteCel);
+        }
+
+        // If only the animations able to progress are visited
+        if (animSpriteCelSystem->schedule == ACTIVE) {
+            // Back in the active set if it was there or woken
+            animSpriteCel->systemActive = ((playheads[index].flags & ANIMSPRITECELSYSTEM_PLAYHEAD_ACTIVE) != 0) ? 1 : 0;
+            if (animSpriteCel->systemActive == 1) {
+                animSpriteCelSystem->active[animSpriteCelSystem->activeCount] = animSpriteCel;
+                animSpriteCelSystem->activeCount++;
+            }
+        } else if (animSpriteCelSystem->schedule == WHEEL) {
+            // Relink the end of the step from the restored tick
+            AnimSpriteCelSystemSchedule(animSpriteCelSystem, animSpriteCel);
+        }
+    }
+    animSpriteCelSystem->hashed = hashed;
+
+    // Pending triggers, in the same order
+    animSpriteCelSystem->triggersFirst = 0;
+    animSpriteCelSystem->triggersCount = header->triggersCount;
+    for (index = 0; index < header->triggersCount; index++) {
+        animSpriteCelSystem->triggers[index].animSpriteCel = (triggers[index].receiverIndex == ANIMSPRITECELSYSTEM_SNAPSHOT_NONE) ? NULL : animSpriteCelSystem->animSpriteCels[triggers[index].receiverIndex];
+        animSpriteCelSystem->triggers[index].depth = triggers[index].depth;
+    }
+
+    // Return success
+    return 1;
+}
+
+// Starts or stops keeping the state hash, and recording its changes
+int32 AnimSpriteCelSystemHashConfiguration(AnimSpriteCelSystem *animSpriteCelSystem, uint32 hashed, uint32 entriesMax) {
+
+    // Current AnimSpriteCel
+    AnimSpriteCel *animSpriteCel = NULL;
+    // Array index
+    uint32 index = 0;
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return -1;
+    }
+
+    // If a partitioned tick is running
+    if (animSpriteCelSystem->partitioned == 1) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem partitioned tick running.\n");
+        return -1;
+    }
+
+    // Free the previous record if present
+    if (animSpriteCelSystem->hashEntries != NULL) {
+        FreeMem(animSpriteCelSystem->hashEntries, animSpriteCelSystem->hashEntriesMax * sizeof(AnimSpriteCelSystemHashEntry));
+        animSpriteCelSystem->hashEntries = NULL;
+        animSpriteCelSystem->hashEntriesMax = 0;
+    }
+
+    // If the state hash is no longer kept
+    if (hashed == 0) {
+        animSpriteCelSystem->hashed = 0;
+        animSpriteCelSystem->stateHash = 0;
+        // Return success
+        return 1;
+    }
+
+    // If the changes are recorded
+    if (entriesMax > 0) {
+        // Allocate memory for the record
+        animSpriteCelSystem->hashEntries = (AnimSpriteCelSystemHashEntry *)AllocMem(entriesMax * sizeof(AnimSpriteCelSystemHashEntry), MEMTYPE_DRAM);
+        // If record allocation fails
+        if (animSpriteCelSystem->hashEntries == NULL) {
+            // Return error
+            printf("Error: Failed to allocate memory for AnimSpriteCelSystem hash entries.\n");
+            return -1;
+        }
+        animSpriteCelSystem->hashEntriesMax = entriesMax;
+    }
+    animSpriteCelSystem->hashEntriesCount = 0;
+    animSpriteCelSystem->hashEntriesLost = 0;
+
+    // If the hash starts being kept, every registered AnimSpriteCel takes its term (the only walk of the array)
+    if (animSpriteCelSystem->hashed == 0) {
+        animSpriteCelSystem->stateHash = 0;
+        for (index = 0; index < animSpriteCelSystem->animSpriteCelsCount; index++) {
+            animSpriteCel = animSpriteCelSystem->animSpriteCels[index];
+            animSpriteCel->stateHash = AnimSpriteCelSystemHashTerm(animSpriteCelSystem, animSpriteCel);
+            animSpriteCelSystem->stateHash += animSpriteCel->stateHash;
+        }
+        animSpriteCelSystem->hashed = 1;
+    }
+
+    // The record starts from the current state
+    animSpriteCelSystem->hashOriginTick = animSpriteCelSystem->tick;
+    animSpriteCelSystem->hashOrigin = animSpriteCelSystem->stateHash;
+
+    // Return success
+    return 1;
+}
+
+// Gives the state hash of the registered AnimSpriteCels
+uint32 AnimSpriteCelSystemHash(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return 0;
+    }
+
+    // Kept up to date by the step changes (0 if not kept)
+    return animSpriteCelSystem->stateHash;
+}
+
+// Writes the recorded changes of the state hash into a buffer
+int32 AnimSpriteCelSystemHashCopy(AnimSpriteCelSystem *animSpriteCelSystem, void *buffer, uint32 bufferSize) {
+
+    // Header at the start of the buffer
+    AnimSpriteCelSystemHashHeader *header = (AnimSpriteCelSystemHashHeader *)buffer;
+    // Number of changes copied
+    uint32 entriesCount = 0;
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return -1;
+    }
+
+    // If the changes are not recorded
+    if (animSpriteCelSystem->hashEntries == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem hash not recorded.\n");
+        return -1;
+    }
+
+    // If the buffer is undefined
+    if (buffer == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem hash buffer unknown.\n");
+        return -1;
+    }
+
+    // If the header doesn't fit
+    if (bufferSize < sizeof(AnimSpriteCelSystemHashHeader)) {
+        // Return error
+        printf("Error: AnimSpriteCelSystem hash buffer too small.\n");
+        return -1;
+    }
+
+    // Changes from the first one, limited to the size of the buffer
+    entriesCount = animSpriteCelSystem->hashEntriesCount;
+    if (entriesCount > (bufferSize - sizeof(AnimSpriteCelSystemHashHeader)) / sizeof(AnimSpriteCelSystemHashEntry)) {
+        entriesCount = (bufferSize - sizeof(AnimSpriteCelSystemHashHeader)) / sizeof(AnimSpriteCelSystemHashEntry);
+    }
+
+    // Header of the record
+    header->magic = ANIMSPRITECELSYSTEM_HASH_MAGIC;
+    header->entriesCount = entriesCount;
+    header->entriesLost = animSpriteCelSystem->hashEntriesLost + (animSpriteCelSystem->hashEntriesCount - entriesCount);
+    header->tick = animSpriteCelSystem->hashOriginTick;
+    header->stateHash = animSpriteCelSystem->hashOrigin;
+
+    // Changes after the header
+    memcpy(header + 1, animSpriteCelSystem->hashEntries, entriesCount * sizeof(AnimSpriteCelSystemHashEntry));
+
+    // Return the number of bytes written
+    return (int32)(sizeof(AnimSpriteCelSystemHashHeader) + entriesCount * sizeof(AnimSpriteCelSystemHashEntry));
+}
+
+// Cleans up the AnimSpriteCelSystem
+int32 AnimSpriteCelSystemCleanup(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+    // Array index
+    uint32 index = 0;
+
+    // If the system is undefined
+    if (animSpriteCelSystem == NULL) {
+        printf("Error: AnimSpriteCelSystem unknown.\n");
+        return -1;
+    }
+
+    // Free the array and the AnimSpriteCels it owns if present
+    if (animSpriteCelSystem->animSpriteCels != NULL) {
+        for (index = 0; index < animSpriteCelSystem->animSpriteCelsCount; index++) {
+            // Unlink first so that the cleanup doesn't shift the array
+            animSpriteCelSystem->animSpriteCels[index]->system = NULL;
+            AnimSpriteCelCleanup(animSpriteCelSystem->animSpriteCels[index]);
+        }
+        FreeMem(animSpriteCelSystem->animSpriteCels, animSpriteCelSystem->animSpriteCelsMax * sizeof(AnimSpriteCel *));
+        animSpriteCelSystem->animSpriteCels = NULL;
+    }
+
+    // Free the active set and the woken AnimSpriteCels if present
+    if (animSpriteCelSystem->active != NULL) {
+        FreeMem(animSpriteCelSystem->active, animSpriteCelSystem->animSpriteCelsMax * sizeof(AnimSpriteCel *));
+        FreeMem(animSpriteCelSystem->woken, animSpriteCelSystem->animSpriteCelsMax * sizeof(AnimSpriteCel *));
+        animSpriteCelSystem->active = NULL;
+        animSpriteCelSystem->woken = NULL;
+    }
+
+    // Free the draw groups if present
+    if (animSpriteCelSystem->drawGroups != NULL) {
+        FreeMem(animSpriteCelSystem->drawGroups, animSpriteCelSystem->drawGroupsMax * sizeof(AnimSpriteCelSystemDrawGroup));
+        animSpriteCelSystem->drawGroups = NULL;
+    }
+
+    // Free the dirty bitset if present
+    if (animSpriteCelSystem->dirty != NULL) {
+        FreeMem(animSpriteCelSystem->dirty, ANIMSPRITECELSYSTEM_DIRTY_WORDS(animSpriteCelSystem->animSpriteCelsMax) * sizeof(uint32));
+        animSpriteCelSystem->dirty = NULL;
+    }
+
+    // Free the record of the state hash if present
+    if (animSpriteCelSystem->hashEntries != NULL) {
+        FreeMem(animSpriteCelSystem->hashEntries, animSpriteCelSystem->hashEntriesMax * sizeof(AnimSpriteCelSystemHashEntry));
+        animSpriteCelSystem->hashEntries = NULL;
+    }
+
+    // Free the trigger queue if present
+    if (animSpriteCelSystem->triggers != NULL) {
+        FreeMem(animSpriteCelSystem->triggers, animSpriteCelSystem->triggersMax * sizeof(AnimSpriteCelSystemTrigger));
+        animSpriteCelSystem->triggers = NULL;
+    }
+
+    // Free the event buffer if present
+    if (animSpriteCelSystem->events != NULL) {
+        FreeMem(animSpriteCelSystem->events, animSpriteCelSystem->eventsMax * sizeof(AnimSpriteCelSystemEvent));
+        animSpriteCelSystem->events = NULL;
+    }
+
+    // Free the outboxes and their events if present
+    if (animSpriteCelSystem->outboxes != NULL) {
+        AnimSpriteCelSystemOutboxEventsFree(animSpriteCelSystem);
+        FreeMem(animSpriteCelSystem->outboxes[0].receivers, animSpriteCelSystem->partitionsCount * animSpriteCelSystem->partitionSize * sizeof(AnimSpriteCel *));
+        FreeMem(animSpriteCelSystem->outboxes, animSpriteCelSystem->partitionsCount * sizeof(AnimSpriteCelSystemOutbox));
+        animSpriteCelSystem->outboxes = NULL;
+    }
+
+    // Free the AnimSpriteCelSystem structure itself
+    FreeMem(animSpriteCelSystem, sizeof(AnimSpriteCelSystem));
+
+    // Return success
+    return 1;
+}
@@ -0,0 +1,875 @@
+#ifndef ANIMSPRITECELSYSTEM_H
+#define ANIMSPRITECELSYSTEM_H
+
+/******************************************************************************
+**
+**  AnimSpriteCelSystem - Batched execution of AnimSpriteCels (3DO Cel Engine)
+**
+**  Author: Christophe Geoffroy (Topper) - MIT License
+**  Last Updated: 2026-10-17
+**
+**  This module groups many AnimSpriteCels in a single container so that they
+**  can be run with one call per display cycle. Each AnimSpriteCel is validated
+**  once when it is registered (AnimSpriteCel, SpriteCel and steps defined,
+**  at least two steps). AnimSpriteCelSystemRun() then walks the contiguous
+**  array of registered AnimSpriteCels without repeating those checks and
+**  without going through AnimSpriteCelRun() for every animation.
+**
+**  The progression of each AnimSpriteCel is strictly identical to a call to
+**  AnimSpriteCelRun(): same NORMAL / REVERSE / ALTERNATE behavior, same
+**  iteration counting and same triggers, in registration order.
+**
+**  Three schedules are available:
+**
+**    - POLLING: every AnimSpriteCel is visited on each display cycle, as with
+**      AnimSpriteCelRun().
+**
+**    - WHEEL: AnimSpriteCels are stored in a hierarchical timing wheel keyed
+**      by the display cycle ("tick") at which their current step ends. Each
+**      display cycle only visits the AnimSpriteCels whose step actually ends,
+**      so the cost scales with the number of transitions instead of the number
+**      of animations. The AnimSpriteCels of a tick are visited in registration
+**      order, as in POLLING schedule. Waiting and finished AnimSpriteCels are not stored at
+**      all. The wheel has 4 levels of 64 slots (2^24 ticks); longer delays
+**      go to an overflow list that is sorted out every 2^24 ticks.
+**
+**    - ACTIVE: only the AnimSpriteCels able to progress are visited, from a
+**      compact array kept in registration order (the active set). An
+**      AnimSpriteCel that waits for a trigger or has completed its iterations
+**      leaves the set when it is visited, so it costs nothing until it is
+**      woken. AnimSpriteCelSystemSchedule(), called on every step change,
+**      wakes it in O(1) by appending it to a list of woken AnimSpriteCels.
+**      That list is sorted and merged into the active set at the start of
+**      the next tick. The visit of each AnimSpriteCel is the one of the
+**      POLLING schedule, so the cost scales with the number of animations
+**      that can progress.
+**
+**  Triggers are delivered in one of three ways:
+**
+**    - IMMEDIATE (default): AnimSpriteCelNextStep() triggers the receiver at
+**      once, as without a system. A chain of triggers recurses on the stack
+**      and its result depends on the registration order.
+**
+**    - SAME_TICK: AnimSpriteCelNextStep() queues the trigger. The queue is
+**      drained iteratively, in sending order, once every animation of the
+**      tick has been run. The triggers sent by the receivers are appended
+**      and dispatched within the same tick.
+**
+**    - NEXT_TICK: the triggers queued during a tick are dispatched at the
+**      start of the next one. A chain moves one link per tick.
+**
+**  The dispatch stops at the budget of triggers per tick, the rest is kept
+**  for the next tick. In SAME_TICK delivery, a trigger reached through more
+**  chained triggers than there are registered AnimSpriteCels has gone around
+**  a cycle of receivers: the dispatch stops and the cycle goes on at the
+**  next tick instead of never settling.
+**
+**  AnimSpriteCelSystemSeed() gives every registered AnimSpriteCel its own
+**  xorshift generator, derived from the system seed and its registration
+**  index, and rolls all the current random steps in one pass. AnimSpriteCels
+**  registered afterwards are seeded the same way. The same seed and the same
+**  registrations then give the same random durations on every run.
+**
+**  AnimSpriteCelSystemTimeScale() slows down or speeds up the whole system
+**  with one store: the time scale, in 16.16 fixed point, is added to an
+**  accumulator on each AnimSpriteCelSystemRun(), which runs as many ticks as
+**  the accumulator holds whole ones (0x8000 runs a tick every other display
+**  cycle, 0x18000 runs 1 and 2 ticks in turn). The visits also follow the
+**  speed of each AnimSpriteCel (AnimSpriteCelSpeed()), from its own
+**  accumulator. Neither uses floating point nor a division per tick.
+**
+**  When the display rate varies, AnimSpriteCelSystemTimeRun() replaces
+**  AnimSpriteCelSystemRun(): given the microseconds elapsed since the last
+**  display cycle, it catches them up on each AnimSpriteCel counted in
+**  MICROSECONDS (AnimSpriteCelTimeBaseConfiguration()) and runs the others
+**  for one display cycle. The time scale applies to the elapsed time, with
+**  the fraction of microsecond carried to the next run.
+**
+**  A POLLING tick can also be split into partitions: contiguous ranges of
+**  the array, run one by one or from several threads on the host (see
+**  AnimSpriteCelParallel). AnimSpriteCelSystemPartitionBegin() does what
+**  AnimSpriteCelSystemRun() does before the visit, each partition is then
+**  visited by AnimSpriteCelSystemPartitionRun(), and
+**  AnimSpriteCelSystemPartitionEnd() does what comes after. A partition
+**  only touches its own AnimSpriteCels: the triggers it sends go to its
+**  outbox instead of the shared queue, and the outboxes are merged in
+**  partition order. The queue then holds the triggers in the order of
+**  AnimSpriteCelSystemRun(), whatever the order in which the partitions
+**  were run, and the tick gives exactly the same result.
+**
+**  The system can also keep the CCBs of its visible AnimSpriteCels linked
+**  in a single list (AnimSpriteCelSystemDrawConfiguration()), drawn with one
+**  DrawCels() call from AnimSpriteCelSystemDrawList(). The list is relinked
+**  only when an AnimSpriteCel is registered, unregistered or changes its
+**  visibility, never by the steps:
+**
+**    - SPAWN_ORDER: a CCB is appended at the end of the list, so the ones
+**      shown last are drawn on top.
+**
+**    - SOURCE_ORDER: the CCBs are grouped by SpriteCel and PLUT, so
+**      consecutive cels read the same sheet with the same palette. A CCB is
+**      inserted after the last one of its group; a new group goes at the
+**      end of the list. The order of the groups and inside a group is the
+**      order in which they were shown.
+**
+**  With AnimSpriteCelSystemDirtyConfiguration(), the system keeps one bit
+**  per registered AnimSpriteCel, set when its CCB is written. A step that
+**  shows the frame already in the CCB doesn't write it, so only the CCBs
+**  that really changed are marked. After a tick, AnimSpriteCelSystemChanged()
+**  lists them in registration order, for a renderer or a network layer that
+**  only wants the deltas, and AnimSpriteCelSystemDirtyClear() starts the
+**  next set:
+**
+**    uint32 cursor = 0;
+**    AnimSpriteCel *animSpriteCel = NULL;
+**
+**    AnimSpriteCelSystemRun(animSpriteCelSystem);
+**    while ((animSpriteCel = AnimSpriteCelSystemChanged(animSpriteCelSystem, &cursor)) != NULL) {
+**        // animSpriteCel->cel changed
+**    }
+**    AnimSpriteCelSystemDirtyClear(animSpriteCelSystem);
+**
+**  With AnimSpriteCelSystemEventConfiguration(), the system collects the
+**  events of the steps (AnimSpriteCelStepEvent()) in a buffer allocated
+**  once: when a registered AnimSpriteCel starts a step carrying an event,
+**  the AnimSpriteCel, the event and the tick are appended. The game drains
+**  the buffer once per frame instead of polling the steps of every
+**  AnimSpriteCel, then AnimSpriteCelSystemEventsClear() empties it:
+**
+**    uint32 eventsCount = 0;
+**    uint32 index = 0;
+**    AnimSpriteCelSystemEvent *events = NULL;
+**
+**    AnimSpriteCelSystemRun(animSpriteCelSystem);
+**    events = AnimSpriteCelSystemEvents(animSpriteCelSystem, &eventsCount);
+**    for (index = 0; index < eventsCount; index++) {
+**        // events[index].eventId sent by events[index].animSpriteCel
+**    }
+**    AnimSpriteCelSystemEventsClear(animSpriteCelSystem);
+**
+**  AnimSpriteCelSystemNextTick() gives the next tick at which a step ends,
+**  and AnimSpriteCelSystemSkip() jumps over the empty ticks before it. A
+**  headless simulation can therefore go from event to event.
+**
+**  For rollback and save states, AnimSpriteCelSystemSnapshot() copies the
+**  playheads of the registered AnimSpriteCels (step, direction, remaining
+**  cycles, iterations, random generator, speed fraction) into a buffer
+**  given by the caller, with the tick, the time scale fraction and the
+**  pending triggers. The buffer holds no pointer: AnimSpriteCels are named
+**  by their registration index, so it stays valid if the system is moved
+**  or rebuilt with the same registrations. AnimSpriteCelSystemRestore()
+**  writes them back without allocating, writes the CCB of each
+**  AnimSpriteCel from its step and rebuilds the wheel or the active set.
+**  A playhead takes 24 bytes, and both functions only copy fields, so they
+**  can run on every display cycle:
+**
+**    uint32 size = AnimSpriteCelSystemSnapshotSize(animSpriteCelSystem);
+**    void *frames = AllocMem(size * 8, MEMTYPE_DRAM);
+**
+**    AnimSpriteCelSystemSnapshot(animSpriteCelSystem, (uint8 *)frames + (frame % 8) * size, size);
+**    ...
+**    AnimSpriteCelSystemRestore(animSpriteCelSystem, (uint8 *)frames + (confirmed % 8) * size, size);
+**
+**  For lockstep and replays, AnimSpriteCelSystemHashConfiguration() keeps a
+**  hash of the playheads. Each registered AnimSpriteCel holds a term, mixed
+**  from its registration index, its playhead and the tick at which it was
+**  set, and the state hash is the sum of the terms. AnimSpriteCelSystemSchedule(),
+**  called on every step change, replaces the term of the AnimSpriteCel in
+**  the sum: the array is never walked again, and AnimSpriteCelSystemHash()
+**  gives the hash after each tick, to be compared with a peer or a replay.
+**  A duration drawn from the hardware random numbers or a trigger delivered
+**  in another order changes the term of the step it starts, and so the hash
+**  of that tick.
+**
+**  Given a number of entries, the configuration also records each change of
+**  a term (tick, registration index, playhead, and state hash after it)
+**  until the record is full. AnimSpriteCelSystemHashCopy() writes the record
+**  into a buffer, and AnimSpriteCelHashTool (host program, see
+**  AnimSpriteCelHashTool.c) bisects two saved records down to the first
+**  change that differs: its tick, its AnimSpriteCel and both playheads.
+**
+**  Important Notes:
+**
+**    - The system owns the registered AnimSpriteCels. AnimSpriteCelSystemCleanup()
+**      cleans them up with the system. An AnimSpriteCel can be given back to
+**      the caller with AnimSpriteCelSystemUnregister().
+**
+**    - Calling AnimSpriteCelCleanup() on a registered AnimSpriteCel removes
+**      it from its system first.
+**
+**    - A packed step names its receiver by registration index. Removing an
+**      AnimSpriteCel shifts the ones after it, so AnimSpriteCelSystemUnregister()
+**      (and AnimSpriteCelCleanup()) refuse it while a registered packed step
+**      names its index or a later one. Unregister the packed senders first, or
+**      clean the system up with them.
+**
+**    - The registration order is kept when an AnimSpriteCel is removed.
+**
+**    - In WHEEL schedule, "remainingCycles" is not decremented on each tick:
+**      the end of the step is held by "expiryTick". It is brought up to date
+**      when the AnimSpriteCel is unregistered. A step started by a trigger
+**      always lasts its full duration from the next tick, whatever the
+**      registration order of the sender and the receiver.
+**
+**    - Queued triggers are dropped when an AnimSpriteCel is unregistered. A
+**      receiver that is not registered in the system must outlive the
+**      triggers sent to it.
+**
+**    - A partitioned tick needs the POLLING schedule and a queued delivery
+**      (SAME_TICK or NEXT_TICK): an IMMEDIATE trigger would change another
+**      partition, and the WHEEL slots are shared. Between
+**      AnimSpriteCelSystemPartitionBegin() and AnimSpriteCelSystemPartitionEnd(),
+**      nothing must be registered, unregistered or triggered. Partitions run
+**      from several threads also need seeded random steps (the hardware
+**      random numbers are shared) and no recording trace.
+**
+**    - The ticks of AnimSpriteCelSystemNextTick() and AnimSpriteCelSystemSkip()
+**      are ticks of the system, whatever its time scale. The partitioned
+**      ticks and the islands of AnimSpriteCelGraph are run one tick at a
+**      time: to follow the time scale, run them as many times as
+**      AnimSpriteCelSystemTicks() gives on each display cycle.
+**
+**    - AnimSpriteCelSystemTimeRun() needs the POLLING schedule: the steps in
+**      microseconds are caught up by AnimSpriteCelAdvance(). The other runs
+**      count display cycles, so AnimSpriteCelSystemRun(),
+**      AnimSpriteCelSystemNextTick(), AnimSpriteCelSystemSkip(),
+**      AnimSpriteCelSystemPartitionBegin() and AnimSpriteCelGraphBegin()
+**      return an error while an AnimSpriteCel counted in MICROSECONDS is
+**      registered.
+**
+**    - In WHEEL schedule, the end of a step is keyed in ticks when the step
+**      starts, so the speed of the AnimSpriteCels can't apply:
+**      AnimSpriteCelSystemRegister() and AnimSpriteCelSpeed() refuse a speed
+**      other than normal. The time scale applies to every schedule.
+**
+**    - In ACTIVE schedule, the result is the one of POLLING schedule with a
+**      queued delivery. With IMMEDIATE delivery, an AnimSpriteCel woken
+**      during the visit by one registered before it starts its step on the
+**      next tick, as in WHEEL schedule, instead of being visited on the
+**      current one.
+**
+**    - The draw list owns the "ccb_NextPtr" of the listed CCBs and their
+**      CCB_LAST and CCB_NPABS flags. The group of a CCB is chosen when it is
+**      shown: after changing its PLUT, hide and show it again. Beyond the
+**      maximum number of groups, new CCBs are appended at the end without
+**      group (drawUngroupedCount).
+**
+**    - The bits are only cleared by AnimSpriteCelSystemDirtyClear(): the
+**      changes made by the game between two ticks (triggers, seeks) are kept
+**      with the ones of the tick. A newly registered AnimSpriteCel is marked,
+**      as is every registered one when the tracking starts. Changes of the
+**      CCB made by the game itself (position, PLUT) are marked with
+**      AnimSpriteCelSystemDirty(). A partitioned tick tracking the changes
+**      needs partitions of a multiple of 32 AnimSpriteCels, so that two
+**      partitions never share a word of the bitset.
+**
+**    - A snapshot only holds what the steps change. The steps, the
+**      registrations, the visibility and the configuration of the system
+**      must be the same when it is restored, which is checked for the number
+**      of AnimSpriteCels. A pending trigger to an AnimSpriteCel outside the
+**      system can't be saved. The buffer is in the byte order of the machine
+**      and must be aligned on 4 bytes. After a restore, the islands of an
+**      AnimSpriteCelGraph are woken by AnimSpriteCelGraphAnalysis().
+**
+**    - The state hash covers the playheads, not the steps nor the
+**      configuration: two runs compare if their registrations, steps,
+**      schedule and delivery are the same. The cycles counted down by the
+**      ticks and the speed fractions are not hashed, they follow from the
+**      hashed playhead. An unregistration renumbers the following
+**      AnimSpriteCels, whose terms are taken again at that tick. A restore
+**      takes back the terms saved in the snapshot, which must have been
+**      taken with the hash kept, and records nothing. A partitioned tick adds
+**      the changes of each partition at its end but can't be recorded, and
+**      the islands of an AnimSpriteCelGraph run from several threads need
+**      the hash not kept.
+**
+**    - The events are appended in the order of the step changes, which only
+**      depends on the registrations, the steps, the schedule and the
+**      delivery: two runs of a scene give the same buffer. A step sends its
+**      event before its trigger, so with IMMEDIATE delivery the event of a
+**      receiver follows the one of its sender. During a partitioned tick,
+**      each partition keeps its events in its outbox and the outboxes are
+**      appended in partition order at the end of the tick, as
+**      AnimSpriteCelSystemRun() would have. Once the buffer is full, the
+**      events are counted as lost until it is cleared. The events of an
+**      unregistered AnimSpriteCel stay in the buffer without their
+**      AnimSpriteCel. A restore doesn't touch the buffer, and the islands of
+**      an AnimSpriteCelGraph run from several threads need the events not
+**      collected.
+**
+**    - A registered AnimSpriteCel must only be run through its system. If the
+**      game changes it directly (e.g. resets "iterationsCount"), it must call
+**      AnimSpriteCelSystemSchedule() so that the wheel or the active set takes
+**      it into account.
+**
+**  Structure Roles:
+**
+**    AnimSpriteCelSystem
+**      - animSpriteCels: contiguous array of registered AnimSpriteCels
+**      - animSpriteCelsCount: number of registered AnimSpriteCels
+**      - animSpriteCelsMax: capacity of the array
+**      - microsecondsCount: registered AnimSpriteCels counted in MICROSECONDS
+**      - generation: changed by each registration, unregistration and step
+**        configuration of a registered AnimSpriteCel (AnimSpriteCelGraph)
+**      - schedule: POLLING, WHEEL or ACTIVE
+**      - tick: next display cycle to run
+**      - wheel: slots of the timing wheel, per level
+**      - wheelOverflow: AnimSpriteCels beyond the range of the wheel
+**      - active, activeCount: active set, in registration order
+**      - woken, wokenCount: AnimSpriteCels woken since the last tick
+**      - delivery: IMMEDIATE, SAME_TICK or NEXT_TICK
+**      - triggers: ring buffer of pending triggers
+**      - triggersMax, triggersFirst, triggersCount: capacity, oldest, pending
+**      - triggersBudget: maximum number of triggers dispatched per tick (0 = no limit)
+**      - triggerDepth: chain depth of the trigger being dispatched
+**      - triggersDeferred, triggersDropped, cyclesCount: statistics
+**      - seed: seed of the random generators (0 = hardware random numbers)
+**      - outboxes: triggers and events sent by each partition during a partitioned tick
+**      - partitionsCount, partitionSize: number and size of the partitions
+**      - partitioned: a partitioned tick is running
+**      - drawListed, drawOrder: draw list kept, SPAWN_ORDER or SOURCE_ORDER
+**      - drawFirst, drawLast, drawCount: visible AnimSpriteCels, in drawing order
+**      - drawGroups, drawGroupsCount, drawGroupsMax: groups of SOURCE_ORDER
+**      - drawUngroupedCount: CCBs shown without group (statistics)
+**      - dirty: bit per registered AnimSpriteCel whose CCB changed (NULL if not tracked)
+**      - timeScale: ticks per display cycle in 16.16 fixed point (0x10000 = 1.0)
+**      - timeAccumulator: fraction of tick (of microsecond in time runs) carried to the next display cycle
+**      - hashed, stateHash: state hash kept, sum of the terms of the registered AnimSpriteCels
+**      - hashEntries: recorded changes of the state hash (NULL if not recorded)
+**      - hashEntriesMax, hashEntriesCount, hashEntriesLost: capacity, recorded, lost once full
+**      - hashOriginTick, hashOrigin: tick and state hash when the recording started
+**      - events: events sent by the steps, in step change order (NULL if not collected)
+**      - eventsMax, eventsCount, eventsLost: capacity, to drain, lost once full
+**
+**    AnimSpriteCelSystemEvent
+**      - animSpriteCel: AnimSpriteCel that started the step (NULL once unregistered)
+**      - eventId: event of the step
+**      - tick: tick of the step change
+**
+**    AnimSpriteCelSystemDrawGroup
+**      - spriteCel, plutPtr: sheet and palette shared by the group
+**      - last: last AnimSpriteCel of the group in the list
+**      - count: number of AnimSpriteCels in the group (0 = free)
+**
+**    AnimSpriteCelSystemSnapshotHeader
+**      - magic: ANIMSPRITECELSYSTEM_SNAPSHOT_MAGIC
+**      - animSpriteCelsCount: number of playheads that follow
+**      - triggersCount: number of pending triggers after the playheads
+**      - tick, timeAccumulator: tick and time scale fraction of the system
+**
+**    AnimSpriteCelSystemPlayhead
+**      - stepIndex, remainingCycles, iterationsCount, randomState: playhead
+**      - stateHash: term of the AnimSpriteCel in the state hash
+**      - speedAccumulator: fraction of display cycle carried by the speed
+**      - flags: ANIMSPRITECELSYSTEM_PLAYHEAD_BACKWARD (direction -1),
+**        ANIMSPRITECELSYSTEM_PLAYHEAD_ACTIVE (in the active set)
+**
+**    AnimSpriteCelSystemSnapshotTrigger
+**      - receiverIndex: registration index of the receiver
+**        (ANIMSPRITECELSYSTEM_SNAPSHOT_NONE once unregistered)
+**      - depth: chain depth of the trigger
+**
+**    AnimSpriteCelSystemHashHeader
+**      - magic: ANIMSPRITECELSYSTEM_HASH_MAGIC
+**      - entriesCount: number of changes that follow
+**      - entriesLost: changes not recorded once the record was full
+**      - tick, stateHash: tick and state hash when the recording started
+**
+**    AnimSpriteCelSystemHashEntry
+**      - tick: tick of the change
+**      - animationIndex: registration index of the AnimSpriteCel
+**      - stepIndex, remainingCycles, iterationsCount, randomState: new playhead
+**      - flags: ANIMSPRITECELSYSTEM_PLAYHEAD_BACKWARD (direction -1)
+**      - stateHash: state hash after the change
+**
+**  Main Functions:
+**
+**    AnimSpriteCelSystemInitialization()
+**      -> Creates a system able to hold a given number of AnimSpriteCels.
+**
+**    AnimSpriteCelSystemRegister()
+**      -> Validates an AnimSpriteCel and adds it to the system.
+**
+**    AnimSpriteCelSystemUnregister()
+**      -> Removes an AnimSpriteCel from the system without deleting it.
+**
+**    AnimSpriteCelSystemTriggerConfiguration()
+**      -> Chooses the delivery of the triggers, the size of the queue and
+**         the dispatch budget per tick.
+**
+**    AnimSpriteCelSystemTriggerPush()
+**      -> Queues a trigger. Called by AnimSpriteCelNextStep() and
+**         AnimSpriteCelAdvance() for registered AnimSpriteCels.
+**
+**    AnimSpriteCelSystemSeed()
+**      -> Seeds the random generators of all the AnimSpriteCels and rolls
+**         their current random steps in one pass.
+**
+**    AnimSpriteCelSystemSchedule()
+**      -> Places an AnimSpriteCel in the wheel according to its current step,
+**         or wakes it in the active set. Called by AnimSpriteCelNextStep()
+**         for registered AnimSpriteCels.
+**
+**    AnimSpriteCelSystemVisit()
+**      -> Runs a registered AnimSpriteCel for one display cycle, unless it is
+**         waiting or done. Shared by the POLLING and ACTIVE visits and by
+**         AnimSpriteCelGraphIslandRun().
+**
+**    AnimSpriteCelSystemRun()
+**      -> Evolution function to call on each display cycle.
+**         Runs every registered AnimSpriteCel (POLLING), only those whose
+**         step ends on this tick (WHEEL) or only those able to progress
+**         (ACTIVE).
+**
+**    AnimSpriteCelSystemTimeScale()
+**      -> Slows down or speeds up the whole system (16.16 fixed point).
+**
+**    AnimSpriteCelSystemTicks()
+**      -> Gives the number of ticks a display cycle runs at the time scale.
+**
+**    AnimSpriteCelSystemTimeRun()
+**      -> Runs the registered animations for the microseconds elapsed since
+**         the last display cycle (POLLING schedule).
+**
+**    AnimSpriteCelSystemPartitionConfiguration()
+**      -> Splits the array into partitions of a given size and allocates
+**         their outboxes.
+**
+**    AnimSpriteCelSystemPartitionBegin()
+**      -> Starts a partitioned tick (dispatch of NEXT_TICK, next tick) and
+**         gives the number of partitions to run.
+**
+**    AnimSpriteCelSystemPartitionRun()
+**      -> Runs the animations of a partition. The partitions of a tick can
+**         be run in any order, from several threads.
+**
+**    AnimSpriteCelSystemOutboxPush()
+**      -> Queues a trigger in the outbox of the sender's partition. Called
+**         by AnimSpriteCelNextStep() during a partitioned tick.
+**
+**    AnimSpriteCelSystemPartitionEnd()
+**      -> Merges the outboxes in partition order and dispatches SAME_TICK.
+**
+**    AnimSpriteCelSystemDrawConfiguration()
+**      -> Keeps the CCBs of the visible AnimSpriteCels in a draw list, in
+**         SPAWN_ORDER or SOURCE_ORDER.
+**
+**    AnimSpriteCelSystemVisibility()
+**      -> Shows or hides an AnimSpriteCel, linking or unlinking its CCB.
+**
+**    AnimSpriteCelSystemDrawList()
+**      -> Gives the first CCB of the draw list, for DrawCels().
+**
+**    AnimSpriteCelSystemDirtyConfiguration()
+**      -> Starts or stops tracking the CCBs changed by the steps.
+**
+**    AnimSpriteCelSystemDirty()
+**      -> Marks the CCB of a registered AnimSpriteCel as changed.
+**
+**    AnimSpriteCelSystemChanged()
+**      -> Gives the next AnimSpriteCel whose CCB changed, from a cursor.
+**
+**    AnimSpriteCelSystemDirtyClear()
+**      -> Clears the changes, once processed.
+**
+**    AnimSpriteCelSystemEventConfiguration()
+**      -> Starts or stops collecting the events of the steps, in a buffer of
+**         a given size.
+**
+**    AnimSpriteCelSystemEventPush()
+**      -> Appends the event of the step a registered AnimSpriteCel started.
+**         Called by AnimSpriteCelNextStep() and AnimSpriteCelAdvance().
+**
+**    AnimSpriteCelSystemEvents()
+**      -> Gives the collected events and their number.
+**
+**    AnimSpriteCelSystemEventsClear()
+**      -> Empties the buffer, once drained.
+**
+**    AnimSpriteCelSystemNextTick()
+**      -> Gives the next tick at which a step ends.
+**
+**    AnimSpriteCelSystemSkip()
+**      -> Jumps to a later tick without running the empty ticks.
+**
+**    AnimSpriteCelSystemSnapshotSize()
+**      -> Gives the size of the buffer of a snapshot, pending triggers
+**         included.
+**
+**    AnimSpriteCelSystemSnapshot()
+**      -> Copies the playheads and the pending triggers into a buffer.
+**
+**    AnimSpriteCelSystemRestore()
+**      -> Writes a snapshot back, without allocating.
+**
+**    AnimSpriteCelSystemHashConfiguration()
+**      -> Starts or stops keeping the state hash, and recording its changes.
+**
+**    AnimSpriteCelSystemHash()
+**      -> Gives the state hash of the registered AnimSpriteCels.
+**
+**    AnimSpriteCelSystemHashCopy()
+**      -> Writes the recorded changes of the state hash into a buffer.
+**
+**    AnimSpriteCelSystemCleanup()
+**      -> Frees the system and the AnimSpriteCels it owns.
+**
+******************************************************************************/
+
+// int32
+#include "types.h"
+// AnimSpriteCel
+#include "AnimSpriteCel.h"
+
+// Timing wheel dimensions
+#define ANIMSPRITECELSYSTEM_WHEEL_LEVELS 4
+#define ANIMSPRITECELSYSTEM_WHEEL_BITS 6
+#define ANIMSPRITECELSYSTEM_WHEEL_SLOTS (1 << ANIMSPRITECELSYSTEM_WHEEL_BITS)
+
+// Group of a CCB shown while every draw group was taken
+#define ANIMSPRITECELSYSTEM_DRAW_UNGROUPED 0xFFFFFFFF
+
+// Highest time scale in 16.16 fixed point (16 ticks per display cycle)
+#define ANIMSPRITECELSYSTEM_TIME_SCALE_MAX 0x00100000
+
+// Snapshot buffers ("SNAP")
+#define ANIMSPRITECELSYSTEM_SNAPSHOT_MAGIC 0x534E4150
+// Receiver of a saved trigger that was unregistered
+#define ANIMSPRITECELSYSTEM_SNAPSHOT_NONE 0xFFFFFFFF
+// Flags of a saved playhead
+#define ANIMSPRITECELSYSTEM_PLAYHEAD_BACKWARD 0x0001
+#define ANIMSPRITECELSYSTEM_PLAYHEAD_ACTIVE 0x0002
+
+// Records of the state hash ("HASH")
+#define ANIMSPRITECELSYSTEM_HASH_MAGIC 0x48415348
+
+// Words of the dirty bitset for a number of AnimSpriteCels
+#define ANIMSPRITECELSYSTEM_DIRTY_WORDS(count) (((count) + 31) >> 5)
+
+// Scheduling of the registered animations
+typedef enum {
+    // Every animation is visited on each display cycle
+    POLLING,
+    // Only the animations whose step ends are visited
+    WHEEL,
+    // Only the animations able to progress are visited
+    ACTIVE
+} AnimSpriteCelSchedule;
+
+// Delivery of the triggers sent by the registered animations
+typedef enum {
+    // The receiver is triggered at once, inside the sender's step change
+    IMMEDIATE,
+    // Triggers are queued and dispatched at the end of the tick
+    SAME_TICK,
+    // Triggers are queued and dispatched at the start of the next tick
+    NEXT_TICK
+} AnimSpriteCelDelivery;
+
+// Order of the draw list
+typedef enum {
+    // CCBs in the order they were shown
+    SPAWN_ORDER,
+    // CCBs grouped by SpriteCel and PLUT
+    SOURCE_ORDER
+} AnimSpriteCelDrawOrder;
+
+// Pending trigger
+typedef struct {
+    // Receiver to trigger (NULL once unregistered)
+    AnimSpriteCel *animSpriteCel;
+    // Number of triggers chained to reach it within the tick
+    uint32 depth;
+} AnimSpriteCelSystemTrigger;
+
+// Event sent by the step an AnimSpriteCel started
+typedef struct {
+    // AnimSpriteCel that started the step (NULL once unregistered)
+    AnimSpriteCel *animSpriteCel;
+    // Event of the step
+    uint32 eventId;
+    // Tick of the step change
+    uint32 tick;
+} AnimSpriteCelSystemEvent;
+
+// Triggers and events sent by a partition during a partitioned tick
+typedef struct {
+    // Receivers, in sending order
+    AnimSpriteCel **receivers;
+    // Number of triggers
+    uint32 receiversCount;
+    // Events, in step change order (NULL if not collected)
+    AnimSpriteCelSystemEvent *events;
+    // Number of events
+    uint32 eventsCount;
+    // Change of the state hash made by the partition
+    uint32 stateHash;
+} AnimSpriteCelSystemOutbox;
+
+// CCBs of the draw list sharing a sheet and a palette (SOURCE_ORDER)
+typedef struct {
+    // Sheet of the group
+    SpriteCel *spriteCel;
+    // Palette of the group
+    void *plutPtr;
+    // Last AnimSpriteCel of the group in the list
+    AnimSpriteCel *last;
+    // Number of AnimSpriteCels in the group (0 = free)
+    uint32 count;
+} AnimSpriteCelSystemDrawGroup;
+
+// Header of a snapshot, followed by the playheads and the pending triggers
+typedef struct {
+    // ANIMSPRITECELSYSTEM_SNAPSHOT_MAGIC
+    uint32 magic;
+    // Number of playheads
+    uint32 animSpriteCelsCount;
+    // Number of pending triggers
+    uint32 triggersCount;
+    // Next display cycle to run
+    uint32 tick;
+    // Fraction of tick carried by the time scale
+    uint32 timeAccumulator;
+} AnimSpriteCelSystemSnapshotHeader;
+
+// Playhead of a registered AnimSpriteCel in a snapshot
+typedef struct {
+    // Current step
+    uint32 stepIndex;
+    // Remaining cycles before next change
+    uint32 remainingCycles;
+    // Remaining iterations
+    uint32 iterationsCount;
+    // State of the xorshift generator
+    uint32 randomState;
+    // Term of the AnimSpriteCel in the state hash
+    uint32 stateHash;
+    // Fraction of display cycle carried by the speed
+    uint16 speedAccumulator;
+    // ANIMSPRITECELSYSTEM_PLAYHEAD_* flags
+    uint16 flags;
+} AnimSpriteCelSystemPlayhead;
+
+// Pending trigger in a snapshot
+typedef struct {
+    // Registration index of the receiver (ANIMSPRITECELSYSTEM_SNAPSHOT_NONE once unregistered)
+    uint32 receiverIndex;
+    // Number of triggers chained to reach it within the tick
+    uint32 depth;
+} AnimSpriteCelSystemSnapshotTrigger;
+
+// Header of a record of the state hash, followed by the changes
+typedef struct {
+    // ANIMSPRITECELSYSTEM_HASH_MAGIC
+    uint32 magic;
+    // Number of changes
+    uint32 entriesCount;
+    // Changes not recorded once the record was full
+    uint32 entriesLost;
+    // Tick when the recording started
+    uint32 tick;
+    // State hash when the recording started
+    uint32 stateHash;
+} AnimSpriteCelSystemHashHeader;
+
+// Recorded change of the state hash
+typedef struct {
+    // Tick of the change
+    uint32 tick;
+    // Registration index of the AnimSpriteCel
+    uint32 animationIndex;
+    // Current step
+    uint16 stepIndex;
+    // ANIMSPRITECELSYSTEM_PLAYHEAD_BACKWARD
+    uint16 flags;
+    // Remaining cycles before next change
+    uint32 remainingCycles;
+    // Remaining iterations
+    uint32 iterationsCount;
+    // State of the xorshift generator
+    uint32 randomState;
+    // State hash after the change
+    uint32 stateHash;
+} AnimSpriteCelSystemHashEntry;
+
+struct AnimSpriteCelSystem {
+    // Registered AnimSpriteCels
+    AnimSpriteCel **animSpriteCels;
+    // Number of registered AnimSpriteCels
+    uint32 animSpriteCelsCount;
+    // Maximum number of AnimSpriteCels
+    uint32 animSpriteCelsMax;
+    // Registered AnimSpriteCels counted in MICROSECONDS (only AnimSpriteCelSystemTimeRun() runs them)
+    uint32 microsecondsCount;
+    // Changed by each registration, unregistration and step configuration of a registered AnimSpriteCel
+    uint32 generation;
+    // Scheduling of the animations
+    AnimSpriteCelSchedule schedule;
+    // Next display cycle to run
+    uint32 tick;
+    // Timing wheel slots (WHEEL schedule)
+    AnimSpriteCel *wheel[ANIMSPRITECELSYSTEM_WHEEL_LEVELS][ANIMSPRITECELSYSTEM_WHEEL_SLOTS];
+    // AnimSpriteCels beyond the range of the wheel
+    AnimSpriteCel *wheelOverflow;
+    // AnimSpriteCels able to progress, in registration order (ACTIVE schedule)
+    AnimSpriteCel **active;
+    // Number of AnimSpriteCels in the active set
+    uint32 activeCount;
+    // AnimSpriteCels woken since the last tick
+    AnimSpriteCel **woken;
+    // Number of woken AnimSpriteCels
+    uint32 wokenCount;
+    // Delivery of the triggers
+    AnimSpriteCelDelivery delivery;
+    // Queue of pending triggers (ring buffer)
+    AnimSpriteCelSystemTrigger *triggers;
+    // Capacity of the queue
+    uint32 triggersMax;
+    // Oldest pending trigger
+    uint32 triggersFirst;
+    // Number of pending triggers
+    uint32 triggersCount;
+    // Maximum number of triggers dispatched per tick (0 = no limit)
+    uint32 triggersBudget;
+    // Depth of the trigger being dispatched (0 outside the dispatch)
+    uint32 triggerDepth;
+    // Triggers left for the next tick by the budget
+    uint32 triggersDeferred;
+    // Triggers lost because the queue was full
+    uint32 triggersDropped;
+    // Trigger cycles cut at the end of a tick
+    uint32 cyclesCount;
+    // Seed of the random generators (0 = hardware random numbers)
+    uint32 seed;
+    // Outboxes of the partitions (NULL if not partitioned)
+    AnimSpriteCelSystemOutbox *outboxes;
+    // Number of partitions
+    uint32 partitionsCount;
+    // AnimSpriteCels per partition
+    uint32 partitionSize;
+    // A partitioned tick is running
+    uint32 partitioned;
+    // The CCBs of the visible AnimSpriteCels are kept in a draw list
+    uint32 drawListed;
+    // Order of the draw list
+    AnimSpriteCelDrawOrder drawOrder;
+    // First and last visible AnimSpriteCels, in drawing order
+    AnimSpriteCel *drawFirst;
+    AnimSpriteCel *drawLast;
+    // Number of listed CCBs
+    uint32 drawCount;
+    // Groups of the list (SOURCE_ORDER)
+    AnimSpriteCelSystemDrawGroup *drawGroups;
+    // Groups used, free ones included
+    uint32 drawGroupsCount;
+    // Capacity of the groups
+    uint32 drawGroupsMax;
+    // CCBs shown without group, the groups being full
+    uint32 drawUngroupedCount;
+    // Bit per registered AnimSpriteCel whose CCB changed since the last clear (NULL if not tracked)
+    uint32 *dirty;
+    // Ticks per display cycle in 16.16 fixed point (0x10000 = 1.0)
+    uint32 timeScale;
+    // Fraction of tick (of microsecond in time runs) carried to the next display cycle
+    uint32 timeAccumulator;
+    // The state hash is kept up to date
+    uint32 hashed;
+    // Sum of the terms of the registered AnimSpriteCels
+    uint32 stateHash;
+    // Recorded changes of the state hash (NULL if not recorded)
+    AnimSpriteCelSystemHashEntry *hashEntries;
+    // Capacity of the record
+    uint32 hashEntriesMax;
+    // Changes recorded
+    uint32 hashEntriesCount;
+    // Changes lost once the record was full
+    uint32 hashEntriesLost;
+    // Tick and state hash when the recording started
+    uint32 hashOriginTick;
+    uint32 hashOrigin;
+    // Events sent by the steps, in step change order (NULL if not collected)
+    AnimSpriteCelSystemEvent *events;
+    // Capacity of the buffer
+    uint32 eventsMax;
+    // Events to drain
+    uint32 eventsCount;
+    // Events lost once the buffer was full
+    uint32 eventsLost;
+};
+
+// Initialization of an AnimSpriteCelSystem
+AnimSpriteCelSystem *AnimSpriteCelSystemInitialization(uint32 animSpriteCelsMax, AnimSpriteCelSchedule schedule);
+// Registers an AnimSpriteCel in the system
+int32 AnimSpriteCelSystemRegister(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel);
+// Removes an AnimSpriteCel from the system
+int32 AnimSpriteCelSystemUnregister(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel);
+// Configuration of the trigger delivery
+int32 AnimSpriteCelSystemTriggerConfiguration(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCelDelivery delivery, uint32 triggersMax, uint32 triggersBudget);
+// Queues a trigger sent by a registered AnimSpriteCel
+void AnimSpriteCelSystemTriggerPush(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel);
+// Seeds the random generators of the registered AnimSpriteCels
+int32 AnimSpriteCelSystemSeed(AnimSpriteCelSystem *animSpriteCelSystem, uint32 seed);
+// Schedules an AnimSpriteCel according to its current step
+void AnimSpriteCelSystemSchedule(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel);
+// Visits a registered AnimSpriteCel for one display cycle, returns 0 if it is waiting or done
+uint32 AnimSpriteCelSystemVisit(AnimSpriteCel *animSpriteCel);
+// Runs all the registered animations
+int32 AnimSpriteCelSystemRun(AnimSpriteCelSystem *animSpriteCelSystem);
+// Sets the time scale of the system
+int32 AnimSpriteCelSystemTimeScale(AnimSpriteCelSystem *animSpriteCelSystem, uint32 timeScale);
+// Gives the number of ticks of a display cycle at the time scale
+uint32 AnimSpriteCelSystemTicks(AnimSpriteCelSystem *animSpriteCelSystem);
+// Runs the registered animations for the time elapsed since the last run
+int32 AnimSpriteCelSystemTimeRun(AnimSpriteCelSystem *animSpriteCelSystem, uint32 elapsedMicroseconds);
+// Splits the registered animations into partitions run separately
+int32 AnimSpriteCelSystemPartitionConfiguration(AnimSpriteCelSystem *animSpriteCelSystem, uint32 partitionSize);
+// Queues a trigger in the outbox of the sender's partition
+void AnimSpriteCelSystemOutboxPush(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCelSender, AnimSpriteCel *animSpriteCel);
+// Starts a partitioned tick
+int32 AnimSpriteCelSystemPartitionBegin(AnimSpriteCelSystem *animSpriteCelSystem);
+// Runs the animations of a partition
+void AnimSpriteCelSystemPartitionRun(AnimSpriteCelSystem *animSpriteCelSystem, uint32 partitionIndex);
+// Ends a partitioned tick
+int32 AnimSpriteCelSystemPartitionEnd(AnimSpriteCelSystem *animSpriteCelSystem);
+// Keeps the CCBs of the visible AnimSpriteCels in a draw list
+int32 AnimSpriteCelSystemDrawConfiguration(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCelDrawOrder drawOrder, uint32 drawGroupsMax);
+// Shows or hides a registered AnimSpriteCel
+int32 AnimSpriteCelSystemVisibility(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel, uint32 visible);
+// Gives the first CCB of the draw list
+CCB *AnimSpriteCelSystemDrawList(AnimSpriteCelSystem *animSpriteCelSystem);
+// Starts or stops tracking the CCBs changed by the steps
+int32 AnimSpriteCelSystemDirtyConfiguration(AnimSpriteCelSystem *animSpriteCelSystem, uint32 tracked);
+// Marks the CCB of a registered AnimSpriteCel as changed
+void AnimSpriteCelSystemDirty(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel);
+// Gives the next AnimSpriteCel whose CCB changed, from a cursor
+AnimSpriteCel *AnimSpriteCelSystemChanged(AnimSpriteCelSystem *animSpriteCelSystem, uint32 *cursor);
+// Clears the changes, once processed
+int32 AnimSpriteCelSystemDirtyClear(AnimSpriteCelSystem *animSpriteCelSystem);
+// Starts or stops collecting the events of the steps
+int32 AnimSpriteCelSystemEventConfiguration(AnimSpriteCelSystem *animSpriteCelSystem, uint32 eventsMax);
+// Appends the event of the step a registered AnimSpriteCel started
+void AnimSpriteCelSystemEventPush(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel, uint32 eventId);
+// Gives the collected events and their number
+AnimSpriteCelSystemEvent *AnimSpriteCelSystemEvents(AnimSpriteCelSystem *animSpriteCelSystem, uint32 *eventsCount);
+// Empties the event buffer, once drained
+int32 AnimSpriteCelSystemEventsClear(AnimSpriteCelSystem *animSpriteCelSystem);
+// Gives the next tick at which a step ends
+int32 AnimSpriteCelSystemNextTick(AnimSpriteCelSystem *animSpriteCelSystem, uint32 *tick);
+// Jumps to a later tick without running the empty ticks
+int32 AnimSpriteCelSystemSkip(AnimSpriteCelSystem *animSpriteCelSystem, uint32 tick);
+// Gives the size of the buffer of a snapshot
+uint32 AnimSpriteCelSystemSnapshotSize(AnimSpriteCelSystem *animSpriteCelSystem);
+// Copies the playheads of the registered AnimSpriteCels into a buffer
+int32 AnimSpriteCelSystemSnapshot(AnimSpriteCelSystem *animSpriteCelSystem, void *buffer, uint32 bufferSize);
+// Writes the playheads of a snapshot back
+int32 AnimSpriteCelSystemRestore(AnimSpriteCelSystem *animSpriteCelSystem, const void *buffer, uint32 bufferSize);
+// Starts or stops keeping the state hash, and recording its changes
+int32 AnimSpriteCelSystemHashConfiguration(AnimSpriteCelSystem *animSpriteCelSystem, uint32 hashed, uint32 entriesMax);
+// Gives the state hash of the registered AnimSpriteCels
+uint32 AnimSpriteCelSystemHash(AnimSpriteCelSystem *animSpriteCelSystem);
+// Writes the recorded changes of the state hash into a buffer
+int32 AnimSpriteCelSystemHashCopy(AnimSpriteCelSystem *animSpriteCelSystem, void *buffer, uint32 bufferSize);
+// Cleans up the AnimSpriteCelSystem
+int32 AnimSpriteCelSystemCleanup(AnimSpriteCelSystem *animSpriteCelSystem);
+
+#endif // ANIMSPRITECELSYSTEM_H
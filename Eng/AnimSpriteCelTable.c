@@ -0,0 +1,75 @@
+#include "AnimSpriteCelTable.h"
+
+// AllocMem(), MEMTYPE_DRAM
+#include "mem.h"
+// CloneCel()
+#include "celutils.h"
+// printf()
+#include "stdio.h"
+
+// Creates an AnimSpriteCel playing a generated table
+AnimSpriteCel *AnimSpriteCelTableInstance(AnimSpriteCelTable *animSpriteCelTable, SpriteCel *spriteCel, int32 direction, uint32 stepIndex) {
+
+    // AnimSpriteCel instance
+    AnimSpriteCel *animSpriteCel = NULL;
+
+    // If the AnimSpriteCelTable is undefined
+    if (animSpriteCelTable == NULL) {
+        // Display error message
+        printf("Error: AnimSpriteCelTable unknown.\n");
+        return NULL;
+    }
+
+    // If the sprite sheet doesn't exist
+    if (spriteCel == NULL) {
+        // Display error message
+        printf("Error: SpriteCel unknown.\n");
+        return NULL;
+    }
+
+    // If the table already plays another sprite sheet
+    if ((animSpriteCelTable->spriteCel != NULL) && (animSpriteCelTable->spriteCel != spriteCel)) {
+        // Display error message
+        printf("Error: AnimSpriteCelTable already uses another SpriteCel.\n");
+        return NULL;
+    }
+
+    // On the first instance, resolve the descriptor of each frame once for all the instances
+    if (animSpriteCelTable->spriteCel == NULL) {
+        AnimSpriteCelFramesResolve(spriteCel, animSpriteCelTable->frames, animSpriteCelTable->framesCount);
+        animSpriteCelTable->spriteCel = spriteCel;
+    }
+
+    // Allocate memory for AnimSpriteCel (the steps, the frames and the timeline are shared)
+    animSpriteCel = (AnimSpriteCel *)AllocMem(sizeof(AnimSpriteCel), MEMTYPE_DRAM);
+    // If allocation fails
+    if (animSpriteCel == NULL) {
+        // Display error message
+        printf("Error: Failed to allocate memory for AnimSpriteCel.\n");
+        return NULL;
+    }
+
+    // Not taken from a pool, packed steps in the table
+    animSpriteCel->pool = NULL;
+    animSpriteCel->sequence = NULL;
+    animSpriteCel->file = NULL;
+    animSpriteCel->table = animSpriteCelTable;
+    animSpriteCel->release = NULL;
+    animSpriteCel->steps = NULL;
+    // The steps are only read, AnimSpriteCelPackedStepConfiguration() refuses them
+    animSpriteCel->packedSteps = (AnimSpriteCelPackedStep *)animSpriteCelTable->steps;
+    animSpriteCel->frames = animSpriteCelTable->frames;
+    animSpriteCel->framesCount = animSpriteCelTable->framesCount;
+    animSpriteCel->timeline = animSpriteCelTable->timeline;
+
+    // Clone the SpriteCel CCB (Command Control Block)
+    animSpriteCel->cel = CloneCel(spriteCel->cel, CLONECEL_CCB_ONLY);
+
+    // Initialize the playhead, the steps are left untouched
+    AnimSpriteCelSetup(animSpriteCel, spriteCel, animSpriteCelTable->loop, animSpriteCelTable->range, animSpriteCelTable->iterations, direction, stepIndex, animSpriteCelTable->stepsCount);
+    // Display the starting step
+    AnimSpriteCelUpdate(animSpriteCel);
+
+    // Return the newly created AnimSpriteCel
+    return animSpriteCel;
+}
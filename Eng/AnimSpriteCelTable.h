@@ -0,0 +1,89 @@
+#ifndef ANIMSPRITECELTABLE_H
+#define ANIMSPRITECELTABLE_H
+
+/******************************************************************************
+**
+**  AnimSpriteCelTable - Constant step tables generated at build time (3DO Cel Engine)
+**
+**  Author: Christophe Geoffroy (Topper) - MIT License
+**  Last Updated: 2026-10-17
+**
+**  AnimSpriteCelStepsConfiguration() reads its steps through va_arg: the
+**  arguments are not type-checked, every step is checked again on each boot,
+**  and each one is written to DRAM.
+**
+**  AnimSpriteCelCompiler (host program, see AnimSpriteCelCompiler.c) turns a
+**  text description of the animations into a C header holding one constant
+**  array of packed steps ("AnimSpriteCelPackedStep") and one AnimSpriteCelTable
+**  per animation. The frame indexes are checked against the frame count
+**  declared for each SpriteCel and the receivers, named by their label, are
+**  resolved while the game is built. The C compiler then type-checks the
+**  generated arrays.
+**
+**  AnimSpriteCelTableInstance() creates an AnimSpriteCel whose packed steps
+**  point to the constant array: no step is configured, checked or written at
+**  run time.
+**
+**  Important Notes:
+**
+**    - The generated header defines its data: include it in a single C file.
+**
+**    - The receiver of a step is the animation registered at the index of
+**      its label in the system. The animations of a header must be the first
+**      ones registered, in the order of the header.
+**
+**    - The frame descriptors and the timeline of a table are shared by its
+**      instances and made at the first one. All the instances of a table
+**      must therefore use the same SpriteCel.
+**
+**    - The steps of a table are read-only: AnimSpriteCelPackedStepConfiguration()
+**      and AnimSpriteCelStepEvent() are refused on an instance.
+**
+**  Structure Roles:
+**
+**    AnimSpriteCelTable
+**      - steps: constant packed steps
+**      - stepsCount: number of steps
+**      - framesCount: number of SpriteCel frames the steps may display
+**      - loop, range, iterations: as given to AnimSpriteCelInitialization()
+**      - frames: frame descriptors shared by the instances
+**      - timeline: cumulative durations shared by the instances
+**      - spriteCel: SpriteCel of the instances (NULL until the first one)
+**
+**  Main Functions:
+**
+**    AnimSpriteCelTableInstance()
+**      -> Creates an AnimSpriteCel playing a generated table.
+**
+******************************************************************************/
+
+// int32
+#include "types.h"
+// AnimSpriteCel
+#include "AnimSpriteCel.h"
+
+struct AnimSpriteCelTable {
+    // Constant packed steps
+    const AnimSpriteCelPackedStep *steps;
+    // Number of steps
+    uint32 stepsCount;
+    // Number of SpriteCel frames
+    uint32 framesCount;
+    // Loop mode
+    AnimSpriteCelLoop loop;
+    // Random duration range
+    AnimSpriteCelRange range;
+    // Number of cycle repetitions
+    uint32 iterations;
+    // Frame descriptors shared by the instances
+    AnimSpriteCelFrame *frames;
+    // Cumulative durations shared by the instances
+    uint32 *timeline;
+    // SpriteCel of the instances (NULL until the first one)
+    SpriteCel *spriteCel;
+};
+
+// Creates an AnimSpriteCel playing a generated table
+AnimSpriteCel *AnimSpriteCelTableInstance(AnimSpriteCelTable *animSpriteCelTable, SpriteCel *spriteCel, int32 direction, uint32 stepIndex);
+
+#endif // ANIMSPRITECELTABLE_H
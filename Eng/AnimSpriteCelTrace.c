@@ -0,0 +1,170 @@
+#include "AnimSpriteCelTrace.h"
+
+// AnimSpriteCelSystem
+#include "AnimSpriteCelSystem.h"
+// AllocMem(), FreeMem(), MEMTYPE_DRAM
+#include "mem.h"
+// memcpy()
+#include "string.h"
+// printf()
+#include "stdio.h"
+
+// Trace shared by all the AnimSpriteCels
+AnimSpriteCelTrace animSpriteCelTrace = { NULL, 0, 0, 0 };
+
+// Allocates the ring buffer and starts recording
+int32 AnimSpriteCelTraceInitialization(uint32 eventsMax) {
+
+    // Capacity rounded up to a power of 2
+    uint32 eventsCount = 1;
+
+    // If the trace is already recording
+    if (animSpriteCelTrace.events != NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelTrace already initialized.\n");
+        return -1;
+    }
+
+    // The position in the buffer is a mask of the event count
+    while ((eventsCount < eventsMax) && (eventsCount < 0x80000000)) {
+        eventsCount <<= 1;
+    }
+
+    // Allocate memory for the ring buffer
+    animSpriteCelTrace.events = (AnimSpriteCelTraceEvent *)AllocMem(eventsCount * sizeof(AnimSpriteCelTraceEvent), MEMTYPE_DRAM);
+    // If allocation fails
+    if (animSpriteCelTrace.events == NULL) {
+        // Return error
+        printf("Error: Failed to allocate memory for AnimSpriteCelTrace events.\n");
+        return -1;
+    }
+
+    // Empty buffer
+    animSpriteCelTrace.eventsMask = eventsCount - 1;
+    animSpriteCelTrace.eventsWritten = 0;
+
+    // Return success
+    return 1;
+}
+
+// Records an event
+void AnimSpriteCelTraceWrite(AnimSpriteCelTraceType type, AnimSpriteCel *animSpriteCel, int32 value) {
+
+    // Recorded event
+    AnimSpriteCelTraceEvent *event = NULL;
+
+    // If the trace is not recording
+    if (animSpriteCelTrace.events == NULL) {
+        return;
+    }
+
+    // Take the next slot, overwriting the oldest event when full
+    event = &animSpriteCelTrace.events[animSpriteCelTrace.eventsWritten & animSpriteCelTrace.eventsMask];
+    animSpriteCelTrace.eventsWritten++;
+
+    // Fill the event
+    event->tick = (animSpriteCel->system != NULL) ? animSpriteCel->system->tick : 0;
+#if ANIMSPRITECEL_TRACE == 1
+    event->animationId = animSpriteCel->traceId;
+#else
+    event->animationId = 0;
+#endif
+    event->type = (uint16)type;
+    event->stepIndex = (uint16)animSpriteCel->stepIndex;
+    event->value = value;
+}
+
+// Records the counters of an AnimSpriteCel
+void AnimSpriteCelTraceCounters(AnimSpriteCel *animSpriteCel) {
+
+    // If the AnimSpriteCel is undefined
+    if (animSpriteCel == NULL) {
+        printf("Error: AnimSpriteCel unknown.\n");
+        return;
+    }
+
+    // The counters only exist in a traced build
+#if ANIMSPRITECEL_TRACE == 1
+    AnimSpriteCelTraceWrite(TRACE_COUNT_STEPS, animSpriteCel, (int32)animSpriteCel->traceSteps);
+    AnimSpriteCelTraceWrite(TRACE_COUNT_IDLE, animSpriteCel, (int32)animSpriteCel->traceIdleCycles);
+    AnimSpriteCelTraceWrite(TRACE_COUNT_SENT, animSpriteCel, (int32)animSpriteCel->traceTriggersSent);
+    AnimSpriteCelTraceWrite(TRACE_COUNT_RECEIVED, animSpriteCel, (int32)animSpriteCel->traceTriggersReceived);
+#endif
+}
+
+// Writes the header and the events into a buffer
+int32 AnimSpriteCelTraceCopy(void *buffer, uint32 bufferSize) {
+
+    // Header at the start of the buffer
+    AnimSpriteCelTraceHeader *header = (AnimSpriteCelTraceHeader *)buffer;
+    // Events after the header
+    AnimSpriteCelTraceEvent *events = NULL;
+    // Number of events kept and oldest one
+    uint32 eventsCount = 0;
+    uint32 eventIndex = 0;
+    // Events before the end of the ring buffer
+    uint32 firstCount = 0;
+
+    // If the trace is not recording
+    if (animSpriteCelTrace.events == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelTrace not initialized.\n");
+        return -1;
+    }
+
+    // If the buffer is undefined
+    if (buffer == NULL) {
+        // Return error
+        printf("Error: AnimSpriteCelTrace buffer unknown.\n");
+        return -1;
+    }
+
+    // If the header doesn't fit
+    if (bufferSize < sizeof(AnimSpriteCelTraceHeader)) {
+        // Return error
+        printf("Error: AnimSpriteCelTrace buffer too small.\n");
+        return -1;
+    }
+
+    // Events still in the ring buffer, limited to the size of the buffer
+    eventsCount = (animSpriteCelTrace.eventsWritten <= animSpriteCelTrace.eventsMask) ? animSpriteCelTrace.eventsWritten : animSpriteCelTrace.eventsMask + 1;
+    if (eventsCount > (bufferSize - sizeof(AnimSpriteCelTraceHeader)) / sizeof(AnimSpriteCelTraceEvent)) {
+        eventsCount = (bufferSize - sizeof(AnimSpriteCelTraceHeader)) / sizeof(AnimSpriteCelTraceEvent);
+    }
+
+    // Header of the trace
+    header->magic = ANIMSPRITECELTRACE_MAGIC;
+    header->version = ANIMSPRITECELTRACE_VERSION;
+    header->eventsCount = eventsCount;
+    header->eventsLost = animSpriteCelTrace.eventsWritten - eventsCount;
+
+    // The kept events are the newest ones, copied from the oldest in two parts
+    events = (AnimSpriteCelTraceEvent *)(header + 1);
+    eventIndex = (animSpriteCelTrace.eventsWritten - eventsCount) & animSpriteCelTrace.eventsMask;
+    firstCount = animSpriteCelTrace.eventsMask + 1 - eventIndex;
+    firstCount = (firstCount < eventsCount) ? firstCount : eventsCount;
+    memcpy(events, &animSpriteCelTrace.events[eventIndex], firstCount * sizeof(AnimSpriteCelTraceEvent));
+    memcpy(events + firstCount, animSpriteCelTrace.events, (eventsCount - firstCount) * sizeof(AnimSpriteCelTraceEvent));
+
+    // Return the number of bytes written
+    return (int32)(sizeof(AnimSpriteCelTraceHeader) + eventsCount * sizeof(AnimSpriteCelTraceEvent));
+}
+
+// Stops recording and frees the ring buffer
+int32 AnimSpriteCelTraceCleanup(void) {
+
+    // If the trace is not recording
+    if (animSpriteCelTrace.events == NULL) {
+        printf("Error: AnimSpriteCelTrace not initialized.\n");
+        return -1;
+    }
+
+    // Free the ring buffer
+    FreeMem(animSpriteCelTrace.events, (animSpriteCelTrace.eventsMask + 1) * sizeof(AnimSpriteCelTraceEvent));
+    animSpriteCelTrace.events = NULL;
+    animSpriteCelTrace.eventsMask = 0;
+    animSpriteCelTrace.eventsWritten = 0;
+
+    // Return success
+    return 1;
+}
@@ -0,0 +1,194 @@
+#ifndef ANIMSPRITECELTRACE_H
+#define ANIMSPRITECELTRACE_H
+
+/******************************************************************************
+**
+**  AnimSpriteCelTrace - Binary event trace of the AnimSpriteCels (3DO Cel Engine)
+**
+**  Author: Christophe Geoffroy (Topper) - MIT License
+**  Last Updated: 2026-10-17
+**
+**  A printf() on each step change takes longer than the animation itself,
+**  so a scene traced that way no longer runs at its real speed. This module
+**  records fixed-size binary events ("AnimSpriteCelTraceEvent", 16 bytes)
+**  in a ring buffer instead: recording an event is a few stores, without any
+**  formatting, call to the system or lock.
+**
+**  The trace is selected when the game is compiled, with the switch
+**  ANIMSPRITECEL_TRACE of AnimSpriteCel.h (or -DANIMSPRITECEL_TRACE=1 on
+**  the command line). At 0 (default), the recording macros are empty and
+**  the counters are not part of AnimSpriteCel: the code and the memory are
+**  the same as without a trace. At 1, every AnimSpriteCel records:
+**
+**    - TRACE_INIT: initialized (value: number of steps)
+**    - TRACE_CONFIGURATION: step configured (value: configured step)
+**    - TRACE_STEP: step changed (value: cycles before the next change)
+**    - TRACE_TRIGGER_SENT: trigger sent (value: identifier of the receiver)
+**    - TRACE_TRIGGER_RECEIVED: trigger received (value: 1 if it started
+**      the next step, 0 if the animation wasn't waiting)
+**    - TRACE_ITERATION_END: cycle ended (value: iterations left)
+**    - TRACE_CLEANUP: cleaned up or given back to its pool
+**
+**  and keeps four counters: steps advanced, idle cycles (display cycles a
+**  timed step is held before the next change), triggers sent and triggers
+**  received. AnimSpriteCelTraceCounters() records them as TRACE_COUNT_*
+**  events; the cleanup of an AnimSpriteCel does it before TRACE_CLEANUP.
+**
+**  AnimSpriteCelTraceCopy() writes the trace (header, then the events from
+**  the oldest one) into a buffer, to be saved or read from the debugger.
+**  AnimSpriteCelTraceTool (host program, see AnimSpriteCelTraceTool.c)
+**  decodes it and sums up each AnimSpriteCel.
+**
+**  Important Notes:
+**
+**    - All the files of the game must be compiled with the same value of
+**      ANIMSPRITECEL_TRACE: it changes the size of AnimSpriteCel.
+**
+**    - Nothing is recorded before AnimSpriteCelTraceInitialization(). When
+**      the buffer is full, the oldest events are overwritten.
+**
+**    - The trace has a single writer: the task running the animations. The
+**      events are only read through AnimSpriteCelTraceCopy(), from that task.
+**
+**    - The loop periods skipped in closed form by AnimSpriteCelAdvance() are
+**      neither recorded nor counted, and AnimSpriteCelSeek() records nothing.
+**
+**    - An AnimSpriteCel gets a new identifier each time it is set up, so an
+**      AnimSpriteCel given back to a pool and taken again is a new one.
+**
+**  Structure Roles:
+**
+**    AnimSpriteCelTraceEvent
+**      - tick: tick of the system of the AnimSpriteCel (0 if not registered)
+**      - animationId: identifier of the AnimSpriteCel
+**      - type: TRACE_INIT, TRACE_STEP, ...
+**      - stepIndex: current step of the AnimSpriteCel
+**      - value: argument of the event
+**
+**    AnimSpriteCelTraceHeader
+**      - magic: ANIMSPRITECELTRACE_MAGIC ("TRCE" in the byte order of the target)
+**      - version: ANIMSPRITECELTRACE_VERSION
+**      - eventsCount: number of events following the header
+**      - eventsLost: older events overwritten in the ring buffer
+**
+**    AnimSpriteCelTrace
+**      - events: ring buffer of events
+**      - eventsMask: capacity of the buffer minus 1 (power of 2)
+**      - eventsWritten: number of events recorded since the initialization
+**      - nextId: identifier of the next AnimSpriteCel set up
+**
+**  Main Functions:
+**
+**    AnimSpriteCelTraceInitialization()
+**      -> Allocates the ring buffer and starts recording.
+**
+**    AnimSpriteCelTraceWrite()
+**      -> Internal function to record an event. Called through
+**         ANIMSPRITECEL_TRACE_EVENT().
+**
+**    AnimSpriteCelTraceCounters()
+**      -> Records the counters of an AnimSpriteCel. Called by
+**         AnimSpriteCelCleanup() through ANIMSPRITECEL_TRACE_COUNTERS().
+**
+**    AnimSpriteCelTraceCopy()
+**      -> Writes the header and the events into a buffer.
+**
+**    AnimSpriteCelTraceCleanup()
+**      -> Stops recording and frees the ring buffer.
+**
+******************************************************************************/
+
+// int32
+#include "types.h"
+// AnimSpriteCel, ANIMSPRITECEL_TRACE
+#include "AnimSpriteCel.h"
+
+// "TRCE"
+#define ANIMSPRITECELTRACE_MAGIC 0x54524345
+// Version of the trace layout
+#define ANIMSPRITECELTRACE_VERSION 1
+
+// Recording macros, empty without trace
+#if ANIMSPRITECEL_TRACE == 1
+#define ANIMSPRITECEL_TRACE_EVENT(type, animSpriteCel, value) AnimSpriteCelTraceWrite((type), (animSpriteCel), (int32)(value))
+#define ANIMSPRITECEL_TRACE_COUNT(counter, count) ((counter) += (count))
+#define ANIMSPRITECEL_TRACE_COUNTERS(animSpriteCel) AnimSpriteCelTraceCounters((animSpriteCel))
+#else
+#define ANIMSPRITECEL_TRACE_EVENT(type, animSpriteCel, value)
+#define ANIMSPRITECEL_TRACE_COUNT(counter, count)
+#define ANIMSPRITECEL_TRACE_COUNTERS(animSpriteCel)
+#endif
+
+// Types of events
+typedef enum {
+    // AnimSpriteCel initialized
+    TRACE_INIT,
+    // Step configured
+    TRACE_CONFIGURATION,
+    // Step changed
+    TRACE_STEP,
+    // Trigger sent to a receiver
+    TRACE_TRIGGER_SENT,
+    // Trigger received
+    TRACE_TRIGGER_RECEIVED,
+    // Animation cycle ended
+    TRACE_ITERATION_END,
+    // Counters of the AnimSpriteCel
+    TRACE_COUNT_STEPS,
+    TRACE_COUNT_IDLE,
+    TRACE_COUNT_SENT,
+    TRACE_COUNT_RECEIVED,
+    // AnimSpriteCel cleaned up
+    TRACE_CLEANUP
+} AnimSpriteCelTraceType;
+
+typedef struct {
+    // Tick of the system (0 if not registered)
+    uint32 tick;
+    // Identifier of the AnimSpriteCel
+    uint32 animationId;
+    // Type of event
+    uint16 type;
+    // Current step
+    uint16 stepIndex;
+    // Argument of the event
+    int32 value;
+} AnimSpriteCelTraceEvent;
+
+typedef struct {
+    // "TRCE"
+    uint32 magic;
+    // Version of the layout
+    uint32 version;
+    // Number of events following the header
+    uint32 eventsCount;
+    // Older events overwritten in the ring buffer
+    uint32 eventsLost;
+} AnimSpriteCelTraceHeader;
+
+typedef struct {
+    // Ring buffer of events (NULL when not recording)
+    AnimSpriteCelTraceEvent *events;
+    // Capacity of the buffer minus 1
+    uint32 eventsMask;
+    // Number of events recorded
+    uint32 eventsWritten;
+    // Identifier of the next AnimSpriteCel
+    uint32 nextId;
+} AnimSpriteCelTrace;
+
+// Trace shared by all the AnimSpriteCels
+extern AnimSpriteCelTrace animSpriteCelTrace;
+
+// Allocates the ring buffer and starts recording
+int32 AnimSpriteCelTraceInitialization(uint32 eventsMax);
+// Records an event
+void AnimSpriteCelTraceWrite(AnimSpriteCelTraceType type, AnimSpriteCel *animSpriteCel, int32 value);
+// Records the counters of an AnimSpriteCel
+void AnimSpriteCelTraceCounters(AnimSpriteCel *animSpriteCel);
+// Writes the header and the events into a buffer
+int32 AnimSpriteCelTraceCopy(void *buffer, uint32 bufferSize);
+// Stops recording and frees the ring buffer
+int32 AnimSpriteCelTraceCleanup(void);
+
+#endif // ANIMSPRITECELTRACE_H
@@ -0,0 +1,240 @@
+/******************************************************************************
+**
+**  AnimSpriteCelTraceTool - Decodes the traces of AnimSpriteCelTrace (host tool)
+**
+**  Author: Christophe Geoffroy (Topper) - MIT License
+**  Last Updated: 2026-10-17
+**
+**  Offline program, built and run on the development computer with any C
+**  compiler (it doesn't use the 3DO SDK):
+**
+**    cc -o AnimSpriteCelTraceTool AnimSpriteCelTraceTool.c
+**    AnimSpriteCelTraceTool [-summary] trace.bin
+**
+**  The input is the buffer written by AnimSpriteCelTraceCopy(), saved as is
+**  (from the debugger on the 3DO, with fwrite() on the host). Its byte order
+**  is found from the magic number, so traces of the 3DO (big-endian) and of
+**  the host (little-endian) are both read.
+**
+**  Each event is printed on a line:
+**
+**    tick  animation  step  event  value
+**
+**  then each AnimSpriteCel is summed up: steps advanced, cycle ends,
+**  triggers sent and received, and the counters it recorded when it was
+**  cleaned up (or "-" if it wasn't). "-summary" only prints the summary.
+**
+**  The layout must match AnimSpriteCelTrace.h.
+**
+******************************************************************************/
+
+// printf(), fopen()
+#include <stdio.h>
+// malloc(), realloc(), free()
+#include <stdlib.h>
+// strcmp(), memset()
+#include <string.h>
+
+// Values of AnimSpriteCelTrace.h
+#define TOOL_MAGIC 0x54524345UL
+#define TOOL_VERSION 1UL
+#define TOOL_HEADER_SIZE 16UL
+#define TOOL_EVENT_SIZE 16UL
+#define TOOL_STEP 2
+#define TOOL_TRIGGER_SENT 3
+#define TOOL_TRIGGER_RECEIVED 4
+#define TOOL_ITERATION_END 5
+#define TOOL_COUNT_STEPS 6
+#define TOOL_COUNT_RECEIVED 9
+#define TOOL_TYPES_COUNT 11
+
+// Names of the event types, in the order of AnimSpriteCelTraceType
+static const char *toolTypeNames[TOOL_TYPES_COUNT] = {
+    "INIT", "CONFIGURATION", "STEP", "TRIGGER_SENT", "TRIGGER_RECEIVED", "ITERATION_END",
+    "COUNT_STEPS", "COUNT_IDLE", "COUNT_SENT", "COUNT_RECEIVED", "CLEANUP"
+};
+
+// Summary of an AnimSpriteCel
+typedef struct {
+    // Events of each type
+    unsigned long eventsCount[TOOL_TYPES_COUNT];
+    // Counters recorded at the cleanup
+    long counters[4];
+    // Counters recorded flag
+    int countersRecorded;
+    // Seen in the trace flag
+    int seen;
+} ToolAnimation;
+
+// Byte order of the trace
+static int toolLittleEndian = 0;
+
+// Reads a 32-bit value in the byte order of the trace
+static unsigned long ToolRead32(const unsigned char *bytes) {
+
+    // If the trace is little-endian
+    if (toolLittleEndian == 1) {
+        return (unsigned long)bytes[0] | ((unsigned long)bytes[1] << 8) | ((unsigned long)bytes[2] << 16) | ((unsigned long)bytes[3] << 24);
+    }
+    return ((unsigned long)bytes[0] << 24) | ((unsigned long)bytes[1] << 16) | ((unsigned long)bytes[2] << 8) | (unsigned long)bytes[3];
+}
+
+// Reads a 16-bit value in the byte order of the trace
+static unsigned long ToolRead16(const unsigned char *bytes) {
+
+    // If the trace is little-endian
+    if (toolLittleEndian == 1) {
+        return (unsigned long)bytes[0] | ((unsigned long)bytes[1] << 8);
+    }
+    return ((unsigned long)bytes[0] << 8) | (unsigned long)bytes[1];
+}
+
+// Gives a signed 32-bit value
+static long ToolSigned32(unsigned long value) {
+    return (value & 0x80000000UL) ? (long)(value - 0x80000000UL) - 0x7FFFFFFFL - 1 : (long)value;
+}
+
+int main(int argc, char *argv[]) {
+
+    // Argument index
+    int argumentIndex = 1;
+    // Summary only
+    int summaryOnly = 0;
+    // Trace file
+    FILE *input = NULL;
+    unsigned char header[TOOL_HEADER_SIZE];
+    unsigned char event[TOOL_EVENT_SIZE];
+    // Header values
+    unsigned long eventsCount = 0;
+    unsigned long eventsLost = 0;
+    // Event values
+    unsigned long eventIndex = 0;
+    unsigned long tick = 0;
+    unsigned long animationId = 0;
+    unsigned long type = 0;
+    unsigned long stepIndex = 0;
+    long value = 0;
+    // Summaries, indexed by identifier
+    ToolAnimation *animations = NULL;
+    ToolAnimation *grown = NULL;
+    unsigned long animationsMax = 0;
+    unsigned long animationIndex = 0;
+    unsigned long counterIndex = 0;
+
+    // Options
+    while ((argumentIndex < argc) && (argv[argumentIndex][0] == '-')) {
+        if (strcmp(argv[argumentIndex], "-summary") == 0) {
+            summaryOnly = 1;
+        } else {
+            break;
+        }
+        argumentIndex++;
+    }
+
+    // If the file is missing
+    if (argc - argumentIndex != 1) {
+        printf("Usage: AnimSpriteCelTraceTool [-summary] trace.bin\n");
+        return 1;
+    }
+
+    // Open the trace
+    input = fopen(argv[argumentIndex], "rb");
+    if (input == NULL) {
+        printf("Error: can't open %s.\n", argv[argumentIndex]);
+        return 1;
+    }
+
+    // Header, in either byte order
+    if (fread(header, 1, TOOL_HEADER_SIZE, input) != TOOL_HEADER_SIZE) {
+        printf("Error: %s is not a trace.\n", argv[argumentIndex]);
+        fclose(input);
+        return 1;
+    }
+    if (ToolRead32(header) != TOOL_MAGIC) {
+        toolLittleEndian = 1;
+    }
+    if ((ToolRead32(header) != TOOL_MAGIC) || (ToolRead32(header + 4) != TOOL_VERSION)) {
+        printf("Error: %s is not a trace of version %lu.\n", argv[argumentIndex], TOOL_VERSION);
+        fclose(input);
+        return 1;
+    }
+    eventsCount = ToolRead32(header + 8);
+    eventsLost = ToolRead32(header + 12);
+
+    printf("%lu events (%s), %lu older events lost\n\n", eventsCount, (toolLittleEndian == 1) ? "little-endian" : "big-endian", eventsLost);
+    if (summaryOnly == 0) {
+        printf("%10s %9s %5s %-16s %11s\n", "tick", "animation", "step", "event", "value");
+    }
+
+    // Decode each event
+    for (eventIndex = 0; eventIndex < eventsCount; eventIndex++) {
+
+        if (fread(event, 1, TOOL_EVENT_SIZE, input) != TOOL_EVENT_SIZE) {
+            printf("Error: trace cut after %lu events.\n", eventIndex);
+            break;
+        }
+
+        // Fields of the event
+        tick = ToolRead32(event);
+        animationId = ToolRead32(event + 4);
+        type = ToolRead16(event + 8);
+        stepIndex = ToolRead16(event + 10);
+        value = ToolSigned32(ToolRead32(event + 12));
+
+        // If the type is unknown
+        if (type >= TOOL_TYPES_COUNT) {
+            printf("Error: unknown event type %lu.\n", type);
+            continue;
+        }
+
+        // Print the event
+        if (summaryOnly == 0) {
+            printf("%10lu %9lu %5lu %-16s %11ld\n", tick, animationId, stepIndex, toolTypeNames[type], value);
+        }
+
+        // Make room for the identifier
+        if (animationId >= animationsMax) {
+            grown = (ToolAnimation *)realloc(animations, (animationId + 1) * sizeof(ToolAnimation));
+            if (grown == NULL) {
+                printf("Error: out of memory.\n");
+                break;
+            }
+            animations = grown;
+            memset(&animations[animationsMax], 0, (animationId + 1 - animationsMax) * sizeof(ToolAnimation));
+            animationsMax = animationId + 1;
+        }
+
+        // Sum up the event
+        animations[animationId].seen = 1;
+        animations[animationId].eventsCount[type]++;
+        if ((type >= TOOL_COUNT_STEPS) && (type <= TOOL_COUNT_RECEIVED)) {
+            animations[animationId].counters[type - TOOL_COUNT_STEPS] = value;
+            animations[animationId].countersRecorded = 1;
+        }
+    }
+    fclose(input);
+
+    // Summary of each AnimSpriteCel seen in the trace
+    printf("\n%9s %9s %9s %9s %9s | %9s %9s %9s %9s\n", "animation", "steps", "cycles", "sent", "received", "steps", "idle", "sent", "received");
+    for (animationIndex = 0; animationIndex < animationsMax; animationIndex++) {
+
+        // Identifier without event
+        if (animations[animationIndex].seen == 0) {
+            continue;
+        }
+
+        printf("%9lu %9lu %9lu %9lu %9lu |", animationIndex, animations[animationIndex].eventsCount[TOOL_STEP], animations[animationIndex].eventsCount[TOOL_ITERATION_END],
+            animations[animationIndex].eventsCount[TOOL_TRIGGER_SENT], animations[animationIndex].eventsCount[TOOL_TRIGGER_RECEIVED]);
+        for (counterIndex = 0; counterIndex < 4; counterIndex++) {
+            if (animations[animationIndex].countersRecorded == 1) {
+                printf(" %9ld", animations[animationIndex].counters[counterIndex]);
+            } else {
+                printf(" %9s", "-");
+            }
+        }
+        printf("\n");
+    }
+
+    free(animations);
+    return 0;
+}
@@ -0,0 +1,185 @@
+/******************************************************************************
+**
+**  Host - Stand-in for the 3DO SDK functions used by AnimSpriteCel
+**
+**  Author: Christophe Geoffroy (Topper) - MIT License
+**  Last Updated: 2026-10-17
+**
+**  Lets AnimSpriteCel be built and measured on a development computer. The
+**  headers of this directory replace the ones of the 3DO SDK: put it first
+**  in the include path (see AnimSpriteCelBenchmark.c).
+**
+******************************************************************************/
+
+// calloc(), malloc(), free()
+#include <stdlib.h>
+// fopen()
+#include <stdio.h>
+
+// AllocMem(), FreeMem()
+#include "mem.h"
+// CloneCel(), DeleteCel()
+#include "celutils.h"
+// ReadHardwareRandomNumber()
+#include "hardware.h"
+// LoadFile(), UnloadFile()
+#include "utils3do.h"
+// SpriteCel
+#include "SpriteCel.h"
+
+// Allocations made since the start
+uint32 hostAllocationsCount = 0;
+uint32 hostAllocatedBytes = 0;
+
+// State of the stand-in random generator
+static uint32 hostRandomState = 12345;
+
+// Source data the frame descriptors point to
+static CelData hostCelData[256];
+
+// Allocates a block of zeroed memory
+void *AllocMem(int32 size, uint32 type) {
+
+    (void)type;
+
+    // Count the allocation
+    hostAllocationsCount++;
+    hostAllocatedBytes += (uint32)size;
+
+    return calloc(1, (size_t)size);
+}
+
+// Frees a block of memory
+void FreeMem(void *p, int32 size) {
+
+    (void)size;
+
+    free(p);
+}
+
+// Copies a CCB
+CCB *CloneCel(CCB *cel, int32 options) {
+
+    // Copy of the CCB
+    CCB *clone = (CCB *)AllocMem(sizeof(CCB), MEMTYPE_DRAM);
+
+    (void)options;
+
+    if (clone != NULL) {
+        *clone = *cel;
+    }
+    return clone;
+}
+
+// Frees a CCB made by CloneCel()
+void DeleteCel(CCB *cel) {
+
+    FreeMem(cel, sizeof(CCB));
+}
+
+// Loads a Cel file (a blank CCB on the host)
+CCB *LoadCel(char *fileName, uint32 memTypeBits) {
+
+    (void)fileName;
+
+    return (CCB *)AllocMem(sizeof(CCB), memTypeBits);
+}
+
+// Frees a CCB made by LoadCel()
+void UnloadCel(CCB *cel) {
+
+    FreeMem(cel, sizeof(CCB));
+}
+
+// Reads the stand-in random generator (linear congruential, fixed seed)
+uint32 ReadHardwareRandomNumber(void) {
+
+    hostRandomState = (hostRandomState * 1103515245UL) + 12345UL;
+    return hostRandomState >> 1;
+}
+
+// Loads a whole file in memory
+void *LoadFile(char *fileName, int32 *fileSize, uint32 memTypeBits) {
+
+    // File and its size
+    FILE *file = NULL;
+    long size = 0;
+    // Loaded bytes
+    void *buffer = NULL;
+
+    (void)memTypeBits;
+
+    file = fopen(fileName, "rb");
+    if (file == NULL) {
+        return NULL;
+    }
+
+    // Size of the file
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    // Read it in one block
+    buffer = malloc((size > 0) ? (size_t)size : 1);
+    if ((buffer != NULL) && (fread(buffer, 1, (size_t)size, file) != (size_t)size)) {
+        free(buffer);
+        buffer = NULL;
+    }
+    fclose(file);
+
+    *fileSize = (int32)size;
+    return buffer;
+}
+
+// Frees a file loaded by LoadFile()
+void UnloadFile(void *buffer) {
+
+    free(buffer);
+}
+
+// Creates a SpriteCel of a given number of frames over a CCB
+SpriteCel *SpriteCelInitialization(CCB *cel, uint32 width, uint32 height, uint32 framesCount) {
+
+    // SpriteCel instance
+    SpriteCel *spriteCel = (SpriteCel *)AllocMem(sizeof(SpriteCel), MEMTYPE_DRAM);
+
+    (void)width;
+    (void)height;
+
+    if (spriteCel != NULL) {
+        spriteCel->cel = cel;
+        spriteCel->framesCount = framesCount;
+        spriteCel->frameIndex = 0;
+    }
+    return spriteCel;
+}
+
+// Sets the positions of frames in the sheet (ignored on the host)
+int32 SpriteCelFramesConfiguration(SpriteCel *spriteCel, int32 start, ...) {
+
+    (void)spriteCel;
+    (void)start;
+
+    return 1;
+}
+
+// Displays a frame (a distinct descriptor per frame)
+void SpriteCelSetFrame(SpriteCel *spriteCel, uint32 frameIndex) {
+
+    spriteCel->frameIndex = frameIndex;
+    spriteCel->cel->ccb_PRE0 = (frameIndex * 3) + 1;
+    spriteCel->cel->ccb_PRE1 = (frameIndex * 5) + 2;
+    spriteCel->cel->ccb_SourcePtr = &hostCelData[frameIndex % 256];
+}
+
+// Displays the next frame
+void SpriteCelNextFrame(SpriteCel *spriteCel) {
+
+    SpriteCelSetFrame(spriteCel, (spriteCel->frameIndex + 1) % spriteCel->framesCount);
+}
+
+// Frees the SpriteCel (not its CCB)
+void SpriteCelCleanup(SpriteCel *spriteCel) {
+
+    FreeMem(spriteCel, sizeof(SpriteCel));
+}
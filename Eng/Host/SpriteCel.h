@@ -0,0 +1,37 @@
+#ifndef HOST_SPRITECEL_H
+#define HOST_SPRITECEL_H
+
+/******************************************************************************
+**
+**  Host stand-in for SpriteCel
+**
+**  A sprite sheet of framesCount frames. SpriteCelSetFrame() writes a distinct
+**  descriptor (PRE0, PRE1, SourcePtr) for each frame in the CCB, as the real
+**  SpriteCel does with the frame offsets.
+**
+******************************************************************************/
+
+// CCB
+#include "graphics.h"
+
+typedef struct {
+    // CCB displaying the current frame
+    CCB *cel;
+    // Number of frames
+    uint32 framesCount;
+    // Frame displayed
+    uint32 frameIndex;
+} SpriteCel;
+
+// Creates a SpriteCel of a given number of frames over a CCB
+SpriteCel *SpriteCelInitialization(CCB *cel, uint32 width, uint32 height, uint32 framesCount);
+// Sets the positions of frames in the sheet (ignored on the host)
+int32 SpriteCelFramesConfiguration(SpriteCel *spriteCel, int32 start, ...);
+// Displays a frame
+void SpriteCelSetFrame(SpriteCel *spriteCel, uint32 frameIndex);
+// Displays the next frame
+void SpriteCelNextFrame(SpriteCel *spriteCel);
+// Frees the SpriteCel (not its CCB)
+void SpriteCelCleanup(SpriteCel *spriteCel);
+
+#endif // HOST_SPRITECEL_H
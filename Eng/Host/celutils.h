@@ -0,0 +1,27 @@
+#ifndef HOST_CELUTILS_H
+#define HOST_CELUTILS_H
+
+/******************************************************************************
+**
+**  Host stand-in for the 3DO SDK "celutils.h"
+**
+******************************************************************************/
+
+// CCB
+#include "graphics.h"
+// MEMTYPE_DRAM
+#include "mem.h"
+
+// CloneCel() options
+#define CLONECEL_CCB_ONLY 0x00000000
+
+// Copies a CCB
+CCB *CloneCel(CCB *cel, int32 options);
+// Frees a CCB made by CloneCel()
+void DeleteCel(CCB *cel);
+// Loads a Cel file (a blank CCB on the host)
+CCB *LoadCel(char *fileName, uint32 memTypeBits);
+// Frees a CCB made by LoadCel()
+void UnloadCel(CCB *cel);
+
+#endif // HOST_CELUTILS_H
@@ -0,0 +1,19 @@
+#ifndef HOST_HARDWARE_H
+#define HOST_HARDWARE_H
+
+/******************************************************************************
+**
+**  Host stand-in for the 3DO SDK "hardware.h"
+**
+**  ReadHardwareRandomNumber() is a fixed-seed generator, so that host runs
+**  are reproducible.
+**
+******************************************************************************/
+
+// uint32
+#include "types.h"
+
+// Reads the hardware random number generator
+uint32 ReadHardwareRandomNumber(void);
+
+#endif // HOST_HARDWARE_H
@@ -0,0 +1,29 @@
+#ifndef HOST_MEM_H
+#define HOST_MEM_H
+
+/******************************************************************************
+**
+**  Host stand-in for the 3DO SDK "mem.h"
+**
+**  AllocMem() returns zeroed memory, like MEMTYPE_FILL on the 3DO, and counts
+**  the allocations so that the benchmark can report them.
+**
+******************************************************************************/
+
+// int32
+#include "types.h"
+
+// Memory types
+#define MEMTYPE_DRAM 0x00000001
+#define MEMTYPE_FILL 0x00000100
+
+// Allocations made since the start (AllocMem() calls and bytes)
+extern uint32 hostAllocationsCount;
+extern uint32 hostAllocatedBytes;
+
+// Allocates a block of memory
+void *AllocMem(int32 size, uint32 type);
+// Frees a block of memory
+void FreeMem(void *p, int32 size);
+
+#endif // HOST_MEM_H
@@ -0,0 +1,29 @@
+#ifndef HOST_TYPES_H
+#define HOST_TYPES_H
+
+/******************************************************************************
+**
+**  Host stand-in for the 3DO SDK "types.h"
+**
+**  Only what AnimSpriteCel uses, with the sizes of the 3DO (32-bit int32).
+**  See AnimSpriteCelBenchmark.c for the host build.
+**
+******************************************************************************/
+
+// Fixed-size integers
+#include <stdint.h>
+// NULL, size_t
+#include <stddef.h>
+// va_list
+#include <stdarg.h>
+
+typedef int8_t int8;
+typedef uint8_t uint8;
+typedef int16_t int16;
+typedef uint16_t uint16;
+typedef int32_t int32;
+typedef uint32_t uint32;
+typedef int32 Err;
+typedef int32 Coord;
+
+#endif // HOST_TYPES_H
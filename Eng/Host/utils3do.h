@@ -0,0 +1,18 @@
+#ifndef HOST_UTILS3DO_H
+#define HOST_UTILS3DO_H
+
+/******************************************************************************
+**
+**  Host stand-in for the Lib3DO "utils3do.h"
+**
+******************************************************************************/
+
+// int32
+#include "types.h"
+
+// Loads a whole file in memory
+void *LoadFile(char *fileName, int32 *fileSize, uint32 memTypeBits);
+// Frees a file loaded by LoadFile()
+void UnloadFile(void *buffer);
+
+#endif // HOST_UTILS3DO_H
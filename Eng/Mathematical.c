@@ -7,17 +7,55 @@
 // Gets a random value between start and end
 int32 GetRandomValue(int32 start, int32 end) {
     
-    // Value range
-    int32 range;
     // Random number
     uint32 randomNumber;
     
     // printf("*GetRandomValue()*\n");  
     
-    // Initialize the expected value range
-    range = end - start + 1;
     // Get a random number
     randomNumber = ReadHardwareRandomNumber();
+    // Return the result (multiply-shift instead of a biased modulo)
+    return GetRandomRangeValue(randomNumber, start, end);
+}
+
+// Gets the next value of a xorshift generator (the state must not be 0)
+uint32 GetRandomXorshift(uint32 *state) {
+
+    // Generator state
+    uint32 x = *state;
+
+    // Three shifts and exclusive ors (period 2^32 - 1)
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+
+    // Keep the new state
+    *state = x;
+    return x;
+}
+
+// Maps a random number to a value between start and end, without division
+int32 GetRandomRangeValue(uint32 randomNumber, int32 start, int32 end) {
+
+    // Value range
+    uint32 range;
+    // 16-bit halves of the factors
+    uint32 randomHigh, randomLow, rangeHigh, rangeLow;
+    // Partial products
+    uint32 lowLow, lowHigh, highLow;
+
+    // Initialize the expected value range
+    range = (uint32)(end - start) + 1;
+
+    // High 32 bits of randomNumber * range, from 16-bit halves (the ARM60 has no long multiply)
+    randomHigh = randomNumber >> 16;
+    randomLow = randomNumber & 0xFFFF;
+    rangeHigh = range >> 16;
+    rangeLow = range & 0xFFFF;
+    lowLow = randomLow * rangeLow;
+    lowHigh = randomLow * rangeHigh;
+    highLow = randomHigh * rangeLow;
+
     // Return the result
-    return start + (randomNumber % range);
+    return start + (int32)((randomHigh * rangeHigh) + (lowHigh >> 16) + (highLow >> 16) + (((lowLow >> 16) + (lowHigh & 0xFFFF) + (highLow & 0xFFFF)) >> 16));
 }
@@ -6,5 +6,9 @@
 
 // Gets a random value between start and end
 int32 GetRandomValue(int32 start, int32 end);
+// Gets the next value of a xorshift generator (the state must not be 0)
+uint32 GetRandomXorshift(uint32 *state);
+// Maps a random number to a value between start and end, without division
+int32 GetRandomRangeValue(uint32 randomNumber, int32 start, int32 end);
 
 #endif // LIBRARY_MATHEMATICAL_H
\ No newline at end of file
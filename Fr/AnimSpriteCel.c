@@ -1,43 +1,222 @@
 
 #include "AnimSpriteCel.h"
 
+// AnimSpriteCelSystemUnregister(), AnimSpriteCelSystemSchedule(), AnimSpriteCelSystemTriggerPush(), AnimSpriteCelSystemOutboxPush(), AnimSpriteCelSystemEventPush()
+#include "AnimSpriteCelSystem.h"
+// ANIMSPRITECEL_TRACE_EVENT(), ANIMSPRITECEL_TRACE_COUNTERS(), animSpriteCelTrace
+#include "AnimSpriteCelTrace.h"
 // UNDEFINED, LIST_START, LIST_END
 #include "DefinitionsArguments.h"
 // AllocMem(), FreeMem(), MEMTYPE_DRAM
 #include "mem.h"
 // CloneCel()
 #include "celutils.h"
-// GetRandomValue()
+// GetRandomValue(), GetRandomXorshift(), GetRandomRangeValue()
 #include "Mathematical.h"
 // memset()
 #include "string.h"
 // printf()
 #include "stdio.h"
 
-// Initialisation d'un AnimSpriteCel
-AnimSpriteCel *AnimSpriteCelInitialization(SpriteCel *spriteCel, AnimSpriteCelLoop loop, AnimSpriteCelRange range, uint32 iterations, int32 direction, uint32 stepIndex, uint32 stepsCount) {
+// Résout et mémorise le descripteur CCB d'une frame du SpriteCel
+void AnimSpriteCelFrameResolve(SpriteCel *spriteCel, AnimSpriteCelFrame *frames, uint32 frameIndex) {
+	
+	// Descripteur de frame affiché par le SpriteCel
+	uint32 spritePRE0 = 0;
+	uint32 spritePRE1 = 0;
+	CelData *spriteSourcePtr = NULL;
+	
+	// Sauvegarde la frame affichée par le SpriteCel partagé
+	spritePRE0 = spriteCel->cel->ccb_PRE0;
+	spritePRE1 = spriteCel->cel->ccb_PRE1;
+	spriteSourcePtr = spriteCel->cel->ccb_SourcePtr;
+	
+	// Laisse le SpriteCel calculer le descripteur de la frame
+	SpriteCelSetFrame(spriteCel, frameIndex);
+	
+	// Le mémorise dans la table, pour toutes les étapes qui affichent la frame
+	frames[frameIndex].ccbPRE0 = spriteCel->cel->ccb_PRE0;
+	frames[frameIndex].ccbPRE1 = spriteCel->cel->ccb_PRE1;
+	frames[frameIndex].ccbSourcePtr = spriteCel->cel->ccb_SourcePtr;
+	
+	// Rend sa frame au SpriteCel
+	spriteCel->cel->ccb_PRE0 = spritePRE0;
+	spriteCel->cel->ccb_PRE1 = spritePRE1;
+	spriteCel->cel->ccb_SourcePtr = spriteSourcePtr;
+}
 
-	// AnimSpriteCel
-	AnimSpriteCel *animSpriteCel = NULL;
-		
-	if (DEBUG_ANIMSPRITECEL_INIT == 1) { printf("*AnimSpriteCelInitialization()*\n");	}
+// Agrandit une table de descripteurs de frames pour contenir un index de frame
+int32 AnimSpriteCelFramesReserve(AnimSpriteCelFrame **frames, uint32 *framesCount, uint32 frameIndex) {
 	
-	// Si le sprite sheet n'existe pas
-    if (spriteCel == NULL){
-		// Affiche un message d'erreur
-		printf("Error : SpriteCel unknow.\n");
-        return NULL;
-	} 	
+	// Table agrandie
+	AnimSpriteCelFrame *grownFrames = NULL;
 	
-	// Alloue de la mémoire pour le AnimSpriteCel
-	animSpriteCel = (AnimSpriteCel *)AllocMem(sizeof(AnimSpriteCel), MEMTYPE_DRAM);
+	// Si la table contient déjà la frame
+	if (frameIndex < *framesCount) {
+		return 1;
+	}
+	
+	// Si la frame ne peut pas être indexée sur 16 bits
+	if (frameIndex >= 0x10000) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel frameIndex %u out of bounds (65536 frames at most).\n", frameIndex);
+		return -1;
+	}
+	
+	// Alloue de la mémoire pour les frames jusqu'à la nouvelle
+	grownFrames = (AnimSpriteCelFrame *)AllocMem((frameIndex + 1) * sizeof(AnimSpriteCelFrame), MEMTYPE_DRAM);
 	// Si c'est un échec
-    if (animSpriteCel == NULL) {
-		// Affiche un message d'erreur
-        printf("Error : Failed to allocate memory for AnimSpriteCel.\n");
-        return NULL;
-    }
+	if (grownFrames == NULL) {
+		// Retourne une erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCel frames.\n");
+		return -1;
+	}
+	
+	// Garde les frames déjà résolues, les nouvelles sont résolues par leurs étapes
+	if (*frames != NULL) {
+		memcpy(grownFrames, *frames, (size_t)*framesCount * sizeof(AnimSpriteCelFrame));
+		FreeMem(*frames, *framesCount * sizeof(AnimSpriteCelFrame));
+	}
+	*frames = grownFrames;
+	*framesCount = frameIndex + 1;
+	
+	// Retourne un succès
+	return 1;
+}
+
+// Résout les descripteurs de frame CCB des frames du SpriteCel
+void AnimSpriteCelFramesResolve(SpriteCel *spriteCel, AnimSpriteCelFrame *frames, uint32 framesCount) {
+	
+	// Index de frame
+	uint32 frameIndex = 0;
+	// Descripteur de frame affiché par le SpriteCel
+	uint32 spritePRE0 = 0;
+	uint32 spritePRE1 = 0;
+	CelData *spriteSourcePtr = NULL;
+	
+	// Sauvegarde la frame affichée par le SpriteCel partagé
+	spritePRE0 = spriteCel->cel->ccb_PRE0;
+	spritePRE1 = spriteCel->cel->ccb_PRE1;
+	spriteSourcePtr = spriteCel->cel->ccb_SourcePtr;
+	
+	// Résout une seule fois le descripteur de chaque frame, pour toutes les étapes qui l'affichent
+	for (frameIndex = 0; frameIndex < framesCount; frameIndex++) {
+		SpriteCelSetFrame(spriteCel, frameIndex);
+		frames[frameIndex].ccbPRE0 = spriteCel->cel->ccb_PRE0;
+		frames[frameIndex].ccbPRE1 = spriteCel->cel->ccb_PRE1;
+		frames[frameIndex].ccbSourcePtr = spriteCel->cel->ccb_SourcePtr;
+	}
+	
+	// Rend sa frame au SpriteCel
+	spriteCel->cel->ccb_PRE0 = spritePRE0;
+	spriteCel->cel->ccb_PRE1 = spritePRE1;
+	spriteCel->cel->ccb_SourcePtr = spriteSourcePtr;
+}
+
+// Écrit la frame de l'étape en cours dans le CCB (disposition normale), renvoie 1 si le CCB a changé
+static uint32 AnimSpriteCelStepDisplay(AnimSpriteCel *animSpriteCel) {
+
+	// Descripteur mémorisé de la frame de l'étape
+	AnimSpriteCelFrame *frame = &animSpriteCel->frames[animSpriteCel->steps[animSpriteCel->stepIndex].frameIndex];
+
+	// Si le CCB montre déjà cette frame, rien à écrire
+	if ((animSpriteCel->cel->ccb_SourcePtr == frame->ccbSourcePtr) && (animSpriteCel->cel->ccb_PRE0 == frame->ccbPRE0) && (animSpriteCel->cel->ccb_PRE1 == frame->ccbPRE1)) {
+		return 0;
+	}
+
+	// Copie le descripteur de frame mémorisé de l'étape
+	animSpriteCel->cel->ccb_PRE0 = frame->ccbPRE0;
+	animSpriteCel->cel->ccb_PRE1 = frame->ccbPRE1;
+	animSpriteCel->cel->ccb_SourcePtr = frame->ccbSourcePtr;
+	return 1;
+}
+
+// Écrit la frame de l'étape en cours dans le CCB (disposition compacte), renvoie 1 si le CCB a changé
+static uint32 AnimSpriteCelPackedStepDisplay(AnimSpriteCel *animSpriteCel) {
+
+	// Les étapes compactes partagent le descripteur de leur frame
+	AnimSpriteCelFrame *frame = &animSpriteCel->frames[animSpriteCel->packedSteps[animSpriteCel->stepIndex].frameIndex];
+
+	// Si le CCB montre déjà cette frame, rien à écrire
+	if ((animSpriteCel->cel->ccb_SourcePtr == frame->ccbSourcePtr) && (animSpriteCel->cel->ccb_PRE0 == frame->ccbPRE0) && (animSpriteCel->cel->ccb_PRE1 == frame->ccbPRE1)) {
+		return 0;
+	}
+
+	animSpriteCel->cel->ccb_PRE0 = frame->ccbPRE0;
+	animSpriteCel->cel->ccb_PRE1 = frame->ccbPRE1;
+	animSpriteCel->cel->ccb_SourcePtr = frame->ccbSourcePtr;
+	return 1;
+}
+
+// Déplace l'index d'étape en avant (NORMAL), renvoie 1 en fin de cycle
+static uint32 AnimSpriteCelStepMoveNormal(AnimSpriteCel *animSpriteCel) {
+
+	// Avance
+	animSpriteCel->stepIndex++;
+
+	// Si l'étape dépasse le maximum
+	if (animSpriteCel->stepIndex >= (int32)animSpriteCel->stepsCount) {
+		// Reviens au début
+		animSpriteCel->stepIndex = 0;
+		// Indique que la fin du cycle a été atteint
+		return 1;
+	}
 
+	return 0;
+}
+
+// Déplace l'index d'étape en arrière (REVERSE), renvoie 1 en fin de cycle
+static uint32 AnimSpriteCelStepMoveReverse(AnimSpriteCel *animSpriteCel) {
+
+	// Recule
+	animSpriteCel->stepIndex--;
+
+	// Si l'étape dépasse le minimum
+	if (animSpriteCel->stepIndex < 0) {
+		// Retourne à la fin
+		animSpriteCel->stepIndex = animSpriteCel->stepsCount - 1;
+		// Indique que la fin du cycle a été atteint
+		return 1;
+	}
+
+	return 0;
+}
+
+// Déplace l'index d'étape en avant ou en arrière (ALTERNATE), renvoie 1 en fin de cycle
+static uint32 AnimSpriteCelStepMoveAlternate(AnimSpriteCel *animSpriteCel) {
+
+	// Avance ou recule selon la direction
+	animSpriteCel->stepIndex += animSpriteCel->direction;
+
+	// Si l'étape dépasse le maximum
+	if (animSpriteCel->stepIndex >= (int32)animSpriteCel->stepsCount) {
+		// Rebondit avant la dernière étape
+		animSpriteCel->stepIndex = animSpriteCel->stepsCount - 2;
+		// Change la direction
+		animSpriteCel->direction = -1;
+		// Indique que la fin du cycle a été atteint
+		return 1;
+	}
+
+	// Si l'étape dépasse le minimum
+	if (animSpriteCel->stepIndex < 0) {
+		// Rebondit après la première étape
+		animSpriteCel->stepIndex = 1;
+		// Change la direction
+		animSpriteCel->direction = 1;
+		// Indique que la fin du cycle a été atteint
+		return 1;
+	}
+
+	return 0;
+}
+
+// Initialisation d'un AnimSpriteCel dont le CCB, les étapes et la ligne de temps sont déjà alloués
+void AnimSpriteCelSetup(AnimSpriteCel *animSpriteCel, SpriteCel *spriteCel, AnimSpriteCelLoop loop, AnimSpriteCelRange range, uint32 iterations, int32 direction, uint32 stepIndex, uint32 stepsCount) {
+
+	// Index d'une étape non configurée
+	uint32 unconfiguredIndex = 0;
+		
 	// Corrige les paramètres 
 	// -> Nombre minimal d'étapes = 2
 	stepsCount = (stepsCount > 1) ? stepsCount : 2;
@@ -50,6 +229,20 @@ AnimSpriteCel *AnimSpriteCelInitialization(SpriteCel *spriteCel, AnimSpriteCelLo
 	animSpriteCel->spriteCel = spriteCel;
 	// Type de boucle d'animation
 	animSpriteCel->loop = loop;
+	// Déplacement d'étape du mode de boucle, choisi une fois au lieu de chaque changement d'étape
+	switch (loop) {
+		case REVERSE:
+			animSpriteCel->stepMove = AnimSpriteCelStepMoveReverse;
+			break;
+		case ALTERNATE:
+			animSpriteCel->stepMove = AnimSpriteCelStepMoveAlternate;
+			break;
+		default:
+			animSpriteCel->stepMove = AnimSpriteCelStepMoveNormal;
+			break;
+	}
+	// Affichage de frame de la disposition des étapes
+	animSpriteCel->stepDisplay = (animSpriteCel->packedSteps != NULL) ? AnimSpriteCelPackedStepDisplay : AnimSpriteCelStepDisplay;
 	// Plage de valeurs de l'aléatoire
 	animSpriteCel->range = range;
 	// Nombre de cycles restants avant le changement
@@ -62,14 +255,107 @@ AnimSpriteCel *AnimSpriteCelInitialization(SpriteCel *spriteCel, AnimSpriteCelLo
 	animSpriteCel->stepIndex = stepIndex;
 	// Nombre total d'étapes
     animSpriteCel->stepsCount = stepsCount;	
-	// Copie le CCB du SpriteCel
-	animSpriteCel->cel = animSpriteCel->spriteCel->cel;
+	// État de départ de la ligne de temps
+	animSpriteCel->originStepIndex = stepIndex;
+	animSpriteCel->originDirection = direction;
+	animSpriteCel->originIterations = iterations;
+	// Nombres aléatoires matériels tant qu'il n'a pas de graine
+	animSpriteCel->randomState = 0;
+	animSpriteCel->originRandomState = 0;
+	// Vitesse normale, rien de reporté
+	animSpriteCel->speed = ANIMSPRITECEL_SPEED_NORMAL;
+	animSpriteCel->speedAccumulator = 0;
+	// Durées en cycles d'affichage
+	animSpriteCel->timeBase = CYCLES;
+	// Ligne de temps construite à la première recherche
+	animSpriteCel->timelineLength = 0;
+	animSpriteCel->timelineDirty = 1;
+	// Pas encore enregistré dans un système
+	animSpriteCel->system = NULL;
+	animSpriteCel->systemIndex = 0;
+	animSpriteCel->expiryTick = 0;
+	animSpriteCel->wheelSlot = NULL;
+	animSpriteCel->wheelPrevious = NULL;
+	animSpriteCel->wheelNext = NULL;
+	animSpriteCel->systemActive = 0;
+	animSpriteCel->stateHash = 0;
+	// Visible, dessiné une fois enregistré dans un système avec une liste d'affichage
+	animSpriteCel->visible = 1;
+	animSpriteCel->drawPrevious = NULL;
+	animSpriteCel->drawNext = NULL;
+	animSpriteCel->drawGroup = 0;
+	// Identifiant et compteurs de la trace
+#if ANIMSPRITECEL_TRACE == 1
+	animSpriteCel->traceId = animSpriteCelTrace.nextId++;
+	animSpriteCel->traceSteps = 0;
+	animSpriteCel->traceIdleCycles = 0;
+	animSpriteCel->traceTriggersSent = 0;
+	animSpriteCel->traceTriggersReceived = 0;
+#endif
+	ANIMSPRITECEL_TRACE_EVENT(TRACE_INIT, animSpriteCel, stepsCount);
 	
-	// Copie le CCB du SpriteCel
-	animSpriteCel->cel = CloneCel(animSpriteCel->spriteCel->cel, CLONECEL_CCB_ONLY);
 	// Force la lecture des préambules dans le CCB
 	animSpriteCel->cel->ccb_Flags |= CCB_CCBPRE;
 
+	// Les étapes compactes d'un fichier ou d'une table sont déjà configurées
+	if ((animSpriteCel->file != NULL) || (animSpriteCel->table != NULL)) {
+		return;
+	}
+
+	// Les étapes compactes non configurées affichent la première frame et attendent
+	if (animSpriteCel->packedSteps != NULL) {
+		for (unconfiguredIndex = 0; unconfiguredIndex < stepsCount; unconfiguredIndex++) {
+			animSpriteCel->packedSteps[unconfiguredIndex].frameIndex = 0;
+			animSpriteCel->packedSteps[unconfiguredIndex].frameDuration = 0;
+			animSpriteCel->packedSteps[unconfiguredIndex].receiverIndex = ANIMSPRITECEL_RECEIVER_NONE;
+			animSpriteCel->packedSteps[unconfiguredIndex].eventId = ANIMSPRITECEL_EVENT_NONE;
+		}
+	// Les étapes partagées par une séquence sont déjà configurées
+	} else if (animSpriteCel->sequence == NULL) {
+		// Les étapes non configurées affichent la première frame et attendent
+		memset(animSpriteCel->steps, 0, (size_t)stepsCount * sizeof(AnimSpriteCelStep));
+		AnimSpriteCelFrameResolve(spriteCel, animSpriteCel->frames, 0);
+	}
+}
+
+// Initialisation d'un AnimSpriteCel
+AnimSpriteCel *AnimSpriteCelInitialization(SpriteCel *spriteCel, AnimSpriteCelLoop loop, AnimSpriteCelRange range, uint32 iterations, int32 direction, uint32 stepIndex, uint32 stepsCount) {
+
+	// AnimSpriteCel
+	AnimSpriteCel *animSpriteCel = NULL;
+		
+	// Si le sprite sheet n'existe pas
+    if (spriteCel == NULL){
+		// Affiche un message d'erreur
+		printf("Error : SpriteCel unknow.\n");
+        return NULL;
+	} 	
+	
+	// Nombre minimal d'étapes = 2
+	stepsCount = (stepsCount > 1) ? stepsCount : 2;
+	
+	// Alloue de la mémoire pour le AnimSpriteCel
+	animSpriteCel = (AnimSpriteCel *)AllocMem(sizeof(AnimSpriteCel), MEMTYPE_DRAM);
+	// Si c'est un échec
+    if (animSpriteCel == NULL) {
+		// Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for AnimSpriteCel.\n");
+        return NULL;
+    }
+
+	// Ne vient pas d'un pool, possède ses propres étapes
+	animSpriteCel->pool = NULL;
+	animSpriteCel->sequence = NULL;
+	animSpriteCel->file = NULL;
+	animSpriteCel->table = NULL;
+	animSpriteCel->release = NULL;
+	animSpriteCel->packedSteps = NULL;
+	// Descripteurs de frames, agrandis par les configurations d'étapes
+	animSpriteCel->framesCount = 1;
+	
+	// Copie le CCB du SpriteCel
+	animSpriteCel->cel = CloneCel(spriteCel->cel, CLONECEL_CCB_ONLY);
+
     // Alloue de la mémoire pour le tableau d'étapes
     animSpriteCel->steps = (AnimSpriteCelStep *)AllocMem(stepsCount * sizeof(AnimSpriteCelStep), MEMTYPE_DRAM);
 	// Si c'est un échec
@@ -81,8 +367,33 @@ AnimSpriteCel *AnimSpriteCelInitialization(SpriteCel *spriteCel, AnimSpriteCelLo
         return NULL;
     }
 
-    // Initialise les valeurs des étapes à 0 
-    memset(animSpriteCel->steps, 0, (size_t)stepsCount * sizeof(AnimSpriteCelStep));
+	// Alloue de la mémoire pour le descripteur de la première frame
+	animSpriteCel->frames = (AnimSpriteCelFrame *)AllocMem(sizeof(AnimSpriteCelFrame), MEMTYPE_DRAM);
+	// Si c'est un échec
+	if (animSpriteCel->frames == NULL) {
+		// Libère la mémoire précédemment allouée
+		FreeMem(animSpriteCel->steps, stepsCount * sizeof(AnimSpriteCelStep));
+		FreeMem(animSpriteCel, sizeof(AnimSpriteCel));
+		// Affiche un message d'erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCel frames.\n");
+		return NULL;
+	}
+
+	// Alloue de la mémoire pour les durées cumulées (jusqu'à 2 * stepsCount - 2 positions en ALTERNATE)
+	animSpriteCel->timeline = (uint32 *)AllocMem(((2 * stepsCount) - 1) * sizeof(uint32), MEMTYPE_DRAM);
+	// Si c'est un échec
+	if (animSpriteCel->timeline == NULL) {
+		// Libère la mémoire précédemment allouée
+		FreeMem(animSpriteCel->frames, sizeof(AnimSpriteCelFrame));
+		FreeMem(animSpriteCel->steps, stepsCount * sizeof(AnimSpriteCelStep));
+		FreeMem(animSpriteCel, sizeof(AnimSpriteCel));
+		// Affiche un message d'erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCel timeline.\n");
+		return NULL;
+	}
+
+	// Initialise l'animation dans la mémoire allouée
+	AnimSpriteCelSetup(animSpriteCel, spriteCel, loop, range, iterations, direction, stepIndex, stepsCount);
 
 	// Retourne le AnimSpriteCel créé
     return animSpriteCel;
@@ -91,8 +402,6 @@ AnimSpriteCel *AnimSpriteCelInitialization(SpriteCel *spriteCel, AnimSpriteCelLo
 // Configuration d'une étape d'un AnimSpriteCel
 int32 AnimSpriteCelStepConfiguration(AnimSpriteCel *animSpriteCel, uint32 stepIndex, uint32 frameIndex, int32 frameDuration, AnimSpriteCel *animSpriteCelReceiver) {
 	
- 	if (DEBUG_ANIMSPRITECEL_SETUP == 1) { printf("*AnimSpriteCelStepConfiguration()*\n"); }	
-
 	// Si l'animation est inconnue
 	if (animSpriteCel == NULL){
 		// Retourne une erreur
@@ -107,6 +416,17 @@ int32 AnimSpriteCelStepConfiguration(AnimSpriteCel *animSpriteCel, uint32 stepIn
 		return -1;	
 	}
 	
+	// Si les étapes sont compactes
+	if (animSpriteCel->packedSteps != NULL){
+		// Une étape compacte désigne son receveur par un index
+		if (animSpriteCelReceiver == NULL){
+			return AnimSpriteCelPackedStepConfiguration(animSpriteCel, stepIndex, frameIndex, frameDuration, ANIMSPRITECEL_RECEIVER_NONE);
+		}
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel packed steps take a receiver index.\n");
+		return -1;
+	}
+	
 	// Si le tableau d'étapes est inconnu
 	if (animSpriteCel->steps == NULL){
 		// Retourne une erreur
@@ -123,6 +443,13 @@ int32 AnimSpriteCelStepConfiguration(AnimSpriteCel *animSpriteCel, uint32 stepIn
 		
 	}
 
+	// Si les étapes appartiennent à une séquence partagée
+	if (animSpriteCel->sequence != NULL){
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel steps are shared by an AnimSpriteCelSequence.\n");
+		return -1;
+	}
+
 	// Corrige les paramètres
 	if (stepIndex >= animSpriteCel->stepsCount) { 
 		// Affiche un avertissement
@@ -131,18 +458,37 @@ int32 AnimSpriteCelStepConfiguration(AnimSpriteCel *animSpriteCel, uint32 stepIn
 		stepIndex = animSpriteCel->stepsCount - 1; 
 	}
 	
+	// Si les descripteurs de frames d'une case de pool ne peuvent pas contenir la frame
+	if ((animSpriteCel->pool != NULL) && (frameIndex >= animSpriteCel->framesCount)) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelPool slots hold %u frames at most.\n", animSpriteCel->framesCount);
+		return -1;
+	}
+	
+	// Fait de la place pour le descripteur de la frame
+	if (AnimSpriteCelFramesReserve(&animSpriteCel->frames, &animSpriteCel->framesCount, frameIndex) < 0) {
+		// Retourne une erreur
+		printf("Error <- AnimSpriteCelFramesReserve()\n");
+		return -1;
+	}
+	
     // Configure l'étape
     animSpriteCel->steps[stepIndex].frameIndex = frameIndex;
     animSpriteCel->steps[stepIndex].frameDuration = frameDuration;
     animSpriteCel->steps[stepIndex].animSpriteCelReceiver = animSpriteCelReceiver;
-	
-	if (DEBUG_ANIMSPRITECEL_SETUP == 1) { 
-		printf("animSpriteCel->cel : %p\n", animSpriteCel->cel);
-		printf("animSpriteCel->steps[%u].frameIndex : %u\n", stepIndex, animSpriteCel->steps[stepIndex].frameIndex);
-		printf("animSpriteCel->steps[%u].frameDuration : %d\n", stepIndex, animSpriteCel->steps[stepIndex].frameDuration);
-		printf("animSpriteCel->steps[%u].animSpriteCelReceiver : %p\n", stepIndex, animSpriteCel->steps[stepIndex].animSpriteCelReceiver);
+	// Les durées cumulées doivent être reconstruites
+	animSpriteCel->timelineDirty = 1;
+	// Résout une seule fois le descripteur de la frame, pour toutes les étapes qui l'affichent
+	AnimSpriteCelFrameResolve(animSpriteCel->spriteCel, animSpriteCel->frames, frameIndex);
+
+	// Les analyses du système ne correspondent plus à ses déclenchements
+	if (animSpriteCel->system != NULL) {
+		animSpriteCel->system->generation++;
 	}
 	
+	// Trace l'étape configurée
+	ANIMSPRITECEL_TRACE_EVENT(TRACE_CONFIGURATION, animSpriteCel, stepIndex);
+	
 	// Si l'étape configurée est celle affichée
 	if(stepIndex == animSpriteCel->stepIndex){
 		// Mets à jour le CCB principal du AnimSpriteCel
@@ -165,8 +511,6 @@ int32 AnimSpriteCelStepsConfiguration(AnimSpriteCel *animSpriteCel, int32 start,
 	int32 frameDuration = 1;
 	AnimSpriteCel *animSpriteCelReceiver = NULL;
 	
-	if (DEBUG_ANIMSPRITECEL_SETUP == 1) { printf("*AnimSpriteCelStepsConfiguration()*\n"); }		
-
     // Débute la lecture des arguments
     va_start(args, start);
 
@@ -188,7 +532,6 @@ int32 AnimSpriteCelStepsConfiguration(AnimSpriteCel *animSpriteCel, int32 start,
 		animSpriteCelReceiver = va_arg(args, AnimSpriteCel *);
 
 		// Configuration d'une step d'un sprite
-		if (DEBUG_ANIMSPRITECEL_SETUP == 1) { printf("-> AnimSpriteCelStepConfiguration(%p, %u, %u, %d, %p)\n", animSpriteCel, stepIndex, frameIndex, frameDuration, animSpriteCelReceiver); }
 		if (AnimSpriteCelStepConfiguration(animSpriteCel, stepIndex, frameIndex, frameDuration, animSpriteCelReceiver) < 0) {
 			// Fin de la liste des arguments 
 			va_end(args);
@@ -205,159 +548,562 @@ int32 AnimSpriteCelStepsConfiguration(AnimSpriteCel *animSpriteCel, int32 start,
     return 1;
 }
 
-// Mets à jour l'affichage d'un AnimSpriteCel
-void AnimSpriteCelUpdate(AnimSpriteCel *animSpriteCel) {
-	
-	// Valeur maximale de la plage de valeurs aléatoires
-	uint32 randomRangeMax = 0;
-	
-	if (DEBUG_ANIMSPRITECEL_FUNCT == 1) { printf("*AnimSpriteCelUpdate()*\n"); }
+// Initialisation d'un AnimSpriteCel aux étapes compactes
+AnimSpriteCel *AnimSpriteCelPackedInitialization(SpriteCel *spriteCel, AnimSpriteCelLoop loop, AnimSpriteCelRange range, uint32 iterations, int32 direction, uint32 stepIndex, uint32 stepsCount, uint32 framesCount) {
 
-	// Affiche le CCB de l'étape en cours
-	SpriteCelSetFrame(animSpriteCel->spriteCel, animSpriteCel->steps[animSpriteCel->stepIndex].frameIndex);	
-	
-	// Copie le contenu du CCB du SpriteCel vers AnimSpriteCel
-    animSpriteCel->cel->ccb_PRE0 = animSpriteCel->spriteCel->cel->ccb_PRE0;
-    animSpriteCel->cel->ccb_PRE1 = animSpriteCel->spriteCel->cel->ccb_PRE1;
-    animSpriteCel->cel->ccb_SourcePtr = animSpriteCel->spriteCel->cel->ccb_SourcePtr;
+	// AnimSpriteCel
+	AnimSpriteCel *animSpriteCel = NULL;
 
-	// Si la durée de la frame est positive
-	if (animSpriteCel->steps[animSpriteCel->stepIndex].frameDuration > 1) {
-		// Récupère la durée
-		animSpriteCel->remainingCycles = animSpriteCel->steps[animSpriteCel->stepIndex].frameDuration;
-		
-	// Si la durée de la frame est négative
-	} else if (animSpriteCel->steps[animSpriteCel->stepIndex].frameDuration < 1) {
-		// Récupère la valeur maximale
-		randomRangeMax = 0 - animSpriteCel->steps[animSpriteCel->stepIndex].frameDuration;
-		// Selon la plage de valeurs
-		switch (animSpriteCel->range) {
-			// Plage de valeur entre 1 et le maximum
-			case FULL:    
-				animSpriteCel->remainingCycles = GetRandomValue(1, randomRangeMax); 
-				break;
-			// Plage de valeur entre (maximum / 2) et le maximum
-			case HALF:    
-				animSpriteCel->remainingCycles = GetRandomValue(randomRangeMax / 2, randomRangeMax);  
-				break;
-			// Plage de valeur entre (maximum / 4) * 3 et le maximum
-			case QUARTER: 
-				animSpriteCel->remainingCycles = GetRandomValue(randomRangeMax - (randomRangeMax / 4), randomRangeMax);
-				break;
-		}
-	// Sinon la durée est 0
-	} else {
-		// L'animation est en attente de déclenchement
-		animSpriteCel->remainingCycles = 0; 
-	}	
-}
+	// Si le sprite sheet n'existe pas
+	if (spriteCel == NULL) {
+		// Affiche un message d'erreur
+		printf("Error : SpriteCel unknow.\n");
+		return NULL;
+	}
 
-// Passe à l'étape suivante de l'animation
-void AnimSpriteCelNextStep(AnimSpriteCel *animSpriteCel) {
-	
-	// Témoin de fin de cycle
-	uint32 cycleEnd = 0;
-	
-	if (DEBUG_ANIMSPRITECEL_FUNCT == 1) { printf("*AnimSpriteCelNextStep()*\n"); }
+	// Si les frames ne peuvent pas être indexées sur 16 bits
+	if ((framesCount == 0) || (framesCount > 0x10000)) {
+		// Affiche un message d'erreur
+		printf("Error : AnimSpriteCel packed steps index 1 to 65536 frames (%u).\n", framesCount);
+		return NULL;
+	}
 
-	// Selon le mode
-	switch (animSpriteCel->loop) {
-		// L'animation se déroule en avant à chaque cycle
-		case NORMAL:   
-			// Avance
-			animSpriteCel->stepIndex++; 
-			// Si l'étape dépasse le maximum
-			if (animSpriteCel->stepIndex >= animSpriteCel->stepsCount) { 
-				// Reviens au début
-				animSpriteCel->stepIndex = 0;
-				// Indique que la fin du cycle a été atteint
-				cycleEnd = 1;
-			}
-			break;
-			
-		// L'animation se déroule en arrière à chaque cycle	
-		case REVERSE:  
-			// Recule
-			animSpriteCel->stepIndex--; 
-			// Si l'étape dépasse le minimum
-			if (animSpriteCel->stepIndex < 0) { 
-				// Retourne à la fin
-				animSpriteCel->stepIndex = animSpriteCel->stepsCount - 1;
-				// Indique que la fin du cycle a été atteint
-				cycleEnd = 1;
-			}
-			break;
-			
-		// L'animation se déroule en avant, puis en arrière au cycle suivant	
-		case ALTERNATE:
-			// Avance ou recule selon la direction
-			animSpriteCel->stepIndex += animSpriteCel->direction;
-
-			// Si l'étape dépasse le maximum
-			if (animSpriteCel->stepIndex >= animSpriteCel->stepsCount) { 
-				// Reviens au début
-				animSpriteCel->stepIndex = 0;
-				// Change la direction
-				animSpriteCel->direction *= -1;
-				// Indique que la fin du cycle a été atteint
-				cycleEnd = 1;
-			// Si l'étape dépasse le minimum
-			}else if (animSpriteCel->stepIndex < 0) { 
-				// Retourne à la fin
-				animSpriteCel->stepIndex = animSpriteCel->stepsCount - 1;
-				// Change la direction
-				animSpriteCel->direction *= -1;
-				// Indique que la fin du cycle a été atteint
-				cycleEnd = 1;
-			}
-			break;
+	// Nombre minimal d'étapes = 2
+	stepsCount = (stepsCount > 1) ? stepsCount : 2;
+
+	// Alloue de la mémoire pour le AnimSpriteCel
+	animSpriteCel = (AnimSpriteCel *)AllocMem(sizeof(AnimSpriteCel), MEMTYPE_DRAM);
+	// Si c'est un échec
+	if (animSpriteCel == NULL) {
+		// Affiche un message d'erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCel.\n");
+		return NULL;
 	}
 
-	// Mets à jour le CCB principal du AnimSpriteCel
-	AnimSpriteCelUpdate(animSpriteCel);
-	
-	// Si c'est la fin d'un cycle et l'animation n'est pas infinie
-	if ((cycleEnd == 1) && (animSpriteCel->iterationsCount != INFINITE)) { 
-		// Décrémente le compteur de cycles restants
-		animSpriteCel->iterationsCount--; 
+	// Ne vient pas d'un pool, possède ses propres étapes compactes
+	animSpriteCel->pool = NULL;
+	animSpriteCel->sequence = NULL;
+	animSpriteCel->file = NULL;
+	animSpriteCel->table = NULL;
+	animSpriteCel->release = NULL;
+	animSpriteCel->steps = NULL;
+	animSpriteCel->framesCount = framesCount;
+
+	// Alloue de la mémoire pour le tableau d'étapes compactes
+	animSpriteCel->packedSteps = (AnimSpriteCelPackedStep *)AllocMem(stepsCount * sizeof(AnimSpriteCelPackedStep), MEMTYPE_DRAM);
+	// Si c'est un échec
+	if (animSpriteCel->packedSteps == NULL) {
+		// Libère la mémoire précédemment allouée
+		FreeMem(animSpriteCel, sizeof(AnimSpriteCel));
+		// Affiche un message d'erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCel packed steps.\n");
+		return NULL;
 	}
-	
-	// Si il y a une animation à contrôler
-	if (animSpriteCel->steps[animSpriteCel->stepIndex].animSpriteCelReceiver != NULL) {
-		// Envoie un déclenchement de la suite  
-		AnimSpriteCelTrigger(animSpriteCel->steps[animSpriteCel->stepIndex].animSpriteCelReceiver);
+
+	// Alloue de la mémoire pour les descripteurs de frames
+	animSpriteCel->frames = (AnimSpriteCelFrame *)AllocMem(framesCount * sizeof(AnimSpriteCelFrame), MEMTYPE_DRAM);
+	// Si c'est un échec
+	if (animSpriteCel->frames == NULL) {
+		// Libère la mémoire précédemment allouée
+		FreeMem(animSpriteCel->packedSteps, stepsCount * sizeof(AnimSpriteCelPackedStep));
+		FreeMem(animSpriteCel, sizeof(AnimSpriteCel));
+		// Affiche un message d'erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCel frames.\n");
+		return NULL;
+	}
+
+	// Alloue de la mémoire pour les durées cumulées (jusqu'à 2 * stepsCount - 2 positions en ALTERNATE)
+	animSpriteCel->timeline = (uint32 *)AllocMem(((2 * stepsCount) - 1) * sizeof(uint32), MEMTYPE_DRAM);
+	// Si c'est un échec
+	if (animSpriteCel->timeline == NULL) {
+		// Libère la mémoire précédemment allouée
+		FreeMem(animSpriteCel->frames, framesCount * sizeof(AnimSpriteCelFrame));
+		FreeMem(animSpriteCel->packedSteps, stepsCount * sizeof(AnimSpriteCelPackedStep));
+		FreeMem(animSpriteCel, sizeof(AnimSpriteCel));
+		// Affiche un message d'erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCel timeline.\n");
+		return NULL;
 	}
+
+	// Résout une seule fois le descripteur de chaque frame
+	AnimSpriteCelFramesResolve(spriteCel, animSpriteCel->frames, framesCount);
+
+	// Copie le CCB du SpriteCel
+	animSpriteCel->cel = CloneCel(spriteCel->cel, CLONECEL_CCB_ONLY);
+
+	// Initialise l'animation dans la mémoire allouée
+	AnimSpriteCelSetup(animSpriteCel, spriteCel, loop, range, iterations, direction, stepIndex, stepsCount);
+
+	// Retourne le AnimSpriteCel
+	return animSpriteCel;
 }
 
-// Exécution de l'animation
-void AnimSpriteCelRun(AnimSpriteCel *animSpriteCel) {
-	
-	if (DEBUG_ANIMSPRITECEL_FUNCT == 1) { printf("*AnimSpriteCelRun()*\n"); }
+// Configuration d'une étape compacte d'un AnimSpriteCel
+int32 AnimSpriteCelPackedStepConfiguration(AnimSpriteCel *animSpriteCel, uint32 stepIndex, uint32 frameIndex, int32 frameDuration, uint32 receiverIndex) {
 
 	// Si l'animation est inconnue
-	if (animSpriteCel == NULL){
+	if (animSpriteCel == NULL) {
 		// Retourne une erreur
 		printf("Error : AnimSpriteCel unknow.\n");
-		return;	
+		return -1;
 	}
-	
-	// Si le SpriteCel est inconnu
-	if (animSpriteCel->spriteCel == NULL){
+
+	// Si les étapes ne sont pas compactes
+	if (animSpriteCel->packedSteps == NULL) {
 		// Retourne une erreur
-		printf("Error : AnimSpriteCel SpriteCel unknow.\n");
-		return;	
+		printf("Error : AnimSpriteCel steps are not packed.\n");
+		return -1;
 	}
-	
-	// Si le tableau d'étapes est inconnu
-	if (animSpriteCel->steps == NULL){
+
+	// Si les étapes sont lues dans un fichier
+	if (animSpriteCel->file != NULL) {
 		// Retourne une erreur
-		printf("Error : AnimSpriteCel steps unknow.\n");
+		printf("Error : AnimSpriteCel steps belong to an AnimSpriteCelFile.\n");
+		return -1;
+	}
+
+	// Si les étapes sont lues dans une table générée
+	if (animSpriteCel->table != NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel steps belong to an AnimSpriteCelTable.\n");
+		return -1;
+	}
+
+	// Si l'étape n'existe pas
+	if (stepIndex >= animSpriteCel->stepsCount) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel stepIndex %u out of bounds (%u steps).\n", stepIndex, animSpriteCel->stepsCount);
+		return -1;
+	}
+
+	// Si la frame n'a pas de descripteur
+	if (frameIndex >= animSpriteCel->framesCount) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel frameIndex %u out of bounds (%u frames).\n", frameIndex, animSpriteCel->framesCount);
+		return -1;
+	}
+
+	// Si la durée ne tient pas sur 16 bits
+	if ((frameDuration < -32768) || (frameDuration > 32767)) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel frameDuration %d out of the packed range (-32768 to 32767).\n", frameDuration);
+		return -1;
+	}
+
+	// Si l'index du receveur ne tient pas sur 16 bits
+	if ((receiverIndex > ANIMSPRITECEL_RECEIVER_NONE) || ((receiverIndex != ANIMSPRITECEL_RECEIVER_NONE) && (animSpriteCel->system != NULL) && (receiverIndex >= animSpriteCel->system->animSpriteCelsMax))) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel receiverIndex %u out of bounds.\n", receiverIndex);
+		return -1;
+	}
+
+	// Configure l'étape compacte
+	animSpriteCel->packedSteps[stepIndex].frameIndex = (uint16)frameIndex;
+	animSpriteCel->packedSteps[stepIndex].frameDuration = (int16)frameDuration;
+	animSpriteCel->packedSteps[stepIndex].receiverIndex = (uint16)receiverIndex;
+	// Les durées cumulées doivent être reconstruites
+	animSpriteCel->timelineDirty = 1;
+
+	// Les analyses du système ne correspondent plus à ses déclenchements
+	if (animSpriteCel->system != NULL) {
+		animSpriteCel->system->generation++;
+	}
+
+	// Trace l'étape configurée
+	ANIMSPRITECEL_TRACE_EVENT(TRACE_CONFIGURATION, animSpriteCel, stepIndex);
+
+	// Si l'étape configurée est celle affichée
+	if (stepIndex == (uint32)animSpriteCel->stepIndex) {
+		// Mets à jour le CCB principal du AnimSpriteCel
+		AnimSpriteCelUpdate(animSpriteCel);
+	}
+
+	// Retourne un succès
+	return 1;
+}
+
+// Définit l'événement qu'une étape envoie au système quand elle commence
+int32 AnimSpriteCelStepEvent(AnimSpriteCel *animSpriteCel, uint32 stepIndex, uint32 eventId) {
+
+	// Si l'animation est inconnue
+	if (animSpriteCel == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel unknow.\n");
+		return -1;
+	}
+
+	// Si le tableau d'étapes est inconnu
+	if ((animSpriteCel->steps == NULL) && (animSpriteCel->packedSteps == NULL)) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel steps unknow.\n");
+		return -1;
+	}
+
+	// Si l'étape n'existe pas
+	if (stepIndex >= animSpriteCel->stepsCount) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel stepIndex %u out of bounds (%u steps).\n", stepIndex, animSpriteCel->stepsCount);
+		return -1;
+	}
+
+	// Si les étapes appartiennent à une séquence partagée
+	if (animSpriteCel->sequence != NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel steps are shared by an AnimSpriteCelSequence.\n");
+		return -1;
+	}
+
+	// Si les étapes sont lues dans un fichier
+	if (animSpriteCel->file != NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel steps belong to an AnimSpriteCelFile.\n");
+		return -1;
+	}
+
+	// Si les étapes sont lues dans une table générée
+	if (animSpriteCel->table != NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel steps belong to an AnimSpriteCelTable.\n");
+		return -1;
+	}
+
+	// Si les étapes sont compactes
+	if (animSpriteCel->packedSteps != NULL) {
+		// Si l'événement ne tient pas sur 16 bits
+		if (eventId > 0xFFFF) {
+			// Retourne une erreur
+			printf("Error : AnimSpriteCel eventId %u out of the packed range (0 to 65535).\n", eventId);
+			return -1;
+		}
+		animSpriteCel->packedSteps[stepIndex].eventId = (uint16)eventId;
+	} else {
+		animSpriteCel->steps[stepIndex].eventId = eventId;
+	}
+
+	// Trace l'étape configurée
+	ANIMSPRITECEL_TRACE_EVENT(TRACE_CONFIGURATION, animSpriteCel, stepIndex);
+
+	// Retourne un succès
+	return 1;
+}
+
+// Donne le receveur d'une étape dans l'une ou l'autre disposition (NULL si aucun)
+AnimSpriteCel *AnimSpriteCelStepReceiver(AnimSpriteCel *animSpriteCel, uint32 stepIndex) {
+
+	// Index du receveur de l'étape compacte
+	uint32 receiverIndex = 0;
+
+	// Disposition normale : l'étape pointe vers son receveur
+	if (animSpriteCel->packedSteps == NULL) {
+		return animSpriteCel->steps[stepIndex].animSpriteCelReceiver;
+	}
+
+	receiverIndex = animSpriteCel->packedSteps[stepIndex].receiverIndex;
+
+	// Pas de receveur, ou pas de système dans lequel le trouver
+	if ((receiverIndex == ANIMSPRITECEL_RECEIVER_NONE) || (animSpriteCel->system == NULL) || (receiverIndex >= animSpriteCel->system->animSpriteCelsCount)) {
+		return NULL;
+	}
+
+	// AnimSpriteCel enregistré à cet index
+	return animSpriteCel->system->animSpriteCels[receiverIndex];
+}
+
+// Définit les cycles restants de l'étape en cours
+static void AnimSpriteCelStepDuration(AnimSpriteCel *animSpriteCel) {
+	
+	// Valeurs minimale et maximale de la plage de valeurs aléatoires
+	uint32 randomRangeMin = 0;
+	uint32 randomRangeMax = 0;
+	// Durée de l'étape
+	int32 frameDuration = ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex);
+
+	// Si la durée de la frame est positive
+	if (frameDuration > 1) {
+		// Récupère la durée
+		animSpriteCel->remainingCycles = frameDuration;
+		
+	// Si la durée de la frame est négative
+	} else if (frameDuration < 0) {
+		// Récupère la valeur maximale
+		randomRangeMax = 0 - frameDuration;
+		// Selon la plage de valeurs, récupère la valeur minimale
+		switch (animSpriteCel->range) {
+			// Plage de valeur entre 1 et le maximum
+			case FULL:    
+				randomRangeMin = 1; 
+				break;
+			// Plage de valeur entre (maximum / 2) et le maximum
+			case HALF:    
+				randomRangeMin = randomRangeMax / 2;  
+				break;
+			// Plage de valeur entre (maximum / 4) * 3 et le maximum
+			case QUARTER: 
+				randomRangeMin = randomRangeMax - (randomRangeMax / 4);
+				break;
+		}
+		
+		// Si l'animation a son propre générateur
+		if (animSpriteCel->randomState != 0) {
+			// Valeur reproductible
+			animSpriteCel->remainingCycles = GetRandomRangeValue(GetRandomXorshift(&animSpriteCel->randomState), randomRangeMin, randomRangeMax);
+		} else {
+			// Valeur aléatoire matérielle
+			animSpriteCel->remainingCycles = GetRandomValue(randomRangeMin, randomRangeMax);
+		}
+	// Sinon la durée est 0 ou 1
+	} else {
+		// L'animation est en attente de déclenchement ou change immédiatement
+		animSpriteCel->remainingCycles = 0; 
+	}	
+
+	// En microsecondes, l'unité qui quitte l'étape fait partie de sa durée
+	if ((animSpriteCel->timeBase == MICROSECONDS) && (animSpriteCel->remainingCycles > 0)) {
+		animSpriteCel->remainingCycles--;
+	}
+}
+
+// Donne à l'AnimSpriteCel son propre générateur aléatoire
+int32 AnimSpriteCelRandomSeed(AnimSpriteCel *animSpriteCel, uint32 seed) {
+	
+	// Si l'animation est inconnue
+	if (animSpriteCel == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel unknow.\n");
+		return -1;
+	}
+	
+	// Si le tableau d'étapes est inconnu
+	if ((animSpriteCel->steps == NULL) && (animSpriteCel->packedSteps == NULL)) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel steps unknow.\n");
+		return -1;
+	}
+	
+	// La suite aléatoire repart de la graine (0 = nombres aléatoires matériels)
+	animSpriteCel->randomState = seed;
+	animSpriteCel->originRandomState = seed;
+	
+	// Si l'étape en cours est aléatoire, la tire depuis la graine
+	if (ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) < 0) {
+		AnimSpriteCelStepDuration(animSpriteCel);
+		// La fin de l'étape a changé
+		if (animSpriteCel->system != NULL) {
+			AnimSpriteCelSystemSchedule(animSpriteCel->system, animSpriteCel);
+		}
+	}
+	
+	// Retourne un succès
+	return 1;
+}
+
+// Règle la vitesse de lecture de l'AnimSpriteCel
+int32 AnimSpriteCelSpeed(AnimSpriteCel *animSpriteCel, uint32 speed) {
+
+	// Si l'animation est inconnue
+	if (animSpriteCel == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel unknow.\n");
+		return -1;
+	}
+
+	// Corrige la vitesse pour que l'accumulateur ne puisse pas déborder
+	if (speed > ANIMSPRITECEL_SPEED_MAX) {
+		// Affiche un avertissement
+		printf("Warning : AnimSpriteCel speed 0x%08X too high. Clamped to 0x%08X.\n", speed, ANIMSPRITECEL_SPEED_MAX);
+		// Modifie la vitesse à la plus haute
+		speed = ANIMSPRITECEL_SPEED_MAX;
+	}
+
+	// Une roue temporelle range la fin d'une étape en ticks au début de l'étape
+	if ((speed != ANIMSPRITECEL_SPEED_NORMAL) && (animSpriteCel->system != NULL) && (animSpriteCel->system->schedule == WHEEL)) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel speed doesn't apply in WHEEL schedule.\n");
+		return -1;
+	}
+
+	// Prise en compte à la prochaine exécution, la fraction reportée est gardée
+	animSpriteCel->speed = speed;
+
+	// Retourne un succès
+	return 1;
+}
+
+// Règle l'unité des durées des étapes
+int32 AnimSpriteCelTimeBaseConfiguration(AnimSpriteCel *animSpriteCel, AnimSpriteCelTimeBase timeBase) {
+
+	// Si l'animation est inconnue
+	if (animSpriteCel == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel unknow.\n");
+		return -1;
+	}
+
+	// Si le tableau d'étapes est inconnu
+	if ((animSpriteCel->steps == NULL) && (animSpriteCel->packedSteps == NULL)) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel steps unknow.\n");
+		return -1;
+	}
+
+	// Si les étapes appartiennent à une séquence partagée, sa ligne de temps l'est aussi
+	if (animSpriteCel->sequence != NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel steps are shared by an AnimSpriteCelSequence.\n");
+		return -1;
+	}
+
+	// Si les étapes sont lues dans un fichier
+	if (animSpriteCel->file != NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel steps belong to an AnimSpriteCelFile.\n");
+		return -1;
+	}
+
+	// Si les étapes sont lues dans une table générée
+	if (animSpriteCel->table != NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel steps belong to an AnimSpriteCelTable.\n");
+		return -1;
+	}
+
+	// S'il est enregistré, le système compte les AnimSpriteCels en MICROSECONDS
+	if (animSpriteCel->system != NULL) {
+		if (animSpriteCel->timeBase == MICROSECONDS) {
+			animSpriteCel->system->microsecondsCount--;
+		}
+		if (timeBase == MICROSECONDS) {
+			animSpriteCel->system->microsecondsCount++;
+		}
+	}
+
+	// Les durées cumulées changent avec l'unité
+	animSpriteCel->timeBase = timeBase;
+	animSpriteCel->timelineDirty = 1;
+
+	// L'étape en cours recommence dans la nouvelle unité
+	AnimSpriteCelStepDuration(animSpriteCel);
+	if (animSpriteCel->system != NULL) {
+		AnimSpriteCelSystemSchedule(animSpriteCel->system, animSpriteCel);
+	}
+
+	// Retourne un succès
+	return 1;
+}
+
+// Mets à jour l'affichage d'un AnimSpriteCel
+void AnimSpriteCelUpdate(AnimSpriteCel *animSpriteCel) {
+	
+	// Frame de l'étape, un CCB changé est noté par le système qui les suit
+	if ((animSpriteCel->stepDisplay(animSpriteCel) == 1) && (animSpriteCel->system != NULL) && (animSpriteCel->system->dirty != NULL)) {
+		AnimSpriteCelSystemDirty(animSpriteCel->system, animSpriteCel);
+	}
+
+	// Durée de l'étape
+	AnimSpriteCelStepDuration(animSpriteCel);
+}
+
+// Déclenche le receveur de l'étape en cours, par la file du système lorsque les déclenchements sont différés
+static void AnimSpriteCelTriggerReceiver(AnimSpriteCel *animSpriteCel, AnimSpriteCel *animSpriteCelReceiver) {
+	
+	// Trace le déclencheur envoyé
+	ANIMSPRITECEL_TRACE_COUNT(animSpriteCel->traceTriggersSent, 1);
+	ANIMSPRITECEL_TRACE_EVENT(TRACE_TRIGGER_SENT, animSpriteCel, animSpriteCelReceiver->traceId);
+
+	// Si le système distribue les déclenchements plus tard
+	if ((animSpriteCel->system != NULL) && (animSpriteCel->system->delivery != IMMEDIATE)) {
+		// Met le déclenchement en file (dans la boîte d'envoi de la partition de l'émetteur pendant un tick partitionné)
+		if (animSpriteCel->system->partitioned == 1) {
+			AnimSpriteCelSystemOutboxPush(animSpriteCel->system, animSpriteCel, animSpriteCelReceiver);
+		} else {
+			AnimSpriteCelSystemTriggerPush(animSpriteCel->system, animSpriteCelReceiver);
+		}
+		return;
+	}
+	
+	// Envoie immédiatement un déclenchement de la suite
+	AnimSpriteCelTrigger(animSpriteCelReceiver);
+}
+
+// Passe à l'étape suivante de l'animation
+void AnimSpriteCelNextStep(AnimSpriteCel *animSpriteCel) {
+	
+	// Témoin de fin de cycle
+	uint32 cycleEnd = 0;
+	// Événement de la nouvelle étape
+	uint32 eventId = 0;
+	// Receveur de la nouvelle étape
+	AnimSpriteCel *animSpriteCelReceiver = NULL;
+	
+	// Déplace l'index d'étape
+	cycleEnd = animSpriteCel->stepMove(animSpriteCel);
+
+	// Mets à jour le CCB principal du AnimSpriteCel
+	AnimSpriteCelUpdate(animSpriteCel);
+	// Trace la nouvelle étape et les cycles qu'elle dure
+	ANIMSPRITECEL_TRACE_COUNT(animSpriteCel->traceSteps, 1);
+	ANIMSPRITECEL_TRACE_COUNT(animSpriteCel->traceIdleCycles, animSpriteCel->remainingCycles);
+	ANIMSPRITECEL_TRACE_EVENT(TRACE_STEP, animSpriteCel, animSpriteCel->remainingCycles);
+	
+	// Si c'est la fin d'un cycle et l'animation n'est pas infinie
+	if ((cycleEnd == 1) && (animSpriteCel->iterationsCount != INFINITE)) { 
+		// Décrémente le compteur de cycles restants
+		animSpriteCel->iterationsCount--; 
+	}
+
+	// Trace la fin du cycle
+	if (cycleEnd == 1) {
+		ANIMSPRITECEL_TRACE_EVENT(TRACE_ITERATION_END, animSpriteCel, animSpriteCel->iterationsCount);
+	}
+	
+	// Si l'animation appartient à un système
+	if (animSpriteCel->system != NULL) {
+		// Planifie la fin de la nouvelle étape
+		AnimSpriteCelSystemSchedule(animSpriteCel->system, animSpriteCel);
+		// Envoie l'événement de la nouvelle étape si le système les collecte
+		if (animSpriteCel->system->events != NULL) {
+			eventId = ANIMSPRITECEL_STEP_EVENT(animSpriteCel, animSpriteCel->stepIndex);
+			if (eventId != ANIMSPRITECEL_EVENT_NONE) {
+				AnimSpriteCelSystemEventPush(animSpriteCel->system, animSpriteCel, eventId);
+			}
+		}
+	}
+	
+	// Si il y a une animation à contrôler
+	animSpriteCelReceiver = AnimSpriteCelStepReceiver(animSpriteCel, animSpriteCel->stepIndex);
+	if (animSpriteCelReceiver != NULL) {
+		// Envoie un déclenchement de la suite  
+		AnimSpriteCelTriggerReceiver(animSpriteCel, animSpriteCelReceiver);
+	}
+}
+
+// Exécution de l'animation
+void AnimSpriteCelRun(AnimSpriteCel *animSpriteCel) {
+	
+	// Si l'animation est inconnue
+	if (animSpriteCel == NULL){
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel unknow.\n");
+		return;	
+	}
+	
+	// Si le SpriteCel est inconnu
+	if (animSpriteCel->spriteCel == NULL){
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel SpriteCel unknow.\n");
+		return;	
+	}
+	
+	// Si le tableau d'étapes est inconnu
+	if ((animSpriteCel->steps == NULL) && (animSpriteCel->packedSteps == NULL)){
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel steps unknow.\n");
 		return;
 		
 	}
 	
 	// Si l'animation est en attente d'un déclencheur
-	if (animSpriteCel->steps[animSpriteCel->stepIndex].frameDuration == 0){
+	if (ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) == 0){
 		// Quitte prématurément
 		return;
 	}
@@ -368,6 +1114,13 @@ void AnimSpriteCelRun(AnimSpriteCel *animSpriteCel) {
 		return;
 	}
 	
+	// Si l'animation joue à une autre vitesse, ses cycles viennent de l'accumulateur
+	if (animSpriteCel->speed != ANIMSPRITECEL_SPEED_NORMAL) {
+		AnimSpriteCelSpeedRun(animSpriteCel);
+		// Quitte prématurément
+		return;
+	}
+	
 	// Si ce n'est pas le moment de changer d'étape
 	if(animSpriteCel->remainingCycles > 0){	
 		// Décrémente le nombre de cycles d'affichage
@@ -381,11 +1134,501 @@ void AnimSpriteCelRun(AnimSpriteCel *animSpriteCel) {
 	
 }
 
+// Exécute un cycle d'affichage à la vitesse de l'animation
+void AnimSpriteCelSpeedRun(AnimSpriteCel *animSpriteCel) {
+
+	// Cycles d'affichage entiers atteints par l'accumulateur
+	uint32 cycles = 0;
+
+	// Ajoute la vitesse : les cycles entiers sont joués, la fraction est reportée
+	animSpriteCel->speedAccumulator += animSpriteCel->speed;
+	cycles = animSpriteCel->speedAccumulator >> 16;
+	animSpriteCel->speedAccumulator &= 0xFFFF;
+
+	// Si l'étape ne se termine pas pendant ces cycles
+	if (animSpriteCel->remainingCycles >= cycles) {
+		// Les consomme
+		animSpriteCel->remainingCycles -= cycles;
+		return;
+	}
+
+	// Rattrape les cycles au-delà de la fin de l'étape comme AnimSpriteCelAdvance(), le CCB est écrit une fois
+	AnimSpriteCelAdvance(animSpriteCel, cycles);
+}
+
+// Donne les unités que dure une étape de durée fixe (en cycles, plus le cycle qui la quitte)
+static uint32 AnimSpriteCelStepLifetime(AnimSpriteCel *animSpriteCel, int32 frameDuration) {
+
+	// Un changement immédiat dure une unité, une étape en microsecondes dure sa durée
+	if ((frameDuration == 1) || (animSpriteCel->timeBase == MICROSECONDS)) {
+		return frameDuration;
+	}
+
+	return frameDuration + 1;
+}
+
+// Donne la durée en cycles d'une période de boucle et les itérations qu'elle consomme (0 si elle ne peut pas être sautée)
+static uint32 AnimSpriteCelLoopPeriod(AnimSpriteCel *animSpriteCel, uint32 *iterations) {
+	
+	// Index d'étape
+	uint32 stepIndex = 0;
+	// Durée de vie d'une étape en cycles
+	uint32 stepCycles = 0;
+	// Durée de la période
+	uint32 periodCycles = 0;
+	
+	for (stepIndex = 0; stepIndex < animSpriteCel->stepsCount; stepIndex++) {
+		
+		// Les étapes aléatoires, en attente, déclenchantes ou à événement doivent être jouées une à une
+		if ((ANIMSPRITECEL_STEP_DURATION(animSpriteCel, stepIndex) < 1) || (AnimSpriteCelStepReceiver(animSpriteCel, stepIndex) != NULL) || (ANIMSPRITECEL_STEP_EVENT(animSpriteCel, stepIndex) != ANIMSPRITECEL_EVENT_NONE)) {
+			return 0;
+		}
+		
+		// Durée de vie de l'étape dans l'unité de temps
+		stepCycles = AnimSpriteCelStepLifetime(animSpriteCel, ANIMSPRITECEL_STEP_DURATION(animSpriteCel, stepIndex));
+		periodCycles += stepCycles;
+		
+		// Les étapes intérieures sont jouées deux fois par période ALTERNATE (aller et retour)
+		if ((animSpriteCel->loop == ALTERNATE) && (stepIndex > 0) && (stepIndex < animSpriteCel->stepsCount - 1)) {
+			periodCycles += stepCycles;
+		}
+	}
+	
+	// Une période NORMAL ou REVERSE est un cycle, une période ALTERNATE est un aller et un retour
+	*iterations = (animSpriteCel->loop == ALTERNATE) ? 2 : 1;
+	
+	return periodCycles;
+}
+
+// Rattrape un nombre donné de cycles d'affichage
+void AnimSpriteCelAdvance(AnimSpriteCel *animSpriteCel, uint32 elapsedCycles) {
+	
+	// Témoin de fin de cycle
+	uint32 cycleEnd = 0;
+	// Témoin de changement d'étape
+	uint32 stepChanged = 0;
+	// Durée d'une période de boucle (0 = non calculée ou ne peut pas être sautée)
+	uint32 periodCycles = 0;
+	// Itérations consommées par une période de boucle
+	uint32 periodIterations = 0;
+	// Périodes de boucle à sauter
+	uint32 periodsCount = 0;
+	// Témoin de calcul de la période
+	uint32 periodChecked = 0;
+	// Événement d'une étape franchie
+	uint32 eventId = 0;
+	// Receveur d'une étape franchie
+	AnimSpriteCel *animSpriteCelReceiver = NULL;
+	
+	// Si l'animation n'est pas définie
+	if (animSpriteCel == NULL) {
+		// Affiche une erreur
+		printf("Error : AnimSpriteCel unknow.\n");
+		return;
+	}
+	
+	// Si le SpriteCel n'est pas défini
+	if (animSpriteCel->spriteCel == NULL) {
+		// Affiche une erreur
+		printf("Error : AnimSpriteCel SpriteCel unknow.\n");
+		return;
+	}
+	
+	// Si le tableau d'étapes n'est pas défini
+	if ((animSpriteCel->steps == NULL) && (animSpriteCel->packedSteps == NULL)) {
+		// Affiche une erreur
+		printf("Error : AnimSpriteCel steps unknow.\n");
+		return;
+	}
+	
+	// Si la fin de l'étape est portée par la roue temporelle d'un système
+	if (animSpriteCel->wheelSlot != NULL) {
+		// Remet à jour les cycles restants
+		animSpriteCel->remainingCycles = animSpriteCel->expiryTick - animSpriteCel->system->tick;
+	}
+	
+	while (elapsedCycles > 0) {
+		
+		// Si l'animation est en attente d'un déclenchement
+		if (ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) == 0) {
+			break;
+		}
+		
+		// Si toutes les itérations sont terminées
+		if (animSpriteCel->iterationsCount == 0) {
+			break;
+		}
+		
+		// Si l'étape en cours ne se termine pas dans les cycles écoulés
+		if (animSpriteCel->remainingCycles >= elapsedCycles) {
+			animSpriteCel->remainingCycles -= elapsedCycles;
+			break;
+		}
+		
+		// Consomme la fin de l'étape et le cycle qui la quitte
+		elapsedCycles -= animSpriteCel->remainingCycles + 1;
+		
+		// Passe à l'étape suivante sans toucher au CCB
+		cycleEnd = animSpriteCel->stepMove(animSpriteCel);
+		AnimSpriteCelStepDuration(animSpriteCel);
+		stepChanged = 1;
+		// Trace la nouvelle étape et les cycles qu'elle dure
+		ANIMSPRITECEL_TRACE_COUNT(animSpriteCel->traceSteps, 1);
+		ANIMSPRITECEL_TRACE_COUNT(animSpriteCel->traceIdleCycles, animSpriteCel->remainingCycles);
+		ANIMSPRITECEL_TRACE_EVENT(TRACE_STEP, animSpriteCel, animSpriteCel->remainingCycles);
+		
+		// Si c'est la fin d'un cycle et l'animation n'est pas infinie
+		if ((cycleEnd == 1) && (animSpriteCel->iterationsCount != INFINITE)) { 
+			// Décrémente le compteur de cycles restants
+			animSpriteCel->iterationsCount--; 
+		}
+
+		// Trace la fin du cycle
+		if (cycleEnd == 1) {
+			ANIMSPRITECEL_TRACE_EVENT(TRACE_ITERATION_END, animSpriteCel, animSpriteCel->iterationsCount);
+		}
+		
+		// Envoie l'événement de cette étape, dans l'ordre, si le système les collecte
+		if ((animSpriteCel->system != NULL) && (animSpriteCel->system->events != NULL)) {
+			eventId = ANIMSPRITECEL_STEP_EVENT(animSpriteCel, animSpriteCel->stepIndex);
+			if (eventId != ANIMSPRITECEL_EVENT_NONE) {
+				AnimSpriteCelSystemEventPush(animSpriteCel->system, animSpriteCel, eventId);
+			}
+		}
+		
+		// Si il y a une animation à contrôler
+		animSpriteCelReceiver = AnimSpriteCelStepReceiver(animSpriteCel, animSpriteCel->stepIndex);
+		if (animSpriteCelReceiver != NULL) {
+			// Envoie un déclenchement de la suite, dans l'ordre
+			AnimSpriteCelTriggerReceiver(animSpriteCel, animSpriteCelReceiver);
+		}
+		
+		// Une seule fois, cherche une période de boucle qui peut être sautée directement
+		if (periodChecked == 0) {
+			periodCycles = AnimSpriteCelLoopPeriod(animSpriteCel, &periodIterations);
+			periodChecked = 1;
+		}
+		
+		// Si des périodes entières tiennent dans les cycles écoulés, les saute (l'étape vient de commencer, l'état se répète)
+		if ((periodCycles > 0) && (elapsedCycles >= periodCycles) && (animSpriteCel->iterationsCount != 0)) {
+			periodsCount = elapsedCycles / periodCycles;
+			// Garde au moins une itération pour que la dernière période soit jouée normalement
+			if ((animSpriteCel->iterationsCount != INFINITE) && (periodsCount * periodIterations >= animSpriteCel->iterationsCount)) {
+				periodsCount = (animSpriteCel->iterationsCount - 1) / periodIterations;
+			}
+			elapsedCycles -= periodsCount * periodCycles;
+			if (animSpriteCel->iterationsCount != INFINITE) {
+				animSpriteCel->iterationsCount -= periodsCount * periodIterations;
+			}
+		}
+	}
+	
+	// Si l'étape a changé
+	if (stepChanged == 1) {
+		// Écrit le CCB une seule fois, pour l'étape finale, un CCB changé est noté par le système qui les suit
+		if ((animSpriteCel->stepDisplay(animSpriteCel) == 1) && (animSpriteCel->system != NULL) && (animSpriteCel->system->dirty != NULL)) {
+			AnimSpriteCelSystemDirty(animSpriteCel->system, animSpriteCel);
+		}
+	}
+	
+	// Si l'animation appartient à un système
+	if (animSpriteCel->system != NULL) {
+		// Planifie la fin de l'étape en cours
+		AnimSpriteCelSystemSchedule(animSpriteCel->system, animSpriteCel);
+	}
+}
+
+// Exécute l'animation pendant le temps écoulé depuis sa dernière exécution
+void AnimSpriteCelTimeRun(AnimSpriteCel *animSpriteCel, uint32 elapsedMicroseconds) {
+
+	// Si l'animation est inconnue
+	if (animSpriteCel == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel unknow.\n");
+		return;
+	}
+
+	// Si les durées sont comptées en cycles d'affichage
+	if (animSpriteCel->timeBase != MICROSECONDS) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel durations are not in MICROSECONDS.\n");
+		return;
+	}
+
+	// Rattrape les microsecondes écoulées : le temps au-delà de la fin d'une étape va dans la suivante, le CCB est écrit une fois
+	AnimSpriteCelAdvance(animSpriteCel, elapsedMicroseconds);
+}
+
+// Donne l'étape jouée à une position de la ligne de temps
+static uint32 AnimSpriteCelTimelineStep(AnimSpriteCel *animSpriteCel, uint32 position) {
+
+	// Selon le mode
+	switch (animSpriteCel->loop) {
+		// Les positions suivent les étapes en arrière
+		case REVERSE:
+			return animSpriteCel->stepsCount - 1 - position;
+		// Les positions avancent jusqu'à la dernière étape, puis reviennent jusqu'à la deuxième
+		case ALTERNATE:
+			return (position < animSpriteCel->stepsCount) ? position : (2 * animSpriteCel->stepsCount) - 2 - position;
+		// Les positions suivent les étapes en avant
+		default:
+			return position;
+	}
+}
+
+// Construit les durées cumulées d'une période de boucle
+static void AnimSpriteCelTimelineBuild(AnimSpriteCel *animSpriteCel) {
+
+	// Position dans la période de boucle
+	uint32 position = 0;
+	// Nombre de positions dans la période de boucle
+	uint32 length = 0;
+	// Durée de l'étape à la position
+	int32 frameDuration = 0;
+
+	// Une période ALTERNATE joue deux fois les étapes intérieures
+	length = (animSpriteCel->loop == ALTERNATE) ? (2 * animSpriteCel->stepsCount) - 2 : animSpriteCel->stepsCount;
+
+	// La période commence à 0
+	animSpriteCel->timeline[0] = 0;
+	// La table est à jour une fois construite
+	animSpriteCel->timelineDirty = 0;
+
+	for (position = 0; position < length; position++) {
+
+		frameDuration = ANIMSPRITECEL_STEP_DURATION(animSpriteCel, AnimSpriteCelTimelineStep(animSpriteCel, position));
+
+		// Les étapes aléatoires ou en attente n'ont pas de position fixe dans le temps
+		if (frameDuration < 1) {
+			animSpriteCel->timelineLength = 0;
+			return;
+		}
+
+		// Durée de vie de l'étape dans l'unité de temps
+		animSpriteCel->timeline[position + 1] = animSpriteCel->timeline[position] + AnimSpriteCelStepLifetime(animSpriteCel, frameDuration);
+	}
+
+	animSpriteCel->timelineLength = length;
+}
+
+// Place l'animation à un cycle d'affichage donné de sa ligne de temps
+int32 AnimSpriteCelSeek(AnimSpriteCel *animSpriteCel, uint32 tick) {
+
+	// Nombre de positions dans la période de boucle
+	uint32 length = 0;
+	// Durée de la période de boucle
+	uint32 periodCycles = 0;
+	// Périodes entières et cycles restants dans le tick
+	uint32 periodsCount = 0;
+	uint32 restCycles = 0;
+	// Position et temps de l'état de départ dans la période
+	uint32 originPosition = 0;
+	uint32 originTime = 0;
+	// Sorties de fin de cycle dans la première période (temps relatif et position quittée)
+	uint32 exitTimes[2];
+	uint32 exitPositions[2];
+	uint32 exitsCount = 0;
+	// Première sortie qui ne termine pas un cycle (ALTERNATE démarré sur une borne, vers l'intérieur)
+	uint32 exitsSkipped = 0;
+	// Fins de cycle traversées jusqu'au tick
+	uint32 cycleEnds = 0;
+	// Index de la fin de cycle qui arrête l'animation
+	uint32 stopIndex = 0;
+	// Position atteinte et son temps dans la période
+	uint32 position = 0;
+	uint32 time = 0;
+	// Bornes de la recherche dichotomique
+	uint32 low = 0;
+	uint32 high = 0;
+	// Valeur d'échange
+	uint32 swap = 0;
+	// Témoin de fin de cycle (rejeu)
+	uint32 cycleEnd = 0;
+
+	// Si l'animation n'est pas définie
+	if (animSpriteCel == NULL) {
+		// Affiche une erreur
+		printf("Error : AnimSpriteCel unknow.\n");
+		return -1;
+	}
+
+	// Si le SpriteCel n'est pas défini
+	if (animSpriteCel->spriteCel == NULL) {
+		// Affiche une erreur
+		printf("Error : AnimSpriteCel SpriteCel unknow.\n");
+		return -1;
+	}
+
+	// Si le tableau d'étapes n'est pas défini
+	if ((animSpriteCel->steps == NULL) && (animSpriteCel->packedSteps == NULL)) {
+		// Affiche une erreur
+		printf("Error : AnimSpriteCel steps unknow.\n");
+		return -1;
+	}
+
+	// Reconstruit les durées cumulées après une configuration d'étape
+	if (animSpriteCel->timelineDirty == 1) {
+		AnimSpriteCelTimelineBuild(animSpriteCel);
+	}
+
+	// Retour à l'état de départ de la ligne de temps
+	animSpriteCel->stepIndex = animSpriteCel->originStepIndex;
+	animSpriteCel->direction = animSpriteCel->originDirection;
+	animSpriteCel->iterationsCount = animSpriteCel->originIterations;
+	animSpriteCel->randomState = animSpriteCel->originRandomState;
+
+	// Si des durées sont aléatoires ou en attente, rejoue la ligne de temps depuis le départ
+	if (animSpriteCel->timelineLength == 0) {
+
+		// Durée de l'étape de départ (les durées aléatoires sont tirées à nouveau)
+		AnimSpriteCelStepDuration(animSpriteCel);
+
+		while (tick > 0) {
+
+			// S'arrête sur une étape en attente ou lorsque toutes les itérations sont terminées
+			if ((ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) == 0) || (animSpriteCel->iterationsCount == 0)) {
+				break;
+			}
+
+			// Si l'étape en cours ne se termine pas dans les cycles restants
+			if (animSpriteCel->remainingCycles >= tick) {
+				animSpriteCel->remainingCycles -= tick;
+				break;
+			}
+
+			// Consomme la fin de l'étape et le cycle qui la quitte
+			tick -= animSpriteCel->remainingCycles + 1;
+
+			// Passe à l'étape suivante
+			cycleEnd = animSpriteCel->stepMove(animSpriteCel);
+			AnimSpriteCelStepDuration(animSpriteCel);
+
+			// Si c'est la fin d'un cycle et l'animation n'est pas infinie
+			if ((cycleEnd == 1) && (animSpriteCel->iterationsCount != INFINITE)) {
+				// Décrémente le compteur de cycles restants
+				animSpriteCel->iterationsCount--;
+			}
+		}
+
+	} else {
+
+		length = animSpriteCel->timelineLength;
+		periodCycles = animSpriteCel->timeline[length];
+
+		// Position de l'état de départ
+		switch (animSpriteCel->loop) {
+			case REVERSE:
+				originPosition = animSpriteCel->stepsCount - 1 - animSpriteCel->originStepIndex;
+				break;
+			case ALTERNATE:
+				originPosition = ((animSpriteCel->originDirection == 1) || (animSpriteCel->originStepIndex == 0)) ? (uint32)animSpriteCel->originStepIndex : (2 * animSpriteCel->stepsCount) - 2 - animSpriteCel->originStepIndex;
+				// Démarré sur une borne vers l'intérieur, la première borne ne termine pas de cycle
+				if (((animSpriteCel->originStepIndex == 0) && (animSpriteCel->originDirection == 1)) || ((animSpriteCel->originStepIndex == (int32)animSpriteCel->stepsCount - 1) && (animSpriteCel->originDirection == -1))) {
+					exitsSkipped = 1;
+				}
+				break;
+			default:
+				originPosition = animSpriteCel->originStepIndex;
+				break;
+		}
+		originTime = animSpriteCel->timeline[originPosition];
+
+		// Si l'étape de départ n'est pas encore quittée (ou l'animation ne tourne pas)
+		if ((animSpriteCel->iterationsCount == 0) || (tick < animSpriteCel->timeline[originPosition + 1] - originTime)) {
+			position = originPosition;
+			time = originTime + ((animSpriteCel->iterationsCount == 0) ? 0 : tick);
+
+		} else {
+
+			// Positions dont la sortie termine un cycle : les bornes en ALTERNATE, la dernière sinon
+			if (animSpriteCel->loop == ALTERNATE) {
+				exitPositions[exitsCount++] = animSpriteCel->stepsCount - 1;
+				exitPositions[exitsCount++] = 0;
+			} else {
+				exitPositions[exitsCount++] = length - 1;
+			}
+
+			// Temps de chaque sortie après le départ, triés
+			for (low = 0; low < exitsCount; low++) {
+				time = animSpriteCel->timeline[exitPositions[low] + 1];
+				exitTimes[low] = (time > originTime) ? time - originTime : time + periodCycles - originTime;
+			}
+			if ((exitsCount == 2) && (exitTimes[1] < exitTimes[0])) {
+				swap = exitTimes[0]; exitTimes[0] = exitTimes[1]; exitTimes[1] = swap;
+				swap = exitPositions[0]; exitPositions[0] = exitPositions[1]; exitPositions[1] = swap;
+			}
+
+			// Compte les fins de cycle traversées
+			periodsCount = tick / periodCycles;
+			restCycles = tick % periodCycles;
+			for (low = 0; low < exitsCount; low++) {
+				cycleEnds += periodsCount + ((exitTimes[low] <= restCycles) ? 1 : 0);
+			}
+			cycleEnds -= exitsSkipped;
+
+			// Si la dernière itération se termine avant le tick
+			if ((animSpriteCel->iterationsCount != INFINITE) && (cycleEnds >= animSpriteCel->iterationsCount)) {
+				// L'animation s'arrête sur l'étape atteinte par la dernière fin de cycle
+				stopIndex = animSpriteCel->iterationsCount - 1 + exitsSkipped;
+				position = (exitPositions[stopIndex % exitsCount] + 1) % length;
+				time = animSpriteCel->timeline[position];
+				animSpriteCel->iterationsCount = 0;
+
+			} else {
+				// Temps dans la période
+				time = originTime + restCycles;
+				if (time >= periodCycles) {
+					time -= periodCycles;
+				}
+
+				// Dernière position qui commence à ce temps ou avant
+				low = 0;
+				high = length - 1;
+				while (low < high) {
+					position = (low + high + 1) / 2;
+					if (animSpriteCel->timeline[position] <= time) {
+						low = position;
+					} else {
+						high = position - 1;
+					}
+				}
+				position = low;
+
+				// Itérations restantes
+				if (animSpriteCel->iterationsCount != INFINITE) {
+					animSpriteCel->iterationsCount -= cycleEnds;
+				}
+			}
+
+			// Étape et direction à la position
+			animSpriteCel->stepIndex = AnimSpriteCelTimelineStep(animSpriteCel, position);
+			if (animSpriteCel->loop == ALTERNATE) {
+				animSpriteCel->direction = ((position > 0) && (position < animSpriteCel->stepsCount)) ? 1 : -1;
+			}
+		}
+
+		// Cycles restants avant la fin de l'étape
+		animSpriteCel->remainingCycles = animSpriteCel->timeline[position + 1] - 1 - time;
+	}
+
+	// Écrit le CCB une seule fois, un CCB changé est noté par le système qui les suit
+	if ((animSpriteCel->stepDisplay(animSpriteCel) == 1) && (animSpriteCel->system != NULL) && (animSpriteCel->system->dirty != NULL)) {
+		AnimSpriteCelSystemDirty(animSpriteCel->system, animSpriteCel);
+	}
+
+	// Si l'animation appartient à un système
+	if (animSpriteCel->system != NULL) {
+		// Planifie la fin de l'étape en cours
+		AnimSpriteCelSystemSchedule(animSpriteCel->system, animSpriteCel);
+	}
+
+	// Retourne un succès
+	return 1;
+}
+
 // Déclencheur de l'animation en attente
 void AnimSpriteCelTrigger(AnimSpriteCel *animSpriteCel) {
 	
-	if (DEBUG_ANIMSPRITECEL_FUNCT == 1) { printf("*AnimSpriteCelTrigger()*\n"); }
-
 	// Si l'animation est inconnue
 	if (animSpriteCel == NULL){
 		// Retourne une erreur
@@ -401,15 +1644,19 @@ void AnimSpriteCelTrigger(AnimSpriteCel *animSpriteCel) {
 	}
 	
 	// Si le tableau d'étapes est inconnu
-	if (animSpriteCel->steps == NULL){
+	if ((animSpriteCel->steps == NULL) && (animSpriteCel->packedSteps == NULL)){
 		// Retourne une erreur
 		printf("Error : AnimSpriteCel steps unknow.\n");
 		return;
 		
 	}
 	
+	// Trace le déclencheur reçu (1 s'il lance l'étape suivante)
+	ANIMSPRITECEL_TRACE_COUNT(animSpriteCel->traceTriggersReceived, 1);
+	ANIMSPRITECEL_TRACE_EVENT(TRACE_TRIGGER_RECEIVED, animSpriteCel, (ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) == 0) && (animSpriteCel->iterationsCount != 0));
+
 	// Si l'animation n'est pas en attente d'un déclencheur
-	if (animSpriteCel->steps[animSpriteCel->stepIndex].frameDuration != 0){
+	if (ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) != 0){
 		// Quitte prématurément
 		return;
 	}
@@ -428,8 +1675,6 @@ void AnimSpriteCelTrigger(AnimSpriteCel *animSpriteCel) {
 // Supprime le AnimSpriteCel
 int32 AnimSpriteCelCleanup(AnimSpriteCel *animSpriteCel) {
 		
-	if (DEBUG_ANIMSPRITECEL_CLEAN == 1) { printf("*AnimSpriteCelCleanup()*\n"); }	
-	
 	// Si le sprite n'existe pas
     if (animSpriteCel == NULL){
 		// Affiche une erreur
@@ -437,6 +1682,23 @@ int32 AnimSpriteCelCleanup(AnimSpriteCel *animSpriteCel) {
 		return -1;	
 	} 
 
+	// Trace ses compteurs et sa fin
+	ANIMSPRITECEL_TRACE_COUNTERS(animSpriteCel);
+	ANIMSPRITECEL_TRACE_EVENT(TRACE_CLEANUP, animSpriteCel, 0);
+
+	// Si il vient d'un pool
+	if (animSpriteCel->pool != NULL) {
+		// Son callback rend la case entière au pool
+		return animSpriteCel->release(animSpriteCel);
+	}
+
+	// Le retire de son système s'il est enregistré, il est gardé si des receveurs compacts seraient redirigés
+	if ((animSpriteCel->system != NULL) && (AnimSpriteCelSystemUnregister(animSpriteCel->system, animSpriteCel) < 0)) {
+		// Retourne une erreur
+		printf("Error <- AnimSpriteCelSystemUnregister()\n");
+		return -1;
+	}
+
 	// Si il y a un Cel
     if (animSpriteCel->cel != NULL) {
 		// Supprime le Cel du sprite
@@ -444,6 +1706,22 @@ int32 AnimSpriteCelCleanup(AnimSpriteCel *animSpriteCel) {
 		animSpriteCel->cel = NULL;
     }
 	
+	// Si les étapes appartiennent à une séquence ou un fichier partagé
+	if (animSpriteCel->release != NULL) {
+		// Son callback abandonne la référence au lieu de les libérer
+		animSpriteCel->release(animSpriteCel);
+		animSpriteCel->release = NULL;
+	}
+	
+	// Si les étapes compactes sont lues dans une table générée
+	if (animSpriteCel->table != NULL) {
+		// Étapes constantes, frames et ligne de temps partagées : rien à libérer
+		animSpriteCel->table = NULL;
+		animSpriteCel->packedSteps = NULL;
+		animSpriteCel->frames = NULL;
+		animSpriteCel->timeline = NULL;
+	}
+	
 	// Si il y a des steps
     if (animSpriteCel->steps != NULL) {
 		// Libère la mémoire utilisée pour le tableau de steps
@@ -451,9 +1729,27 @@ int32 AnimSpriteCelCleanup(AnimSpriteCel *animSpriteCel) {
         animSpriteCel->steps = NULL;
     }
 	
+	// Si il y a des étapes compactes
+	if (animSpriteCel->packedSteps != NULL) {
+		// Libère la mémoire utilisée pour les étapes compactes et les descripteurs de frames
+		FreeMem(animSpriteCel->packedSteps, animSpriteCel->stepsCount * sizeof(AnimSpriteCelPackedStep));
+		animSpriteCel->packedSteps = NULL;
+	}
+	if (animSpriteCel->frames != NULL) {
+		FreeMem(animSpriteCel->frames, animSpriteCel->framesCount * sizeof(AnimSpriteCelFrame));
+		animSpriteCel->frames = NULL;
+	}
+	
+	// Si il y a une ligne de temps
+	if (animSpriteCel->timeline != NULL) {
+		// Libère la mémoire utilisée pour les durées cumulées
+		FreeMem(animSpriteCel->timeline, ((2 * animSpriteCel->stepsCount) - 1) * sizeof(uint32));
+		animSpriteCel->timeline = NULL;
+	}
+	
 	// Libère la mémoire utilisée pour le AnimSpriteCel
-    FreeMem(animSpriteCel, sizeof(AnimSpriteCel));
 	animSpriteCel->spriteCel = NULL;
+    FreeMem(animSpriteCel, sizeof(AnimSpriteCel));
 	
 	// Finalise le nettoyage
 	animSpriteCel = NULL;
@@ -36,16 +36,116 @@
 **
 **  Notes importantes :
 **
-**    - L'affichage du SpriteCel utilisé est directement affecté par l'AnimSpriteCel
-**      car celui-ci modifie la frame courante affichée. Si un SpriteCel doit être affiché
-**      indépendamment, il est conseillé de créer un clone dédié uniquement au AnimSpriteCel.
-**      Une autre solution est de stocker la frame courante durant l'exécution, puis
-**      appeler SpriteCelSetFrame() pour rétablir la bonne position après AnimSpriteCelRun().
+**    - Le descripteur de frame (PRE0, PRE1, SourcePtr) de chaque frame affichée est
+**      résolu à travers le SpriteCel une seule fois, lors de la configuration d'une
+**      étape qui l'affiche, et la frame affichée par le SpriteCel lui est rendue
+**      aussitôt. Les descripteurs sont gardés dans une table indexée par frame,
+**      partagée par toutes les étapes qui affichent la même frame. Un changement
+**      d'étape ne fait alors que copier le descripteur mémorisé dans le CCB : le
+**      SpriteCel utilisé n'est jamais modifié pendant l'animation et peut être affiché
+**      indépendamment. Si les frames du SpriteCel changent, les étapes doivent être
+**      configurées à nouveau.
 **
 **    - Un unique SpriteCel peut être utilisé pour de multiples AnimSpriteCels qui ont leurs 
 **      propres séquences d'animation. Il n'est pas nécessaire de créer autant de SpriteCels
 **      que de AnimSpriteCels.
 **
+**    - En boucle ALTERNATE, l'animation rebondit sur la première et la dernière
+**      étape sans les jouer deux fois (0, 1, 2, 1, 0, 1, ...). Chaque rebond termine
+**      un cycle.
+**
+**    - Le mode de boucle et la disposition des étapes sont fixés par
+**      AnimSpriteCelSetup(), qui choisit le déplacement d'étape et l'affichage
+**      de frame écrits pour eux ("stepMove", "stepDisplay"). Un changement
+**      d'étape ne teste donc plus le mode de boucle ni la disposition.
+**
+**    - L'affichage de frame n'écrit "ccb_PRE0", "ccb_PRE1" et "ccb_SourcePtr"
+**      que lorsque la nouvelle étape montre une autre frame. Une étape qui
+**      répète la frame laisse le CCB intact, et seul un CCB réellement écrit
+**      est marqué comme changé dans un système qui les suit.
+**
+**    - AnimSpriteCelAdvance() rattrape de nombreux cycles d'affichage d'un coup (après
+**      une pause, une image sautée ou une simulation sans affichage). Il donne le même
+**      état qu'autant d'appels à AnimSpriteCelRun(), envoie les déclenchements des
+**      étapes traversées dans l'ordre et n'écrit le CCB qu'une seule fois. Lorsque
+**      aucune étape n'est aléatoire, en attente ou déclenchante, les périodes de
+**      boucle entières sont sautées directement.
+**
+**    - AnimSpriteCelSeek() place l'animation à un cycle d'affichage de sa ligne de
+**      temps, compté depuis l'étape, la direction et les itérations de départ donnés
+**      à AnimSpriteCelInitialization(). L'état est celui atteint après autant d'appels
+**      à AnimSpriteCelRun(). Les durées cumulées d'une période de boucle (aller et
+**      retour en ALTERNATE) sont construites à la première recherche après une
+**      configuration d'étape, puis l'étape est trouvée par recherche dichotomique.
+**      Si une durée est aléatoire ou en attente, la ligne de temps est rejouée depuis
+**      le départ : les durées aléatoires sont tirées à nouveau et une étape en attente
+**      arrête le rejeu. Une recherche n'envoie jamais de déclenchement.
+**
+**    - Les durées aléatoires viennent du générateur matériel de nombres
+**      aléatoires, sauf si AnimSpriteCelRandomSeed() donne à l'AnimSpriteCel
+**      son propre générateur xorshift. Les exécutions tirent alors les mêmes
+**      durées pour la même graine, et AnimSpriteCelSeek() rejoue exactement les
+**      durées tirées depuis la graine. Un AnimSpriteCelSystem peut donner une
+**      graine à tous ses AnimSpriteCels d'un coup.
+**
+**    - AnimSpriteCelSpeed() règle la vitesse de lecture de l'AnimSpriteCel en
+**      virgule fixe 16.16 (0x10000 = 1.0, 0x8000 = demi-vitesse, 0x18000 = 1.5,
+**      0 = en pause), sans toucher à ses étapes. Chaque exécution ajoute la
+**      vitesse à un accumulateur : ses cycles d'affichage entiers sont pris sur
+**      l'étape, la fraction est gardée pour l'exécution suivante. Ni virgule
+**      flottante ni division ne sont utilisées, et à 1.0 l'accumulateur n'est
+**      pas utilisé du tout. Les cycles au-delà de la fin d'une étape sont
+**      reportés sur les suivantes comme le fait AnimSpriteCelAdvance() : une
+**      exécution rapide peut franchir plusieurs étapes, leurs déclenchements
+**      sont envoyés dans l'ordre et le CCB montre la dernière.
+**      AnimSpriteCelAdvance() et AnimSpriteCelSeek() comptent des cycles de
+**      l'animation elle-même, la vitesse ne s'applique pas à eux. La vitesse
+**      est refusée dans un système en ordonnancement WHEEL.
+**
+**    - AnimSpriteCelTimeBaseConfiguration() peut compter les durées des étapes
+**      en MICROSECONDS au lieu de cycles d'affichage (CYCLES, par défaut). Un
+**      tel AnimSpriteCel est exécuté par AnimSpriteCelTimeRun() avec le temps
+**      écoulé depuis sa dernière exécution, sa vitesse ne suit donc plus la
+**      fréquence d'affichage. Une étape de durée fixe dure alors exactement
+**      autant de microsecondes, et le temps qui dépasse la fin d'une étape est
+**      reporté sur la suivante en microsecondes entières : rien n'est arrondi,
+**      il n'y a donc pas de dérive. Les étapes traversées en une exécution
+**      envoient leurs déclenchements dans l'ordre et le CCB est écrit une
+**      seule fois, pour la dernière, comme dans AnimSpriteCelAdvance().
+**      AnimSpriteCelAdvance(), AnimSpriteCelSeek() et les autres fonctions
+**      comptent aussi en microsecondes. Les durées compactes contiennent au
+**      plus 32767 microsecondes. L'unité est refusée sur les étapes partagées
+**      par un AnimSpriteCelSequence, un AnimSpriteCelFile ou un
+**      AnimSpriteCelTable : leur ligne de temps est partagée, toutes les
+**      instances comptent donc en cycles.
+**
+**    - Les longues tables d'étapes (cinématiques) peuvent utiliser la disposition
+**      compacte donnée par AnimSpriteCelPackedInitialization() : 8 octets par
+**      étape (index de frame, durée, index du receveur et ID d'événement sur
+**      16 bits) au lieu de 16, avec la même table de descripteurs de frames.
+**      Le receveur d'une étape compacte est
+**      l'AnimSpriteCel enregistré à cet index du AnimSpriteCelSystem
+**      propriétaire, il n'est donc déclenché qu'une fois l'émetteur enregistré,
+**      et un AnimSpriteCel qu'il pourrait rediriger en décalant le tableau ne
+**      peut pas être désenregistré. Les valeurs qui ne tiennent pas sont refusées par
+**      AnimSpriteCelPackedStepConfiguration(). Toutes les autres fonctions
+**      marchent de la même façon avec les deux dispositions.
+**
+**    - Une étape peut porter un ID d'événement (AnimSpriteCelStepEvent())
+**      pour le jeu : un son, une frame de coup, l'apparition de particules.
+**      Quand l'étape commence, l'AnimSpriteCelSystem dans lequel
+**      l'AnimSpriteCel est enregistré ajoute l'AnimSpriteCel, l'événement et
+**      le tick à son tampon d'événements, que le jeu lit une fois par image
+**      au lieu de scruter "stepIndex". Les étapes franchies par
+**      AnimSpriteCelAdvance() envoient leurs événements dans l'ordre,
+**      AnimSpriteCelSeek() n'en envoie aucun, pas plus qu'un AnimSpriteCel
+**      hors d'un système. Les ID d'événement compacts valent au plus 65535.
+**
+**    - Les changements d'étape, les déclencheurs et les fins de cycle sont
+**      enregistrés sous forme d'événements binaires par AnimSpriteCelTrace
+**      lorsque le jeu est compilé avec ANIMSPRITECEL_TRACE à 1. À 0 (par
+**      défaut), la trace n'ajoute ni code ni champ.
+**
 **    - Lorsqu'un AnimSpriteCel est initialisé, il doit être supprimé avec AnimSpriteCelCleanup().
 **      Le SpriteCel qui lui a été associé doit être supprimé indépendamment.
 **
@@ -53,31 +153,95 @@
 **
 **    AnimSpriteCelStep
 **      - frameIndex : index de la frame du SpriteCel à afficher
-**      - frameDuration : durée d'affichage en cycles (int32)
+**      - frameDuration : durée d'affichage en cycles ou en microsecondes (int32)
 **                        > 1 -> durée fixe
 **                        = 1 -> changement immédiat
 **                        = 0 -> en attente d'un déclenchement
 **                        < 0 -> durée aléatoire (entre 1 et abs(valeur)), pondérée via "range"
 **      - animSpriteCelReceiver : pointeur vers un autre AnimSpriteCel à qui est envoyé un 
 **                                déclenchement de l'étape suivante si il est en attente
+**      - eventId : événement envoyé au système quand l'étape commence (ANIMSPRITECEL_EVENT_NONE = pas d'événement)
+**
+**    AnimSpriteCelPackedStep
+**      - frameIndex : index de la frame du SpriteCel à afficher (uint16)
+**      - frameDuration : durée d'affichage en cycles ou en microsecondes (int16), même sens que ci-dessus
+**      - receiverIndex : index du receveur dans l'AnimSpriteCelSystem propriétaire
+**        (ANIMSPRITECEL_RECEIVER_NONE = pas de receveur)
+**      - eventId : événement envoyé au système quand l'étape commence (uint16), même sens que ci-dessus
+**
+**    AnimSpriteCelFrame
+**      - ccbPRE0, ccbPRE1, ccbSourcePtr : descripteur CCB d'une frame du SpriteCel,
+**        partagé par les étapes qui l'affichent (les deux dispositions)
 **
 **    AnimSpriteCel
 **      - cel : CCB principal animé (copie du SpriteCel)
 **      - spriteCel : référence au SpriteCel source (tableau de frames)
 **      - loop : type de boucle (NORMAL, REVERSE, ALTERNATE)
 **      - range : plage de valeurs utilisée pour l'aléatoire (FULL, HALF, QUARTER)
+**      - stepMove : déplacement d'étape du mode de boucle
+**      - stepDisplay : affichage de frame de la disposition des étapes
 **      - remainingCycles : nombre d'exécutions de AnimSpriteCelRun() avant l'étape suivante
 **      - iterationsCount : nombre de répétitions du cycle (illimité = INFINITE)
 **      - direction : sens de l'animation (1 = en avant, -1 en arrière)
 **      - stepIndex : étape courante dans le tableau "steps"
 **      - stepsCount : nombre total d'étapes dans l'animation
-**      - steps : tableau dynamique de "AnimSpriteCelStep"
+**      - steps : tableau dynamique de "AnimSpriteCelStep" (NULL en disposition compacte)
+**      - packedSteps : tableau dynamique de "AnimSpriteCelPackedStep" (NULL en disposition normale)
+**      - frames : descripteurs des frames des étapes, indexés par frame
+**      - framesCount : nombre de descripteurs de frames
+**      - timeline : durées cumulées des étapes sur une période de boucle (AnimSpriteCelSeek())
+**      - timelineLength : positions d'une période de boucle (0 = durées aléatoires ou en attente)
+**      - timelineDirty : ligne de temps à reconstruire après une configuration d'étape
+**      - originStepIndex, originDirection, originIterations : départ de la ligne de temps
+**      - randomState : état du générateur xorshift (0 = nombres aléatoires matériels)
+**      - originRandomState : état du générateur au départ de la ligne de temps
+**      - speed : vitesse de lecture en virgule fixe 16.16 (ANIMSPRITECEL_SPEED_NORMAL = 1.0)
+**      - speedAccumulator : fraction de cycle d'affichage reportée à l'exécution suivante
+**      - timeBase : unité des durées des étapes (CYCLES, MICROSECONDS)
+**      - pool : AnimSpriteCelPool d'où vient l'animation (ou NULL)
+**      - sequence : AnimSpriteCelSequence partageant ses étapes (ou NULL)
+**      - file : AnimSpriteCelFile contenant ses étapes compactes (ou NULL)
+**      - table : AnimSpriteCelTable contenant ses étapes compactes (ou NULL)
+**      - release : callback installé par le pool, la séquence ou le fichier
+**        d'où vient l'animation, appelé par AnimSpriteCelCleanup() (ou NULL)
+**      - system : AnimSpriteCelSystem dans lequel l'animation est enregistrée (ou NULL)
+**      - systemIndex : position dans le tableau de l'AnimSpriteCelSystem
+**      - expiryTick : tick du système auquel l'étape en cours se termine (ordonnancement WHEEL)
+**      - wheelSlot, wheelPrevious, wheelNext : liens dans la roue temporelle du système
+**      - systemActive : dans l'ensemble actif du système, ou réveillé (ordonnancement ACTIVE)
+**      - stateHash : terme de l'AnimSpriteCel dans l'empreinte d'état du système
+**      - visible : dessiné par la liste d'affichage du système
+**      - drawPrevious, drawNext, drawGroup : liens et groupe dans la liste d'affichage
+**      - traceId : identifiant dans la trace (ANIMSPRITECEL_TRACE à 1)
+**      - traceSteps, traceIdleCycles, traceTriggersSent, traceTriggersReceived :
+**        compteurs de la trace (ANIMSPRITECEL_TRACE à 1)
 **
 **  Fonctions principales :
 **
 **    AnimSpriteCelInitialization()
 **      -> Initialise l'animation, clone le CCB et prépare le tableau des étapes.
 **
+**    AnimSpriteCelSetup()
+**      -> Fonction interne initialisant un AnimSpriteCel dont le CCB, les étapes
+**         et la ligne de temps sont déjà alloués. Elle est appelée par
+**         AnimSpriteCelInitialization(), AnimSpriteCelPoolAcquire() et
+**         AnimSpriteCelSequenceInstance().
+**
+**    AnimSpriteCelFrameResolve()
+**      -> Fonction interne résolvant et mémorisant le descripteur CCB de la
+**         frame affichée par une étape. Elle est appelée par
+**         AnimSpriteCelStepConfiguration() et AnimSpriteCelSequenceStepConfiguration().
+**
+**    AnimSpriteCelFramesReserve()
+**      -> Fonction interne agrandissant une table de descripteurs de frames
+**         jusqu'à un index de frame. Elle est appelée par
+**         AnimSpriteCelStepConfiguration() et AnimSpriteCelSequenceStepConfiguration().
+**
+**    AnimSpriteCelFramesResolve()
+**      -> Fonction interne résolvant les descripteurs CCB des frames du
+**         SpriteCel. Elle est appelée par AnimSpriteCelPackedInitialization(),
+**         AnimSpriteCelFileInstance() et AnimSpriteCelTableInstance().
+**
 **    AnimSpriteCelStepConfiguration()
 **      -> Définit une étape d'animation : frame à afficher, durée associée et
 **         pointeur vers un autre AnimSpriteCel
@@ -85,6 +249,37 @@
 **    AnimSpriteCelStepsConfiguration()
 **      -> Définit plusieurs étapes en une seule passe avec des arguments variadiques.
 **
+**    AnimSpriteCelStepEvent()
+**      -> Définit l'événement qu'une étape envoie au système quand elle
+**         commence, dans l'une ou l'autre disposition.
+**
+**    AnimSpriteCelPackedInitialization()
+**      -> Initialise une animation aux étapes compactes et résout les
+**         descripteurs des frames du SpriteCel.
+**
+**    AnimSpriteCelPackedStepConfiguration()
+**      -> Définit une étape compacte : frame à afficher, durée et index du
+**         receveur dans le système. Refuse les valeurs qui ne tiennent pas.
+**
+**    AnimSpriteCelRandomSeed()
+**      -> Donne à l'AnimSpriteCel son propre générateur aléatoire (0 = matériel)
+**         et tire à nouveau l'étape aléatoire en cours.
+**
+**    AnimSpriteCelSpeed()
+**      -> Règle la vitesse de lecture de l'AnimSpriteCel (virgule fixe 16.16).
+**
+**    AnimSpriteCelSpeedRun()
+**      -> Fonction interne exécutant un cycle d'affichage à une vitesse autre
+**         que 1.0. Elle est appelée par AnimSpriteCelRun() et les visites
+**         d'AnimSpriteCelSystem.
+**
+**    AnimSpriteCelTimeBaseConfiguration()
+**      -> Compte les durées des étapes en cycles d'affichage ou en microsecondes.
+**
+**    AnimSpriteCelTimeRun()
+**      -> Fonction d'évolution d'un AnimSpriteCel compté en microsecondes, avec
+**         le temps écoulé depuis sa dernière exécution.
+**
 **    AnimSpriteCelUpdate()
 **      -> Fonction interne permettant de mettre à jour l'affichage.
 **         Elle est appelée par AnimSpriteCelNextStep() lorsque c'est nécessaire.
@@ -98,12 +293,20 @@
 **      -> Fonction d'évolution à appeler à chaque cycle d'affichage. 
 **         Contrôle le passage à l'étape suivante.
 **
+**    AnimSpriteCelAdvance()
+**      -> Équivaut à un nombre donné d'appels à AnimateSpriteCelRun() à vitesse
+**         normale, en un nombre d'opérations borné par les étapes traversées.
+**
+**    AnimSpriteCelSeek()
+**      -> Place l'animation à un cycle d'affichage de sa ligne de temps.
+**
 **    AnimSpriteCelTrigger()
 **      -> Fonction interne permettant de déclencher l'étape suivante sur un 
 **         autre AnimSpriteCel en attente.
 **
 **    AnimSpriteCelCleanup()
-**      -> Libère la mémoire utilisée par la structure AnimSpriteCel
+**      -> Libère la mémoire utilisée par la structure AnimSpriteCel, ou la rend
+**         à son AnimSpriteCelPool
 **
 ******************************************************************************/
 
@@ -114,11 +317,25 @@
 // SpriteCel
 #include "SpriteCel.h"
 
-// Debug
-#define DEBUG_ANIMSPRITECEL_INIT 0
-#define DEBUG_ANIMSPRITECEL_SETUP 0
-#define DEBUG_ANIMSPRITECEL_FUNCT 0
-#define DEBUG_ANIMSPRITECEL_CLEAN 0
+// Trace (AnimSpriteCelTrace) : 1 = événements et compteurs enregistrés, 0 = aucun code de trace
+#ifndef ANIMSPRITECEL_TRACE
+#define ANIMSPRITECEL_TRACE 0
+#endif
+
+// Index de receveur d'une étape compacte sans receveur
+#define ANIMSPRITECEL_RECEIVER_NONE 0xFFFF
+
+// ID d'événement d'une étape sans événement
+#define ANIMSPRITECEL_EVENT_NONE 0
+
+// Vitesses de lecture en virgule fixe 16.16
+#define ANIMSPRITECEL_SPEED_NORMAL 0x00010000
+#define ANIMSPRITECEL_SPEED_MAX 0x01000000
+
+// Durée d'une étape dans l'une ou l'autre disposition
+#define ANIMSPRITECEL_STEP_DURATION(animSpriteCel, index) (((animSpriteCel)->packedSteps != NULL) ? (int32)(animSpriteCel)->packedSteps[(index)].frameDuration : (animSpriteCel)->steps[(index)].frameDuration)
+// Événement d'une étape dans l'une ou l'autre disposition
+#define ANIMSPRITECEL_STEP_EVENT(animSpriteCel, index) (((animSpriteCel)->packedSteps != NULL) ? (uint32)(animSpriteCel)->packedSteps[(index)].eventId : (animSpriteCel)->steps[(index)].eventId)
 
 // Enumération des types de zones interactives
 typedef enum {
@@ -140,7 +357,20 @@ typedef enum {
     QUARTER
 } AnimSpriteCelRange;
 
+// Unité des durées des étapes
+typedef enum {
+	// Durées en cycles d'affichage, un par AnimSpriteCelRun()
+	CYCLES,
+	// Durées en microsecondes, données à AnimSpriteCelTimeRun()
+	MICROSECONDS
+} AnimSpriteCelTimeBase;
+
 typedef struct AnimSpriteCel AnimSpriteCel;
+typedef struct AnimSpriteCelSystem AnimSpriteCelSystem;
+typedef struct AnimSpriteCelPool AnimSpriteCelPool;
+typedef struct AnimSpriteCelSequence AnimSpriteCelSequence;
+typedef struct AnimSpriteCelFile AnimSpriteCelFile;
+typedef struct AnimSpriteCelTable AnimSpriteCelTable;
 
 typedef struct {
 	// Frame affichée
@@ -150,9 +380,29 @@ typedef struct {
 	int32 frameDuration;
 	// AnimSpriteCel vers lequel envoyé un déclenchement
     AnimSpriteCel *animSpriteCelReceiver;
-	// Type de boucle d'animation
+	// Événement envoyé au système quand l'étape commence (ANIMSPRITECEL_EVENT_NONE = pas d'événement)
+	uint32 eventId;
 } AnimSpriteCelStep;
 
+typedef struct {
+	// Frame affichée
+	uint16 frameIndex;
+	// Durée de la frame
+	// (Une valeur négative correspond à une valeur aléatoire)
+	int16 frameDuration;
+	// Index dans le système propriétaire de l'AnimSpriteCel vers lequel envoyer un déclenchement
+	uint16 receiverIndex;
+	// Événement envoyé au système quand l'étape commence (ANIMSPRITECEL_EVENT_NONE = pas d'événement)
+	uint16 eventId;
+} AnimSpriteCelPackedStep;
+
+typedef struct {
+	// Descripteur de frame CCB (résolu à la configuration)
+	uint32 ccbPRE0;
+	uint32 ccbPRE1;
+	CelData *ccbSourcePtr;
+} AnimSpriteCelFrame;
+
 struct AnimSpriteCel {
 	// CCB principal du sprite animé
 	CCB *cel;
@@ -162,6 +412,10 @@ struct AnimSpriteCel {
 	AnimSpriteCelLoop loop;
 	// Plage de valeurs de l'aléatoire
 	AnimSpriteCelRange range;
+	// Déplacement d'étape du mode de boucle, renvoie 1 en fin de cycle
+	uint32 (*stepMove)(AnimSpriteCel *animSpriteCel);
+	// Affichage de frame de la disposition des étapes, renvoie 1 si le CCB a changé
+	uint32 (*stepDisplay)(AnimSpriteCel *animSpriteCel);
 	// Nombre de cycles restants avant le changement
 	uint32 remainingCycles;
 	// Répétitions du cycle d'animation
@@ -174,23 +428,123 @@ struct AnimSpriteCel {
     uint32 stepsCount;
 	// Tableau d'étapes
     AnimSpriteCelStep *steps;
+	// Tableau d'étapes compactes (disposition compacte)
+	AnimSpriteCelPackedStep *packedSteps;
+	// Descripteurs des frames des étapes, indexés par frame
+	AnimSpriteCelFrame *frames;
+	// Nombre de descripteurs de frames
+	uint32 framesCount;
+	// Durées cumulées des étapes sur une période de boucle
+	uint32 *timeline;
+	// Nombre de positions d'une période de boucle (0 si une durée est aléatoire ou en attente)
+	uint32 timelineLength;
+	// Ligne de temps à reconstruire après une configuration d'étape
+	uint32 timelineDirty;
+	// Étape, direction et itérations de départ de la ligne de temps
+	int32 originStepIndex;
+	int32 originDirection;
+	uint32 originIterations;
+	// État du générateur xorshift (0 = nombres aléatoires matériels)
+	uint32 randomState;
+	// État du générateur au départ de la ligne de temps
+	uint32 originRandomState;
+	// Vitesse de lecture en virgule fixe 16.16 (0x10000 = 1.0)
+	uint32 speed;
+	// Fraction de cycle d'affichage reportée à l'exécution suivante
+	uint32 speedAccumulator;
+	// Unité des durées des étapes
+	AnimSpriteCelTimeBase timeBase;
+	// Pool d'où vient l'AnimSpriteCel (NULL si alloué seul)
+	AnimSpriteCelPool *pool;
+	// Séquence partagée contenant les étapes (NULL si les étapes lui sont propres)
+	AnimSpriteCelSequence *sequence;
+	// Fichier d'animation contenant les étapes compactes (NULL si les étapes lui sont propres)
+	AnimSpriteCelFile *file;
+	// Table générée contenant les étapes compactes (NULL si les étapes lui sont propres)
+	AnimSpriteCelTable *table;
+	// Rend ce que le pool, la séquence ou le fichier a prêté (NULL si rien n'a été prêté)
+	int32 (*release)(AnimSpriteCel *animSpriteCel);
+	// Système propriétaire (NULL si non enregistré)
+	AnimSpriteCelSystem *system;
+	// Index dans le système propriétaire
+	uint32 systemIndex;
+	// Tick du système auquel l'étape en cours se termine
+	uint32 expiryTick;
+	// Case de la roue temporelle contenant l'AnimSpriteCel (NULL si non planifié)
+	AnimSpriteCel **wheelSlot;
+	// AnimSpriteCel précédent dans la case (la tête pointe vers la queue)
+	AnimSpriteCel *wheelPrevious;
+	// AnimSpriteCel suivant dans la case
+	AnimSpriteCel *wheelNext;
+	// Dans l'ensemble actif du système, ou réveillé pour le rejoindre (ordonnancement ACTIVE)
+	uint32 systemActive;
+	// Terme de l'AnimSpriteCel dans l'empreinte d'état du système
+	uint32 stateHash;
+	// Dessiné par la liste d'affichage du système
+	uint32 visible;
+	// AnimSpriteCels précédent et suivant dans la liste d'affichage
+	AnimSpriteCel *drawPrevious;
+	AnimSpriteCel *drawNext;
+	// Groupe de la liste d'affichage (SOURCE_ORDER)
+	uint32 drawGroup;
+#if ANIMSPRITECEL_TRACE == 1
+	// Identifiant dans la trace
+	uint32 traceId;
+	// Étapes avancées
+	uint32 traceSteps;
+	// Cycles d'affichage passés sur les étapes avant de les quitter
+	uint32 traceIdleCycles;
+	// Déclencheurs envoyés et reçus
+	uint32 traceTriggersSent;
+	uint32 traceTriggersReceived;
+#endif
 };
 
 // Référence au contexte global
 extern AnimSpriteCel animSpriteCel;
 
+// Résout et mémorise le descripteur CCB d'une frame du SpriteCel
+void AnimSpriteCelFrameResolve(SpriteCel *spriteCel, AnimSpriteCelFrame *frames, uint32 frameIndex);
+// Agrandit une table de descripteurs de frames pour contenir un index de frame
+int32 AnimSpriteCelFramesReserve(AnimSpriteCelFrame **frames, uint32 *framesCount, uint32 frameIndex);
+// Résout les descripteurs de frame CCB des frames du SpriteCel
+void AnimSpriteCelFramesResolve(SpriteCel *spriteCel, AnimSpriteCelFrame *frames, uint32 framesCount);
+// Initialisation d'un AnimSpriteCel dont le CCB, les étapes et la ligne de temps sont déjà alloués
+void AnimSpriteCelSetup(AnimSpriteCel *animSpriteCel, SpriteCel *spriteCel, AnimSpriteCelLoop loop, AnimSpriteCelRange range, uint32 iterations, int32 direction, uint32 stepIndex, uint32 stepsCount);
 // Initialisation d'un AnimSpriteCel
 AnimSpriteCel *AnimSpriteCelInitialization(SpriteCel *spriteCel, AnimSpriteCelLoop loop, AnimSpriteCelRange range, uint32 iterations, int32 direction, uint32 stepIndex, uint32 stepsCount);
 // Configuration d'une étape d'un AnimSpriteCel
 int32 AnimSpriteCelStepConfiguration(AnimSpriteCel *animSpriteCel, uint32 stepIndex, uint32 frameIndex, int32 frameDuration, AnimSpriteCel *animSpriteCelReceiver);
 // Configuration des étapes d'un AnimSpriteCel
 int32 AnimSpriteCelStepsConfiguration(AnimSpriteCel *spriteCel, int32 start, ...);
+// Définit l'événement qu'une étape envoie au système quand elle commence
+int32 AnimSpriteCelStepEvent(AnimSpriteCel *animSpriteCel, uint32 stepIndex, uint32 eventId);
+// Initialisation d'un AnimSpriteCel aux étapes compactes
+AnimSpriteCel *AnimSpriteCelPackedInitialization(SpriteCel *spriteCel, AnimSpriteCelLoop loop, AnimSpriteCelRange range, uint32 iterations, int32 direction, uint32 stepIndex, uint32 stepsCount, uint32 framesCount);
+// Configuration d'une étape compacte d'un AnimSpriteCel
+int32 AnimSpriteCelPackedStepConfiguration(AnimSpriteCel *animSpriteCel, uint32 stepIndex, uint32 frameIndex, int32 frameDuration, uint32 receiverIndex);
+// Donne à l'AnimSpriteCel son propre générateur aléatoire
+int32 AnimSpriteCelRandomSeed(AnimSpriteCel *animSpriteCel, uint32 seed);
+// Règle la vitesse de lecture de l'AnimSpriteCel
+int32 AnimSpriteCelSpeed(AnimSpriteCel *animSpriteCel, uint32 speed);
+// Règle l'unité des durées des étapes
+int32 AnimSpriteCelTimeBaseConfiguration(AnimSpriteCel *animSpriteCel, AnimSpriteCelTimeBase timeBase);
+// Donne le receveur d'une étape dans l'une ou l'autre disposition (NULL si aucun)
+AnimSpriteCel *AnimSpriteCelStepReceiver(AnimSpriteCel *animSpriteCel, uint32 stepIndex);
 // Mets à jour l'affichage d'un AnimSpriteCel
 void AnimSpriteCelUpdate(AnimSpriteCel *animSpriteCel);
 // Passe à l'étape suivante de l'animation
 void AnimSpriteCelNextStep(AnimSpriteCel *animSpriteCel);
 // Exécution de l'animation
 void AnimSpriteCelRun(AnimSpriteCel *animSpriteCel);
+// Exécute un cycle d'affichage à la vitesse de l'animation
+void AnimSpriteCelSpeedRun(AnimSpriteCel *animSpriteCel);
+// Exécute l'animation pendant le temps écoulé depuis sa dernière exécution
+void AnimSpriteCelTimeRun(AnimSpriteCel *animSpriteCel, uint32 elapsedMicroseconds);
+// Rattrape un nombre de cycles d'affichage
+void AnimSpriteCelAdvance(AnimSpriteCel *animSpriteCel, uint32 elapsedCycles);
+// Place l'animation à un cycle d'affichage de sa ligne de temps
+int32 AnimSpriteCelSeek(AnimSpriteCel *animSpriteCel, uint32 tick);
 // Déclencheur de l'animation en attente
 void AnimSpriteCelTrigger(AnimSpriteCel *animSpriteCel);
 // Supprime le AnimSpriteCel
@@ -0,0 +1,373 @@
+/******************************************************************************
+**
+**  AnimSpriteCelBenchmark - Débit d'AnimSpriteCelRun() (programme hôte)
+**
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 17-10-2026
+**
+**  Mesure AnimSpriteCel sur un ordinateur de développement, avec les
+**  remplacements du répertoire Host à la place du SDK 3DO. Construit et
+**  exécuté depuis ce répertoire :
+**
+**    gcc -O2 -pthread -I Host -I . -o AnimSpriteCelBenchmark AnimSpriteCelBenchmark.c
+**        AnimSpriteCel.c AnimSpriteCelSystem.c AnimSpriteCelPool.c
+**        AnimSpriteCelSequence.c AnimSpriteCelFile.c AnimSpriteCelTable.c
+**        AnimSpriteCelTrace.c AnimSpriteCelParallel.c Mathematical.c Host/Host.c
+**    ./AnimSpriteCelBenchmark [nombre maximal d'animations] [nombre maximal de travailleurs]
+**
+**  Ajouter -DANIMSPRITECEL_TRACE=1 mesure les mêmes exécutions avec
+**  l'enregistrement de la trace (tampon circulaire de 65 536 événements).
+**  Chaque scénario crée 1 000, 100 000 et 1 000 000 d'animations de 4 étapes
+**  (jusqu'au maximum donné) et appelle AnimSpriteCelRun() sur chacune pendant
+**  un nombre de ticks (10 000 000 d'exécutions par mesure). Il affiche :
+**
+**    - ns/anim/tick : durée d'un appel à AnimSpriteCelRun()
+**    - allocs/anim, bytes/anim : appels à AllocMem() et octets par animation
+**    - events/anim/tick : événements de trace enregistrés par exécution (0 sans trace)
+**
+**  Scénarios :
+**
+**    - NORMAL, REVERSE, ALTERNATE : durées fixes (2, 3, 1, 4)
+**    - random : durées aléatoires (-4, -6, -2, -8), plage FULL
+**    - packed : NORMAL avec durées fixes en disposition compacte
+**    - trigger chain : groupes de 8 animations, la première change d'étape à
+**      chaque tick et chaque changement d'étape déclenche l'animation suivante
+**      du groupe, dont les étapes attendent un déclenchement (8 changements
+**      d'étape par groupe)
+**    - speed 1.5 : NORMAL avec durées fixes, joué à la vitesse 0x18000
+**
+**  Les chaînes de déclenchements du plus grand nombre d'animations sont
+**  ensuite enregistrées dans un système en distribution SAME_TICK et
+**  exécutées pendant 100 ticks avec AnimSpriteCelSystemRun(), en
+**  ordonnancement POLLING et ACTIVE. Les suiveurs des chaînes ne font
+**  qu'attendre, l'ensemble actif contient donc une animation sur 8.
+**
+**  Avec un nombre maximal de travailleurs, l'exécution POLLING est ensuite
+**  répétée avec AnimSpriteCelParallelRun() sur 1, 2, 4... travailleurs
+**  (partitions de 4 096 AnimSpriteCels). Chaque exécution affiche sa durée
+**  réelle par animation et par tick, son accélération par rapport à
+**  l'exécution POLLING d'AnimSpriteCelSystemRun(), et si ses états finaux
+**  sont les mêmes. L'accélération des travailleurs est limitée par les cœurs
+**  de l'ordinateur.
+**
+**  Les durées mesurées sur l'hôte ne servent qu'à comparer des versions du
+**  code entre elles : l'ARM60 de la 3DO n'a pas de cache et une mémoire bien
+**  plus lente, les valeurs absolues diffèrent donc.
+**
+******************************************************************************/
+
+// printf()
+#include <stdio.h>
+// malloc(), free(), atol()
+#include <stdlib.h>
+// memset()
+#include <string.h>
+// clock(), clock_gettime()
+#include <time.h>
+
+// AnimSpriteCel
+#include "AnimSpriteCel.h"
+// AnimSpriteCelSystemInitialization(), AnimSpriteCelSystemRun()
+#include "AnimSpriteCelSystem.h"
+// AnimSpriteCelParallelInitialization(), AnimSpriteCelParallelRun()
+#include "AnimSpriteCelParallel.h"
+// INFINITE
+#include "DefinitionsArguments.h"
+// AnimSpriteCelTraceInitialization(), animSpriteCelTrace
+#include "AnimSpriteCelTrace.h"
+// hostAllocationsCount, hostAllocatedBytes
+#include "mem.h"
+
+// Exécutions par mesure
+#define BENCHMARK_RUNS 10000000UL
+// Étapes de chaque animation
+#define BENCHMARK_STEPS 4
+// Frames du SpriteCel
+#define BENCHMARK_FRAMES 8
+// Animations par chaîne de déclenchements
+#define BENCHMARK_CHAIN 8
+// Événements du tampon circulaire de la trace
+#define BENCHMARK_TRACE_EVENTS 65536
+// AnimSpriteCels par partition des exécutions parallèles
+#define BENCHMARK_PARTITION 4096
+// Ticks des exécutions du système
+#define BENCHMARK_SYSTEM_TICKS 100
+
+// Scénario du banc d'essai
+typedef struct {
+	// Nom affiché
+	const char *name;
+	// Type de boucle d'animation
+	AnimSpriteCelLoop loop;
+	// Durées des étapes
+	int32 durations[BENCHMARK_STEPS];
+	// Disposition compacte
+	int packed;
+	// Chaînes de déclenchements
+	int chain;
+	// Vitesse de lecture (virgule fixe 16.16)
+	uint32 speed;
+} BenchmarkScenario;
+
+static const BenchmarkScenario benchmarkScenarios[] = {
+	{ "NORMAL",        NORMAL,    {  2,  3,  1,  4 }, 0, 0, ANIMSPRITECEL_SPEED_NORMAL },
+	{ "REVERSE",       REVERSE,   {  2,  3,  1,  4 }, 0, 0, ANIMSPRITECEL_SPEED_NORMAL },
+	{ "ALTERNATE",     ALTERNATE, {  2,  3,  1,  4 }, 0, 0, ANIMSPRITECEL_SPEED_NORMAL },
+	{ "random",        NORMAL,    { -4, -6, -2, -8 }, 0, 0, ANIMSPRITECEL_SPEED_NORMAL },
+	{ "packed",        NORMAL,    {  2,  3,  1,  4 }, 1, 0, ANIMSPRITECEL_SPEED_NORMAL },
+	{ "trigger chain", NORMAL,    {  1,  1,  1,  1 }, 0, 1, ANIMSPRITECEL_SPEED_NORMAL },
+	{ "speed 1.5",     NORMAL,    {  2,  3,  1,  4 }, 0, 0, 0x00018000 }
+};
+
+// Crée les animations d'un scénario, retourne 0 en cas d'erreur
+static int BenchmarkCreate(const BenchmarkScenario *scenario, SpriteCel *spriteCel, AnimSpriteCel **animSpriteCels, unsigned long count) {
+
+	// Index d'animation et d'étape
+	unsigned long index = 0;
+	uint32 stepIndex = 0;
+	// Durée et receveur d'une étape
+	int32 frameDuration = 0;
+	AnimSpriteCel *animSpriteCelReceiver = NULL;
+
+	for (index = 0; index < count; index++) {
+		if (scenario->packed == 1) {
+			animSpriteCels[index] = AnimSpriteCelPackedInitialization(spriteCel, scenario->loop, FULL, INFINITE, 1, 0, BENCHMARK_STEPS, BENCHMARK_FRAMES);
+		} else {
+			animSpriteCels[index] = AnimSpriteCelInitialization(spriteCel, scenario->loop, FULL, INFINITE, 1, 0, BENCHMARK_STEPS);
+		}
+		if (animSpriteCels[index] == NULL) {
+			printf("Error : %lu animations can't be created.\n", count);
+			return 0;
+		}
+	}
+
+	for (index = 0; index < count; index++) {
+		for (stepIndex = 0; stepIndex < BENCHMARK_STEPS; stepIndex++) {
+
+			frameDuration = scenario->durations[stepIndex];
+			animSpriteCelReceiver = NULL;
+
+			// Dans une chaîne, les suivantes attendent et chaque étape déclenche l'animation suivante
+			if (scenario->chain == 1) {
+				frameDuration = ((index % BENCHMARK_CHAIN) == 0) ? frameDuration : 0;
+				if (((index % BENCHMARK_CHAIN) != BENCHMARK_CHAIN - 1) && (index + 1 < count)) {
+					animSpriteCelReceiver = animSpriteCels[index + 1];
+				}
+			}
+
+			if (scenario->packed == 1) {
+				AnimSpriteCelPackedStepConfiguration(animSpriteCels[index], stepIndex, stepIndex * 2, frameDuration, ANIMSPRITECEL_RECEIVER_NONE);
+			} else {
+				AnimSpriteCelStepConfiguration(animSpriteCels[index], stepIndex, stepIndex * 2, frameDuration, animSpriteCelReceiver);
+			}
+		}
+		// Affiche l'étape de départ avec sa durée, à la vitesse du scénario
+		AnimSpriteCelUpdate(animSpriteCels[index]);
+		AnimSpriteCelSpeed(animSpriteCels[index], scenario->speed);
+	}
+
+	return 1;
+}
+
+// Mesure un scénario avec un nombre donné d'animations
+static void BenchmarkMeasure(const BenchmarkScenario *scenario, SpriteCel *spriteCel, AnimSpriteCel **animSpriteCels, unsigned long count) {
+
+	// Index d'animation et tick
+	unsigned long index = 0;
+	unsigned long tick = 0;
+	unsigned long ticksCount = 0;
+	// Allocations avant la création
+	uint32 allocationsCount = hostAllocationsCount;
+	uint32 allocatedBytes = hostAllocatedBytes;
+	// Durée des exécutions
+	clock_t start = 0;
+	double seconds = 0.0;
+	// Événements de trace avant les exécutions
+	uint32 eventsWritten = 0;
+
+	// Crée et configure les animations
+	if (BenchmarkCreate(scenario, spriteCel, animSpriteCels, count) == 0) {
+		return;
+	}
+	allocationsCount = hostAllocationsCount - allocationsCount;
+	allocatedBytes = hostAllocatedBytes - allocatedBytes;
+
+	// Même nombre d'exécutions quel que soit le nombre d'animations
+	ticksCount = (BENCHMARK_RUNS / count > 0) ? BENCHMARK_RUNS / count : 1;
+
+	eventsWritten = animSpriteCelTrace.eventsWritten;
+	start = clock();
+	for (tick = 0; tick < ticksCount; tick++) {
+		for (index = 0; index < count; index++) {
+			AnimSpriteCelRun(animSpriteCels[index]);
+		}
+	}
+	seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+	eventsWritten = animSpriteCelTrace.eventsWritten - eventsWritten;
+
+	printf("%-14s %10lu %7lu %13.2f %12.1f %11.1f %17.3f\n", scenario->name, count, ticksCount,
+		(seconds * 1.0e9) / ((double)count * (double)ticksCount),
+		(double)allocationsCount / (double)count, (double)allocatedBytes / (double)count,
+		(double)eventsWritten / ((double)count * (double)ticksCount));
+
+	for (index = 0; index < count; index++) {
+		AnimSpriteCelCleanup(animSpriteCels[index]);
+	}
+}
+
+// Exécute les chaînes de déclenchements d'un système seul (sans travailleur) ou sur des travailleurs, donne la durée réelle et une empreinte des états finaux
+static int BenchmarkSystem(SpriteCel *spriteCel, AnimSpriteCel **animSpriteCels, unsigned long count, AnimSpriteCelSchedule schedule, uint32 workersCount, double *seconds, unsigned long *digest) {
+
+	// Index d'animation et tick
+	unsigned long index = 0;
+	unsigned long tick = 0;
+	// Système exécuté et ses travailleurs
+	AnimSpriteCelSystem *animSpriteCelSystem = NULL;
+	AnimSpriteCelParallel *animSpriteCelParallel = NULL;
+	// Durée réelle des exécutions (clock() additionnerait les threads)
+	struct timespec start;
+	struct timespec end;
+
+	// Chaînes de déclenchements livrées dans le même tick, avec graine pour les travailleurs
+	if (BenchmarkCreate(&benchmarkScenarios[5], spriteCel, animSpriteCels, count) == 0) {
+		return 0;
+	}
+	animSpriteCelSystem = AnimSpriteCelSystemInitialization(count, schedule);
+	if (animSpriteCelSystem == NULL) {
+		return 0;
+	}
+	for (index = 0; index < count; index++) {
+		AnimSpriteCelSystemRegister(animSpriteCelSystem, animSpriteCels[index]);
+	}
+	AnimSpriteCelSystemTriggerConfiguration(animSpriteCelSystem, SAME_TICK, count, 0);
+	AnimSpriteCelSystemSeed(animSpriteCelSystem, 1);
+
+	// Travailleurs de l'exécution parallèle
+	if (workersCount > 0) {
+		AnimSpriteCelSystemPartitionConfiguration(animSpriteCelSystem, BENCHMARK_PARTITION);
+		animSpriteCelParallel = AnimSpriteCelParallelInitialization(animSpriteCelSystem, workersCount);
+		if (animSpriteCelParallel == NULL) {
+			AnimSpriteCelSystemCleanup(animSpriteCelSystem);
+			return 0;
+		}
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (tick = 0; tick < BENCHMARK_SYSTEM_TICKS; tick++) {
+		if (animSpriteCelParallel != NULL) {
+			AnimSpriteCelParallelRun(animSpriteCelParallel);
+		} else {
+			AnimSpriteCelSystemRun(animSpriteCelSystem);
+		}
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	*seconds = (double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) * 1.0e-9;
+
+	// Empreinte des états finaux, la même pour chaque exécution
+	*digest = 0;
+	for (index = 0; index < count; index++) {
+		*digest = *digest * 31 + (unsigned long)animSpriteCels[index]->stepIndex * 7 + (unsigned long)animSpriteCels[index]->remainingCycles;
+	}
+
+	// Le système supprime ses AnimSpriteCels
+	if (animSpriteCelParallel != NULL) {
+		AnimSpriteCelParallelCleanup(animSpriteCelParallel);
+	}
+	AnimSpriteCelSystemCleanup(animSpriteCelSystem);
+	return 1;
+}
+
+// Compare l'exécution POLLING d'AnimSpriteCelSystemRun() avec l'exécution ACTIVE, puis avec AnimSpriteCelParallelRun() sur 1, 2, 4... travailleurs
+static void BenchmarkSystems(SpriteCel *spriteCel, AnimSpriteCel **animSpriteCels, unsigned long count, uint32 workersMax) {
+
+	// Nombre de travailleurs
+	uint32 workersCount = 0;
+	// Durée réelle et empreinte de l'exécution sur un thread, puis d'une exécution parallèle
+	double systemSeconds = 0.0;
+	unsigned long systemDigest = 0;
+	double seconds = 0.0;
+	unsigned long digest = 0;
+
+	printf("\n%-14s %10s %7s %13s %8s %7s\n", "run", "animations", "ticks", "ns/anim/tick", "speedup", "states");
+
+	if (BenchmarkSystem(spriteCel, animSpriteCels, count, POLLING, 0, &systemSeconds, &systemDigest) == 0) {
+		return;
+	}
+	printf("%-14s %10lu %7lu %13.2f %8.2f %7s\n", "system POLLING", count, (unsigned long)BENCHMARK_SYSTEM_TICKS,
+		(systemSeconds * 1.0e9) / ((double)count * BENCHMARK_SYSTEM_TICKS), 1.0, "-");
+
+	if (BenchmarkSystem(spriteCel, animSpriteCels, count, ACTIVE, 0, &seconds, &digest) == 0) {
+		return;
+	}
+	printf("%-14s %10lu %7lu %13.2f %8.2f %7s\n", "system ACTIVE", count, (unsigned long)BENCHMARK_SYSTEM_TICKS,
+		(seconds * 1.0e9) / ((double)count * BENCHMARK_SYSTEM_TICKS), systemSeconds / seconds, (digest == systemDigest) ? "same" : "DIFFER");
+
+	for (workersCount = 1; workersCount <= workersMax; workersCount *= 2) {
+		if (BenchmarkSystem(spriteCel, animSpriteCels, count, POLLING, workersCount, &seconds, &digest) == 0) {
+			return;
+		}
+		printf("parallel %-5u %10lu %7lu %13.2f %8.2f %7s\n", workersCount, count, (unsigned long)BENCHMARK_SYSTEM_TICKS,
+			(seconds * 1.0e9) / ((double)count * BENCHMARK_SYSTEM_TICKS), systemSeconds / seconds, (digest == systemDigest) ? "same" : "DIFFER");
+	}
+}
+
+int main(int argc, char *argv[]) {
+
+	// Nombres d'animations mesurés
+	static const unsigned long counts[] = { 1000UL, 100000UL, 1000000UL };
+	unsigned long countIndex = 0;
+	unsigned long countMax = 1000000UL;
+	// Index du scénario
+	unsigned long scenarioIndex = 0;
+	// Sprite sheet partagée par les animations
+	CCB cel;
+	SpriteCel *spriteCel = NULL;
+	// Animations mesurées
+	AnimSpriteCel **animSpriteCels = NULL;
+	// Nombre maximal de travailleurs des exécutions parallèles (0 = pas de mesure)
+	uint32 workersMax = 0;
+
+	// Nombre maximal optionnel d'animations et de travailleurs
+	if (argc > 1) {
+		countMax = (unsigned long)atol(argv[1]);
+	}
+	if (argc > 2) {
+		workersMax = (uint32)atol(argv[2]);
+	}
+
+	memset(&cel, 0, sizeof(CCB));
+	spriteCel = SpriteCelInitialization(&cel, 16, 16, BENCHMARK_FRAMES);
+	animSpriteCels = (AnimSpriteCel **)malloc(countMax * sizeof(AnimSpriteCel *));
+	if ((spriteCel == NULL) || (animSpriteCels == NULL)) {
+		printf("Error : out of memory.\n");
+		return 1;
+	}
+
+	printf("sizeof(AnimSpriteCel) %u, sizeof(AnimSpriteCelStep) %u, sizeof(AnimSpriteCelPackedStep) %u, sizeof(CCB) %u\n\n",
+		(unsigned int)sizeof(AnimSpriteCel), (unsigned int)sizeof(AnimSpriteCelStep), (unsigned int)sizeof(AnimSpriteCelPackedStep), (unsigned int)sizeof(CCB));
+	// Enregistre les exécutions dans une version tracée
+	if ((ANIMSPRITECEL_TRACE == 1) && (AnimSpriteCelTraceInitialization(BENCHMARK_TRACE_EVENTS) < 0)) {
+		return 1;
+	}
+
+	printf("%-14s %10s %7s %13s %12s %11s %17s\n", "scenario", "animations", "ticks", "ns/anim/tick", "allocs/anim", "bytes/anim", "events/anim/tick");
+
+	for (scenarioIndex = 0; scenarioIndex < sizeof(benchmarkScenarios) / sizeof(benchmarkScenarios[0]); scenarioIndex++) {
+		for (countIndex = 0; countIndex < sizeof(counts) / sizeof(counts[0]); countIndex++) {
+			if (counts[countIndex] <= countMax) {
+				BenchmarkMeasure(&benchmarkScenarios[scenarioIndex], spriteCel, animSpriteCels, counts[countIndex]);
+			}
+		}
+	}
+
+	if (ANIMSPRITECEL_TRACE == 1) {
+		AnimSpriteCelTraceCleanup();
+	}
+
+	// Les travailleurs ont besoin de la trace arrêtée
+	BenchmarkSystems(spriteCel, animSpriteCels, countMax, workersMax);
+
+	free(animSpriteCels);
+	SpriteCelCleanup(spriteCel);
+	return 0;
+}
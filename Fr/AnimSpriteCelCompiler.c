@@ -0,0 +1,522 @@
+/******************************************************************************
+**
+**  AnimSpriteCelCompiler - Génère des tables d'étapes constantes (outil hôte)
+**
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 17-10-2026
+**
+**  Étape de construction, exécutée sur l'ordinateur de développement avant de
+**  compiler le jeu. Il se compile avec n'importe quel compilateur C (il
+**  n'utilise pas le SDK 3DO) :
+**
+**    cc -o AnimSpriteCelCompiler AnimSpriteCelCompiler.c
+**    AnimSpriteCelCompiler animations.txt animations.h
+**
+**  L'entrée est un fichier texte avec une commande par ligne :
+**
+**    # commentaire
+**    spritecel name framesCount
+**    animation name spritecel loop range iterations
+**    step frameIndex frameDuration [receiver] [event eventId]
+**
+**    - spritecel : déclare une sprite sheet et son nombre de frames
+**    - loop : NORMAL, REVERSE ou ALTERNATE
+**    - range : FULL, HALF ou QUARTER
+**    - iterations : un nombre ou INFINITE
+**    - les étapes suivent leur animation, au moins deux par animation
+**    - receiver : étiquette de l'animation à déclencher (déclarée avant ou après)
+**    - eventId : événement envoyé au système quand une instance atteint l'étape
+**
+**  Chaque valeur est vérifiée avant toute écriture : index de frame inférieur
+**  au nombre de frames du SpriteCel, durée de -32768 à 32767, étiquette de
+**  receveur connue, ID d'événement jusqu'à 65535. En cas d'erreur, la ligne est signalée et le programme
+**  retourne 1, ce qui arrête la construction.
+**
+**  L'en-tête généré contient, pour chaque animation "name" :
+**
+**    NAME_INDEX            index d'enregistrement dans le système (index de receveur)
+**    nameSteps[]           tableau constant d'AnimSpriteCelPackedStep
+**    nameFrames[]          descripteurs de frames partagés par les instances
+**    nameTimeline[]        durées cumulées partagées par les instances
+**    nameTable             AnimSpriteCelTable donné à AnimSpriteCelTableInstance()
+**
+**  et NAME_FRAMES pour chaque SpriteCel. Les animations doivent être
+**  enregistrées les premières dans le système, dans l'ordre du texte.
+**
+******************************************************************************/
+
+// printf(), fopen()
+#include <stdio.h>
+// malloc(), realloc(), free(), strtol()
+#include <stdlib.h>
+// strcmp(), strtok(), strlen()
+#include <string.h>
+// isalpha(), isalnum(), toupper()
+#include <ctype.h>
+
+// Nom le plus long
+#define COMPILER_NAME_SIZE 64
+// Valeurs d'AnimSpriteCel.h
+#define COMPILER_RECEIVER_NONE 0xFFFFUL
+#define COMPILER_EVENT_MAX 0xFFFFUL
+
+// Sprite sheet déclarée dans le texte
+typedef struct {
+	char name[COMPILER_NAME_SIZE];
+	unsigned long framesCount;
+} CompilerSpriteCel;
+
+// Étape lue dans le texte
+typedef struct {
+	unsigned long frameIndex;
+	long frameDuration;
+	// Étiquette du receveur (vide si aucun) et son index résolu
+	char receiver[COMPILER_NAME_SIZE];
+	unsigned long receiverIndex;
+	// ID d'événement (0 si aucun)
+	unsigned long eventId;
+	unsigned long lineNumber;
+} CompilerStep;
+
+// Animation lue dans le texte
+typedef struct {
+	char name[COMPILER_NAME_SIZE];
+	CompilerSpriteCel *spriteCel;
+	const char *loop;
+	const char *range;
+	unsigned long iterations;
+	unsigned long stepsCount;
+	unsigned long stepsMax;
+	CompilerStep *steps;
+} CompilerAnimation;
+
+// Déclarations lues dans le texte
+static CompilerSpriteCel *compilerSpriteCels = NULL;
+static unsigned long compilerSpriteCelsCount = 0;
+static CompilerAnimation *compilerAnimations = NULL;
+static unsigned long compilerAnimationsCount = 0;
+
+// Lit un nombre non signé, retourne 0 si le mot n'en est pas un
+static int CompilerNumber(char *token, unsigned long *value) {
+
+	// Fin du nombre
+	char *end = NULL;
+
+	// Si le mot est absent
+	if (token == NULL) {
+		return 0;
+	}
+
+	*value = (unsigned long)strtol(token, &end, 0);
+	return ((*end == '\0') && (token[0] != '-')) ? 1 : 0;
+}
+
+// Copie un identifiant C, retourne 0 si le mot n'en est pas un
+static int CompilerName(char *token, char *name) {
+
+	// Index du caractère
+	size_t index = 0;
+
+	// Si le mot est absent, trop long ou ne commence pas comme un identifiant
+	if ((token == NULL) || (strlen(token) >= COMPILER_NAME_SIZE) || ((isalpha((unsigned char)token[0]) == 0) && (token[0] != '_'))) {
+		return 0;
+	}
+
+	for (index = 0; token[index] != '\0'; index++) {
+		if ((isalnum((unsigned char)token[index]) == 0) && (token[index] != '_')) {
+			return 0;
+		}
+	}
+
+	strcpy(name, token);
+	return 1;
+}
+
+// Retourne 1 si un SpriteCel ou une animation porte déjà ce nom
+static int CompilerNameUsed(const char *name) {
+
+	// Index de la déclaration
+	unsigned long index = 0;
+
+	for (index = 0; index < compilerSpriteCelsCount; index++) {
+		if (strcmp(compilerSpriteCels[index].name, name) == 0) { return 1; }
+	}
+	for (index = 0; index < compilerAnimationsCount; index++) {
+		if (strcmp(compilerAnimations[index].name, name) == 0) { return 1; }
+	}
+	return 0;
+}
+
+// Écrit un nom en majuscules, pour les macros
+static void CompilerWriteUpper(FILE *output, const char *name) {
+
+	while (*name != '\0') {
+		fputc(toupper((unsigned char)*name), output);
+		name++;
+	}
+}
+
+// Lit la description texte, retourne 0 en cas d'erreur
+static int CompilerRead(FILE *input) {
+
+	// Ligne du texte
+	char line[256];
+	unsigned long lineNumber = 0;
+	// Mot de la ligne
+	char *token = NULL;
+	// Fin d'un nombre signé
+	char *end = NULL;
+	// Nom lu
+	char name[COMPILER_NAME_SIZE];
+	// Tailles des tables
+	unsigned long spriteCelsMax = 0;
+	unsigned long animationsMax = 0;
+	// Index de la déclaration
+	unsigned long index = 0;
+	// Animation et étape en cours de lecture
+	CompilerAnimation *animation = NULL;
+	CompilerStep *step = NULL;
+
+	while (fgets(line, sizeof(line), input) != NULL) {
+
+		lineNumber++;
+		token = strtok(line, " \t\r\n");
+
+		// Ligne vide ou commentaire
+		if ((token == NULL) || (token[0] == '#')) {
+			continue;
+		}
+
+		// Nouvelle sprite sheet
+		if (strcmp(token, "spritecel") == 0) {
+
+			// Name
+			if ((CompilerName(strtok(NULL, " \t\r\n"), name) == 0) || (CompilerNameUsed(name) == 1)) {
+				printf("Error : line %lu: spritecel needs a new C identifier as name.\n", lineNumber);
+				return 0;
+			}
+
+			// Agrandit la table des sprite sheets
+			if (compilerSpriteCelsCount == spriteCelsMax) {
+				spriteCelsMax = (spriteCelsMax == 0) ? 16 : spriteCelsMax * 2;
+				compilerSpriteCels = (CompilerSpriteCel *)realloc(compilerSpriteCels, (size_t)spriteCelsMax * sizeof(CompilerSpriteCel));
+				if (compilerSpriteCels == NULL) {
+					printf("Error : out of memory.\n");
+					return 0;
+				}
+			}
+			strcpy(compilerSpriteCels[compilerSpriteCelsCount].name, name);
+
+			// Nombre de frames
+			if ((CompilerNumber(strtok(NULL, " \t\r\n"), &compilerSpriteCels[compilerSpriteCelsCount].framesCount) == 0) || (compilerSpriteCels[compilerSpriteCelsCount].framesCount == 0) || (compilerSpriteCels[compilerSpriteCelsCount].framesCount > 0x10000UL)) {
+				printf("Error : line %lu: spritecel needs 1 to 65536 frames.\n", lineNumber);
+				return 0;
+			}
+			compilerSpriteCelsCount++;
+			continue;
+		}
+
+		// Nouvelle animation
+		if (strcmp(token, "animation") == 0) {
+
+			// Name
+			if ((CompilerName(strtok(NULL, " \t\r\n"), name) == 0) || (CompilerNameUsed(name) == 1)) {
+				printf("Error : line %lu: animation needs a new C identifier as name.\n", lineNumber);
+				return 0;
+			}
+
+			// Agrandit la table des animations
+			if (compilerAnimationsCount == animationsMax) {
+				animationsMax = (animationsMax == 0) ? 16 : animationsMax * 2;
+				compilerAnimations = (CompilerAnimation *)realloc(compilerAnimations, (size_t)animationsMax * sizeof(CompilerAnimation));
+				if (compilerAnimations == NULL) {
+					printf("Error : out of memory.\n");
+					return 0;
+				}
+			}
+			animation = &compilerAnimations[compilerAnimationsCount++];
+			memset(animation, 0, sizeof(CompilerAnimation));
+			strcpy(animation->name, name);
+
+			// Sprite sheet, déclarée avant
+			token = strtok(NULL, " \t\r\n");
+			for (index = 0; (token != NULL) && (index < compilerSpriteCelsCount); index++) {
+				if (strcmp(compilerSpriteCels[index].name, token) == 0) {
+					animation->spriteCel = &compilerSpriteCels[index];
+				}
+			}
+			if (animation->spriteCel == NULL) {
+				printf("Error : line %lu: animation needs a declared spritecel.\n", lineNumber);
+				return 0;
+			}
+
+			// Type de boucle d'animation
+			token = strtok(NULL, " \t\r\n");
+			if ((token != NULL) && (strcmp(token, "NORMAL") == 0)) { animation->loop = "NORMAL"; }
+			else if ((token != NULL) && (strcmp(token, "REVERSE") == 0)) { animation->loop = "REVERSE"; }
+			else if ((token != NULL) && (strcmp(token, "ALTERNATE") == 0)) { animation->loop = "ALTERNATE"; }
+			else {
+				printf("Error : line %lu: loop must be NORMAL, REVERSE or ALTERNATE.\n", lineNumber);
+				return 0;
+			}
+
+			// Plage de l'aléatoire
+			token = strtok(NULL, " \t\r\n");
+			if ((token != NULL) && (strcmp(token, "FULL") == 0)) { animation->range = "FULL"; }
+			else if ((token != NULL) && (strcmp(token, "HALF") == 0)) { animation->range = "HALF"; }
+			else if ((token != NULL) && (strcmp(token, "QUARTER") == 0)) { animation->range = "QUARTER"; }
+			else {
+				printf("Error : line %lu: range must be FULL, HALF or QUARTER.\n", lineNumber);
+				return 0;
+			}
+
+			// Itérations (0 représente INFINITE dans la sortie)
+			token = strtok(NULL, " \t\r\n");
+			if ((token != NULL) && (strcmp(token, "INFINITE") == 0)) {
+				animation->iterations = 0;
+			} else if ((CompilerNumber(token, &animation->iterations) == 0) || (animation->iterations == 0) || (animation->iterations >= 2147483647UL)) {
+				printf("Error : line %lu: iterations must be a positive number or INFINITE.\n", lineNumber);
+				return 0;
+			}
+			continue;
+		}
+
+		// Étape de l'animation en cours
+		if (strcmp(token, "step") == 0) {
+
+			// Si aucune animation n'est ouverte
+			if (animation == NULL) {
+				printf("Error : line %lu: step before any animation.\n", lineNumber);
+				return 0;
+			}
+
+			// Agrandit les étapes de l'animation
+			if (animation->stepsCount == animation->stepsMax) {
+				animation->stepsMax = (animation->stepsMax == 0) ? 64 : animation->stepsMax * 2;
+				animation->steps = (CompilerStep *)realloc(animation->steps, (size_t)animation->stepsMax * sizeof(CompilerStep));
+				if (animation->steps == NULL) {
+					printf("Error : out of memory.\n");
+					return 0;
+				}
+			}
+			step = &animation->steps[animation->stepsCount++];
+			step->lineNumber = lineNumber;
+
+			// Frame, vérifiée selon le SpriteCel
+			if ((CompilerNumber(strtok(NULL, " \t\r\n"), &step->frameIndex) == 0) || (step->frameIndex >= animation->spriteCel->framesCount)) {
+				printf("Error : line %lu: frame index must be below %lu (frames of %s).\n", lineNumber, animation->spriteCel->framesCount, animation->spriteCel->name);
+				return 0;
+			}
+
+			// Duration
+			token = strtok(NULL, " \t\r\n");
+			step->frameDuration = (token != NULL) ? strtol(token, &end, 0) : 0;
+			if ((token == NULL) || (*end != '\0') || (step->frameDuration < -32768L) || (step->frameDuration > 32767L)) {
+				printf("Error : line %lu: duration must be from -32768 to 32767.\n", lineNumber);
+				return 0;
+			}
+
+			// Receveur facultatif, résolu une fois toutes les animations déclarées
+			token = strtok(NULL, " \t\r\n");
+			step->receiver[0] = '\0';
+			if ((token != NULL) && (strcmp(token, "event") != 0)) {
+				if (CompilerName(token, step->receiver) == 0) {
+					printf("Error : line %lu: receiver must be an animation label.\n", lineNumber);
+					return 0;
+				}
+				token = strtok(NULL, " \t\r\n");
+			}
+
+			// Événement optionnel
+			step->eventId = 0;
+			if ((token != NULL) && ((strcmp(token, "event") != 0) || (CompilerNumber(strtok(NULL, " \t\r\n"), &step->eventId) == 0) || (step->eventId > COMPILER_EVENT_MAX))) {
+				printf("Error : line %lu: event ID must be from 0 to 65535.\n", lineNumber);
+				return 0;
+			}
+			continue;
+		}
+
+		// Commande inconnue
+		printf("Error : line %lu: unknown command %s.\n", lineNumber, token);
+		return 0;
+	}
+
+	// Retourne un succès
+	return 1;
+}
+
+// Vérifie les animations et résout les étiquettes des receveurs, retourne 0 en cas d'erreur
+static int CompilerResolve(void) {
+
+	// Index d'animation, d'étape et de receveur
+	unsigned long animationIndex = 0;
+	unsigned long stepIndex = 0;
+	unsigned long receiverIndex = 0;
+	// Étape en cours de résolution
+	CompilerStep *step = NULL;
+
+	// Si les index de receveur ne tiennent pas dans une étape compacte
+	if ((compilerAnimationsCount == 0) || (compilerAnimationsCount >= COMPILER_RECEIVER_NONE)) {
+		printf("Error : 1 to 65534 animations needed.\n");
+		return 0;
+	}
+
+	for (animationIndex = 0; animationIndex < compilerAnimationsCount; animationIndex++) {
+
+		// Chaque animation a besoin de deux étapes
+		if (compilerAnimations[animationIndex].stepsCount < 2) {
+			printf("Error : animation %s needs at least two steps.\n", compilerAnimations[animationIndex].name);
+			return 0;
+		}
+
+		for (stepIndex = 0; stepIndex < compilerAnimations[animationIndex].stepsCount; stepIndex++) {
+
+			step = &compilerAnimations[animationIndex].steps[stepIndex];
+			step->receiverIndex = COMPILER_RECEIVER_NONE;
+
+			// Étape sans receveur
+			if (step->receiver[0] == '\0') {
+				continue;
+			}
+
+			// Le receveur est l'animation portant cette étiquette
+			for (receiverIndex = 0; receiverIndex < compilerAnimationsCount; receiverIndex++) {
+				if (strcmp(compilerAnimations[receiverIndex].name, step->receiver) == 0) {
+					step->receiverIndex = receiverIndex;
+				}
+			}
+
+			// Si aucune animation ne porte l'étiquette
+			if (step->receiverIndex == COMPILER_RECEIVER_NONE) {
+				printf("Error : line %lu: unknown receiver %s.\n", step->lineNumber, step->receiver);
+				return 0;
+			}
+		}
+	}
+
+	// Retourne un succès
+	return 1;
+}
+
+// Écrit l'en-tête généré
+static void CompilerWrite(FILE *output, const char *inputName) {
+
+	// Index de déclaration et d'étape
+	unsigned long index = 0;
+	unsigned long stepIndex = 0;
+	// Animation en cours d'écriture
+	CompilerAnimation *animation = NULL;
+	CompilerStep *step = NULL;
+
+	fprintf(output, "// Generated by AnimSpriteCelCompiler from %s: do not edit\n", inputName);
+	fprintf(output, "// Defines data: include it in a single C file\n\n");
+	fprintf(output, "// AnimSpriteCelTable, AnimSpriteCelPackedStep\n#include \"AnimSpriteCelTable.h\"\n");
+	fprintf(output, "// INFINITE\n#include \"DefinitionsArguments.h\"\n\n");
+
+	// Frames de chaque SpriteCel
+	fprintf(output, "// Frames of each SpriteCel\n");
+	for (index = 0; index < compilerSpriteCelsCount; index++) {
+		fprintf(output, "#define ");
+		CompilerWriteUpper(output, compilerSpriteCels[index].name);
+		fprintf(output, "_FRAMES %lu\n", compilerSpriteCels[index].framesCount);
+	}
+
+	// Index d'enregistrement de chaque animation
+	fprintf(output, "\n// Registration index of each animation in the system\n");
+	for (index = 0; index < compilerAnimationsCount; index++) {
+		fprintf(output, "#define ");
+		CompilerWriteUpper(output, compilerAnimations[index].name);
+		fprintf(output, "_INDEX %lu\n", index);
+	}
+
+	// Étapes, données partagées et table de chaque animation
+	for (index = 0; index < compilerAnimationsCount; index++) {
+
+		animation = &compilerAnimations[index];
+
+		fprintf(output, "\n// %s: %lu steps of %s\n", animation->name, animation->stepsCount, animation->spriteCel->name);
+		fprintf(output, "static const AnimSpriteCelPackedStep %sSteps[%lu] = {\n", animation->name, animation->stepsCount);
+		for (stepIndex = 0; stepIndex < animation->stepsCount; stepIndex++) {
+			step = &animation->steps[stepIndex];
+			fprintf(output, "    { %lu, %ld, ", step->frameIndex, step->frameDuration);
+			if (step->receiverIndex == COMPILER_RECEIVER_NONE) {
+				fprintf(output, "ANIMSPRITECEL_RECEIVER_NONE");
+			} else {
+				CompilerWriteUpper(output, step->receiver);
+				fprintf(output, "_INDEX");
+			}
+			if (step->eventId == 0) {
+				fprintf(output, ", ANIMSPRITECEL_EVENT_NONE");
+			} else {
+				fprintf(output, ", %lu", step->eventId);
+			}
+			fprintf(output, " }%s\n", (stepIndex + 1 < animation->stepsCount) ? "," : "");
+		}
+		fprintf(output, "};\n");
+
+		// Descripteurs de frames et durées cumulées partagés (jusqu'à 2 * stepsCount - 2 positions en ALTERNATE)
+		fprintf(output, "static AnimSpriteCelFrame %sFrames[", animation->name);
+		CompilerWriteUpper(output, animation->spriteCel->name);
+		fprintf(output, "_FRAMES];\n");
+		fprintf(output, "static uint32 %sTimeline[%lu];\n", animation->name, (2 * animation->stepsCount) - 1);
+
+		// Table
+		fprintf(output, "static AnimSpriteCelTable %sTable = { %sSteps, %lu, ", animation->name, animation->name, animation->stepsCount);
+		CompilerWriteUpper(output, animation->spriteCel->name);
+		fprintf(output, "_FRAMES, %s, %s, ", animation->loop, animation->range);
+		if (animation->iterations == 0) {
+			fprintf(output, "INFINITE");
+		} else {
+			fprintf(output, "%lu", animation->iterations);
+		}
+		fprintf(output, ", %sFrames, %sTimeline, NULL };\n", animation->name, animation->name);
+	}
+}
+
+int main(int argc, char *argv[]) {
+
+	// Files
+	FILE *input = NULL;
+	FILE *output = NULL;
+	// Index de l'animation
+	unsigned long index = 0;
+	// Résultat de la lecture
+	int read = 0;
+
+	// Si les fichiers sont absents
+	if (argc != 3) {
+		printf("Usage: AnimSpriteCelCompiler input.txt output.h\n");
+		return 1;
+	}
+
+	// Lit et vérifie la description texte
+	input = fopen(argv[1], "r");
+	if (input == NULL) {
+		printf("Error : can't open %s.\n", argv[1]);
+		return 1;
+	}
+	read = CompilerRead(input);
+	fclose(input);
+	if ((read == 0) || (CompilerResolve() == 0)) {
+		printf("Error : %s not written.\n", argv[2]);
+		return 1;
+	}
+
+	// N'écrit l'en-tête qu'une fois tout validé
+	output = fopen(argv[2], "w");
+	if (output == NULL) {
+		printf("Error : can't create %s.\n", argv[2]);
+		return 1;
+	}
+	CompilerWrite(output, argv[1]);
+	fclose(output);
+
+	printf("%lu animations written to %s.\n", compilerAnimationsCount, argv[2]);
+
+	for (index = 0; index < compilerAnimationsCount; index++) {
+		free(compilerAnimations[index].steps);
+	}
+	free(compilerAnimations);
+	free(compilerSpriteCels);
+	return 0;
+}
@@ -0,0 +1,312 @@
+#include "AnimSpriteCelFile.h"
+
+// AllocMem(), FreeMem(), MEMTYPE_DRAM
+#include "mem.h"
+// CloneCel()
+#include "celutils.h"
+// LoadFile(), UnloadFile()
+#include "utils3do.h"
+// memset()
+#include "string.h"
+// printf()
+#include "stdio.h"
+
+// Vérifie l'en-tête et la table des séquences d'un fichier chargé
+static int32 AnimSpriteCelFileCheck(uint8 *buffer, int32 bufferSize) {
+
+	// En-tête du fichier
+	AnimSpriteCelFileHeader *header = (AnimSpriteCelFileHeader *)buffer;
+	// Table des séquences du fichier
+	AnimSpriteCelFileSequence *sequences = (AnimSpriteCelFileSequence *)(header + 1);
+	// Index de la séquence
+	uint32 sequenceIndex = 0;
+
+	// Si le fichier ne peut pas contenir d'en-tête
+	if (bufferSize < (int32)sizeof(AnimSpriteCelFileHeader)) {
+		printf("Error : AnimSpriteCelFile too short.\n");
+		return -1;
+	}
+
+	// Si le fichier n'est pas un fichier d'animation
+	if (header->magic != ANIMSPRITECELFILE_MAGIC) {
+		// Écrit pour une cible de l'autre ordre des octets
+		if (header->magic == 0x4D494E41) {
+			printf("Error : AnimSpriteCelFile written in the wrong byte order.\n");
+		} else {
+			printf("Error : Not an AnimSpriteCelFile.\n");
+		}
+		return -1;
+	}
+
+	// Si la disposition n'est pas celle de ce code
+	if (header->version != ANIMSPRITECELFILE_VERSION) {
+		printf("Error : AnimSpriteCelFile version %u unsupported (expected %u).\n", header->version, ANIMSPRITECELFILE_VERSION);
+		return -1;
+	}
+
+	// Si les étapes compactes ne correspondent pas à la structure de la cible
+	if (header->stepSize != sizeof(AnimSpriteCelPackedStep)) {
+		printf("Error : AnimSpriteCelFile steps of %u bytes (expected %u).\n", header->stepSize, (uint32)sizeof(AnimSpriteCelPackedStep));
+		return -1;
+	}
+
+	// Si la table des séquences est vide ou dépasse du fichier
+	if ((header->sequencesCount == 0) || (header->sequencesCount > ((uint32)bufferSize - sizeof(AnimSpriteCelFileHeader)) / sizeof(AnimSpriteCelFileSequence))) {
+		printf("Error : AnimSpriteCelFile sequence table invalid (%u sequences).\n", header->sequencesCount);
+		return -1;
+	}
+
+	// Vérifie chaque séquence une fois, ses étapes sont utilisées telles quelles
+	for (sequenceIndex = 0; sequenceIndex < header->sequencesCount; sequenceIndex++) {
+
+		// Si les étapes sont mal placées ou dépassent du fichier
+		if (((sequences[sequenceIndex].stepsOffset & 3) != 0) || (sequences[sequenceIndex].stepsOffset > (uint32)bufferSize) || (sequences[sequenceIndex].stepsCount < 2) || (sequences[sequenceIndex].stepsCount > ((uint32)bufferSize - sequences[sequenceIndex].stepsOffset) / sizeof(AnimSpriteCelPackedStep))) {
+			printf("Error : AnimSpriteCelFile sequence %u steps invalid.\n", sequenceIndex);
+			return -1;
+		}
+
+		// Si les paramètres sont hors limites
+		if ((sequences[sequenceIndex].framesCount == 0) || (sequences[sequenceIndex].framesCount > 0x10000) || (sequences[sequenceIndex].loop > ALTERNATE) || (sequences[sequenceIndex].range > QUARTER)) {
+			printf("Error : AnimSpriteCelFile sequence %u parameters invalid.\n", sequenceIndex);
+			return -1;
+		}
+	}
+
+	// Retourne un succès
+	return 1;
+}
+
+// Charge un fichier d'animation
+AnimSpriteCelFile *AnimSpriteCelFileLoad(char *fileName) {
+
+	// Instance d'AnimSpriteCelFile
+	AnimSpriteCelFile *animSpriteCelFile = NULL;
+	// Fichier chargé
+	uint8 *buffer = NULL;
+	int32 bufferSize = 0;
+	// Nombre de séquences
+	uint32 sequencesCount = 0;
+
+	// Lit tout le fichier en un seul bloc
+	buffer = (uint8 *)LoadFile(fileName, &bufferSize, MEMTYPE_DRAM);
+	// Si le chargement échoue
+	if (buffer == NULL) {
+		// Affiche un message d'erreur
+		printf("Error : Failed to load AnimSpriteCelFile %s.\n", fileName);
+		return NULL;
+	}
+
+	// Si l'en-tête ou la table des séquences est invalide
+	if (AnimSpriteCelFileCheck(buffer, bufferSize) < 0) {
+		// Décharge le fichier
+		UnloadFile(buffer);
+		// Affiche un message d'erreur
+		printf("Error <- AnimSpriteCelFileCheck(%s)\n", fileName);
+		return NULL;
+	}
+	sequencesCount = ((AnimSpriteCelFileHeader *)buffer)->sequencesCount;
+
+	// Alloue la mémoire pour AnimSpriteCelFile
+	animSpriteCelFile = (AnimSpriteCelFile *)AllocMem(sizeof(AnimSpriteCelFile), MEMTYPE_DRAM);
+	// Si c'est un échec
+	if (animSpriteCelFile == NULL) {
+		// Décharge le fichier
+		UnloadFile(buffer);
+		// Affiche un message d'erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCelFile.\n");
+		return NULL;
+	}
+
+	// Alloue les données partagées des séquences
+	animSpriteCelFile->spriteCels = (SpriteCel **)AllocMem(sequencesCount * sizeof(SpriteCel *), MEMTYPE_DRAM);
+	animSpriteCelFile->frames = (AnimSpriteCelFrame **)AllocMem(sequencesCount * sizeof(AnimSpriteCelFrame *), MEMTYPE_DRAM);
+	animSpriteCelFile->timelines = (uint32 **)AllocMem(sequencesCount * sizeof(uint32 *), MEMTYPE_DRAM);
+	// Si une allocation échoue
+	if ((animSpriteCelFile->spriteCels == NULL) || (animSpriteCelFile->frames == NULL) || (animSpriteCelFile->timelines == NULL)) {
+		// Libère les tables allouées, l'AnimSpriteCelFile et le fichier
+		if (animSpriteCelFile->spriteCels != NULL) { FreeMem(animSpriteCelFile->spriteCels, sequencesCount * sizeof(SpriteCel *)); }
+		if (animSpriteCelFile->frames != NULL) { FreeMem(animSpriteCelFile->frames, sequencesCount * sizeof(AnimSpriteCelFrame *)); }
+		if (animSpriteCelFile->timelines != NULL) { FreeMem(animSpriteCelFile->timelines, sequencesCount * sizeof(uint32 *)); }
+		FreeMem(animSpriteCelFile, sizeof(AnimSpriteCelFile));
+		UnloadFile(buffer);
+		// Affiche un message d'erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCelFile sequences.\n");
+		return NULL;
+	}
+
+	// Aucune séquence n'a encore d'instance
+	memset(animSpriteCelFile->spriteCels, 0, (size_t)sequencesCount * sizeof(SpriteCel *));
+	memset(animSpriteCelFile->frames, 0, (size_t)sequencesCount * sizeof(AnimSpriteCelFrame *));
+	memset(animSpriteCelFile->timelines, 0, (size_t)sequencesCount * sizeof(uint32 *));
+
+	// L'en-tête et les séquences sont lus sur place
+	animSpriteCelFile->buffer = buffer;
+	animSpriteCelFile->bufferSize = bufferSize;
+	animSpriteCelFile->header = (AnimSpriteCelFileHeader *)buffer;
+	animSpriteCelFile->sequences = (AnimSpriteCelFileSequence *)(animSpriteCelFile->header + 1);
+	// Référence de l'appelant
+	animSpriteCelFile->referencesCount = 1;
+
+	// Retourne l'AnimSpriteCelFile nouvellement chargé
+	return animSpriteCelFile;
+}
+
+// Abandonne la référence d'une instance depuis AnimSpriteCelCleanup()
+static int32 AnimSpriteCelFileInstanceRelease(AnimSpriteCel *animSpriteCel) {
+
+	// Abandonne la référence au lieu de libérer les étapes partagées
+	AnimSpriteCelFileCleanup(animSpriteCel->file);
+	animSpriteCel->file = NULL;
+	animSpriteCel->packedSteps = NULL;
+	animSpriteCel->frames = NULL;
+	animSpriteCel->timeline = NULL;
+
+	// Retourne un succès
+	return 1;
+}
+
+// Crée un AnimSpriteCel jouant une séquence du fichier
+AnimSpriteCel *AnimSpriteCelFileInstance(AnimSpriteCelFile *animSpriteCelFile, uint32 sequenceIndex, SpriteCel *spriteCel, int32 direction, uint32 stepIndex) {
+
+	// Instance de l'AnimSpriteCel
+	AnimSpriteCel *animSpriteCel = NULL;
+	// Séquence jouée
+	AnimSpriteCelFileSequence *sequence = NULL;
+
+	// Si l'AnimSpriteCelFile n'est pas défini
+	if (animSpriteCelFile == NULL) {
+		// Affiche un message d'erreur
+		printf("Error : AnimSpriteCelFile unknow.\n");
+		return NULL;
+	}
+
+	// Si la séquence n'existe pas
+	if (sequenceIndex >= animSpriteCelFile->header->sequencesCount) {
+		// Affiche un message d'erreur
+		printf("Error : AnimSpriteCelFile sequence %u out of bounds (%u sequences).\n", sequenceIndex, animSpriteCelFile->header->sequencesCount);
+		return NULL;
+	}
+
+	// Si la planche de sprites n'existe pas
+	if (spriteCel == NULL) {
+		// Affiche un message d'erreur
+		printf("Error : SpriteCel unknow.\n");
+		return NULL;
+	}
+
+	// Si la séquence joue déjà une autre sprite sheet
+	if ((animSpriteCelFile->spriteCels[sequenceIndex] != NULL) && (animSpriteCelFile->spriteCels[sequenceIndex] != spriteCel)) {
+		// Affiche un message d'erreur
+		printf("Error : AnimSpriteCelFile sequence %u already uses another SpriteCel.\n", sequenceIndex);
+		return NULL;
+	}
+
+	sequence = &animSpriteCelFile->sequences[sequenceIndex];
+
+	// À la première instance, construit les données partagées de la séquence
+	if (animSpriteCelFile->spriteCels[sequenceIndex] == NULL) {
+
+		// Alloue les descripteurs de frames et les durées cumulées (jusqu'à 2 * stepsCount - 2 positions en ALTERNATE)
+		animSpriteCelFile->frames[sequenceIndex] = (AnimSpriteCelFrame *)AllocMem(sequence->framesCount * sizeof(AnimSpriteCelFrame), MEMTYPE_DRAM);
+		animSpriteCelFile->timelines[sequenceIndex] = (uint32 *)AllocMem(((2 * sequence->stepsCount) - 1) * sizeof(uint32), MEMTYPE_DRAM);
+		// Si une allocation échoue
+		if ((animSpriteCelFile->frames[sequenceIndex] == NULL) || (animSpriteCelFile->timelines[sequenceIndex] == NULL)) {
+			// Libère les données allouées
+			if (animSpriteCelFile->frames[sequenceIndex] != NULL) { FreeMem(animSpriteCelFile->frames[sequenceIndex], sequence->framesCount * sizeof(AnimSpriteCelFrame)); }
+			if (animSpriteCelFile->timelines[sequenceIndex] != NULL) { FreeMem(animSpriteCelFile->timelines[sequenceIndex], ((2 * sequence->stepsCount) - 1) * sizeof(uint32)); }
+			animSpriteCelFile->frames[sequenceIndex] = NULL;
+			animSpriteCelFile->timelines[sequenceIndex] = NULL;
+			// Affiche un message d'erreur
+			printf("Error : Failed to allocate memory for AnimSpriteCelFile sequence %u.\n", sequenceIndex);
+			return NULL;
+		}
+
+		// Résout le descripteur de chaque frame une fois pour toutes les instances
+		AnimSpriteCelFramesResolve(spriteCel, animSpriteCelFile->frames[sequenceIndex], sequence->framesCount);
+		animSpriteCelFile->spriteCels[sequenceIndex] = spriteCel;
+	}
+
+	// Alloue la mémoire pour AnimSpriteCel (les étapes, les frames et la ligne de temps sont partagées)
+	animSpriteCel = (AnimSpriteCel *)AllocMem(sizeof(AnimSpriteCel), MEMTYPE_DRAM);
+	// Si c'est un échec
+	if (animSpriteCel == NULL) {
+		// Affiche un message d'erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCel.\n");
+		return NULL;
+	}
+
+	// Pas issu d'un pool, étapes compactes dans le fichier
+	animSpriteCel->pool = NULL;
+	animSpriteCel->sequence = NULL;
+	animSpriteCel->file = animSpriteCelFile;
+	animSpriteCel->table = NULL;
+	animSpriteCel->release = AnimSpriteCelFileInstanceRelease;
+	animSpriteCel->steps = NULL;
+	animSpriteCel->packedSteps = (AnimSpriteCelPackedStep *)(animSpriteCelFile->buffer + sequence->stepsOffset);
+	animSpriteCel->frames = animSpriteCelFile->frames[sequenceIndex];
+	animSpriteCel->framesCount = sequence->framesCount;
+	animSpriteCel->timeline = animSpriteCelFile->timelines[sequenceIndex];
+
+	// Copie le CCB du SpriteCel
+	animSpriteCel->cel = CloneCel(spriteCel->cel, CLONECEL_CCB_ONLY);
+
+	// Initialise la tête de lecture, les étapes restent intactes
+	AnimSpriteCelSetup(animSpriteCel, spriteCel, (AnimSpriteCelLoop)sequence->loop, (AnimSpriteCelRange)sequence->range, sequence->iterations, direction, stepIndex, sequence->stepsCount);
+	// Affiche l'étape de départ
+	AnimSpriteCelUpdate(animSpriteCel);
+
+	// Référence de l'instance
+	animSpriteCelFile->referencesCount++;
+
+	// Retourne le AnimSpriteCel créé
+	return animSpriteCel;
+}
+
+// Abandonne une référence à l'AnimSpriteCelFile
+int32 AnimSpriteCelFileCleanup(AnimSpriteCelFile *animSpriteCelFile) {
+
+	// Index de la séquence
+	uint32 sequenceIndex = 0;
+	// Nombre de séquences
+	uint32 sequencesCount = 0;
+
+	// Si l'AnimSpriteCelFile n'est pas défini
+	if (animSpriteCelFile == NULL) {
+		printf("Error : AnimSpriteCelFile unknow.\n");
+		return -1;
+	}
+
+	// Abandonne la référence
+	animSpriteCelFile->referencesCount--;
+
+	// Si des instances jouent encore le fichier
+	if (animSpriteCelFile->referencesCount > 0) {
+		// La conserve
+		return 1;
+	}
+
+	sequencesCount = animSpriteCelFile->header->sequencesCount;
+
+	// Libère les données partagées des séquences qui ont eu des instances
+	for (sequenceIndex = 0; sequenceIndex < sequencesCount; sequenceIndex++) {
+		if (animSpriteCelFile->spriteCels[sequenceIndex] != NULL) {
+			FreeMem(animSpriteCelFile->frames[sequenceIndex], animSpriteCelFile->sequences[sequenceIndex].framesCount * sizeof(AnimSpriteCelFrame));
+			FreeMem(animSpriteCelFile->timelines[sequenceIndex], ((2 * animSpriteCelFile->sequences[sequenceIndex].stepsCount) - 1) * sizeof(uint32));
+		}
+	}
+
+	// Libère les tables des séquences
+	FreeMem(animSpriteCelFile->spriteCels, sequencesCount * sizeof(SpriteCel *));
+	FreeMem(animSpriteCelFile->frames, sequencesCount * sizeof(AnimSpriteCelFrame *));
+	FreeMem(animSpriteCelFile->timelines, sequencesCount * sizeof(uint32 *));
+
+	// Décharge le fichier
+	UnloadFile(animSpriteCelFile->buffer);
+	animSpriteCelFile->buffer = NULL;
+
+	// Libère la structure AnimSpriteCelFile elle-même
+	FreeMem(animSpriteCelFile, sizeof(AnimSpriteCelFile));
+
+	// Retourne un succès
+	return 1;
+}
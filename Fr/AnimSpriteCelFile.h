@@ -0,0 +1,154 @@
+#ifndef ANIMSPRITECELFILE_H
+#define ANIMSPRITECELFILE_H
+
+/******************************************************************************
+**
+**  AnimSpriteCelFile - Fichiers d'animation binaires (3DO Cel Engine)
+**
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 17-10-2026
+**
+**  Les étapes configurées avec AnimSpriteCelStepsConfiguration() sont écrites
+**  dans le code C et reconstruites à chaque démarrage, un appel par étape. Un
+**  fichier ".anim" contient à la place des séquences toutes prêtes : type de
+**  boucle, plage de l'aléatoire, itérations, référence du SpriteCel et étapes
+**  compactes ("AnimSpriteCelPackedStep"), dans la disposition mémoire de la
+**  cible.
+**
+**  AnimSpriteCelFileLoad() lit le fichier en mémoire en un seul bloc et
+**  vérifie l'en-tête et la table des séquences. AnimSpriteCelFileInstance()
+**  crée un AnimSpriteCel dont les étapes compactes pointent directement dans
+**  les octets chargés : aucune étape n'est analysée ni copiée, charger un
+**  niveau coûte donc le même temps quel que soit le nombre d'étapes.
+**
+**  Les fichiers sont écrits hors ligne par AnimSpriteCelFileTool (programme
+**  hôte, voir AnimSpriteCelFileTool.c) à partir d'une description texte.
+**
+**  Disposition du fichier (ordre des octets et taille d'étape de la cible) :
+**
+**    AnimSpriteCelFileHeader
+**    AnimSpriteCelFileSequence[sequencesCount]
+**    étapes compactes de chaque séquence, chaque tableau aligné sur 4 octets
+**
+**  Notes importantes :
+**
+**    - Les étapes d'un fichier sont en lecture seule :
+**      AnimSpriteCelPackedStepConfiguration() et AnimSpriteCelStepEvent() sont
+**      refusées sur une instance.
+**
+**    - L'ID d'événement d'une étape occupe les 2 octets de remplissage que le
+**      compilateur ARM laissait après l'index de receveur : les fichiers
+**      écrits avant les événements gardent la version 1 et n'envoient aucun
+**      événement.
+**
+**    - Les descripteurs de frames et la ligne de temps d'une séquence sont
+**      construits une seule fois, à sa première instance, et partagés par les
+**      suivantes. Toutes les instances d'une séquence doivent donc utiliser le
+**      même SpriteCel.
+**
+**    - Les index de frames des étapes sont vérifiés par l'outil, pas au
+**      chargement. Seuls les fichiers écrits par l'outil doivent être chargés.
+**
+**    - Le fichier compte ses références : l'appelant en détient une, chaque
+**      instance une de plus. AnimSpriteCelFileCleanup() et la suppression
+**      d'une instance abandonnent une référence, le fichier est déchargé avec
+**      la dernière.
+**
+**  Rôle des structures :
+**
+**    AnimSpriteCelFileHeader
+**      - magic : ANIMSPRITECELFILE_MAGIC ("ANIM" dans l'ordre des octets de la cible)
+**      - version : ANIMSPRITECELFILE_VERSION
+**      - stepSize : taille d'une étape compacte sur la cible
+**      - sequencesCount : nombre de séquences
+**
+**    AnimSpriteCelFileSequence
+**      - stepsOffset : position des étapes compactes depuis le début du fichier
+**      - stepsCount : nombre d'étapes
+**      - framesCount : nombre de frames du SpriteCel que les étapes peuvent afficher
+**      - spriteCelIndex : SpriteCel de la séquence, numéroté par le jeu
+**      - loop, range, iterations : comme pour AnimSpriteCelInitialization()
+**
+**    AnimSpriteCelFile
+**      - buffer, bufferSize : fichier chargé
+**      - header, sequences : en-tête et table des séquences dans le tampon
+**      - spriteCels, frames, timelines : données partagées de chaque séquence,
+**        construites à sa première instance
+**      - referencesCount : référence de l'appelant plus une par instance
+**
+**  Fonctions principales :
+**
+**    AnimSpriteCelFileLoad()
+**      -> Charge un fichier ".anim" et vérifie son en-tête et ses séquences.
+**
+**    AnimSpriteCelFileInstance()
+**      -> Crée un AnimSpriteCel jouant une séquence du fichier.
+**
+**    AnimSpriteCelFileCleanup()
+**      -> Abandonne une référence, décharge le fichier avec la dernière.
+**
+******************************************************************************/
+
+// int32
+#include "types.h"
+// AnimSpriteCel
+#include "AnimSpriteCel.h"
+
+// "ANIM"
+#define ANIMSPRITECELFILE_MAGIC 0x414E494D
+// Version de la disposition du fichier
+#define ANIMSPRITECELFILE_VERSION 1
+
+typedef struct {
+	// "ANIM"
+	uint32 magic;
+	// Version de la disposition du fichier
+	uint32 version;
+	// Taille d'une étape compacte sur la cible
+	uint32 stepSize;
+	// Nombre de séquences
+	uint32 sequencesCount;
+} AnimSpriteCelFileHeader;
+
+typedef struct {
+	// Position des étapes compactes depuis le début du fichier
+	uint32 stepsOffset;
+	// Nombre total d'étapes
+	uint32 stepsCount;
+	// Nombre de frames du SpriteCel
+	uint32 framesCount;
+	// SpriteCel de la séquence
+	uint32 spriteCelIndex;
+	// Type de boucle d'animation
+	uint32 loop;
+	// Plage de valeurs de l'aléatoire
+	uint32 range;
+	// Nombre de répétitions du cycle
+	uint32 iterations;
+} AnimSpriteCelFileSequence;
+
+struct AnimSpriteCelFile {
+	// Fichier chargé
+	uint8 *buffer;
+	int32 bufferSize;
+	// En-tête et table des séquences dans le tampon
+	AnimSpriteCelFileHeader *header;
+	AnimSpriteCelFileSequence *sequences;
+	// SpriteCel de chaque séquence (NULL jusqu'à sa première instance)
+	SpriteCel **spriteCels;
+	// Descripteurs de frames de chaque séquence
+	AnimSpriteCelFrame **frames;
+	// Durées cumulées de chaque séquence
+	uint32 **timelines;
+	// Référence de l'appelant plus une par instance
+	uint32 referencesCount;
+};
+
+// Charge un fichier d'animation
+AnimSpriteCelFile *AnimSpriteCelFileLoad(char *fileName);
+// Crée un AnimSpriteCel jouant une séquence du fichier
+AnimSpriteCel *AnimSpriteCelFileInstance(AnimSpriteCelFile *animSpriteCelFile, uint32 sequenceIndex, SpriteCel *spriteCel, int32 direction, uint32 stepIndex);
+// Abandonne une référence à l'AnimSpriteCelFile
+int32 AnimSpriteCelFileCleanup(AnimSpriteCelFile *animSpriteCelFile);
+
+#endif // ANIMSPRITECELFILE_H
@@ -0,0 +1,369 @@
+/******************************************************************************
+**
+**  AnimSpriteCelFileTool - Écrit les fichiers ".anim" d'AnimSpriteCelFile (outil hôte)
+**
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 17-10-2026
+**
+**  Programme hors ligne, compilé et exécuté sur l'ordinateur de développement
+**  avec n'importe quel compilateur C (il n'utilise pas le SDK 3DO) :
+**
+**    cc -o AnimSpriteCelFileTool AnimSpriteCelFileTool.c
+**    AnimSpriteCelFileTool [-little] input.txt output.anim
+**
+**  L'entrée est un fichier texte avec une commande par ligne :
+**
+**    # commentaire
+**    sequence spriteCelIndex framesCount loop range iterations
+**    step frameIndex frameDuration [receiverIndex] [event eventId]
+**
+**    - loop : NORMAL, REVERSE ou ALTERNATE
+**    - range : FULL, HALF ou QUARTER
+**    - iterations : un nombre ou INFINITE
+**    - les étapes suivent leur séquence, au moins deux par séquence
+**    - receiverIndex : index d'enregistrement du receveur dans le système
+**      (aucun s'il est omis)
+**    - eventId : événement envoyé au système quand une instance atteint
+**      l'étape (aucun s'il est omis ou à 0)
+**
+**  Chaque valeur est vérifiée selon la disposition des étapes compactes
+**  (index de frame inférieur à framesCount, durée de -32768 à 32767, index de
+**  receveur inférieur à 65535, ID d'événement jusqu'à 65535), le chargeur ne
+**  vérifie donc que l'en-tête et la table des séquences.
+**
+**  Par défaut, le fichier est écrit pour la 3DO : big-endian, étapes
+**  compactes de 8 octets. "-little" l'écrit pour un hôte little-endian.
+**  La disposition doit correspondre à AnimSpriteCelFile.h.
+**
+******************************************************************************/
+
+// printf(), fopen()
+#include <stdio.h>
+// malloc(), realloc(), free(), strtol()
+#include <stdlib.h>
+// strcmp(), strtok()
+#include <string.h>
+
+// Valeurs d'AnimSpriteCelFile.h, AnimSpriteCel.h et DefinitionsArguments.h
+#define TOOL_MAGIC 0x414E494DUL
+#define TOOL_VERSION 1UL
+#define TOOL_HEADER_SIZE 16UL
+#define TOOL_SEQUENCE_SIZE 28UL
+#define TOOL_STEP_SIZE 8UL
+#define TOOL_RECEIVER_NONE 0xFFFFUL
+#define TOOL_EVENT_MAX 0xFFFFUL
+#define TOOL_INFINITE 2147483647UL
+
+// Étape lue dans le texte
+typedef struct {
+	unsigned long frameIndex;
+	long frameDuration;
+	unsigned long receiverIndex;
+	unsigned long eventId;
+} ToolStep;
+
+// Séquence lue dans le texte
+typedef struct {
+	unsigned long spriteCelIndex;
+	unsigned long framesCount;
+	unsigned long loop;
+	unsigned long range;
+	unsigned long iterations;
+	unsigned long stepsCount;
+	unsigned long stepsMax;
+	unsigned long stepsOffset;
+	ToolStep *steps;
+} ToolSequence;
+
+// Ordre des octets de la cible
+static int toolLittleEndian = 0;
+
+// Écrit une valeur 32 bits dans l'ordre des octets de la cible
+static void ToolWrite32(FILE *file, unsigned long value) {
+
+	// Si la cible est little-endian
+	if (toolLittleEndian == 1) {
+		fputc((int)(value & 0xFF), file);
+		fputc((int)((value >> 8) & 0xFF), file);
+		fputc((int)((value >> 16) & 0xFF), file);
+		fputc((int)((value >> 24) & 0xFF), file);
+	} else {
+		fputc((int)((value >> 24) & 0xFF), file);
+		fputc((int)((value >> 16) & 0xFF), file);
+		fputc((int)((value >> 8) & 0xFF), file);
+		fputc((int)(value & 0xFF), file);
+	}
+}
+
+// Écrit une valeur 16 bits dans l'ordre des octets de la cible
+static void ToolWrite16(FILE *file, unsigned long value) {
+
+	// Si la cible est little-endian
+	if (toolLittleEndian == 1) {
+		fputc((int)(value & 0xFF), file);
+		fputc((int)((value >> 8) & 0xFF), file);
+	} else {
+		fputc((int)((value >> 8) & 0xFF), file);
+		fputc((int)(value & 0xFF), file);
+	}
+}
+
+// Lit un nombre non signé, retourne 0 si le mot n'en est pas un
+static int ToolNumber(char *token, unsigned long *value) {
+
+	// Fin du nombre
+	char *end = NULL;
+
+	// Si le mot est absent
+	if (token == NULL) {
+		return 0;
+	}
+
+	*value = (unsigned long)strtol(token, &end, 0);
+	return ((*end == '\0') && (token[0] != '-')) ? 1 : 0;
+}
+
+// Lit la description texte, retourne le nombre de séquences (-1 en cas d'erreur)
+static long ToolRead(FILE *input, ToolSequence **sequences) {
+
+	// Ligne du texte
+	char line[256];
+	unsigned long lineNumber = 0;
+	// Mot de la ligne
+	char *token = NULL;
+	// Fin d'un nombre signé
+	char *end = NULL;
+	// Séquences lues
+	long sequencesCount = 0;
+	long sequencesMax = 0;
+	// Séquence et étape en cours de lecture
+	ToolSequence *sequence = NULL;
+	ToolStep *step = NULL;
+
+	*sequences = NULL;
+
+	while (fgets(line, sizeof(line), input) != NULL) {
+
+		lineNumber++;
+		token = strtok(line, " \t\r\n");
+
+		// Ligne vide ou commentaire
+		if ((token == NULL) || (token[0] == '#')) {
+			continue;
+		}
+
+		// Nouvelle séquence
+		if (strcmp(token, "sequence") == 0) {
+
+			// Agrandit la table des séquences
+			if (sequencesCount == sequencesMax) {
+				sequencesMax = (sequencesMax == 0) ? 16 : sequencesMax * 2;
+				*sequences = (ToolSequence *)realloc(*sequences, (size_t)sequencesMax * sizeof(ToolSequence));
+				if (*sequences == NULL) {
+					printf("Error : out of memory.\n");
+					return -1;
+				}
+			}
+			sequence = &(*sequences)[sequencesCount++];
+			memset(sequence, 0, sizeof(ToolSequence));
+
+			// SpriteCel et nombre de frames
+			if ((ToolNumber(strtok(NULL, " \t\r\n"), &sequence->spriteCelIndex) == 0) || (ToolNumber(strtok(NULL, " \t\r\n"), &sequence->framesCount) == 0) || (sequence->framesCount == 0) || (sequence->framesCount > 0x10000UL)) {
+				printf("Error : line %lu: sequence needs a SpriteCel index and 1 to 65536 frames.\n", lineNumber);
+				return -1;
+			}
+
+			// Type de boucle d'animation
+			token = strtok(NULL, " \t\r\n");
+			if ((token != NULL) && (strcmp(token, "NORMAL") == 0)) { sequence->loop = 0; }
+			else if ((token != NULL) && (strcmp(token, "REVERSE") == 0)) { sequence->loop = 1; }
+			else if ((token != NULL) && (strcmp(token, "ALTERNATE") == 0)) { sequence->loop = 2; }
+			else {
+				printf("Error : line %lu: loop must be NORMAL, REVERSE or ALTERNATE.\n", lineNumber);
+				return -1;
+			}
+
+			// Plage de l'aléatoire
+			token = strtok(NULL, " \t\r\n");
+			if ((token != NULL) && (strcmp(token, "FULL") == 0)) { sequence->range = 0; }
+			else if ((token != NULL) && (strcmp(token, "HALF") == 0)) { sequence->range = 1; }
+			else if ((token != NULL) && (strcmp(token, "QUARTER") == 0)) { sequence->range = 2; }
+			else {
+				printf("Error : line %lu: range must be FULL, HALF or QUARTER.\n", lineNumber);
+				return -1;
+			}
+
+			// Iterations
+			token = strtok(NULL, " \t\r\n");
+			if ((token != NULL) && (strcmp(token, "INFINITE") == 0)) {
+				sequence->iterations = TOOL_INFINITE;
+			} else if (ToolNumber(token, &sequence->iterations) == 0) {
+				printf("Error : line %lu: iterations must be a number or INFINITE.\n", lineNumber);
+				return -1;
+			}
+			continue;
+		}
+
+		// Étape de la séquence en cours
+		if (strcmp(token, "step") == 0) {
+
+			// Si aucune séquence n'est ouverte
+			if (sequence == NULL) {
+				printf("Error : line %lu: step before any sequence.\n", lineNumber);
+				return -1;
+			}
+
+			// Agrandit les étapes de la séquence
+			if (sequence->stepsCount == sequence->stepsMax) {
+				sequence->stepsMax = (sequence->stepsMax == 0) ? 64 : sequence->stepsMax * 2;
+				sequence->steps = (ToolStep *)realloc(sequence->steps, (size_t)sequence->stepsMax * sizeof(ToolStep));
+				if (sequence->steps == NULL) {
+					printf("Error : out of memory.\n");
+					return -1;
+				}
+			}
+			step = &sequence->steps[sequence->stepsCount++];
+
+			// Frame
+			if ((ToolNumber(strtok(NULL, " \t\r\n"), &step->frameIndex) == 0) || (step->frameIndex >= sequence->framesCount)) {
+				printf("Error : line %lu: frame index must be below %lu.\n", lineNumber, sequence->framesCount);
+				return -1;
+			}
+
+			// Duration
+			token = strtok(NULL, " \t\r\n");
+			step->frameDuration = (token != NULL) ? strtol(token, &end, 0) : 0;
+			if ((token == NULL) || (*end != '\0') || (step->frameDuration < -32768L) || (step->frameDuration > 32767L)) {
+				printf("Error : line %lu: duration must be from -32768 to 32767.\n", lineNumber);
+				return -1;
+			}
+
+			// Receveur facultatif
+			token = strtok(NULL, " \t\r\n");
+			step->receiverIndex = TOOL_RECEIVER_NONE;
+			if ((token != NULL) && (strcmp(token, "event") != 0)) {
+				if ((ToolNumber(token, &step->receiverIndex) == 0) || (step->receiverIndex >= TOOL_RECEIVER_NONE)) {
+					printf("Error : line %lu: receiver index must be below 65535.\n", lineNumber);
+					return -1;
+				}
+				token = strtok(NULL, " \t\r\n");
+			}
+
+			// Événement optionnel
+			step->eventId = 0;
+			if ((token != NULL) && ((strcmp(token, "event") != 0) || (ToolNumber(strtok(NULL, " \t\r\n"), &step->eventId) == 0) || (step->eventId > TOOL_EVENT_MAX))) {
+				printf("Error : line %lu: event ID must be from 0 to 65535.\n", lineNumber);
+				return -1;
+			}
+			continue;
+		}
+
+		// Commande inconnue
+		printf("Error : line %lu: unknown command %s.\n", lineNumber, token);
+		return -1;
+	}
+
+	// Retourne le nombre de séquences
+	return sequencesCount;
+}
+
+int main(int argc, char *argv[]) {
+
+	// Index de l'argument
+	int argumentIndex = 1;
+	// Files
+	FILE *input = NULL;
+	FILE *output = NULL;
+	// Séquences lues
+	ToolSequence *sequences = NULL;
+	long sequencesCount = 0;
+	// Index de séquence et d'étape
+	long sequenceIndex = 0;
+	unsigned long stepIndex = 0;
+	// Position dans le fichier
+	unsigned long offset = 0;
+
+	// Options
+	while ((argumentIndex < argc) && (argv[argumentIndex][0] == '-')) {
+		if (strcmp(argv[argumentIndex], "-little") == 0) {
+			toolLittleEndian = 1;
+		} else {
+			break;
+		}
+		argumentIndex++;
+	}
+
+	// Si les fichiers sont absents
+	if (argc - argumentIndex != 2) {
+		printf("Usage: AnimSpriteCelFileTool [-little] input.txt output.anim\n");
+		return 1;
+	}
+
+	// Lit la description texte
+	input = fopen(argv[argumentIndex], "r");
+	if (input == NULL) {
+		printf("Error : can't open %s.\n", argv[argumentIndex]);
+		return 1;
+	}
+	sequencesCount = ToolRead(input, &sequences);
+	fclose(input);
+	if (sequencesCount <= 0) {
+		printf("Error : no sequence written.\n");
+		return 1;
+	}
+
+	// Chaque séquence a besoin de deux étapes
+	for (sequenceIndex = 0; sequenceIndex < sequencesCount; sequenceIndex++) {
+		if (sequences[sequenceIndex].stepsCount < 2) {
+			printf("Error : sequence %ld needs at least two steps.\n", sequenceIndex);
+			return 1;
+		}
+	}
+
+	// Placer les étapes après la table des séquences (les étapes de 8 octets gardent chaque tableau sur 4 octets)
+	offset = TOOL_HEADER_SIZE + ((unsigned long)sequencesCount * TOOL_SEQUENCE_SIZE);
+	for (sequenceIndex = 0; sequenceIndex < sequencesCount; sequenceIndex++) {
+		sequences[sequenceIndex].stepsOffset = offset;
+		offset += sequences[sequenceIndex].stepsCount * TOOL_STEP_SIZE;
+	}
+
+	output = fopen(argv[argumentIndex + 1], "wb");
+	if (output == NULL) {
+		printf("Error : can't create %s.\n", argv[argumentIndex + 1]);
+		return 1;
+	}
+
+	// Header
+	ToolWrite32(output, TOOL_MAGIC);
+	ToolWrite32(output, TOOL_VERSION);
+	ToolWrite32(output, TOOL_STEP_SIZE);
+	ToolWrite32(output, (unsigned long)sequencesCount);
+
+	// Table des séquences
+	for (sequenceIndex = 0; sequenceIndex < sequencesCount; sequenceIndex++) {
+		ToolWrite32(output, sequences[sequenceIndex].stepsOffset);
+		ToolWrite32(output, sequences[sequenceIndex].stepsCount);
+		ToolWrite32(output, sequences[sequenceIndex].framesCount);
+		ToolWrite32(output, sequences[sequenceIndex].spriteCelIndex);
+		ToolWrite32(output, sequences[sequenceIndex].loop);
+		ToolWrite32(output, sequences[sequenceIndex].range);
+		ToolWrite32(output, sequences[sequenceIndex].iterations);
+	}
+
+	// Étapes compactes, comme AnimSpriteCelPackedStep
+	for (sequenceIndex = 0; sequenceIndex < sequencesCount; sequenceIndex++) {
+		for (stepIndex = 0; stepIndex < sequences[sequenceIndex].stepsCount; stepIndex++) {
+			ToolWrite16(output, sequences[sequenceIndex].steps[stepIndex].frameIndex);
+			ToolWrite16(output, (unsigned long)sequences[sequenceIndex].steps[stepIndex].frameDuration & 0xFFFFUL);
+			ToolWrite16(output, sequences[sequenceIndex].steps[stepIndex].receiverIndex);
+			ToolWrite16(output, sequences[sequenceIndex].steps[stepIndex].eventId);
+		}
+		free(sequences[sequenceIndex].steps);
+	}
+
+	fclose(output);
+	free(sequences);
+
+	printf("%ld sequences written to %s (%lu bytes).\n", sequencesCount, argv[argumentIndex + 1], offset);
+	return 0;
+}
@@ -0,0 +1,604 @@
+#include "AnimSpriteCelGraph.h"
+
+// AllocMem(), FreeMem(), MEMTYPE_DRAM
+#include "mem.h"
+// printf()
+#include "stdio.h"
+
+// AnimSpriteCel sur la pile de la recherche des cycles (drapeau de travail)
+#define ANIMSPRITECELGRAPH_STACKED 0x80
+// AnimSpriteCel pas encore atteint par la recherche des cycles
+#define ANIMSPRITECELGRAPH_UNVISITED 0xFFFFFFFF
+
+// Donne la racine d'un AnimSpriteCel dans la forêt union-find, en divisant le chemin par deux
+static uint32 AnimSpriteCelGraphRoot(uint32 *parents, uint32 index) {
+
+	while (parents[index] != index) {
+		parents[index] = parents[parents[index]];
+		index = parents[index];
+	}
+	return index;
+}
+
+// Donne l'index d'enregistrement d'un receveur (ANIMSPRITECELGRAPH_UNVISITED s'il est hors du système)
+static uint32 AnimSpriteCelGraphReceiverIndex(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCelReceiver) {
+
+	// Si le receveur appartient au système
+	if (animSpriteCelReceiver->system == animSpriteCelSystem) {
+		return animSpriteCelReceiver->systemIndex;
+	}
+	return ANIMSPRITECELGRAPH_UNVISITED;
+}
+
+// Trouve les cycles du graphe des déclenchements (recherche de Tarjan itérative)
+static void AnimSpriteCelGraphCycles(AnimSpriteCelGraph *animSpriteCelGraph, uint32 *offsets, uint32 *targets, uint32 *cursors, uint32 *indexes, uint32 *lowLinks, uint32 *stack, uint32 *calls) {
+
+	// Nombre d'AnimSpriteCels
+	uint32 count = animSpriteCelGraph->animSpriteCelsCount;
+	// Drapeaux des AnimSpriteCels
+	uint8 *flags = animSpriteCelGraph->flags;
+	// Prochain index de recherche
+	uint32 searchIndex = 0;
+	// Tailles de la pile et des appels
+	uint32 stackCount = 0;
+	uint32 callsCount = 0;
+	// Début de la recherche, AnimSpriteCels visité et atteint
+	uint32 root = 0;
+	uint32 current = 0;
+	uint32 target = 0;
+	// Composante retirée de la pile
+	uint32 componentFirst = 0;
+	uint32 componentIndex = 0;
+	uint32 cycle = 0;
+	// Index d'arête
+	uint32 edgeIndex = 0;
+
+	// Rien d'atteint pour l'instant, chaque arête à suivre
+	for (current = 0; current < count; current++) {
+		indexes[current] = ANIMSPRITECELGRAPH_UNVISITED;
+		cursors[current] = offsets[current];
+	}
+
+	for (root = 0; root < count; root++) {
+
+		// Déjà dans une composante
+		if (indexes[root] != ANIMSPRITECELGRAPH_UNVISITED) {
+			continue;
+		}
+
+		// Démarre une recherche
+		indexes[root] = searchIndex;
+		lowLinks[root] = searchIndex;
+		searchIndex++;
+		stack[stackCount++] = root;
+		flags[root] |= ANIMSPRITECELGRAPH_STACKED;
+		calls[callsCount++] = root;
+
+		while (callsCount > 0) {
+
+			current = calls[callsCount - 1];
+
+			// S'il reste une arête, la suivre
+			if (cursors[current] < offsets[current + 1]) {
+				target = targets[cursors[current]];
+				cursors[current]++;
+
+				if (indexes[target] == ANIMSPRITECELGRAPH_UNVISITED) {
+					// Descend vers le receveur
+					indexes[target] = searchIndex;
+					lowLinks[target] = searchIndex;
+					searchIndex++;
+					stack[stackCount++] = target;
+					flags[target] |= ANIMSPRITECELGRAPH_STACKED;
+					calls[callsCount++] = target;
+				} else if ((flags[target] & ANIMSPRITECELGRAPH_STACKED) != 0) {
+					// Retour vers un AnimSpriteCel de la chaîne en cours
+					if (indexes[target] < lowLinks[current]) {
+						lowLinks[current] = indexes[target];
+					}
+				}
+				continue;
+			}
+
+			// Chaque arête suivie, retour à l'appelant
+			callsCount--;
+			if ((callsCount > 0) && (lowLinks[current] < lowLinks[calls[callsCount - 1]])) {
+				lowLinks[calls[callsCount - 1]] = lowLinks[current];
+			}
+
+			// Si l'AnimSpriteCel est la racine d'une composante
+			if (lowLinks[current] != indexes[current]) {
+				continue;
+			}
+
+			// Retire la composante
+			componentFirst = stackCount;
+			do {
+				componentFirst--;
+				flags[stack[componentFirst]] &= ~ANIMSPRITECELGRAPH_STACKED;
+			} while (stack[componentFirst] != current);
+
+			// Une composante de plusieurs AnimSpriteCels, ou d'un seul qui se déclenche lui-même, est un cycle
+			cycle = (stackCount - componentFirst > 1) ? 1 : 0;
+			for (edgeIndex = offsets[current]; (cycle == 0) && (edgeIndex < offsets[current + 1]); edgeIndex++) {
+				if (targets[edgeIndex] == current) {
+					cycle = 1;
+				}
+			}
+			if (cycle == 1) {
+				for (componentIndex = componentFirst; componentIndex < stackCount; componentIndex++) {
+					flags[stack[componentIndex]] |= ANIMSPRITECELGRAPH_CYCLE;
+				}
+				animSpriteCelGraph->cyclesCount++;
+			}
+			stackCount = componentFirst;
+		}
+	}
+}
+
+// Crée le graphe d'un système et l'analyse
+AnimSpriteCelGraph *AnimSpriteCelGraphInitialization(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+	// Graphe nouvellement créé
+	AnimSpriteCelGraph *animSpriteCelGraph = NULL;
+	// Capacité du système
+	uint32 animSpriteCelsMax = 0;
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Affiche un message d'erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return NULL;
+	}
+	animSpriteCelsMax = animSpriteCelSystem->animSpriteCelsMax;
+
+	// Alloue la mémoire pour AnimSpriteCelGraph
+	animSpriteCelGraph = (AnimSpriteCelGraph *)AllocMem(sizeof(AnimSpriteCelGraph), MEMTYPE_DRAM);
+	// Si c'est un échec
+	if (animSpriteCelGraph == NULL) {
+		// Affiche un message d'erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCelGraph.\n");
+		return NULL;
+	}
+
+	// Alloue la mémoire pour les tableaux, dimensionnés par la capacité du système
+	animSpriteCelGraph->islandIndexes = (uint32 *)AllocMem(animSpriteCelsMax * sizeof(uint32), MEMTYPE_DRAM);
+	animSpriteCelGraph->members = (uint32 *)AllocMem(animSpriteCelsMax * sizeof(uint32), MEMTYPE_DRAM);
+	animSpriteCelGraph->flags = (uint8 *)AllocMem(animSpriteCelsMax * sizeof(uint8), MEMTYPE_DRAM);
+	animSpriteCelGraph->islands = (AnimSpriteCelIsland *)AllocMem(animSpriteCelsMax * sizeof(AnimSpriteCelIsland), MEMTYPE_DRAM);
+	animSpriteCelGraph->system = animSpriteCelSystem;
+	animSpriteCelGraph->animSpriteCelsMax = animSpriteCelsMax;
+	// Si une allocation échoue
+	if ((animSpriteCelGraph->islandIndexes == NULL) || (animSpriteCelGraph->members == NULL) || (animSpriteCelGraph->flags == NULL) || (animSpriteCelGraph->islands == NULL)) {
+		// Libère ce qui a été alloué
+		AnimSpriteCelGraphCleanup(animSpriteCelGraph);
+		// Affiche un message d'erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCelGraph arrays.\n");
+		return NULL;
+	}
+
+	// Analyse les enregistrements actuels
+	if (AnimSpriteCelGraphAnalysis(animSpriteCelGraph) < 0) {
+		AnimSpriteCelGraphCleanup(animSpriteCelGraph);
+		return NULL;
+	}
+
+	// Retourne l'AnimSpriteCelGraph nouvellement créé
+	return animSpriteCelGraph;
+}
+
+// Trouve les îlots, les cycles et les orphelins
+int32 AnimSpriteCelGraphAnalysis(AnimSpriteCelGraph *animSpriteCelGraph) {
+
+	// Système analysé et ses AnimSpriteCels
+	AnimSpriteCelSystem *animSpriteCelSystem = NULL;
+	AnimSpriteCel *animSpriteCel = NULL;
+	AnimSpriteCel *animSpriteCelReceiver = NULL;
+	// Nombre d'AnimSpriteCels
+	uint32 count = 0;
+	// Tableaux de travail, dans un seul bloc
+	uint32 *block = NULL;
+	uint32 blockSize = 0;
+	uint32 *offsets = NULL;
+	uint32 *targets = NULL;
+	uint32 *roots = NULL;
+	uint32 *senders = NULL;
+	uint32 *indexes = NULL;
+	uint32 *lowLinks = NULL;
+	uint32 *stack = NULL;
+	uint32 *calls = NULL;
+	// Indexes
+	uint32 index = 0;
+	uint32 stepIndex = 0;
+	uint32 receiverIndex = 0;
+	uint32 edgeIndex = 0;
+	uint32 islandIndex = 0;
+	// Racines des îlots d'un émetteur et de son receveur
+	uint32 senderRoot = 0;
+	uint32 receiverRoot = 0;
+	// Étape en attente trouvée
+	uint32 waiting = 0;
+	// Îlot en cours de remplissage
+	AnimSpriteCelIsland *island = NULL;
+
+	// Si le graphe n'est pas défini
+	if (animSpriteCelGraph == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelGraph unknow.\n");
+		return -1;
+	}
+	animSpriteCelSystem = animSpriteCelGraph->system;
+	count = animSpriteCelSystem->animSpriteCelsCount;
+
+	// Analyse vide des enregistrements actuels
+	animSpriteCelGraph->animSpriteCelsCount = count;
+	animSpriteCelGraph->generation = animSpriteCelSystem->generation;
+	animSpriteCelGraph->islandsCount = 0;
+	animSpriteCelGraph->edgesCount = 0;
+	animSpriteCelGraph->cyclesCount = 0;
+	animSpriteCelGraph->orphansCount = 0;
+	animSpriteCelGraph->externalCount = 0;
+
+	// Compte les déclenchements entre AnimSpriteCels enregistrés
+	for (index = 0; index < count; index++) {
+		animSpriteCel = animSpriteCelSystem->animSpriteCels[index];
+		for (stepIndex = 0; stepIndex < animSpriteCel->stepsCount; stepIndex++) {
+			animSpriteCelReceiver = AnimSpriteCelStepReceiver(animSpriteCel, stepIndex);
+			if ((animSpriteCelReceiver != NULL) && (AnimSpriteCelGraphReceiverIndex(animSpriteCelSystem, animSpriteCelReceiver) != ANIMSPRITECELGRAPH_UNVISITED)) {
+				animSpriteCelGraph->edgesCount++;
+			}
+		}
+	}
+
+	// Alloue la mémoire pour les tableaux de travail : arêtes, racines, émetteurs et recherche des cycles
+	blockSize = (count + 1 + animSpriteCelGraph->edgesCount + 6 * count) * sizeof(uint32);
+	block = (uint32 *)AllocMem(blockSize, MEMTYPE_DRAM);
+	// Si c'est un échec
+	if (block == NULL) {
+		// Retourne une erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCelGraph analysis.\n");
+		return -1;
+	}
+	offsets = block;
+	targets = offsets + count + 1;
+	roots = targets + animSpriteCelGraph->edgesCount;
+	senders = roots + count;
+	indexes = senders + count;
+	lowLinks = indexes + count;
+	stack = lowLinks + count;
+	calls = stack + count;
+
+	// Chaque AnimSpriteCel est son propre îlot, sans émetteur
+	for (index = 0; index < count; index++) {
+		roots[index] = index;
+		senders[index] = 0;
+		animSpriteCelGraph->flags[index] = 0;
+	}
+
+	// Arêtes de chaque AnimSpriteCel, dans l'ordre des étapes
+	for (index = 0; index < count; index++) {
+		animSpriteCel = animSpriteCelSystem->animSpriteCels[index];
+		offsets[index] = edgeIndex;
+		waiting = 0;
+		for (stepIndex = 0; stepIndex < animSpriteCel->stepsCount; stepIndex++) {
+
+			// Étape en attente
+			if (ANIMSPRITECEL_STEP_DURATION(animSpriteCel, stepIndex) == 0) {
+				waiting = 1;
+			}
+
+			// Pas de receveur
+			animSpriteCelReceiver = AnimSpriteCelStepReceiver(animSpriteCel, stepIndex);
+			if (animSpriteCelReceiver == NULL) {
+				continue;
+			}
+
+			// Receveur hors du système
+			receiverIndex = AnimSpriteCelGraphReceiverIndex(animSpriteCelSystem, animSpriteCelReceiver);
+			if (receiverIndex == ANIMSPRITECELGRAPH_UNVISITED) {
+				animSpriteCelGraph->flags[index] |= ANIMSPRITECELGRAPH_EXTERNAL;
+				animSpriteCelGraph->externalCount++;
+				continue;
+			}
+
+			// L'émetteur et le receveur sont dans le même îlot, gardé sous son premier membre
+			targets[edgeIndex++] = receiverIndex;
+			senders[receiverIndex]++;
+			senderRoot = AnimSpriteCelGraphRoot(roots, index);
+			receiverRoot = AnimSpriteCelGraphRoot(roots, receiverIndex);
+			if (senderRoot < receiverRoot) {
+				roots[receiverRoot] = senderRoot;
+			} else {
+				roots[senderRoot] = receiverRoot;
+			}
+		}
+
+		// Un AnimSpriteCel en attente est orphelin tant qu'aucun émetteur n'est trouvé (vérifié plus bas)
+		if (waiting == 1) {
+			animSpriteCelGraph->flags[index] |= ANIMSPRITECELGRAPH_ORPHAN;
+		}
+	}
+	offsets[count] = edgeIndex;
+
+	// Orphelins : AnimSpriteCels en attente sans aucun émetteur
+	for (index = 0; index < count; index++) {
+		if (senders[index] > 0) {
+			animSpriteCelGraph->flags[index] &= ~ANIMSPRITECELGRAPH_ORPHAN;
+		}
+		if ((animSpriteCelGraph->flags[index] & ANIMSPRITECELGRAPH_ORPHAN) != 0) {
+			animSpriteCelGraph->orphansCount++;
+		}
+	}
+
+	// Îlots numérotés dans l'ordre de leur premier membre (la racine a le plus petit index)
+	for (index = 0; index < count; index++) {
+		roots[index] = AnimSpriteCelGraphRoot(roots, index);
+	}
+	for (index = 0; index < count; index++) {
+		if (roots[index] == index) {
+			island = &animSpriteCelGraph->islands[animSpriteCelGraph->islandsCount];
+			island->membersFirst = 0;
+			island->membersCount = 0;
+			island->flags = 0;
+			island->cycleMembersCount = 0;
+			island->orphansCount = 0;
+			island->asleep = 0;
+			animSpriteCelGraph->islandIndexes[index] = animSpriteCelGraph->islandsCount;
+			animSpriteCelGraph->islandsCount++;
+		} else {
+			animSpriteCelGraph->islandIndexes[index] = animSpriteCelGraph->islandIndexes[roots[index]];
+		}
+		animSpriteCelGraph->islands[animSpriteCelGraph->islandIndexes[index]].membersCount++;
+	}
+
+	// Cycles (les émetteurs ne servent plus, leur tableau garde la prochaine arête de chaque AnimSpriteCel)
+	AnimSpriteCelGraphCycles(animSpriteCelGraph, offsets, targets, senders, indexes, lowLinks, stack, calls);
+
+	// Membres groupés par îlot, dans l'ordre d'enregistrement
+	for (islandIndex = 1; islandIndex < animSpriteCelGraph->islandsCount; islandIndex++) {
+		animSpriteCelGraph->islands[islandIndex].membersFirst = animSpriteCelGraph->islands[islandIndex - 1].membersFirst + animSpriteCelGraph->islands[islandIndex - 1].membersCount;
+		animSpriteCelGraph->islands[islandIndex - 1].membersCount = 0;
+	}
+	if (animSpriteCelGraph->islandsCount > 0) {
+		animSpriteCelGraph->islands[animSpriteCelGraph->islandsCount - 1].membersCount = 0;
+	}
+	for (index = 0; index < count; index++) {
+		island = &animSpriteCelGraph->islands[animSpriteCelGraph->islandIndexes[index]];
+		animSpriteCelGraph->members[island->membersFirst + island->membersCount] = index;
+		island->membersCount++;
+		island->flags |= animSpriteCelGraph->flags[index];
+		if ((animSpriteCelGraph->flags[index] & ANIMSPRITECELGRAPH_CYCLE) != 0) {
+			island->cycleMembersCount++;
+		}
+		if ((animSpriteCelGraph->flags[index] & ANIMSPRITECELGRAPH_ORPHAN) != 0) {
+			island->orphansCount++;
+		}
+	}
+
+	// Libère les tableaux de travail
+	FreeMem(block, blockSize);
+
+	// Retourne le nombre d'îlots
+	return (int32)animSpriteCelGraph->islandsCount;
+}
+
+// Passe le système au tick suivant avant l'exécution de ses îlots
+int32 AnimSpriteCelGraphBegin(AnimSpriteCelGraph *animSpriteCelGraph) {
+
+	// Si le graphe n'est pas défini
+	if (animSpriteCelGraph == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelGraph unknow.\n");
+		return -1;
+	}
+
+	// Si les enregistrements ou les étapes ont changé depuis l'analyse
+	if (animSpriteCelGraph->generation != animSpriteCelGraph->system->generation) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelGraph analysis out of date (generation %u analyzed, %u now).\n", animSpriteCelGraph->generation, animSpriteCelGraph->system->generation);
+		return -1;
+	}
+
+	// Un déclenchement ne reste dans son îlot que si chaque animation est visitée et le receveur déclenché immédiatement
+	if ((animSpriteCelGraph->system->schedule != POLLING) || (animSpriteCelGraph->system->delivery != IMMEDIATE)) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelGraph islands need POLLING schedule and IMMEDIATE triggers.\n");
+		return -1;
+	}
+
+	// Un tick est un cycle d'affichage, pas les microsecondes écoulées
+	if (animSpriteCelGraph->system->microsecondsCount > 0) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem runs AnimSpriteCels in MICROSECONDS, use AnimSpriteCelSystemTimeRun().\n");
+		return -1;
+	}
+
+	// Cycle d'affichage suivant
+	animSpriteCelGraph->system->tick++;
+
+	// Retourne le nombre d'îlots
+	return (int32)animSpriteCelGraph->islandsCount;
+}
+
+// Exécute les membres d'un îlot pendant un cycle d'affichage
+void AnimSpriteCelGraphIslandRun(AnimSpriteCelGraph *animSpriteCelGraph, uint32 islandIndex) {
+
+	// Îlot en cours d'exécution
+	AnimSpriteCelIsland *island = NULL;
+	// AnimSpriteCels enregistrés
+	AnimSpriteCel **animSpriteCels = NULL;
+	// Index du membre
+	uint32 index = 0;
+	// Membres capables d'avancer
+	uint32 awakeCount = 0;
+
+	// Si l'îlot est inconnu
+	if ((animSpriteCelGraph == NULL) || (islandIndex >= animSpriteCelGraph->islandsCount)) {
+		// Affiche une erreur
+		printf("Error : AnimSpriteCelGraph island unknow.\n");
+		return;
+	}
+
+	// Si rien dans l'îlot ne peut avancer
+	island = &animSpriteCelGraph->islands[islandIndex];
+	if (island->asleep == 1) {
+		return;
+	}
+
+	// Même visite qu'AnimSpriteCelSystemRun(), limitée aux membres
+	animSpriteCels = animSpriteCelGraph->system->animSpriteCels;
+	for (index = island->membersFirst; index < island->membersFirst + island->membersCount; index++) {
+
+		// Compte les membres capables d'avancer
+		awakeCount += AnimSpriteCelSystemVisit(animSpriteCels[animSpriteCelGraph->members[index]]);
+	}
+
+	// Sans membre en cours, aucun déclenchement n'a été envoyé : l'îlot reste tel quel jusqu'au réveil
+	if (awakeCount == 0) {
+		island->asleep = 1;
+	}
+}
+
+// Exécute chaque îlot qui n'est pas endormi
+int32 AnimSpriteCelGraphRun(AnimSpriteCelGraph *animSpriteCelGraph) {
+
+	// Index de l'îlot
+	uint32 islandIndex = 0;
+	// Îlots exécutés
+	int32 runCount = 0;
+
+	// Tick suivant (vérifie l'analyse, l'ordonnancement et la distribution)
+	if (AnimSpriteCelGraphBegin(animSpriteCelGraph) < 0) {
+		return -1;
+	}
+
+	// Îlots dans l'ordre, les endormis sont sautés
+	for (islandIndex = 0; islandIndex < animSpriteCelGraph->islandsCount; islandIndex++) {
+		if (animSpriteCelGraph->islands[islandIndex].asleep == 0) {
+			AnimSpriteCelGraphIslandRun(animSpriteCelGraph, islandIndex);
+			runCount++;
+		}
+	}
+
+	// Retourne le nombre d'îlots exécutés
+	return runCount;
+}
+
+// Réveille l'îlot d'un AnimSpriteCel
+void AnimSpriteCelGraphWake(AnimSpriteCelGraph *animSpriteCelGraph, AnimSpriteCel *animSpriteCel) {
+
+	// Si l'AnimSpriteCel n'est pas dans l'analyse
+	if ((animSpriteCelGraph == NULL) || (animSpriteCel == NULL) || (animSpriteCel->system != animSpriteCelGraph->system) || (animSpriteCel->systemIndex >= animSpriteCelGraph->animSpriteCelsCount)) {
+		// Affiche une erreur
+		printf("Error : AnimSpriteCel not analyzed in this AnimSpriteCelGraph.\n");
+		return;
+	}
+
+	// Visité de nouveau dès le tick suivant
+	animSpriteCelGraph->islands[animSpriteCelGraph->islandIndexes[animSpriteCel->systemIndex]].asleep = 0;
+}
+
+// Affiche l'analyse
+int32 AnimSpriteCelGraphDump(AnimSpriteCelGraph *animSpriteCelGraph) {
+
+	// Système analysé et ses AnimSpriteCels
+	AnimSpriteCelSystem *animSpriteCelSystem = NULL;
+	AnimSpriteCel *animSpriteCel = NULL;
+	AnimSpriteCel *animSpriteCelReceiver = NULL;
+	// Îlot en cours d'affichage
+	AnimSpriteCelIsland *island = NULL;
+	// Indexes
+	uint32 islandIndex = 0;
+	uint32 memberIndex = 0;
+	uint32 index = 0;
+	uint32 stepIndex = 0;
+	uint32 receiverIndex = 0;
+	// Receveurs affichés
+	uint32 receiversCount = 0;
+	// Drapeaux de la ligne
+	uint32 flags = 0;
+
+	// Si le graphe n'est pas défini
+	if (animSpriteCelGraph == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelGraph unknow.\n");
+		return -1;
+	}
+	animSpriteCelSystem = animSpriteCelGraph->system;
+
+	// Graphe entier
+	printf("graph animations %u islands %u edges %u cycles %u orphans %u external %u\n", animSpriteCelGraph->animSpriteCelsCount, animSpriteCelGraph->islandsCount,
+		animSpriteCelGraph->edgesCount, animSpriteCelGraph->cyclesCount, animSpriteCelGraph->orphansCount, animSpriteCelGraph->externalCount);
+
+	for (islandIndex = 0; islandIndex < animSpriteCelGraph->islandsCount; islandIndex++) {
+
+		// Island
+		island = &animSpriteCelGraph->islands[islandIndex];
+		flags = island->flags;
+		printf("island %u members %u cycleMembers %u orphans %u flags %c%c%c asleep %u\n", islandIndex, island->membersCount, island->cycleMembersCount, island->orphansCount,
+			((flags & ANIMSPRITECELGRAPH_CYCLE) != 0) ? 'C' : '-', ((flags & ANIMSPRITECELGRAPH_ORPHAN) != 0) ? 'O' : '-', ((flags & ANIMSPRITECELGRAPH_EXTERNAL) != 0) ? 'E' : '-', island->asleep);
+
+		// Ses membres et les index d'enregistrement de leurs receveurs
+		for (memberIndex = island->membersFirst; memberIndex < island->membersFirst + island->membersCount; memberIndex++) {
+
+			index = animSpriteCelGraph->members[memberIndex];
+			animSpriteCel = animSpriteCelSystem->animSpriteCels[index];
+			flags = animSpriteCelGraph->flags[index];
+			printf("animation %u island %u flags %c%c%c receivers", index, islandIndex,
+				((flags & ANIMSPRITECELGRAPH_CYCLE) != 0) ? 'C' : '-', ((flags & ANIMSPRITECELGRAPH_ORPHAN) != 0) ? 'O' : '-', ((flags & ANIMSPRITECELGRAPH_EXTERNAL) != 0) ? 'E' : '-');
+
+			receiversCount = 0;
+			for (stepIndex = 0; stepIndex < animSpriteCel->stepsCount; stepIndex++) {
+				animSpriteCelReceiver = AnimSpriteCelStepReceiver(animSpriteCel, stepIndex);
+				if (animSpriteCelReceiver == NULL) {
+					continue;
+				}
+				receiverIndex = AnimSpriteCelGraphReceiverIndex(animSpriteCelSystem, animSpriteCelReceiver);
+				if (receiverIndex == ANIMSPRITECELGRAPH_UNVISITED) {
+					printf("%cE", (receiversCount == 0) ? ' ' : ',');
+				} else {
+					printf("%c%u", (receiversCount == 0) ? ' ' : ',', receiverIndex);
+				}
+				receiversCount++;
+			}
+			printf("%s\n", (receiversCount == 0) ? " -" : "");
+		}
+	}
+
+	// Retourne un succès
+	return 1;
+}
+
+// Libère le graphe
+int32 AnimSpriteCelGraphCleanup(AnimSpriteCelGraph *animSpriteCelGraph) {
+
+	// Capacité des tableaux
+	uint32 animSpriteCelsMax = 0;
+
+	// Si le graphe n'est pas défini
+	if (animSpriteCelGraph == NULL) {
+		printf("Error : AnimSpriteCelGraph unknow.\n");
+		return -1;
+	}
+	animSpriteCelsMax = animSpriteCelGraph->animSpriteCelsMax;
+
+	// Libère les tableaux s'ils existent
+	if (animSpriteCelGraph->islandIndexes != NULL) {
+		FreeMem(animSpriteCelGraph->islandIndexes, animSpriteCelsMax * sizeof(uint32));
+	}
+	if (animSpriteCelGraph->members != NULL) {
+		FreeMem(animSpriteCelGraph->members, animSpriteCelsMax * sizeof(uint32));
+	}
+	if (animSpriteCelGraph->flags != NULL) {
+		FreeMem(animSpriteCelGraph->flags, animSpriteCelsMax * sizeof(uint8));
+	}
+	if (animSpriteCelGraph->islands != NULL) {
+		FreeMem(animSpriteCelGraph->islands, animSpriteCelsMax * sizeof(AnimSpriteCelIsland));
+	}
+
+	// Libère la structure AnimSpriteCelGraph elle-même
+	FreeMem(animSpriteCelGraph, sizeof(AnimSpriteCelGraph));
+
+	// Retourne un succès
+	return 1;
+}
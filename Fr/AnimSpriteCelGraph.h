@@ -0,0 +1,197 @@
+#ifndef ANIMSPRITECELGRAPH_H
+#define ANIMSPRITECELGRAPH_H
+
+/******************************************************************************
+**
+**  AnimSpriteCelGraph - Îlots de déclenchements d'un AnimSpriteCelSystem (3DO Cel Engine)
+**
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 17-10-2026
+**
+**  Les receveurs des étapes relient les AnimSpriteCels d'un système en un
+**  graphe de déclenchements. AnimSpriteCelGraphAnalysis() le parcourt une
+**  fois et trouve :
+**
+**    - les îlots : groupes d'AnimSpriteCels reliés par des déclenchements,
+**      dans un sens ou dans l'autre. Un AnimSpriteCel sans receveur ni
+**      émetteur est un îlot à lui seul. Deux îlots ne se déclenchent jamais.
+**
+**    - les cycles : AnimSpriteCels qui se déclenchent eux-mêmes en retour à
+**      travers une chaîne de receveurs (composantes fortement connexes,
+**      Tarjan).
+**
+**    - les orphelins : AnimSpriteCels avec une étape en attente
+**      (frameDuration 0) qu'aucun AnimSpriteCel enregistré ne déclenche.
+**      Seul le jeu peut leur faire passer cette étape.
+**
+**  Les îlots sont des unités d'ordonnancement. Avec l'ordonnancement
+**  POLLING et la distribution IMMEDIATE, un déclenchement reste dans son
+**  îlot : exécuter les îlots un par un, dans n'importe quel ordre, donne
+**  donc le résultat d'AnimSpriteCelSystemRun(). AnimSpriteCelGraphBegin()
+**  passe au tick suivant, puis AnimSpriteCelGraphIslandRun() visite les
+**  membres d'un îlot dans l'ordre d'enregistrement. AnimSpriteCelGraphRun()
+**  fait les deux pour tout le système.
+**
+**  Un îlot dont tous les membres étaient en attente ou terminés pendant sa
+**  visite est endormi : plus rien en lui ne peut envoyer de déclenchement,
+**  ses visites suivantes sont donc sautées. AnimSpriteCelGraphWake() le
+**  réveille quand le jeu déclenche ou redémarre l'un de ses membres.
+**
+**  AnimSpriteCelGraphDump() affiche l'analyse, une ligne par îlot et par
+**  AnimSpriteCel, pour les outils :
+**
+**    graph animations 6 islands 2 edges 4 cycles 1 orphans 1 external 0
+**    island 0 members 4 cycleMembers 2 orphans 0 flags C-- asleep 0
+**    animation 0 island 0 flags C-- receivers 1
+**    ...
+**
+**  Les drapeaux sont affichés C (dans un cycle), O (orphelin) et E
+**  (déclenche un AnimSpriteCel qui n'est pas enregistré dans le système),
+**  "-" quand ils ne sont pas levés.
+**
+**  Notes importantes :
+**
+**    - L'analyse est une image du système : elle doit être refaite après un
+**      enregistrement, un désenregistrement ou un changement de receveurs.
+**      AnimSpriteCelGraphBegin() refuse un système dont la génération a
+**      changé depuis, que chacun d'eux et chaque configuration d'étape d'un
+**      AnimSpriteCel enregistré font avancer.
+**
+**    - Des îlots distincts peuvent être exécutés depuis plusieurs threads
+**      entre deux appels à AnimSpriteCelGraphBegin(), si aucun membre ne
+**      déclenche un AnimSpriteCel hors du système (drapeau E), si les étapes
+**      aléatoires sont amorcées, si la trace n'enregistre pas, si
+**      l'empreinte d'état n'est pas gardée (sa somme est partagée), si les
+**      événements des étapes ne sont pas collectés (leur tampon est partagé)
+**      et si les CCB changés ne sont pas suivis (les membres d'un îlot
+**      partagent des mots du champ de bits avec d'autres îlots).
+**
+**    - L'analyse alloue ses tableaux de travail et les libère avant de
+**      retourner. Le graphe lui-même est dimensionné par la capacité du
+**      système.
+**
+**  Rôles des structures :
+**
+**    AnimSpriteCelIsland
+**      - membersFirst : premier membre dans le tableau "members" du graphe
+**      - membersCount : nombre de membres
+**      - flags : union des drapeaux des membres
+**      - cycleMembersCount : membres dans un cycle
+**      - orphansCount : membres orphelins
+**      - asleep : aucun membre ne peut avancer avant le réveil par le jeu
+**
+**    AnimSpriteCelGraph
+**      - system : système analysé
+**      - animSpriteCelsMax : capacité des tableaux (capacité du système)
+**      - animSpriteCelsCount : nombre d'AnimSpriteCels analysés
+**      - generation : génération du système lors de l'analyse
+**      - islandIndexes : îlot de chaque AnimSpriteCel (par index d'enregistrement)
+**      - members : index d'enregistrement groupés par îlot
+**      - flags : drapeaux de chaque AnimSpriteCel
+**      - islands : îlots, dans l'ordre de leur premier membre
+**      - islandsCount : nombre d'îlots
+**      - edgesCount : déclenchements entre AnimSpriteCels enregistrés
+**      - cyclesCount : nombre de cycles
+**      - orphansCount : nombre d'orphelins
+**      - externalCount : déclenchements vers des AnimSpriteCels hors du système
+**
+**  Fonctions principales :
+**
+**    AnimSpriteCelGraphInitialization()
+**      -> Crée le graphe d'un système et l'analyse.
+**
+**    AnimSpriteCelGraphAnalysis()
+**      -> Trouve les îlots, les cycles et les orphelins.
+**
+**    AnimSpriteCelGraphBegin()
+**      -> Passe le système au tick suivant avant l'exécution de ses îlots.
+**
+**    AnimSpriteCelGraphIslandRun()
+**      -> Exécute les membres d'un îlot pendant un cycle d'affichage.
+**
+**    AnimSpriteCelGraphRun()
+**      -> Exécute chaque îlot qui n'est pas endormi.
+**
+**    AnimSpriteCelGraphWake()
+**      -> Réveille l'îlot d'un AnimSpriteCel.
+**
+**    AnimSpriteCelGraphDump()
+**      -> Affiche l'analyse.
+**
+**    AnimSpriteCelGraphCleanup()
+**      -> Libère le graphe.
+**
+******************************************************************************/
+
+// int32
+#include "types.h"
+// AnimSpriteCelSystem
+#include "AnimSpriteCelSystem.h"
+
+// Drapeaux des AnimSpriteCels et des îlots
+#define ANIMSPRITECELGRAPH_CYCLE 0x01
+#define ANIMSPRITECELGRAPH_ORPHAN 0x02
+#define ANIMSPRITECELGRAPH_EXTERNAL 0x04
+
+typedef struct {
+	// Premier membre dans le tableau des membres
+	uint32 membersFirst;
+	// Nombre de membres
+	uint32 membersCount;
+	// Union des drapeaux des membres
+	uint32 flags;
+	// Membres dans un cycle
+	uint32 cycleMembersCount;
+	// Membres orphelins
+	uint32 orphansCount;
+	// Aucun membre ne peut avancer avant le réveil
+	uint32 asleep;
+} AnimSpriteCelIsland;
+
+typedef struct {
+	// Système analysé
+	AnimSpriteCelSystem *system;
+	// Capacité des tableaux
+	uint32 animSpriteCelsMax;
+	// Nombre d'AnimSpriteCels analysés
+	uint32 animSpriteCelsCount;
+	// Génération du système lors de l'analyse
+	uint32 generation;
+	// Îlot de chaque AnimSpriteCel
+	uint32 *islandIndexes;
+	// Index d'enregistrement groupés par îlot
+	uint32 *members;
+	// Drapeaux de chaque AnimSpriteCel
+	uint8 *flags;
+	// Îlots, dans l'ordre de leur premier membre
+	AnimSpriteCelIsland *islands;
+	// Nombre d'îlots
+	uint32 islandsCount;
+	// Déclenchements entre AnimSpriteCels enregistrés
+	uint32 edgesCount;
+	// Nombre de cycles
+	uint32 cyclesCount;
+	// Nombre d'orphelins
+	uint32 orphansCount;
+	// Déclenchements vers des AnimSpriteCels hors du système
+	uint32 externalCount;
+} AnimSpriteCelGraph;
+
+// Crée le graphe d'un système et l'analyse
+AnimSpriteCelGraph *AnimSpriteCelGraphInitialization(AnimSpriteCelSystem *animSpriteCelSystem);
+// Trouve les îlots, les cycles et les orphelins
+int32 AnimSpriteCelGraphAnalysis(AnimSpriteCelGraph *animSpriteCelGraph);
+// Passe le système au tick suivant avant l'exécution de ses îlots
+int32 AnimSpriteCelGraphBegin(AnimSpriteCelGraph *animSpriteCelGraph);
+// Exécute les membres d'un îlot pendant un cycle d'affichage
+void AnimSpriteCelGraphIslandRun(AnimSpriteCelGraph *animSpriteCelGraph, uint32 islandIndex);
+// Exécute chaque îlot qui n'est pas endormi
+int32 AnimSpriteCelGraphRun(AnimSpriteCelGraph *animSpriteCelGraph);
+// Réveille l'îlot d'un AnimSpriteCel
+void AnimSpriteCelGraphWake(AnimSpriteCelGraph *animSpriteCelGraph, AnimSpriteCel *animSpriteCel);
+// Affiche l'analyse
+int32 AnimSpriteCelGraphDump(AnimSpriteCelGraph *animSpriteCelGraph);
+// Libère le graphe
+int32 AnimSpriteCelGraphCleanup(AnimSpriteCelGraph *animSpriteCelGraph);
+
+#endif // ANIMSPRITECELGRAPH_H
@@ -0,0 +1,280 @@
+/******************************************************************************
+**
+**  AnimSpriteCelHashTool - Compare par dichotomie deux enregistrements de l'empreinte d'état (outil hôte)
+**
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 17-10-2026
+**
+**  Programme hors ligne, compilé et exécuté sur l'ordinateur de développement
+**  avec n'importe quel compilateur C (il n'utilise pas le SDK 3DO) :
+**
+**    cc -o AnimSpriteCelHashTool AnimSpriteCelHashTool.c
+**    AnimSpriteCelHashTool first.bin second.bin
+**
+**  Les entrées sont les tampons écrits par AnimSpriteCelSystemHashCopy() pour
+**  deux exécutions de la même scène (deux pairs, ou un jeu et son rejeu),
+**  sauvegardés tels quels. L'ordre des octets de chacun est déduit du nombre
+**  magique : un enregistrement de la 3DO (big-endian) peut donc être comparé
+**  à un enregistrement de l'hôte (little-endian).
+**
+**  Chaque changement enregistré contient l'empreinte d'état après lui. Tant
+**  que les exécutions concordent, leurs changements sont les mêmes un à un ;
+**  dès qu'un AnimSpriteCel dérive, l'empreinte d'état porte la différence
+**  dans tous les changements suivants (jusqu'à ce que les états se
+**  rejoignent, ce qu'une empreinte de 32 bits rend improbable). L'outil
+**  cherche par dichotomie sur cette règle, en autant de comparaisons que les
+**  bits de leur nombre, le premier changement qui diffère, et affiche son
+**  tick, son AnimSpriteCel (index d'enregistrement), les têtes de lecture
+**  des deux exécutions et le changement précédent de cet AnimSpriteCel :
+**
+**    first difference: change 5296, tick 159, animation 45 (14 comparisons)
+**
+**                       tick animation  step dir  remaining iterations     random       hash
+**      first.bin         159        45     2  +1          0   INFINITE 0x65C19C9E 0xCB5C835A
+**      second.bin        159        45     2  +1          0   INFINITE 0x65C19C9F 0xC83EC127
+**      previous          150        45     1  +1          8   INFINITE 0x65C19C9E 0x9C540B32
+**
+**  Ici le générateur de l'animation 45 a dérivé d'un bit : l'étape commencée
+**  au tick 159 a la même durée dans les deux exécutions, mais la prochaine
+**  durée aléatoire sera différente.
+**
+**  Il retourne 0 si les enregistrements sont les mêmes, 1 s'ils diffèrent et
+**  2 si un fichier ne peut pas être lu.
+**
+**  La disposition doit correspondre à AnimSpriteCelSystem.h.
+**
+******************************************************************************/
+
+// printf(), fopen()
+#include <stdio.h>
+// malloc(), free()
+#include <stdlib.h>
+
+// Valeurs d'AnimSpriteCelSystem.h et de DefinitionsArguments.h
+#define TOOL_MAGIC 0x48415348UL
+#define TOOL_HEADER_SIZE 20UL
+#define TOOL_ENTRY_SIZE 28UL
+#define TOOL_BACKWARD 0x0001UL
+#define TOOL_INFINITE 2147483647UL
+
+// Changement enregistré
+typedef struct {
+	unsigned long tick;
+	unsigned long animationIndex;
+	unsigned long stepIndex;
+	unsigned long flags;
+	unsigned long remainingCycles;
+	unsigned long iterationsCount;
+	unsigned long randomState;
+	unsigned long stateHash;
+} ToolEntry;
+
+// Enregistrement d'une exécution
+typedef struct {
+	// Nom du fichier
+	const char *name;
+	// Valeurs de l'en-tête
+	unsigned long entriesCount;
+	unsigned long entriesLost;
+	unsigned long tick;
+	unsigned long stateHash;
+	// Changes
+	ToolEntry *entries;
+} ToolRecord;
+
+// Lit une valeur de 32 bits dans l'ordre des octets de l'enregistrement
+static unsigned long ToolRead32(const unsigned char *bytes, int littleEndian) {
+
+	// Si l'enregistrement est little-endian
+	if (littleEndian == 1) {
+		return (unsigned long)bytes[0] | ((unsigned long)bytes[1] << 8) | ((unsigned long)bytes[2] << 16) | ((unsigned long)bytes[3] << 24);
+	}
+	return ((unsigned long)bytes[0] << 24) | ((unsigned long)bytes[1] << 16) | ((unsigned long)bytes[2] << 8) | (unsigned long)bytes[3];
+}
+
+// Lit une valeur de 16 bits dans l'ordre des octets de l'enregistrement
+static unsigned long ToolRead16(const unsigned char *bytes, int littleEndian) {
+
+	// Si l'enregistrement est little-endian
+	if (littleEndian == 1) {
+		return (unsigned long)bytes[0] | ((unsigned long)bytes[1] << 8);
+	}
+	return ((unsigned long)bytes[0] << 8) | (unsigned long)bytes[1];
+}
+
+// Charge un enregistrement, retourne 0 en cas d'erreur
+static int ToolLoad(ToolRecord *record) {
+
+	// Fichier de l'enregistrement
+	FILE *input = NULL;
+	unsigned char header[TOOL_HEADER_SIZE];
+	unsigned char entry[TOOL_ENTRY_SIZE];
+	// Ordre des octets de l'enregistrement
+	int littleEndian = 0;
+	// Index du changement
+	unsigned long entryIndex = 0;
+
+	// Ouvrir l'enregistrement
+	input = fopen(record->name, "rb");
+	if (input == NULL) {
+		printf("Error : can't open %s.\n", record->name);
+		return 0;
+	}
+
+	// En-tête, dans l'un ou l'autre ordre des octets
+	if (fread(header, 1, TOOL_HEADER_SIZE, input) != TOOL_HEADER_SIZE) {
+		printf("Error : %s is not a record of the state hash.\n", record->name);
+		fclose(input);
+		return 0;
+	}
+	if (ToolRead32(header, 0) != TOOL_MAGIC) {
+		littleEndian = 1;
+	}
+	if (ToolRead32(header, littleEndian) != TOOL_MAGIC) {
+		printf("Error : %s is not a record of the state hash.\n", record->name);
+		fclose(input);
+		return 0;
+	}
+	record->entriesCount = ToolRead32(header + 4, littleEndian);
+	record->entriesLost = ToolRead32(header + 8, littleEndian);
+	record->tick = ToolRead32(header + 12, littleEndian);
+	record->stateHash = ToolRead32(header + 16, littleEndian);
+
+	// Changements (un de plus pour qu'un enregistrement vide alloue quand même)
+	record->entries = (ToolEntry *)malloc((record->entriesCount + 1) * sizeof(ToolEntry));
+	if (record->entries == NULL) {
+		printf("Error : out of memory.\n");
+		fclose(input);
+		return 0;
+	}
+	for (entryIndex = 0; entryIndex < record->entriesCount; entryIndex++) {
+
+		if (fread(entry, 1, TOOL_ENTRY_SIZE, input) != TOOL_ENTRY_SIZE) {
+			printf("Warning : %s cut after %lu changes.\n", record->name, entryIndex);
+			record->entriesCount = entryIndex;
+			break;
+		}
+
+		record->entries[entryIndex].tick = ToolRead32(entry, littleEndian);
+		record->entries[entryIndex].animationIndex = ToolRead32(entry + 4, littleEndian);
+		record->entries[entryIndex].stepIndex = ToolRead16(entry + 8, littleEndian);
+		record->entries[entryIndex].flags = ToolRead16(entry + 10, littleEndian);
+		record->entries[entryIndex].remainingCycles = ToolRead32(entry + 12, littleEndian);
+		record->entries[entryIndex].iterationsCount = ToolRead32(entry + 16, littleEndian);
+		record->entries[entryIndex].randomState = ToolRead32(entry + 20, littleEndian);
+		record->entries[entryIndex].stateHash = ToolRead32(entry + 24, littleEndian);
+	}
+	fclose(input);
+
+	printf("%s: %lu changes (%s) from tick %lu, %lu lost once full\n", record->name, record->entriesCount, (littleEndian == 1) ? "little-endian" : "big-endian", record->tick, record->entriesLost);
+	return 1;
+}
+
+// Compare deux changements, retourne 1 s'ils sont les mêmes
+static int ToolSame(const ToolEntry *first, const ToolEntry *second) {
+	return (first->tick == second->tick) && (first->animationIndex == second->animationIndex) && (first->stepIndex == second->stepIndex) && (first->flags == second->flags)
+		&& (first->remainingCycles == second->remainingCycles) && (first->iterationsCount == second->iterationsCount) && (first->randomState == second->randomState)
+		&& (first->stateHash == second->stateHash);
+}
+
+// Affiche un changement sur une ligne
+static void ToolPrint(const char *label, const ToolEntry *entry) {
+
+	printf("  %-12s %10lu %9lu %5lu %3s ", label, entry->tick, entry->animationIndex, entry->stepIndex, ((entry->flags & TOOL_BACKWARD) != 0) ? "-1" : "+1");
+	printf("%10lu ", entry->remainingCycles);
+	if (entry->iterationsCount == TOOL_INFINITE) {
+		printf("%10s ", "INFINITE");
+	} else {
+		printf("%10lu ", entry->iterationsCount);
+	}
+	printf("0x%08lX 0x%08lX\n", entry->randomState, entry->stateHash);
+}
+
+int main(int argc, char *argv[]) {
+
+	// Enregistrements des deux exécutions
+	ToolRecord records[2];
+	// Changements présents dans les deux enregistrements
+	unsigned long entriesCount = 0;
+	// Dichotomie : les changements avant "low" sont les mêmes, celui à "high" diffère
+	unsigned long low = 0;
+	unsigned long high = 0;
+	unsigned long middle = 0;
+	unsigned long comparisons = 0;
+	// Changement précédent de l'AnimSpriteCel qui dérive
+	unsigned long previous = 0;
+	// Result
+	int different = 0;
+
+	// Si les fichiers sont absents
+	if (argc != 3) {
+		printf("Usage: AnimSpriteCelHashTool first.bin second.bin\n");
+		return 2;
+	}
+
+	// Charger les deux enregistrements
+	records[0].name = argv[1];
+	records[0].entries = NULL;
+	records[1].name = argv[2];
+	records[1].entries = NULL;
+	if ((ToolLoad(&records[0]) == 0) || (ToolLoad(&records[1]) == 0)) {
+		free(records[0].entries);
+		free(records[1].entries);
+		return 2;
+	}
+	printf("\n");
+
+	// Si les enregistrements ne sont pas partis du même état
+	if ((records[0].tick != records[1].tick) || (records[0].stateHash != records[1].stateHash)) {
+		printf("The runs differ before the recordings: tick %lu hash 0x%08lX, tick %lu hash 0x%08lX.\n", records[0].tick, records[0].stateHash, records[1].tick, records[1].stateHash);
+		free(records[0].entries);
+		free(records[1].entries);
+		return 1;
+	}
+
+	// Chercher par dichotomie dans les changements des deux enregistrements
+	entriesCount = (records[0].entriesCount < records[1].entriesCount) ? records[0].entriesCount : records[1].entriesCount;
+	low = 0;
+	high = entriesCount;
+	while (low < high) {
+		middle = low + (high - low) / 2;
+		comparisons++;
+		if (ToolSame(&records[0].entries[middle], &records[1].entries[middle]) == 1) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+
+	// Si tous les changements communs sont les mêmes
+	if (low == entriesCount) {
+		if (records[0].entriesCount == records[1].entriesCount) {
+			printf("The records are the same (%lu changes, %lu comparisons).\n", entriesCount, comparisons);
+		} else {
+			different = 1;
+			printf("The records are the same for %lu changes, then %s goes on alone (%lu comparisons).\n", entriesCount, (records[0].entriesCount > records[1].entriesCount) ? records[0].name : records[1].name, comparisons);
+		}
+		if ((records[0].entriesLost != 0) || (records[1].entriesLost != 0)) {
+			printf("The changes after a full record were not compared.\n");
+		}
+		free(records[0].entries);
+		free(records[1].entries);
+		return different;
+	}
+
+	// Premier changement qui diffère, et le précédent de son AnimSpriteCel dans la première exécution
+	printf("first difference: change %lu, tick %lu, animation %lu (%lu comparisons)\n\n", low, records[0].entries[low].tick, records[0].entries[low].animationIndex, comparisons);
+	printf("  %-12s %10s %9s %5s %3s %10s %10s %10s %10s\n", "", "tick", "animation", "step", "dir", "remaining", "iterations", "random", "hash");
+	ToolPrint(records[0].name, &records[0].entries[low]);
+	ToolPrint(records[1].name, &records[1].entries[low]);
+	for (previous = low; previous > 0; previous--) {
+		if (records[0].entries[previous - 1].animationIndex == records[0].entries[low].animationIndex) {
+			ToolPrint("previous", &records[0].entries[previous - 1]);
+			break;
+		}
+	}
+
+	free(records[0].entries);
+	free(records[1].entries);
+	return 1;
+}
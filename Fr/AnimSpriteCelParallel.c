@@ -0,0 +1,260 @@
+#include "AnimSpriteCelParallel.h"
+
+// animSpriteCelTrace
+#include "AnimSpriteCelTrace.h"
+// AllocMem(), FreeMem(), MEMTYPE_DRAM
+#include "mem.h"
+// printf()
+#include "stdio.h"
+
+// Exécute les partitions de la plage d'un travailleur, puis celles qui restent dans les autres plages
+static void AnimSpriteCelParallelWork(AnimSpriteCelParallelWorker *animSpriteCelParallelWorker) {
+
+	// Exécution parallèle
+	AnimSpriteCelParallel *animSpriteCelParallel = animSpriteCelParallelWorker->parallel;
+	// Plage en cours de vidage
+	AnimSpriteCelParallelWorker *range = NULL;
+	// Partition réservée
+	uint32 partitionIndex = 0;
+	// Plages visitées
+	uint32 rangeIndex = 0;
+
+	// Sa propre plage d'abord, puis les suivantes à tour de rôle
+	for (rangeIndex = 0; rangeIndex < animSpriteCelParallel->workersCount; rangeIndex++) {
+
+		range = &animSpriteCelParallel->workers[(animSpriteCelParallelWorker->workerIndex + rangeIndex) % animSpriteCelParallel->workersCount];
+
+		// Réserve les partitions une par une jusqu'à ce que la plage soit vide
+		while (1) {
+			partitionIndex = __sync_fetch_and_add(&range->partitionNext, 1);
+			if (partitionIndex >= range->partitionEnd) {
+				break;
+			}
+			AnimSpriteCelSystemPartitionRun(animSpriteCelParallel->system, partitionIndex);
+			animSpriteCelParallelWorker->partitionsRun++;
+			if (rangeIndex > 0) {
+				animSpriteCelParallelWorker->partitionsStolen++;
+			}
+		}
+	}
+}
+
+// Corps des threads des travailleurs : exécute chaque nouveau tick jusqu'à l'arrêt
+static void *AnimSpriteCelParallelThread(void *argument) {
+
+	// Travailleur du thread
+	AnimSpriteCelParallelWorker *animSpriteCelParallelWorker = (AnimSpriteCelParallelWorker *)argument;
+	// Exécution parallèle
+	AnimSpriteCelParallel *animSpriteCelParallel = animSpriteCelParallelWorker->parallel;
+	// Dernier tick exécuté par le thread
+	uint32 generation = 0;
+
+	pthread_mutex_lock(&animSpriteCelParallel->mutex);
+	while (1) {
+
+		// Attend un nouveau tick
+		while ((animSpriteCelParallel->generation == generation) && (animSpriteCelParallel->stopping == 0)) {
+			pthread_cond_wait(&animSpriteCelParallel->started, &animSpriteCelParallel->mutex);
+		}
+		if (animSpriteCelParallel->stopping == 1) {
+			break;
+		}
+		generation = animSpriteCelParallel->generation;
+
+		// L'exécute sans le verrou
+		pthread_mutex_unlock(&animSpriteCelParallel->mutex);
+		AnimSpriteCelParallelWork(animSpriteCelParallelWorker);
+		pthread_mutex_lock(&animSpriteCelParallel->mutex);
+
+		// Le dernier thread terminé réveille le thread appelant
+		animSpriteCelParallel->workersRunning--;
+		if (animSpriteCelParallel->workersRunning == 0) {
+			pthread_cond_signal(&animSpriteCelParallel->finished);
+		}
+	}
+	pthread_mutex_unlock(&animSpriteCelParallel->mutex);
+
+	return NULL;
+}
+
+// Démarre les threads des travailleurs d'un système partitionné
+AnimSpriteCelParallel *AnimSpriteCelParallelInitialization(AnimSpriteCelSystem *animSpriteCelSystem, uint32 workersCount) {
+
+	// Exécution parallèle nouvellement créée
+	AnimSpriteCelParallel *animSpriteCelParallel = NULL;
+	// Index de travailleur
+	uint32 index = 0;
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Affiche un message d'erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return NULL;
+	}
+
+	// Si le système n'est pas partitionné
+	if (animSpriteCelSystem->outboxes == NULL) {
+		// Affiche un message d'erreur
+		printf("Error : AnimSpriteCelSystem partitions not configured.\n");
+		return NULL;
+	}
+
+	// S'il n'y a aucun travailleur
+	if (workersCount == 0) {
+		// Affiche un message d'erreur
+		printf("Error : AnimSpriteCelParallel needs at least one worker.\n");
+		return NULL;
+	}
+
+	// Alloue la mémoire pour AnimSpriteCelParallel
+	animSpriteCelParallel = (AnimSpriteCelParallel *)AllocMem(sizeof(AnimSpriteCelParallel), MEMTYPE_DRAM);
+	// Si c'est un échec
+	if (animSpriteCelParallel == NULL) {
+		// Affiche un message d'erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCelParallel.\n");
+		return NULL;
+	}
+
+	// Alloue la mémoire des travailleurs et de leurs threads
+	animSpriteCelParallel->workers = (AnimSpriteCelParallelWorker *)AllocMem(workersCount * sizeof(AnimSpriteCelParallelWorker), MEMTYPE_DRAM);
+	animSpriteCelParallel->threads = (pthread_t *)AllocMem(workersCount * sizeof(pthread_t), MEMTYPE_DRAM);
+	// Si une allocation échoue
+	if ((animSpriteCelParallel->workers == NULL) || (animSpriteCelParallel->threads == NULL)) {
+		// Libère la mémoire allouée précédemment
+		if (animSpriteCelParallel->workers != NULL) {
+			FreeMem(animSpriteCelParallel->workers, workersCount * sizeof(AnimSpriteCelParallelWorker));
+		}
+		if (animSpriteCelParallel->threads != NULL) {
+			FreeMem(animSpriteCelParallel->threads, workersCount * sizeof(pthread_t));
+		}
+		FreeMem(animSpriteCelParallel, sizeof(AnimSpriteCelParallel));
+		// Affiche un message d'erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCelParallel workers.\n");
+		return NULL;
+	}
+
+	// Aucun tick commencé
+	animSpriteCelParallel->system = animSpriteCelSystem;
+	animSpriteCelParallel->workersCount = workersCount;
+	animSpriteCelParallel->workersMax = workersCount;
+	animSpriteCelParallel->generation = 0;
+	animSpriteCelParallel->workersRunning = 0;
+	animSpriteCelParallel->stopping = 0;
+	pthread_mutex_init(&animSpriteCelParallel->mutex, NULL);
+	pthread_cond_init(&animSpriteCelParallel->started, NULL);
+	pthread_cond_init(&animSpriteCelParallel->finished, NULL);
+
+	// Plages vides
+	for (index = 0; index < workersCount; index++) {
+		animSpriteCelParallel->workers[index].parallel = animSpriteCelParallel;
+		animSpriteCelParallel->workers[index].workerIndex = index;
+		animSpriteCelParallel->workers[index].partitionNext = 0;
+		animSpriteCelParallel->workers[index].partitionEnd = 0;
+		animSpriteCelParallel->workers[index].partitionsRun = 0;
+		animSpriteCelParallel->workers[index].partitionsStolen = 0;
+	}
+
+	// Démarre les threads des travailleurs 1 et suivants, le travailleur 0 est le thread appelant
+	for (index = 1; index < workersCount; index++) {
+		if (pthread_create(&animSpriteCelParallel->threads[index], NULL, AnimSpriteCelParallelThread, &animSpriteCelParallel->workers[index]) != 0) {
+			// Garde les threads déjà démarrés
+			printf("Error : AnimSpriteCelParallel can't start worker %u, %u workers kept.\n", index, index);
+			animSpriteCelParallel->workersCount = index;
+			break;
+		}
+	}
+
+	// Retourne l'AnimSpriteCelParallel nouvellement créé
+	return animSpriteCelParallel;
+}
+
+// Exécute un tick du système sur tous les travailleurs
+int32 AnimSpriteCelParallelRun(AnimSpriteCelParallel *animSpriteCelParallel) {
+
+	// Partitions du tick
+	int32 partitionsCount = 0;
+	// Index de travailleur
+	uint32 index = 0;
+
+	// Si l'exécution parallèle n'est pas définie
+	if (animSpriteCelParallel == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelParallel unknow.\n");
+		return -1;
+	}
+
+#if ANIMSPRITECEL_TRACE == 1
+	// Si la trace enregistre
+	if (animSpriteCelTrace.events != NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelParallel can't run while AnimSpriteCelTrace is recording.\n");
+		return -1;
+	}
+#endif
+
+	// Commence le tick (vérifie l'ordonnancement et la livraison)
+	partitionsCount = AnimSpriteCelSystemPartitionBegin(animSpriteCelParallel->system);
+	if (partitionsCount < 0) {
+		return -1;
+	}
+
+	// Répartit les partitions en plages contiguës
+	for (index = 0; index < animSpriteCelParallel->workersCount; index++) {
+		animSpriteCelParallel->workers[index].partitionNext = (uint32)partitionsCount * index / animSpriteCelParallel->workersCount;
+		animSpriteCelParallel->workers[index].partitionEnd = (uint32)partitionsCount * (index + 1) / animSpriteCelParallel->workersCount;
+	}
+
+	// Réveille les threads
+	pthread_mutex_lock(&animSpriteCelParallel->mutex);
+	animSpriteCelParallel->generation++;
+	animSpriteCelParallel->workersRunning = animSpriteCelParallel->workersCount - 1;
+	pthread_cond_broadcast(&animSpriteCelParallel->started);
+	pthread_mutex_unlock(&animSpriteCelParallel->mutex);
+
+	// Le thread appelant est le travailleur 0
+	AnimSpriteCelParallelWork(&animSpriteCelParallel->workers[0]);
+
+	// Attend les autres travailleurs
+	pthread_mutex_lock(&animSpriteCelParallel->mutex);
+	while (animSpriteCelParallel->workersRunning > 0) {
+		pthread_cond_wait(&animSpriteCelParallel->finished, &animSpriteCelParallel->mutex);
+	}
+	pthread_mutex_unlock(&animSpriteCelParallel->mutex);
+
+	// Fusionne les boîtes d'envoi et distribue les déclenchements du tick
+	return AnimSpriteCelSystemPartitionEnd(animSpriteCelParallel->system);
+}
+
+// Termine les threads des travailleurs et libère la structure
+int32 AnimSpriteCelParallelCleanup(AnimSpriteCelParallel *animSpriteCelParallel) {
+
+	// Index de travailleur
+	uint32 index = 0;
+
+	// Si l'exécution parallèle n'est pas définie
+	if (animSpriteCelParallel == NULL) {
+		printf("Error : AnimSpriteCelParallel unknow.\n");
+		return -1;
+	}
+
+	// Arrête les threads et les attend
+	pthread_mutex_lock(&animSpriteCelParallel->mutex);
+	animSpriteCelParallel->stopping = 1;
+	pthread_cond_broadcast(&animSpriteCelParallel->started);
+	pthread_mutex_unlock(&animSpriteCelParallel->mutex);
+	for (index = 1; index < animSpriteCelParallel->workersCount; index++) {
+		pthread_join(animSpriteCelParallel->threads[index], NULL);
+	}
+
+	pthread_cond_destroy(&animSpriteCelParallel->finished);
+	pthread_cond_destroy(&animSpriteCelParallel->started);
+	pthread_mutex_destroy(&animSpriteCelParallel->mutex);
+
+	// Libère les travailleurs, leurs threads et la structure elle-même
+	FreeMem(animSpriteCelParallel->workers, animSpriteCelParallel->workersMax * sizeof(AnimSpriteCelParallelWorker));
+	FreeMem(animSpriteCelParallel->threads, animSpriteCelParallel->workersMax * sizeof(pthread_t));
+	FreeMem(animSpriteCelParallel, sizeof(AnimSpriteCelParallel));
+
+	// Retourne un succès
+	return 1;
+}
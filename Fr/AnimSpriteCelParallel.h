@@ -0,0 +1,151 @@
+#ifndef ANIMSPRITECELPARALLEL_H
+#define ANIMSPRITECELPARALLEL_H
+
+/******************************************************************************
+**
+**  AnimSpriteCelParallel - Exécution multi-thread d'un AnimSpriteCelSystem (hôte)
+**
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 17-10-2026
+**
+**  La 3DO n'a qu'un ARM60, ce module est donc destiné à l'ordinateur de
+**  développement et aux simulations sans affichage : il utilise les threads
+**  POSIX et les fonctions atomiques intégrées de GCC et Clang, et se
+**  construit avec -pthread (voir AnimSpriteCelBenchmark.c).
+**
+**  AnimSpriteCelParallelRun() exécute un tick d'un système partitionné (voir
+**  AnimSpriteCelSystemPartitionConfiguration()) sur plusieurs travailleurs :
+**  le thread appelant est le travailleur 0, les autres sont des threads
+**  démarrés une fois par AnimSpriteCelParallelInitialization() et réveillés
+**  à chaque tick.
+**
+**  Vol de travail : à chaque tick, les partitions sont réparties en plages
+**  contiguës, une par travailleur. Un travailleur réserve les partitions de
+**  sa plage une par une avec un incrément atomique de la prochaine partition
+**  de la plage. Une fois sa plage terminée, il réserve de la même façon les
+**  partitions qui restent dans les autres plages, ainsi un travailleur ralenti
+**  par des partitions lourdes (chaînes de déclenchements, étapes aléatoires)
+**  est aidé par les autres au lieu de retenir le tick.
+**
+**  Les déclenchements envoyés par une partition vont dans sa propre boîte
+**  d'envoi, fusionnée dans l'ordre des partitions par
+**  AnimSpriteCelSystemPartitionEnd() : le résultat du tick est exactement
+**  celui d'AnimSpriteCelSystemRun(), quels que soient le nombre de
+**  travailleurs et les partitions que chacun a exécutées.
+**
+**  Notes importantes :
+**
+**    - Mêmes conditions qu'un tick partitionné : ordonnancement POLLING,
+**      distribution SAME_TICK ou NEXT_TICK, étapes aléatoires avec graine
+**      (AnimSpriteCelSystemSeed()) et aucune trace en enregistrement (le
+**      tampon circulaire n'a qu'un seul écrivain). Lorsque les CCB changés
+**      sont suivis, la taille des partitions doit être un multiple de 32.
+**      L'empreinte d'état peut être gardée, chaque partition ajoutant ses
+**      changements à la fin du tick, mais pas enregistrée. Les événements des
+**      étapes peuvent être collectés, chaque partition les gardant dans sa
+**      boîte d'envoi.
+**
+**    - Des partitions de quelques milliers d'AnimSpriteCels rendent les
+**      réservations rares tout en en laissant assez à répartir : 1 000 000
+**      d'AnimSpriteCels en partitions de 4 096 donnent 245 partitions.
+**
+**    - Le système ne doit être ni exécuté ni modifié par un autre thread
+**      pendant AnimSpriteCelParallelRun().
+**
+**  Rôle des structures :
+**
+**    AnimSpriteCelParallelWorker
+**      - parallel : exécution parallèle du travailleur
+**      - workerIndex : index du travailleur (0 = thread appelant)
+**      - partitionNext : prochaine partition de la plage du travailleur (réservée atomiquement)
+**      - partitionEnd : fin de la plage du travailleur
+**      - partitionsRun, partitionsStolen : partitions exécutées, et prises dans
+**        d'autres plages (statistiques)
+**      - padding : sépare les compteurs de réservation (faux partage)
+**
+**    AnimSpriteCelParallel
+**      - system : système partitionné exécuté
+**      - workers : travailleurs, le premier est le thread appelant
+**      - workersCount : nombre de travailleurs
+**      - workersMax : nombre de travailleurs alloués (plus que workersCount si
+**        un thread n'a pas pu démarrer)
+**      - threads : threads des travailleurs 1 et suivants
+**      - mutex, started, finished : réveil des threads et fin du tick
+**      - generation : nombre de ticks commencés (un thread exécute chaque nouveau)
+**      - workersRunning : threads exécutant encore le tick
+**      - stopping : les threads doivent se terminer
+**
+**  Fonctions principales :
+**
+**    AnimSpriteCelParallelInitialization()
+**      -> Démarre les threads des travailleurs d'un système partitionné.
+**
+**    AnimSpriteCelParallelRun()
+**      -> Exécute un tick du système sur tous les travailleurs.
+**
+**    AnimSpriteCelParallelCleanup()
+**      -> Termine les threads des travailleurs et libère la structure.
+**
+******************************************************************************/
+
+// pthread_t, pthread_mutex_t, pthread_cond_t
+#include <pthread.h>
+
+// int32
+#include "types.h"
+// AnimSpriteCelSystem
+#include "AnimSpriteCelSystem.h"
+
+// Taille d'une ligne de cache, sépare les compteurs de réservation des travailleurs
+#define ANIMSPRITECELPARALLEL_LINE 64
+
+typedef struct AnimSpriteCelParallel AnimSpriteCelParallel;
+
+typedef struct {
+	// Exécution parallèle du travailleur
+	AnimSpriteCelParallel *parallel;
+	// Index du travailleur (0 = thread appelant)
+	uint32 workerIndex;
+	// Prochaine partition de la plage du travailleur, réservée par n'importe quel travailleur
+	volatile uint32 partitionNext;
+	// Fin de la plage du travailleur
+	uint32 partitionEnd;
+	// Partitions exécutées
+	uint32 partitionsRun;
+	// Partitions prises dans les plages des autres travailleurs
+	uint32 partitionsStolen;
+	// Garde les compteurs de réservation de deux travailleurs sur des lignes de cache différentes
+	uint8 padding[ANIMSPRITECELPARALLEL_LINE];
+} AnimSpriteCelParallelWorker;
+
+struct AnimSpriteCelParallel {
+	// Système partitionné
+	AnimSpriteCelSystem *system;
+	// Travailleurs, le premier est le thread appelant
+	AnimSpriteCelParallelWorker *workers;
+	// Nombre de travailleurs
+	uint32 workersCount;
+	// Nombre de travailleurs alloués
+	uint32 workersMax;
+	// Threads des travailleurs 1 et suivants
+	pthread_t *threads;
+	// Réveil des threads et fin du tick
+	pthread_mutex_t mutex;
+	pthread_cond_t started;
+	pthread_cond_t finished;
+	// Nombre de ticks commencés
+	uint32 generation;
+	// Threads exécutant encore le tick
+	uint32 workersRunning;
+	// Les threads doivent se terminer
+	uint32 stopping;
+};
+
+// Démarre les threads des travailleurs d'un système partitionné
+AnimSpriteCelParallel *AnimSpriteCelParallelInitialization(AnimSpriteCelSystem *animSpriteCelSystem, uint32 workersCount);
+// Exécute un tick du système sur tous les travailleurs
+int32 AnimSpriteCelParallelRun(AnimSpriteCelParallel *animSpriteCelParallel);
+// Termine les threads des travailleurs et libère la structure
+int32 AnimSpriteCelParallelCleanup(AnimSpriteCelParallel *animSpriteCelParallel);
+
+#endif // ANIMSPRITECELPARALLEL_H
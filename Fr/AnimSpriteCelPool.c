@@ -0,0 +1,249 @@
+#include "AnimSpriteCelPool.h"
+
+// AnimSpriteCelSystemUnregister()
+#include "AnimSpriteCelSystem.h"
+// AllocMem(), FreeMem(), MEMTYPE_DRAM
+#include "mem.h"
+// printf()
+#include "stdio.h"
+
+// Alignement des cases dans le bloc
+#define ANIMSPRITECELPOOL_ALIGNMENT 8
+
+// Rend une case à son pool depuis AnimSpriteCelCleanup()
+static int32 AnimSpriteCelPoolSlotRelease(AnimSpriteCel *animSpriteCel) {
+	return AnimSpriteCelPoolRelease(animSpriteCel->pool, animSpriteCel);
+}
+
+// Initialisation d'un AnimSpriteCelPool
+AnimSpriteCelPool *AnimSpriteCelPoolInitialization(uint32 animSpriteCelsMax, uint32 stepsMax, uint32 framesMax) {
+
+	// Instance de l'AnimSpriteCelPool
+	AnimSpriteCelPool *animSpriteCelPool = NULL;
+	// Index de case
+	uint32 index = 0;
+	// AnimSpriteCel d'une case
+	AnimSpriteCel *animSpriteCel = NULL;
+
+	// Si la capacité est nulle
+	if (animSpriteCelsMax == 0) {
+		// Affiche un message d'erreur
+		printf("Error : AnimSpriteCelPool needs at least one AnimSpriteCel.\n");
+		return NULL;
+	}
+
+	// Nombre minimal d'étapes = 2
+	stepsMax = (stepsMax > 1) ? stepsMax : 2;
+	// Nombre minimum de frames = 1, indexées sur 16 bits
+	framesMax = (framesMax > 0) ? framesMax : 1;
+	framesMax = (framesMax < 0x10000) ? framesMax : 0x10000;
+
+	// Alloue de la mémoire pour l'AnimSpriteCelPool
+	animSpriteCelPool = (AnimSpriteCelPool *)AllocMem(sizeof(AnimSpriteCelPool), MEMTYPE_DRAM);
+	// Si c'est un échec
+	if (animSpriteCelPool == NULL) {
+		// Affiche un message d'erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCelPool.\n");
+		return NULL;
+	}
+
+	// Une case contient la structure, le CCB, les étapes, les descripteurs de frames et la ligne de temps (jusqu'à 2 * stepsMax - 1 valeurs)
+	animSpriteCelPool->slotSize = sizeof(AnimSpriteCel) + sizeof(CCB) + (stepsMax * sizeof(AnimSpriteCelStep)) + (framesMax * sizeof(AnimSpriteCelFrame)) + (((2 * stepsMax) - 1) * sizeof(uint32));
+	animSpriteCelPool->slotSize = (animSpriteCelPool->slotSize + ANIMSPRITECELPOOL_ALIGNMENT - 1) & ~(uint32)(ANIMSPRITECELPOOL_ALIGNMENT - 1);
+
+	// Alloue le bloc
+	animSpriteCelPool->slab = (uint8 *)AllocMem(animSpriteCelsMax * animSpriteCelPool->slotSize, MEMTYPE_DRAM);
+	// Si l'allocation du bloc échoue
+	if (animSpriteCelPool->slab == NULL) {
+		// Libère l'AnimSpriteCelPool précédemment alloué
+		FreeMem(animSpriteCelPool, sizeof(AnimSpriteCelPool));
+		// Affiche un message d'erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCelPool slab.\n");
+		return NULL;
+	}
+
+	// Alloue la pile des cases libres
+	animSpriteCelPool->freeSlots = (AnimSpriteCel **)AllocMem(animSpriteCelsMax * sizeof(AnimSpriteCel *), MEMTYPE_DRAM);
+	// Si l'allocation de la pile échoue
+	if (animSpriteCelPool->freeSlots == NULL) {
+		// Libère le bloc et l'AnimSpriteCelPool précédemment alloués
+		FreeMem(animSpriteCelPool->slab, animSpriteCelsMax * animSpriteCelPool->slotSize);
+		FreeMem(animSpriteCelPool, sizeof(AnimSpriteCelPool));
+		// Affiche un message d'erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCelPool free slots.\n");
+		return NULL;
+	}
+
+	// Capacité du pool
+	animSpriteCelPool->animSpriteCelsMax = animSpriteCelsMax;
+	animSpriteCelPool->stepsMax = stepsMax;
+	animSpriteCelPool->framesMax = framesMax;
+	// Statistiques
+	animSpriteCelPool->acquiredCount = 0;
+	animSpriteCelPool->acquiredMax = 0;
+	animSpriteCelPool->acquisitionsCount = 0;
+	animSpriteCelPool->failuresCount = 0;
+
+	// Découpe les cases une seule fois, empilées à l'envers pour que la première case soit prise en premier
+	for (index = 0; index < animSpriteCelsMax; index++) {
+		animSpriteCel = (AnimSpriteCel *)(animSpriteCelPool->slab + (index * animSpriteCelPool->slotSize));
+		animSpriteCel->cel = (CCB *)(animSpriteCel + 1);
+		animSpriteCel->steps = (AnimSpriteCelStep *)(animSpriteCel->cel + 1);
+		animSpriteCel->frames = (AnimSpriteCelFrame *)(animSpriteCel->steps + stepsMax);
+		animSpriteCel->framesCount = framesMax;
+		animSpriteCel->timeline = (uint32 *)(animSpriteCel->frames + framesMax);
+		animSpriteCel->pool = animSpriteCelPool;
+		animSpriteCel->sequence = NULL;
+		animSpriteCel->file = NULL;
+		animSpriteCel->table = NULL;
+		animSpriteCel->release = AnimSpriteCelPoolSlotRelease;
+		animSpriteCel->packedSteps = NULL;
+		// Une case libre n'a pas de SpriteCel
+		animSpriteCel->spriteCel = NULL;
+		animSpriteCel->system = NULL;
+		animSpriteCelPool->freeSlots[animSpriteCelsMax - 1 - index] = animSpriteCel;
+	}
+	animSpriteCelPool->freeCount = animSpriteCelsMax;
+
+	// Retourne l'AnimSpriteCelPool créé
+	return animSpriteCelPool;
+}
+
+// Prend un AnimSpriteCel dans le pool
+AnimSpriteCel *AnimSpriteCelPoolAcquire(AnimSpriteCelPool *animSpriteCelPool, SpriteCel *spriteCel, AnimSpriteCelLoop loop, AnimSpriteCelRange range, uint32 iterations, int32 direction, uint32 stepIndex, uint32 stepsCount) {
+
+	// Instance de l'AnimSpriteCel
+	AnimSpriteCel *animSpriteCel = NULL;
+
+	// Si le pool n'est pas défini
+	if (animSpriteCelPool == NULL) {
+		// Affiche un message d'erreur
+		printf("Error : AnimSpriteCelPool unknow.\n");
+		return NULL;
+	}
+
+	// Si la planche de sprites n'existe pas
+	if (spriteCel == NULL) {
+		// Affiche un message d'erreur
+		printf("Error : SpriteCel unknow.\n");
+		return NULL;
+	}
+
+	// Si les étapes ne tiennent pas dans une case
+	if (stepsCount > animSpriteCelPool->stepsMax) {
+		animSpriteCelPool->failuresCount++;
+		// Affiche un message d'erreur
+		printf("Error : AnimSpriteCelPool slots hold %u steps at most.\n", animSpriteCelPool->stepsMax);
+		return NULL;
+	}
+
+	// Si toutes les cases sont utilisées
+	if (animSpriteCelPool->freeCount == 0) {
+		animSpriteCelPool->failuresCount++;
+		// Affiche un message d'erreur
+		printf("Error : AnimSpriteCelPool empty (%u AnimSpriteCels).\n", animSpriteCelPool->animSpriteCelsMax);
+		return NULL;
+	}
+
+	// Dépile une case libre
+	animSpriteCelPool->freeCount--;
+	animSpriteCel = animSpriteCelPool->freeSlots[animSpriteCelPool->freeCount];
+
+	// Copie le CCB du SpriteCel dans la case
+	*animSpriteCel->cel = *spriteCel->cel;
+
+	// Initialise l'animation dans la case
+	AnimSpriteCelSetup(animSpriteCel, spriteCel, loop, range, iterations, direction, stepIndex, stepsCount);
+
+	// Statistiques
+	animSpriteCelPool->acquiredCount++;
+	animSpriteCelPool->acquisitionsCount++;
+	if (animSpriteCelPool->acquiredCount > animSpriteCelPool->acquiredMax) {
+		animSpriteCelPool->acquiredMax = animSpriteCelPool->acquiredCount;
+	}
+
+	// Retourne l'AnimSpriteCel
+	return animSpriteCel;
+}
+
+// Rend un AnimSpriteCel au pool
+int32 AnimSpriteCelPoolRelease(AnimSpriteCelPool *animSpriteCelPool, AnimSpriteCel *animSpriteCel) {
+
+	// Si le pool n'est pas défini
+	if (animSpriteCelPool == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelPool unknow.\n");
+		return -1;
+	}
+
+	// Si l'AnimSpriteCel est inconnu
+	if (animSpriteCel == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel unknow.\n");
+		return -1;
+	}
+
+	// Si l'AnimSpriteCel vient d'un autre pool
+	if (animSpriteCel->pool != animSpriteCelPool) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel not taken from this AnimSpriteCelPool.\n");
+		return -1;
+	}
+
+	// Si l'AnimSpriteCel est déjà libre
+	if (animSpriteCel->spriteCel == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel already released.\n");
+		return -1;
+	}
+
+	// Le retire de son système s'il est enregistré, il est gardé si des receveurs compacts seraient redirigés
+	if ((animSpriteCel->system != NULL) && (AnimSpriteCelSystemUnregister(animSpriteCel->system, animSpriteCel) < 0)) {
+		// Retourne une erreur
+		printf("Error <- AnimSpriteCelSystemUnregister()\n");
+		return -1;
+	}
+
+	// Marque la case comme libre et l'empile
+	animSpriteCel->spriteCel = NULL;
+	animSpriteCelPool->freeSlots[animSpriteCelPool->freeCount] = animSpriteCel;
+	animSpriteCelPool->freeCount++;
+	animSpriteCelPool->acquiredCount--;
+
+	// Retourne un succès
+	return 1;
+}
+
+// Supprime l'AnimSpriteCelPool
+int32 AnimSpriteCelPoolCleanup(AnimSpriteCelPool *animSpriteCelPool) {
+
+	// Si le pool n'est pas défini
+	if (animSpriteCelPool == NULL) {
+		printf("Error : AnimSpriteCelPool unknow.\n");
+		return -1;
+	}
+
+	// Si des AnimSpriteCels sont encore utilisés
+	if (animSpriteCelPool->acquiredCount > 0) {
+		// Affiche un avertissement
+		printf("Warning : AnimSpriteCelPool cleaned up with %u AnimSpriteCels in use.\n", animSpriteCelPool->acquiredCount);
+	}
+
+	// Libère la pile des cases libres si elle existe
+	if (animSpriteCelPool->freeSlots != NULL) {
+		FreeMem(animSpriteCelPool->freeSlots, animSpriteCelPool->animSpriteCelsMax * sizeof(AnimSpriteCel *));
+		animSpriteCelPool->freeSlots = NULL;
+	}
+
+	// Libère le bloc s'il existe
+	if (animSpriteCelPool->slab != NULL) {
+		FreeMem(animSpriteCelPool->slab, animSpriteCelPool->animSpriteCelsMax * animSpriteCelPool->slotSize);
+		animSpriteCelPool->slab = NULL;
+	}
+
+	// Libère la structure AnimSpriteCelPool elle-même
+	FreeMem(animSpriteCelPool, sizeof(AnimSpriteCelPool));
+
+	// Retourne un succès
+	return 1;
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+#ifndef ANIMSPRITECELPOOL_H
+#define ANIMSPRITECELPOOL_H
+
+/******************************************************************************
+**
+**  AnimSpriteCelPool - Allocateur d'AnimSpriteCels à capacité fixe (3DO Cel Engine)
+**
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 17-10-2026
+**
+**  AnimSpriteCelInitialization() alloue séparément la structure, le tableau
+**  d'étapes et la ligne de temps, et clone le CCB du SpriteCel. Faire apparaître
+**  et disparaître des effets pendant le jeu fragmente donc la mémoire et coûte
+**  du temps d'allocation.
+**
+**  Un AnimSpriteCelPool réserve, une seule fois, un bloc unique pouvant contenir
+**  un nombre donné d'AnimSpriteCels d'au plus un nombre donné d'étapes et
+**  de frames. Chaque case du bloc contient côte à côte la structure
+**  AnimSpriteCel, son CCB, son tableau d'étapes, ses descripteurs de frames et
+**  sa ligne de temps. AnimSpriteCelPoolAcquire() prend une
+**  case libre et l'initialise comme AnimSpriteCelInitialization(),
+**  AnimSpriteCelPoolRelease() la rend. Les deux sont en O(1) grâce à une pile
+**  de cases libres et n'appellent jamais l'allocateur.
+**
+**  Notes importantes :
+**
+**    - Un AnimSpriteCel pris dans un pool se comporte exactement comme un
+**      AnimSpriteCel créé par AnimSpriteCelInitialization(). AnimSpriteCelCleanup()
+**      le rend à son pool, il peut donc aussi appartenir à un AnimSpriteCelSystem.
+**
+**    - La table des descripteurs de frames d'une case contient "framesMax"
+**      frames : AnimSpriteCelStepConfiguration() refuse un index de frame
+**      au-delà au lieu d'agrandir la table.
+**
+**    - Le CCB d'une case est une copie du CCB du SpriteCel, comme celle que
+**      donnerait CloneCel() avec CLONECEL_CCB_ONLY. Il ne doit pas être supprimé
+**      avec DeleteCel().
+**
+**    - AnimSpriteCelPoolCleanup() libère le bloc : chaque AnimSpriteCel pris dans
+**      le pool doit être rendu (ou ne plus être utilisé) avant.
+**
+**  Rôle des structures :
+**
+**    AnimSpriteCelPool
+**      - slab : bloc mémoire contenant toutes les cases
+**      - slotSize : taille d'une case en octets
+**      - animSpriteCelsMax : nombre de cases
+**      - stepsMax : nombre maximal d'étapes d'un AnimSpriteCel
+**      - framesMax : nombre de frames du SpriteCel que les étapes d'un AnimSpriteCel peuvent afficher
+**      - freeSlots : pile des AnimSpriteCels libres
+**      - freeCount : nombre d'AnimSpriteCels libres
+**      - acquiredCount : nombre d'AnimSpriteCels utilisés
+**      - acquiredMax : niveau maximal atteint par "acquiredCount"
+**      - acquisitionsCount : nombre total de prises réussies
+**      - failuresCount : nombre de prises refusées (pool vide ou trop d'étapes)
+**
+**  Fonctions principales :
+**
+**    AnimSpriteCelPoolInitialization()
+**      -> Réserve le bloc pour un nombre donné d'AnimSpriteCels, d'étapes et
+**         de frames.
+**
+**    AnimSpriteCelPoolAcquire()
+**      -> Prend un AnimSpriteCel libre et l'initialise. Mêmes paramètres que
+**         AnimSpriteCelInitialization().
+**
+**    AnimSpriteCelPoolRelease()
+**      -> Rend un AnimSpriteCel au pool.
+**
+**    AnimSpriteCelPoolCleanup()
+**      -> Libère le bloc et le pool.
+**
+******************************************************************************/
+
+// int32
+#include "types.h"
+// AnimSpriteCel
+#include "AnimSpriteCel.h"
+
+struct AnimSpriteCelPool {
+	// Bloc mémoire contenant toutes les cases
+	uint8 *slab;
+	// Taille d'une case en octets
+	uint32 slotSize;
+	// Nombre de cases
+	uint32 animSpriteCelsMax;
+	// Nombre maximal d'étapes d'un AnimSpriteCel
+	uint32 stepsMax;
+	// Nombre de frames du SpriteCel que les étapes d'un AnimSpriteCel peuvent afficher
+	uint32 framesMax;
+	// Pile des AnimSpriteCels libres
+	AnimSpriteCel **freeSlots;
+	// Nombre d'AnimSpriteCels libres
+	uint32 freeCount;
+	// Nombre d'AnimSpriteCels utilisés
+	uint32 acquiredCount;
+	// Niveau maximal d'AnimSpriteCels utilisés
+	uint32 acquiredMax;
+	// Nombre total de prises réussies
+	uint32 acquisitionsCount;
+	// Nombre de prises refusées
+	uint32 failuresCount;
+};
+
+// Initialisation d'un AnimSpriteCelPool
+AnimSpriteCelPool *AnimSpriteCelPoolInitialization(uint32 animSpriteCelsMax, uint32 stepsMax, uint32 framesMax);
+// Prend un AnimSpriteCel dans le pool
+AnimSpriteCel *AnimSpriteCelPoolAcquire(AnimSpriteCelPool *animSpriteCelPool, SpriteCel *spriteCel, AnimSpriteCelLoop loop, AnimSpriteCelRange range, uint32 iterations, int32 direction, uint32 stepIndex, uint32 stepsCount);
+// Rend un AnimSpriteCel au pool
+int32 AnimSpriteCelPoolRelease(AnimSpriteCelPool *animSpriteCelPool, AnimSpriteCel *animSpriteCel);
+// Supprime l'AnimSpriteCelPool
+int32 AnimSpriteCelPoolCleanup(AnimSpriteCelPool *animSpriteCelPool);
+
+#endif // ANIMSPRITECELPOOL_H
@@ -0,0 +1,320 @@
+#include "AnimSpriteCelSequence.h"
+
+// LIST_END
+#include "DefinitionsArguments.h"
+// AllocMem(), FreeMem(), MEMTYPE_DRAM
+#include "mem.h"
+// CloneCel()
+#include "celutils.h"
+// memset()
+#include "string.h"
+// printf()
+#include "stdio.h"
+
+// Initialisation d'un AnimSpriteCelSequence
+AnimSpriteCelSequence *AnimSpriteCelSequenceInitialization(SpriteCel *spriteCel, AnimSpriteCelLoop loop, AnimSpriteCelRange range, uint32 stepsCount) {
+
+	// Instance de AnimSpriteCelSequence
+	AnimSpriteCelSequence *animSpriteCelSequence = NULL;
+
+	// Si la planche de sprites n'existe pas
+	if (spriteCel == NULL) {
+		// Affiche un message d'erreur
+		printf("Error : SpriteCel unknow.\n");
+		return NULL;
+	}
+
+	// Nombre minimal d'étapes = 2
+	stepsCount = (stepsCount > 1) ? stepsCount : 2;
+
+	// Alloue de la mémoire pour le AnimSpriteCelSequence
+	animSpriteCelSequence = (AnimSpriteCelSequence *)AllocMem(sizeof(AnimSpriteCelSequence), MEMTYPE_DRAM);
+	// Si c'est un échec
+	if (animSpriteCelSequence == NULL) {
+		// Affiche un message d'erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCelSequence.\n");
+		return NULL;
+	}
+
+	// Alloue de la mémoire pour le tableau d'étapes
+	animSpriteCelSequence->steps = (AnimSpriteCelStep *)AllocMem(stepsCount * sizeof(AnimSpriteCelStep), MEMTYPE_DRAM);
+	// Si c'est un échec
+	if (animSpriteCelSequence->steps == NULL) {
+		// Libère la mémoire précédemment allouée
+		FreeMem(animSpriteCelSequence, sizeof(AnimSpriteCelSequence));
+		// Affiche un message d'erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCelSequence steps.\n");
+		return NULL;
+	}
+
+	// Alloue la mémoire pour le descripteur de la première frame, agrandi par les configurations d'étapes
+	animSpriteCelSequence->frames = (AnimSpriteCelFrame *)AllocMem(sizeof(AnimSpriteCelFrame), MEMTYPE_DRAM);
+	// Si l'allocation des frames échoue
+	if (animSpriteCelSequence->frames == NULL) {
+		// Libère la mémoire précédemment allouée
+		FreeMem(animSpriteCelSequence->steps, stepsCount * sizeof(AnimSpriteCelStep));
+		FreeMem(animSpriteCelSequence, sizeof(AnimSpriteCelSequence));
+		// Affiche un message d'erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCelSequence frames.\n");
+		return NULL;
+	}
+
+	// Alloue de la mémoire pour les durées cumulées (jusqu'à 2 * stepsCount - 2 positions en ALTERNATE)
+	animSpriteCelSequence->timeline = (uint32 *)AllocMem(((2 * stepsCount) - 1) * sizeof(uint32), MEMTYPE_DRAM);
+	// Si c'est un échec
+	if (animSpriteCelSequence->timeline == NULL) {
+		// Libère les frames, les étapes et l'AnimSpriteCelSequence alloués précédemment
+		FreeMem(animSpriteCelSequence->frames, sizeof(AnimSpriteCelFrame));
+		FreeMem(animSpriteCelSequence->steps, stepsCount * sizeof(AnimSpriteCelStep));
+		FreeMem(animSpriteCelSequence, sizeof(AnimSpriteCelSequence));
+		// Affiche un message d'erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCelSequence timeline.\n");
+		return NULL;
+	}
+
+	// Paramètres de la séquence
+	animSpriteCelSequence->spriteCel = spriteCel;
+	animSpriteCelSequence->loop = loop;
+	animSpriteCelSequence->range = range;
+	animSpriteCelSequence->stepsCount = stepsCount;
+	animSpriteCelSequence->framesCount = 1;
+	// Référence de l'appelant
+	animSpriteCelSequence->referencesCount = 1;
+
+	// Les étapes non configurées affichent la première frame et attendent
+	memset(animSpriteCelSequence->steps, 0, (size_t)stepsCount * sizeof(AnimSpriteCelStep));
+	AnimSpriteCelFrameResolve(spriteCel, animSpriteCelSequence->frames, 0);
+
+	// Retourne le AnimSpriteCelSequence créé
+	return animSpriteCelSequence;
+}
+
+// Configuration d'une étape d'un AnimSpriteCelSequence
+int32 AnimSpriteCelSequenceStepConfiguration(AnimSpriteCelSequence *animSpriteCelSequence, uint32 stepIndex, uint32 frameIndex, int32 frameDuration, AnimSpriteCel *animSpriteCelReceiver) {
+
+	// Si la séquence est inconnue
+	if (animSpriteCelSequence == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSequence unknow.\n");
+		return -1;
+	}
+
+	// Si des instances partagent déjà les étapes
+	if (animSpriteCelSequence->referencesCount > 1) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSequence shared by %u AnimSpriteCels.\n", animSpriteCelSequence->referencesCount - 1);
+		return -1;
+	}
+
+	// Corrige les paramètres
+	if (stepIndex >= animSpriteCelSequence->stepsCount) {
+		// Affiche un avertissement
+		printf("Warning : AnimSpriteCelSequence stepIndex %u out of bounds. Clamped to last index.\n", stepIndex);
+		// Modifie l'index au dernier disponible
+		stepIndex = animSpriteCelSequence->stepsCount - 1;
+	}
+
+	// Fait de la place pour le descripteur de la frame
+	if (AnimSpriteCelFramesReserve(&animSpriteCelSequence->frames, &animSpriteCelSequence->framesCount, frameIndex) < 0) {
+		// Retourne une erreur
+		printf("Error <- AnimSpriteCelFramesReserve()\n");
+		return -1;
+	}
+
+	// Configure l'étape de la séquence
+	animSpriteCelSequence->steps[stepIndex].frameIndex = frameIndex;
+	animSpriteCelSequence->steps[stepIndex].frameDuration = frameDuration;
+	animSpriteCelSequence->steps[stepIndex].animSpriteCelReceiver = animSpriteCelReceiver;
+	// Résout le descripteur de la frame une fois pour toutes les étapes et les instances
+	AnimSpriteCelFrameResolve(animSpriteCelSequence->spriteCel, animSpriteCelSequence->frames, frameIndex);
+
+	// Retourne un succès
+	return 1;
+}
+
+// Configuration des étapes d'un AnimSpriteCelSequence
+int32 AnimSpriteCelSequenceStepsConfiguration(AnimSpriteCelSequence *animSpriteCelSequence, int32 start, ...) {
+
+	// Liste des arguments de la fonction
+	va_list args;
+	// Index de l'étape
+	uint32 stepIndex = 0;
+	// Coordonnées
+	uint32 frameIndex = 0;
+	int32 frameDuration = 1;
+	AnimSpriteCel *animSpriteCelReceiver = NULL;
+
+	// Débute la lecture des arguments
+	va_start(args, start);
+
+	// Boucle jusqu'à la valeur sentinelle
+	while (1) {
+
+		// Récupère l'index
+		stepIndex = va_arg(args, uint32);
+
+		// Si c'est la fin de la liste
+		if (stepIndex == LIST_END) {
+			// Sort de la boucle
+			break;
+		}
+
+		// Récupère le reste des arguments
+		frameIndex = va_arg(args, uint32);
+		frameDuration = va_arg(args, int32);
+		animSpriteCelReceiver = va_arg(args, AnimSpriteCel *);
+
+		// Configuration d'une étape de la séquence
+		if (AnimSpriteCelSequenceStepConfiguration(animSpriteCelSequence, stepIndex, frameIndex, frameDuration, animSpriteCelReceiver) < 0) {
+			// Fin de la liste des arguments
+			va_end(args);
+			// Retourne une erreur
+			printf("Error <- AnimSpriteCelSequenceStepConfiguration()\n");
+			return -1;
+		}
+	}
+
+	// Fin de la liste des arguments
+	va_end(args);
+
+	// Retourne un succès
+	return 1;
+}
+
+// ID d'événement d'une étape d'une AnimSpriteCelSequence
+int32 AnimSpriteCelSequenceStepEvent(AnimSpriteCelSequence *animSpriteCelSequence, uint32 stepIndex, uint32 eventId) {
+
+	// Si la séquence est inconnue
+	if (animSpriteCelSequence == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSequence unknow.\n");
+		return -1;
+	}
+
+	// Si des instances partagent déjà les étapes
+	if (animSpriteCelSequence->referencesCount > 1) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSequence shared by %u AnimSpriteCels.\n", animSpriteCelSequence->referencesCount - 1);
+		return -1;
+	}
+
+	// Si l'étape n'existe pas
+	if (stepIndex >= animSpriteCelSequence->stepsCount) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSequence stepIndex %u out of bounds (%u steps).\n", stepIndex, animSpriteCelSequence->stepsCount);
+		return -1;
+	}
+
+	// Chaque instance envoie l'événement quand elle atteint l'étape
+	animSpriteCelSequence->steps[stepIndex].eventId = eventId;
+
+	// Retourne un succès
+	return 1;
+}
+
+// Abandonne la référence d'une instance depuis AnimSpriteCelCleanup()
+static int32 AnimSpriteCelSequenceInstanceRelease(AnimSpriteCel *animSpriteCel) {
+
+	// Abandonne la référence au lieu de libérer les étapes partagées
+	AnimSpriteCelSequenceCleanup(animSpriteCel->sequence);
+	animSpriteCel->sequence = NULL;
+	animSpriteCel->steps = NULL;
+	animSpriteCel->frames = NULL;
+	animSpriteCel->timeline = NULL;
+
+	// Retourne un succès
+	return 1;
+}
+
+// Crée un AnimSpriteCel jouant la séquence
+AnimSpriteCel *AnimSpriteCelSequenceInstance(AnimSpriteCelSequence *animSpriteCelSequence, uint32 iterations, int32 direction, uint32 stepIndex) {
+
+	// Instance de l'AnimSpriteCel
+	AnimSpriteCel *animSpriteCel = NULL;
+
+	// Si la séquence est inconnue
+	if (animSpriteCelSequence == NULL) {
+		// Affiche un message d'erreur
+		printf("Error : AnimSpriteCelSequence unknow.\n");
+		return NULL;
+	}
+
+	// Alloue la mémoire pour AnimSpriteCel (les étapes, les frames et la ligne de temps sont partagées)
+	animSpriteCel = (AnimSpriteCel *)AllocMem(sizeof(AnimSpriteCel), MEMTYPE_DRAM);
+	// Si c'est un échec
+	if (animSpriteCel == NULL) {
+		// Affiche un message d'erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCel.\n");
+		return NULL;
+	}
+
+	// Ne vient pas d'un pool, étapes de la séquence
+	animSpriteCel->pool = NULL;
+	animSpriteCel->sequence = animSpriteCelSequence;
+	animSpriteCel->file = NULL;
+	animSpriteCel->table = NULL;
+	animSpriteCel->release = AnimSpriteCelSequenceInstanceRelease;
+	animSpriteCel->packedSteps = NULL;
+	animSpriteCel->frames = animSpriteCelSequence->frames;
+	animSpriteCel->framesCount = animSpriteCelSequence->framesCount;
+	animSpriteCel->steps = animSpriteCelSequence->steps;
+	animSpriteCel->timeline = animSpriteCelSequence->timeline;
+
+	// Copie le CCB du SpriteCel
+	animSpriteCel->cel = CloneCel(animSpriteCelSequence->spriteCel->cel, CLONECEL_CCB_ONLY);
+
+	// Initialise la tête de lecture, les étapes restent intactes
+	AnimSpriteCelSetup(animSpriteCel, animSpriteCelSequence->spriteCel, animSpriteCelSequence->loop, animSpriteCelSequence->range, iterations, direction, stepIndex, animSpriteCelSequence->stepsCount);
+	// Affiche l'étape de départ
+	AnimSpriteCelUpdate(animSpriteCel);
+
+	// Référence de l'instance
+	animSpriteCelSequence->referencesCount++;
+
+	// Retourne le AnimSpriteCel créé
+	return animSpriteCel;
+}
+
+// Abandonne une référence au AnimSpriteCelSequence
+int32 AnimSpriteCelSequenceCleanup(AnimSpriteCelSequence *animSpriteCelSequence) {
+
+	// Si la séquence est inconnue
+	if (animSpriteCelSequence == NULL) {
+		printf("Error : AnimSpriteCelSequence unknow.\n");
+		return -1;
+	}
+
+	// Abandonne la référence
+	animSpriteCelSequence->referencesCount--;
+
+	// Si des instances jouent encore la séquence
+	if (animSpriteCelSequence->referencesCount > 0) {
+		// La conserve
+		return 1;
+	}
+
+	// Si il y a des étapes
+	if (animSpriteCelSequence->steps != NULL) {
+		FreeMem(animSpriteCelSequence->steps, animSpriteCelSequence->stepsCount * sizeof(AnimSpriteCelStep));
+		animSpriteCelSequence->steps = NULL;
+	}
+
+	// Libère les descripteurs de frames s'ils existent
+	if (animSpriteCelSequence->frames != NULL) {
+		FreeMem(animSpriteCelSequence->frames, animSpriteCelSequence->framesCount * sizeof(AnimSpriteCelFrame));
+		animSpriteCelSequence->frames = NULL;
+	}
+
+	// Si il y a une ligne de temps
+	if (animSpriteCelSequence->timeline != NULL) {
+		FreeMem(animSpriteCelSequence->timeline, ((2 * animSpriteCelSequence->stepsCount) - 1) * sizeof(uint32));
+		animSpriteCelSequence->timeline = NULL;
+	}
+
+	// Libère la mémoire utilisée pour le AnimSpriteCelSequence
+	animSpriteCelSequence->spriteCel = NULL;
+	FreeMem(animSpriteCelSequence, sizeof(AnimSpriteCelSequence));
+
+	// Retourne un succès
+	return 1;
+}
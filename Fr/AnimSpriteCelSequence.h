@@ -0,0 +1,125 @@
+#ifndef ANIMSPRITECELSEQUENCE_H
+#define ANIMSPRITECELSEQUENCE_H
+
+/******************************************************************************
+**
+**  AnimSpriteCelSequence - Séquence d'étapes partagée par plusieurs AnimSpriteCels (3DO Cel Engine)
+**
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 17-10-2026
+**
+**  Chaque AnimSpriteCel créé par AnimSpriteCelInitialization() possède sa
+**  propre copie des étapes et de la ligne de temps. Une foule d'effets
+**  identiques (étincelles, pièces, torches...) alloue et configure donc les
+**  mêmes étapes une fois par animation.
+**
+**  Un AnimSpriteCelSequence contient une seule fois les étapes, leurs
+**  descripteurs de frames, le type de boucle, la plage de l'aléatoire et la
+**  ligne de temps.
+**  AnimSpriteCelSequenceInstance() crée un AnimSpriteCel qui ne possède que
+**  son CCB et sa tête de lecture (étape, sens, cycles restants, itérations)
+**  et pointe vers les étapes de la séquence. Aucune configuration d'étape
+**  n'est nécessaire par instance.
+**
+**  La séquence compte ses références : l'appelant en détient une, chaque
+**  instance une de plus. AnimSpriteCelSequenceCleanup() et la suppression
+**  d'une instance abandonnent une référence, la séquence est libérée avec la
+**  dernière.
+**
+**  Notes importantes :
+**
+**    - Une séquence partagée est immuable : ses étapes ne peuvent être
+**      configurées que tant qu'aucune instance n'y fait référence.
+**
+**    - AnimSpriteCelStepConfiguration() est refusée sur une instance. Ses
+**      étapes appartiennent à la séquence.
+**
+**    - Le receveur d'une étape fait partie de la séquence : toutes les
+**      instances déclenchent le même receveur en quittant cette étape. L'ID
+**      d'événement d'une étape est partagé de la même façon.
+**
+**    - Une instance se comporte comme tout autre AnimSpriteCel : elle peut
+**      être exécutée, avancée, positionnée, déclenchée et enregistrée dans un
+**      AnimSpriteCelSystem.
+**      C'est donc un AnimSpriteCel complet, 172 octets sur la 3DO (264 sur un
+**      hôte 64 bits), dont 16 pour sa tête de lecture. Elle n'économise que ses
+**      étapes, ses descripteurs de frames et sa ligne de temps.
+**
+**  Rôle des structures :
+**
+**    AnimSpriteCelSequence
+**      - spriteCel : sprite sheet des frames
+**      - loop : NORMAL, REVERSE ou ALTERNATE
+**      - range : FULL, HALF ou QUARTER (durées aléatoires)
+**      - stepsCount : nombre d'étapes
+**      - steps : étapes d'animation partagées
+**      - frames : descripteurs de frames partagés des étapes, indexés par frame
+**      - framesCount : nombre de descripteurs de frames
+**      - timeline : durées cumulées partagées (construites par les instances)
+**      - referencesCount : référence de l'appelant plus une par instance
+**
+**  Fonctions principales :
+**
+**    AnimSpriteCelSequenceInitialization()
+**      -> Crée une séquence d'un nombre donné d'étapes.
+**
+**    AnimSpriteCelSequenceStepConfiguration()
+**      -> Définit une étape de la séquence. Mêmes paramètres que
+**         AnimSpriteCelStepConfiguration().
+**
+**    AnimSpriteCelSequenceStepsConfiguration()
+**      -> Définit plusieurs étapes en une seule passe avec des arguments variadiques
+**         (LIST_START, stepIndex, frameIndex, frameDuration, receveur, ..., LIST_END).
+**
+**    AnimSpriteCelSequenceStepEvent()
+**      -> Donne un ID d'événement à une étape de la séquence. Mêmes
+**         paramètres qu'AnimSpriteCelStepEvent().
+**
+**    AnimSpriteCelSequenceInstance()
+**      -> Crée un AnimSpriteCel jouant la séquence.
+**
+**    AnimSpriteCelSequenceCleanup()
+**      -> Abandonne une référence, libère la séquence avec la dernière.
+**
+******************************************************************************/
+
+// int32
+#include "types.h"
+// AnimSpriteCel
+#include "AnimSpriteCel.h"
+
+struct AnimSpriteCelSequence {
+	// Sprite sheet des frames
+	SpriteCel *spriteCel;
+	// Type de boucle d'animation
+	AnimSpriteCelLoop loop;
+	// Plage de valeurs de l'aléatoire
+	AnimSpriteCelRange range;
+	// Nombre total d'étapes
+	uint32 stepsCount;
+	// Étapes d'animation partagées
+	AnimSpriteCelStep *steps;
+	// Descripteurs de frames partagés des étapes
+	AnimSpriteCelFrame *frames;
+	// Nombre de descripteurs de frames
+	uint32 framesCount;
+	// Durées cumulées partagées
+	uint32 *timeline;
+	// Référence de l'appelant plus une par instance
+	uint32 referencesCount;
+};
+
+// Initialisation d'un AnimSpriteCelSequence
+AnimSpriteCelSequence *AnimSpriteCelSequenceInitialization(SpriteCel *spriteCel, AnimSpriteCelLoop loop, AnimSpriteCelRange range, uint32 stepsCount);
+// Configuration d'une étape d'un AnimSpriteCelSequence
+int32 AnimSpriteCelSequenceStepConfiguration(AnimSpriteCelSequence *animSpriteCelSequence, uint32 stepIndex, uint32 frameIndex, int32 frameDuration, AnimSpriteCel *animSpriteCelReceiver);
+// Configuration des étapes d'un AnimSpriteCelSequence
+int32 AnimSpriteCelSequenceStepsConfiguration(AnimSpriteCelSequence *animSpriteCelSequence, int32 start, ...);
+// ID d'événement d'une étape d'une AnimSpriteCelSequence
+int32 AnimSpriteCelSequenceStepEvent(AnimSpriteCelSequence *animSpriteCelSequence, uint32 stepIndex, uint32 eventId);
+// Crée un AnimSpriteCel jouant la séquence
+AnimSpriteCel *AnimSpriteCelSequenceInstance(AnimSpriteCelSequence *animSpriteCelSequence, uint32 iterations, int32 direction, uint32 stepIndex);
+// Abandonne une référence au AnimSpriteCelSequence
+int32 AnimSpriteCelSequenceCleanup(AnimSpriteCelSequence *animSpriteCelSequence);
+
+#endif // ANIMSPRITECELSEQUENCE_H
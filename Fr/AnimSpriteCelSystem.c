@@ -0,0 +1,2777 @@
+#include "AnimSpriteCelSystem.h"
+
+// AllocMem(), FreeMem(), MEMTYPE_DRAM
+#include "mem.h"
+// memset(), memcpy()
+#include "string.h"
+// printf()
+#include "stdio.h"
+
+// Rattache un AnimSpriteCel à la case de la roue correspondant à son tick d'échéance
+static void AnimSpriteCelSystemWheelLink(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel) {
+
+	// Ticks avant la fin de l'étape
+	uint32 delay = animSpriteCel->expiryTick - animSpriteCelSystem->tick;
+	// Niveau de la roue
+	uint32 level = 0;
+	// Case cible
+	AnimSpriteCel **slot = NULL;
+
+	// Cherche le premier niveau dont la portée couvre le délai
+	while ((level < ANIMSPRITECELSYSTEM_WHEEL_LEVELS) && (delay >= ((uint32)1 << ((level + 1) * ANIMSPRITECELSYSTEM_WHEEL_BITS)))) {
+		level++;
+	}
+
+	// Si le délai dépasse la portée de la roue
+	if (level == ANIMSPRITECELSYSTEM_WHEEL_LEVELS) {
+		slot = &animSpriteCelSystem->wheelOverflow;
+	} else {
+		slot = &animSpriteCelSystem->wheel[level][(animSpriteCel->expiryTick >> (level * ANIMSPRITECELSYSTEM_WHEEL_BITS)) & (ANIMSPRITECELSYSTEM_WHEEL_SLOTS - 1)];
+	}
+
+	// Ajoute à la fin de la case (la tête garde un lien vers la queue)
+	if (*slot == NULL) {
+		*slot = animSpriteCel;
+		animSpriteCel->wheelPrevious = animSpriteCel;
+	} else {
+		(*slot)->wheelPrevious->wheelNext = animSpriteCel;
+		animSpriteCel->wheelPrevious = (*slot)->wheelPrevious;
+		(*slot)->wheelPrevious = animSpriteCel;
+	}
+	animSpriteCel->wheelNext = NULL;
+	animSpriteCel->wheelSlot = slot;
+}
+
+// Détache un AnimSpriteCel de sa case de la roue
+static void AnimSpriteCelSystemWheelUnlink(AnimSpriteCel *animSpriteCel) {
+
+	// Case contenant l'AnimSpriteCel
+	AnimSpriteCel **slot = animSpriteCel->wheelSlot;
+
+	// Si c'est la tête de la case
+	if (*slot == animSpriteCel) {
+		// Le suivant devient la tête et garde la queue
+		*slot = animSpriteCel->wheelNext;
+		if (animSpriteCel->wheelNext != NULL) {
+			animSpriteCel->wheelNext->wheelPrevious = animSpriteCel->wheelPrevious;
+		}
+	} else {
+		animSpriteCel->wheelPrevious->wheelNext = animSpriteCel->wheelNext;
+		// Si c'est la queue, la tête pointe désormais vers le précédent
+		if (animSpriteCel->wheelNext != NULL) {
+			animSpriteCel->wheelNext->wheelPrevious = animSpriteCel->wheelPrevious;
+		} else {
+			(*slot)->wheelPrevious = animSpriteCel->wheelPrevious;
+		}
+	}
+
+	animSpriteCel->wheelSlot = NULL;
+	animSpriteCel->wheelPrevious = NULL;
+	animSpriteCel->wheelNext = NULL;
+}
+
+// Répartit le contenu d'une case sur les niveaux inférieurs
+static void AnimSpriteCelSystemWheelSpread(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel **slot) {
+
+	// Liste détachée de la case
+	AnimSpriteCel *list = *slot;
+	// AnimSpriteCel en cours
+	AnimSpriteCel *animSpriteCel = NULL;
+
+	// Détache toute la liste pour que le rattachement ne puisse plus l'atteindre
+	*slot = NULL;
+
+	while (list != NULL) {
+		animSpriteCel = list;
+		list = list->wheelNext;
+		AnimSpriteCelSystemWheelLink(animSpriteCelSystem, animSpriteCel);
+	}
+}
+
+// Redescend les niveaux supérieurs dont la case a changé depuis le tick précédent
+static void AnimSpriteCelSystemWheelCascade(AnimSpriteCelSystem *animSpriteCelSystem, uint32 previousTick) {
+
+	// Niveau de la roue
+	int32 level = 0;
+	// Décalage en bits du niveau
+	uint32 shift = 0;
+	// Tick atteint par la roue
+	uint32 tick = animSpriteCelSystem->tick;
+
+	// Liste de débordement, tous les 2^24 ticks
+	shift = ANIMSPRITECELSYSTEM_WHEEL_LEVELS * ANIMSPRITECELSYSTEM_WHEEL_BITS;
+	if ((previousTick >> shift) != (tick >> shift)) {
+		AnimSpriteCelSystemWheelSpread(animSpriteCelSystem, &animSpriteCelSystem->wheelOverflow);
+	}
+
+	// Du niveau le plus haut vers le bas, pour que chaque niveau alimente le suivant
+	for (level = ANIMSPRITECELSYSTEM_WHEEL_LEVELS - 1; level > 0; level--) {
+		shift = level * ANIMSPRITECELSYSTEM_WHEEL_BITS;
+		if ((previousTick >> shift) != (tick >> shift)) {
+			AnimSpriteCelSystemWheelSpread(animSpriteCelSystem, &animSpriteCelSystem->wheel[level][(tick >> shift) & (ANIMSPRITECELSYSTEM_WHEEL_SLOTS - 1)]);
+		}
+	}
+}
+
+// Fusionne deux listes triées dans l'ordre d'enregistrement
+static AnimSpriteCel *AnimSpriteCelSystemWheelMerge(AnimSpriteCel *first, AnimSpriteCel *second) {
+
+	// Tête de la liste fusionnée
+	AnimSpriteCel *head = NULL;
+	// Queue de la liste fusionnée
+	AnimSpriteCel **tail = &head;
+
+	while ((first != NULL) && (second != NULL)) {
+		if (first->systemIndex < second->systemIndex) {
+			*tail = first;
+			first = first->wheelNext;
+		} else {
+			*tail = second;
+			second = second->wheelNext;
+		}
+		tail = &(*tail)->wheelNext;
+	}
+	*tail = (first != NULL) ? first : second;
+
+	return head;
+}
+
+// Trie une liste détachée dans l'ordre d'enregistrement
+static AnimSpriteCel *AnimSpriteCelSystemWheelSort(AnimSpriteCel *list) {
+
+	// Sous-listes triées de 2^n AnimSpriteCels
+	AnimSpriteCel *sublists[32];
+	// AnimSpriteCel en cours
+	AnimSpriteCel *animSpriteCel = NULL;
+	// Index de sous-liste
+	uint32 index = 0;
+
+	memset(sublists, 0, sizeof(sublists));
+
+	// Tri fusion ascendant, sans récursivité
+	while (list != NULL) {
+		animSpriteCel = list;
+		list = list->wheelNext;
+		animSpriteCel->wheelNext = NULL;
+		for (index = 0; sublists[index] != NULL; index++) {
+			animSpriteCel = AnimSpriteCelSystemWheelMerge(sublists[index], animSpriteCel);
+			sublists[index] = NULL;
+		}
+		sublists[index] = animSpriteCel;
+	}
+
+	// Fusionne les sous-listes restantes
+	for (index = 0; index < 32; index++) {
+		if (sublists[index] != NULL) {
+			list = AnimSpriteCelSystemWheelMerge(sublists[index], list);
+		}
+	}
+
+	return list;
+}
+
+// Distribue les déclenchements en attente, du plus ancien au plus récent
+static void AnimSpriteCelSystemTriggerDispatch(AnimSpriteCelSystem *animSpriteCelSystem, uint32 triggersCount) {
+
+	// Déclenchement en cours de distribution
+	AnimSpriteCelSystemTrigger trigger;
+	// Déclenchements distribués pendant ce tick
+	uint32 dispatchedCount = 0;
+	// Index dans la file
+	uint32 index = 0;
+
+	while ((animSpriteCelSystem->triggersCount > 0) && (triggersCount > 0)) {
+
+		// Si le budget du tick est épuisé
+		if ((animSpriteCelSystem->triggersBudget != 0) && (dispatchedCount >= animSpriteCelSystem->triggersBudget)) {
+			animSpriteCelSystem->triggersDeferred += animSpriteCelSystem->triggersCount;
+			break;
+		}
+
+		// Si la chaîne compte plus de déclenchements qu'il n'y a d'animations, elle boucle
+		trigger = animSpriteCelSystem->triggers[animSpriteCelSystem->triggersFirst];
+		if ((trigger.depth > 1) && (trigger.depth > animSpriteCelSystem->animSpriteCelsCount)) {
+			// Avertit une seule fois
+			if (animSpriteCelSystem->cyclesCount == 0) {
+				printf("Warning : AnimSpriteCelSystem trigger cycle, continued on the next tick.\n");
+			}
+			animSpriteCelSystem->cyclesCount++;
+			break;
+		}
+
+		// Retire le plus ancien déclenchement
+		animSpriteCelSystem->triggersFirst++;
+		if (animSpriteCelSystem->triggersFirst == animSpriteCelSystem->triggersMax) {
+			animSpriteCelSystem->triggersFirst = 0;
+		}
+		animSpriteCelSystem->triggersCount--;
+		triggersCount--;
+
+		// Si le receveur a été retiré entre-temps
+		if (trigger.animSpriteCel == NULL) {
+			continue;
+		}
+
+		// Les déclenchements envoyés par le receveur sont un maillon plus loin dans la chaîne
+		animSpriteCelSystem->triggerDepth = trigger.depth;
+		AnimSpriteCelTrigger(trigger.animSpriteCel);
+		animSpriteCelSystem->triggerDepth = 0;
+		dispatchedCount++;
+	}
+
+	// Les déclenchements laissés au tick suivant commencent de nouvelles chaînes
+	for (index = 0; index < animSpriteCelSystem->triggersCount; index++) {
+		animSpriteCelSystem->triggers[(animSpriteCelSystem->triggersFirst + index) % animSpriteCelSystem->triggersMax].depth = 1;
+	}
+}
+
+// Visite un AnimSpriteCel enregistré pour un cycle d'affichage, retourne 0 s'il est en attente ou terminé
+uint32 AnimSpriteCelSystemVisit(AnimSpriteCel *animSpriteCel) {
+
+	// Si l'animation est en attente d'un déclencheur
+	if (ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) == 0) {
+		return 0;
+	}
+
+	// Si toutes les itérations ont été réalisées
+	if (animSpriteCel->iterationsCount == 0) {
+		return 0;
+	}
+
+	// Si l'animation joue à une autre vitesse, ses cycles viennent de l'accumulateur
+	if (animSpriteCel->speed != ANIMSPRITECEL_SPEED_NORMAL) {
+		AnimSpriteCelSpeedRun(animSpriteCel);
+		return 1;
+	}
+
+	// Si ce n'est pas le moment de changer d'étape
+	if (animSpriteCel->remainingCycles > 0) {
+		// Décrémente le nombre de cycles d'affichage
+		animSpriteCel->remainingCycles--;
+		return 1;
+	}
+
+	// Passe à l'étape suivante de l'animation
+	AnimSpriteCelNextStep(animSpriteCel);
+	return 1;
+}
+
+// Exécute les animations enregistrées d'une plage du tableau (ordonnancement POLLING)
+static void AnimSpriteCelSystemRunRange(AnimSpriteCelSystem *animSpriteCelSystem, uint32 first, uint32 last) {
+
+	// AnimSpriteCels enregistrés
+	AnimSpriteCel **animSpriteCels = animSpriteCelSystem->animSpriteCels;
+	// Index du tableau
+	uint32 index = 0;
+
+	// Pour chaque AnimSpriteCel de la plage (déjà validé à l'enregistrement)
+	for (index = first; index < last; index++) {
+		AnimSpriteCelSystemVisit(animSpriteCels[index]);
+	}
+}
+
+// Trie les AnimSpriteCels réveillés par index d'enregistrement (tri par tas, sur place)
+static void AnimSpriteCelSystemWokenSort(AnimSpriteCel **woken, uint32 wokenCount) {
+
+	// AnimSpriteCel en cours de descente dans le tas
+	AnimSpriteCel *animSpriteCel = NULL;
+	// Taille du tas
+	uint32 heapCount = wokenCount;
+	// Prochain parent à faire descendre pendant la construction du tas
+	uint32 heapFirst = wokenCount / 2;
+	// Positions dans le tas
+	uint32 parent = 0;
+	uint32 child = 0;
+
+	while (heapCount > 1) {
+
+		// Construit le tas depuis son dernier parent, puis déplace son plus grand index à la fin
+		if (heapFirst > 0) {
+			heapFirst--;
+			parent = heapFirst;
+		} else {
+			heapCount--;
+			animSpriteCel = woken[heapCount];
+			woken[heapCount] = woken[0];
+			woken[0] = animSpriteCel;
+			parent = 0;
+		}
+
+		// Fait descendre le parent sous ses enfants plus grands
+		animSpriteCel = woken[parent];
+		while (1) {
+			child = parent * 2 + 1;
+			if (child >= heapCount) {
+				break;
+			}
+			if ((child + 1 < heapCount) && (woken[child + 1]->systemIndex > woken[child]->systemIndex)) {
+				child++;
+			}
+			if (woken[child]->systemIndex <= animSpriteCel->systemIndex) {
+				break;
+			}
+			woken[parent] = woken[child];
+			parent = child;
+		}
+		woken[parent] = animSpriteCel;
+	}
+}
+
+// Fusionne les AnimSpriteCels réveillés dans l'ensemble actif, en gardant l'ordre d'enregistrement (ordonnancement ACTIVE)
+static void AnimSpriteCelSystemActiveMerge(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+	// Ensemble actif et AnimSpriteCels réveillés
+	AnimSpriteCel **active = animSpriteCelSystem->active;
+	AnimSpriteCel **woken = animSpriteCelSystem->woken;
+	// AnimSpriteCels restant à placer depuis chaque tableau
+	uint32 activeIndex = animSpriteCelSystem->activeCount;
+	uint32 wokenIndex = animSpriteCelSystem->wokenCount;
+	// Position en cours de remplissage
+	uint32 index = animSpriteCelSystem->activeCount + animSpriteCelSystem->wokenCount;
+
+	// Si rien n'a été réveillé
+	if (wokenIndex == 0) {
+		return;
+	}
+
+	AnimSpriteCelSystemWokenSort(woken, wokenIndex);
+
+	// Depuis la fin, le plus grand index d'enregistrement d'abord (l'ensemble actif a la place pour chaque AnimSpriteCel enregistré)
+	while (wokenIndex > 0) {
+		index--;
+		if ((activeIndex > 0) && (active[activeIndex - 1]->systemIndex > woken[wokenIndex - 1]->systemIndex)) {
+			activeIndex--;
+			active[index] = active[activeIndex];
+		} else {
+			wokenIndex--;
+			active[index] = woken[wokenIndex];
+		}
+	}
+
+	animSpriteCelSystem->activeCount += animSpriteCelSystem->wokenCount;
+	animSpriteCelSystem->wokenCount = 0;
+}
+
+// Exécute l'ensemble actif et retire les AnimSpriteCels qui ne peuvent plus avancer (ordonnancement ACTIVE)
+static void AnimSpriteCelSystemActiveRun(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+	// Ensemble actif
+	AnimSpriteCel **active = animSpriteCelSystem->active;
+	// AnimSpriteCel en cours
+	AnimSpriteCel *animSpriteCel = NULL;
+	// Taille de l'ensemble au début de la visite
+	uint32 activeCount = animSpriteCelSystem->activeCount;
+	// Index du tableau
+	uint32 index = 0;
+	// AnimSpriteCels gardés, tassés au début du tableau
+	uint32 keptCount = 0;
+
+	// Pour chaque AnimSpriteCel de l'ensemble, comme en ordonnancement POLLING
+	for (index = 0; index < activeCount; index++) {
+
+		animSpriteCel = active[index];
+
+		// Même visite qu'en ordonnancement POLLING (il a pu être arrêté depuis sa dernière visite)
+		AnimSpriteCelSystemVisit(animSpriteCel);
+
+		// En attente d'un déclenchement ou terminée : quitte l'ensemble jusqu'à son réveil
+		if ((ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) == 0) || (animSpriteCel->iterationsCount == 0)) {
+			animSpriteCel->systemActive = 0;
+			continue;
+		}
+		active[keptCount] = animSpriteCel;
+		keptCount++;
+	}
+
+	animSpriteCelSystem->activeCount = keptCount;
+}
+
+// Donne les AnimSpriteCels visités par le prochain tick hors de l'ordonnancement WHEEL (chaque AnimSpriteCel enregistré, ou l'ensemble actif)
+static void AnimSpriteCelSystemArray(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel ***animSpriteCels, uint32 *animSpriteCelsCount) {
+
+	// Si seules les animations capables d'avancer sont visitées
+	if (animSpriteCelSystem->schedule == ACTIVE) {
+		// Les réveillés rejoignent l'ensemble actif maintenant plutôt qu'au prochain tick, ce qui ne change rien
+		AnimSpriteCelSystemActiveMerge(animSpriteCelSystem);
+		*animSpriteCels = animSpriteCelSystem->active;
+		*animSpriteCelsCount = animSpriteCelSystem->activeCount;
+		return;
+	}
+
+	*animSpriteCels = animSpriteCelSystem->animSpriteCels;
+	*animSpriteCelsCount = animSpriteCelSystem->animSpriteCelsCount;
+}
+
+// Lie le CCB d'un AnimSpriteCel après celui d'un autre dans la liste d'affichage (NULL = premier)
+static void AnimSpriteCelSystemDrawLink(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel, AnimSpriteCel *animSpriteCelPrevious) {
+
+	// AnimSpriteCel dessiné après lui
+	AnimSpriteCel *animSpriteCelNext = (animSpriteCelPrevious != NULL) ? animSpriteCelPrevious->drawNext : animSpriteCelSystem->drawFirst;
+
+	animSpriteCel->drawPrevious = animSpriteCelPrevious;
+	animSpriteCel->drawNext = animSpriteCelNext;
+	// La liste contient des pointeurs absolus
+	animSpriteCel->cel->ccb_Flags |= CCB_NPABS;
+
+	// Le lier au CCB précédent, ou en faire le premier
+	if (animSpriteCelPrevious != NULL) {
+		animSpriteCelPrevious->drawNext = animSpriteCel;
+		animSpriteCelPrevious->cel->ccb_NextPtr = animSpriteCel->cel;
+		animSpriteCelPrevious->cel->ccb_Flags &= ~CCB_LAST;
+	} else {
+		animSpriteCelSystem->drawFirst = animSpriteCel;
+	}
+
+	// Lui lier le CCB suivant, ou en faire le dernier
+	if (animSpriteCelNext != NULL) {
+		animSpriteCelNext->drawPrevious = animSpriteCel;
+		animSpriteCel->cel->ccb_NextPtr = animSpriteCelNext->cel;
+		animSpriteCel->cel->ccb_Flags &= ~CCB_LAST;
+	} else {
+		animSpriteCelSystem->drawLast = animSpriteCel;
+		animSpriteCel->cel->ccb_NextPtr = NULL;
+		animSpriteCel->cel->ccb_Flags |= CCB_LAST;
+	}
+
+	animSpriteCelSystem->drawCount++;
+}
+
+// Délie le CCB d'un AnimSpriteCel de la liste d'affichage
+static void AnimSpriteCelSystemDrawUnlink(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel) {
+
+	// Voisins dans la liste
+	AnimSpriteCel *animSpriteCelPrevious = animSpriteCel->drawPrevious;
+	AnimSpriteCel *animSpriteCelNext = animSpriteCel->drawNext;
+
+	// Le CCB précédent continue vers le suivant, ou termine la liste
+	if (animSpriteCelPrevious != NULL) {
+		animSpriteCelPrevious->drawNext = animSpriteCelNext;
+		if (animSpriteCelNext != NULL) {
+			animSpriteCelPrevious->cel->ccb_NextPtr = animSpriteCelNext->cel;
+		} else {
+			animSpriteCelPrevious->cel->ccb_NextPtr = NULL;
+			animSpriteCelPrevious->cel->ccb_Flags |= CCB_LAST;
+		}
+	} else {
+		animSpriteCelSystem->drawFirst = animSpriteCelNext;
+	}
+	if (animSpriteCelNext != NULL) {
+		animSpriteCelNext->drawPrevious = animSpriteCelPrevious;
+	} else {
+		animSpriteCelSystem->drawLast = animSpriteCelPrevious;
+	}
+
+	// Dessiné seul si le jeu le dessine
+	animSpriteCel->drawPrevious = NULL;
+	animSpriteCel->drawNext = NULL;
+	animSpriteCel->cel->ccb_NextPtr = NULL;
+	animSpriteCel->cel->ccb_Flags |= CCB_LAST;
+
+	animSpriteCelSystem->drawCount--;
+}
+
+// Ajoute le CCB d'un AnimSpriteCel visible à la liste d'affichage
+static void AnimSpriteCelSystemDrawShow(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel) {
+
+	// Groupes de la liste
+	AnimSpriteCelSystemDrawGroup *drawGroups = animSpriteCelSystem->drawGroups;
+	// Index du groupe
+	uint32 groupIndex = 0;
+	// Premier groupe libre
+	uint32 freeIndex = ANIMSPRITECELSYSTEM_DRAW_UNGROUPED;
+
+	// En SPAWN_ORDER, dessiné par-dessus les autres
+	if (animSpriteCelSystem->drawOrder == SPAWN_ORDER) {
+		AnimSpriteCelSystemDrawLink(animSpriteCelSystem, animSpriteCel, animSpriteCelSystem->drawLast);
+		return;
+	}
+
+	// Chercher le groupe de sa planche et de sa palette
+	for (groupIndex = 0; groupIndex < animSpriteCelSystem->drawGroupsCount; groupIndex++) {
+		if (drawGroups[groupIndex].count == 0) {
+			if (freeIndex == ANIMSPRITECELSYSTEM_DRAW_UNGROUPED) {
+				freeIndex = groupIndex;
+			}
+			continue;
+		}
+		if ((drawGroups[groupIndex].spriteCel == animSpriteCel->spriteCel) && (drawGroups[groupIndex].plutPtr == animSpriteCel->cel->ccb_PLUTPtr)) {
+			break;
+		}
+	}
+
+	// Si le groupe existe, dessiné après son dernier CCB
+	if (groupIndex < animSpriteCelSystem->drawGroupsCount) {
+		AnimSpriteCelSystemDrawLink(animSpriteCelSystem, animSpriteCel, drawGroups[groupIndex].last);
+		drawGroups[groupIndex].last = animSpriteCel;
+		drawGroups[groupIndex].count++;
+		animSpriteCel->drawGroup = groupIndex;
+		return;
+	}
+
+	// Sinon un nouveau groupe, à la fin de la liste
+	if ((freeIndex == ANIMSPRITECELSYSTEM_DRAW_UNGROUPED) && (animSpriteCelSystem->drawGroupsCount < animSpriteCelSystem->drawGroupsMax)) {
+		freeIndex = animSpriteCelSystem->drawGroupsCount;
+		animSpriteCelSystem->drawGroupsCount++;
+	}
+	AnimSpriteCelSystemDrawLink(animSpriteCelSystem, animSpriteCel, animSpriteCelSystem->drawLast);
+	animSpriteCel->drawGroup = freeIndex;
+
+	// Si tous les groupes sont pris, dessiné à la fin sans groupe
+	if (freeIndex == ANIMSPRITECELSYSTEM_DRAW_UNGROUPED) {
+		// Avertit une seule fois
+		if (animSpriteCelSystem->drawUngroupedCount == 0) {
+			printf("Warning : AnimSpriteCelSystem draw groups full (%u groups).\n", animSpriteCelSystem->drawGroupsMax);
+		}
+		animSpriteCelSystem->drawUngroupedCount++;
+		return;
+	}
+
+	drawGroups[freeIndex].spriteCel = animSpriteCel->spriteCel;
+	drawGroups[freeIndex].plutPtr = animSpriteCel->cel->ccb_PLUTPtr;
+	drawGroups[freeIndex].last = animSpriteCel;
+	drawGroups[freeIndex].count = 1;
+}
+
+// Retire le CCB d'un AnimSpriteCel de la liste d'affichage
+static void AnimSpriteCelSystemDrawHide(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel) {
+
+	// Groupe de l'AnimSpriteCel
+	AnimSpriteCelSystemDrawGroup *drawGroup = NULL;
+
+	// S'il appartient à un groupe
+	if ((animSpriteCelSystem->drawOrder == SOURCE_ORDER) && (animSpriteCel->drawGroup != ANIMSPRITECELSYSTEM_DRAW_UNGROUPED)) {
+		drawGroup = &animSpriteCelSystem->drawGroups[animSpriteCel->drawGroup];
+		drawGroup->count--;
+		// Le groupe est contigu : le CCB avant son dernier est aussi dans le groupe (sauf s'il est maintenant vide)
+		if (drawGroup->last == animSpriteCel) {
+			drawGroup->last = animSpriteCel->drawPrevious;
+		}
+	}
+
+	AnimSpriteCelSystemDrawUnlink(animSpriteCelSystem, animSpriteCel);
+}
+
+// Dérive la graine du générateur d'un AnimSpriteCel enregistré de la graine du système
+static uint32 AnimSpriteCelSystemSeedMix(uint32 seed, uint32 systemIndex) {
+
+	// Répartit les index sur les 32 bits (incrément du nombre d'or)
+	seed += (systemIndex + 1) * 0x9E3779B9;
+	// Mélange les bits
+	seed ^= seed >> 16;
+	seed *= 0x85EBCA6B;
+	seed ^= seed >> 13;
+
+	// Un générateur xorshift ne peut pas partir de 0
+	return (seed != 0) ? seed : 1;
+}
+
+// Donne le terme d'un AnimSpriteCel enregistré dans l'empreinte d'état
+static uint32 AnimSpriteCelSystemHashTerm(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel) {
+
+	// FNV-1a sur les mots de la tête de lecture et le tick auquel elle est fixée
+	uint32 term = 0x811C9DC5;
+
+	term = (term ^ animSpriteCel->systemIndex) * 0x01000193;
+	term = (term ^ animSpriteCelSystem->tick) * 0x01000193;
+	term = (term ^ (uint32)animSpriteCel->stepIndex) * 0x01000193;
+	term = (term ^ (uint32)animSpriteCel->direction) * 0x01000193;
+	term = (term ^ animSpriteCel->remainingCycles) * 0x01000193;
+	term = (term ^ animSpriteCel->iterationsCount) * 0x01000193;
+	term = (term ^ animSpriteCel->randomState) * 0x01000193;
+
+	// Mélanger les bits, pour que la somme des termes les garde tous
+	term ^= term >> 16;
+	term *= 0x85EBCA6B;
+	term ^= term >> 13;
+	term *= 0xC2B2AE35;
+	term ^= term >> 16;
+
+	return term;
+}
+
+// Remplace le terme d'un AnimSpriteCel enregistré dans l'empreinte d'état et enregistre le changement
+static void AnimSpriteCelSystemHashUpdate(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel) {
+
+	// Nouveau terme de l'AnimSpriteCel
+	uint32 term = AnimSpriteCelSystemHashTerm(animSpriteCelSystem, animSpriteCel);
+	// Changement enregistré
+	AnimSpriteCelSystemHashEntry *entry = NULL;
+
+	// Pendant un tick partitionné, le changement est gardé par la partition et ajouté à la fin du tick
+	if (animSpriteCelSystem->partitioned == 1) {
+		animSpriteCelSystem->outboxes[animSpriteCel->systemIndex / animSpriteCelSystem->partitionSize].stateHash += term - animSpriteCel->stateHash;
+		animSpriteCel->stateHash = term;
+		return;
+	}
+
+	// Le nouveau terme remplace l'ancien dans la somme
+	animSpriteCelSystem->stateHash += term - animSpriteCel->stateHash;
+	animSpriteCel->stateHash = term;
+
+	// Si les changements ne sont pas enregistrés
+	if (animSpriteCelSystem->hashEntries == NULL) {
+		return;
+	}
+
+	// Une fois l'enregistrement plein, les changements sont seulement comptés
+	if (animSpriteCelSystem->hashEntriesCount >= animSpriteCelSystem->hashEntriesMax) {
+		animSpriteCelSystem->hashEntriesLost++;
+		return;
+	}
+
+	// Ajouter la nouvelle tête de lecture et l'empreinte d'état qu'elle donne
+	entry = &animSpriteCelSystem->hashEntries[animSpriteCelSystem->hashEntriesCount];
+	animSpriteCelSystem->hashEntriesCount++;
+	entry->tick = animSpriteCelSystem->tick;
+	entry->animationIndex = animSpriteCel->systemIndex;
+	entry->stepIndex = (uint16)animSpriteCel->stepIndex;
+	entry->flags = (animSpriteCel->direction == -1) ? ANIMSPRITECELSYSTEM_PLAYHEAD_BACKWARD : 0;
+	entry->remainingCycles = animSpriteCel->remainingCycles;
+	entry->iterationsCount = animSpriteCel->iterationsCount;
+	entry->randomState = animSpriteCel->randomState;
+	entry->stateHash = animSpriteCelSystem->stateHash;
+}
+
+// Initialisation d'un AnimSpriteCelSystem
+AnimSpriteCelSystem *AnimSpriteCelSystemInitialization(uint32 animSpriteCelsMax, AnimSpriteCelSchedule schedule) {
+
+	// AnimSpriteCelSystem
+	AnimSpriteCelSystem *animSpriteCelSystem = NULL;
+
+	// Si la capacité est nulle
+	if (animSpriteCelsMax == 0) {
+		// Affiche un message d'erreur
+		printf("Error : AnimSpriteCelSystem needs at least one AnimSpriteCel.\n");
+		return NULL;
+	}
+
+	// Alloue de la mémoire pour le AnimSpriteCelSystem
+	animSpriteCelSystem = (AnimSpriteCelSystem *)AllocMem(sizeof(AnimSpriteCelSystem), MEMTYPE_DRAM);
+	// Si c'est un échec
+	if (animSpriteCelSystem == NULL) {
+		// Affiche un message d'erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCelSystem.\n");
+		return NULL;
+	}
+
+	// Alloue de la mémoire pour le tableau d'AnimSpriteCels
+	animSpriteCelSystem->animSpriteCels = (AnimSpriteCel **)AllocMem(animSpriteCelsMax * sizeof(AnimSpriteCel *), MEMTYPE_DRAM);
+	// Si c'est un échec
+	if (animSpriteCelSystem->animSpriteCels == NULL) {
+		// Libère le AnimSpriteCelSystem
+		FreeMem(animSpriteCelSystem, sizeof(AnimSpriteCelSystem));
+		// Affiche un message d'erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCelSystem array.\n");
+		return NULL;
+	}
+
+	// Ensemble actif et AnimSpriteCels réveillés (ordonnancement ACTIVE)
+	animSpriteCelSystem->active = NULL;
+	animSpriteCelSystem->activeCount = 0;
+	animSpriteCelSystem->woken = NULL;
+	animSpriteCelSystem->wokenCount = 0;
+	if (schedule == ACTIVE) {
+		// Alloue la mémoire pour les deux, chacun capable de contenir chaque AnimSpriteCel enregistré
+		animSpriteCelSystem->active = (AnimSpriteCel **)AllocMem(animSpriteCelsMax * sizeof(AnimSpriteCel *), MEMTYPE_DRAM);
+		animSpriteCelSystem->woken = (AnimSpriteCel **)AllocMem(animSpriteCelsMax * sizeof(AnimSpriteCel *), MEMTYPE_DRAM);
+		// Si une allocation échoue
+		if ((animSpriteCelSystem->active == NULL) || (animSpriteCelSystem->woken == NULL)) {
+			// Libère la mémoire allouée précédemment
+			if (animSpriteCelSystem->active != NULL) {
+				FreeMem(animSpriteCelSystem->active, animSpriteCelsMax * sizeof(AnimSpriteCel *));
+			}
+			if (animSpriteCelSystem->woken != NULL) {
+				FreeMem(animSpriteCelSystem->woken, animSpriteCelsMax * sizeof(AnimSpriteCel *));
+			}
+			FreeMem(animSpriteCelSystem->animSpriteCels, animSpriteCelsMax * sizeof(AnimSpriteCel *));
+			FreeMem(animSpriteCelSystem, sizeof(AnimSpriteCelSystem));
+			// Affiche un message d'erreur
+			printf("Error : Failed to allocate memory for AnimSpriteCelSystem active set.\n");
+			return NULL;
+		}
+	}
+
+	// Aucun AnimSpriteCel enregistré
+	animSpriteCelSystem->animSpriteCelsCount = 0;
+	// Capacité du tableau
+	animSpriteCelSystem->animSpriteCelsMax = animSpriteCelsMax;
+	// Aucun AnimSpriteCel compté en MICROSECONDS pour l'instant
+	animSpriteCelSystem->microsecondsCount = 0;
+	// Aucun changement pour l'instant
+	animSpriteCelSystem->generation = 0;
+	// Ordonnancement des animations
+	animSpriteCelSystem->schedule = schedule;
+	// Premier cycle d'affichage
+	animSpriteCelSystem->tick = 0;
+	// Roue temporelle vide
+	memset(animSpriteCelSystem->wheel, 0, sizeof(animSpriteCelSystem->wheel));
+	animSpriteCelSystem->wheelOverflow = NULL;
+	// Déclenchements distribués immédiatement, sans file
+	animSpriteCelSystem->delivery = IMMEDIATE;
+	animSpriteCelSystem->triggers = NULL;
+	animSpriteCelSystem->triggersMax = 0;
+	animSpriteCelSystem->triggersFirst = 0;
+	animSpriteCelSystem->triggersCount = 0;
+	animSpriteCelSystem->triggersBudget = 0;
+	animSpriteCelSystem->triggerDepth = 0;
+	animSpriteCelSystem->triggersDeferred = 0;
+	animSpriteCelSystem->triggersDropped = 0;
+	animSpriteCelSystem->cyclesCount = 0;
+	// Nombres aléatoires matériels tant qu'il n'a pas de graine
+	animSpriteCelSystem->seed = 0;
+	// Pas de partitions
+	animSpriteCelSystem->outboxes = NULL;
+	animSpriteCelSystem->partitionsCount = 0;
+	animSpriteCelSystem->partitionSize = 0;
+	animSpriteCelSystem->partitioned = 0;
+	// Pas de liste d'affichage
+	animSpriteCelSystem->drawListed = 0;
+	animSpriteCelSystem->drawOrder = SPAWN_ORDER;
+	animSpriteCelSystem->drawFirst = NULL;
+	animSpriteCelSystem->drawLast = NULL;
+	animSpriteCelSystem->drawCount = 0;
+	animSpriteCelSystem->drawGroups = NULL;
+	animSpriteCelSystem->drawGroupsCount = 0;
+	animSpriteCelSystem->drawGroupsMax = 0;
+	animSpriteCelSystem->drawUngroupedCount = 0;
+	// Changements non suivis
+	animSpriteCelSystem->dirty = NULL;
+	// Un tick par cycle d'affichage, rien de reporté
+	animSpriteCelSystem->timeScale = ANIMSPRITECEL_SPEED_NORMAL;
+	animSpriteCelSystem->timeAccumulator = 0;
+	// Empreinte d'état non gardée, rien d'enregistré
+	animSpriteCelSystem->hashed = 0;
+	animSpriteCelSystem->stateHash = 0;
+	animSpriteCelSystem->hashEntries = NULL;
+	animSpriteCelSystem->hashEntriesMax = 0;
+	animSpriteCelSystem->hashEntriesCount = 0;
+	animSpriteCelSystem->hashEntriesLost = 0;
+	animSpriteCelSystem->hashOriginTick = 0;
+	animSpriteCelSystem->hashOrigin = 0;
+	// Événements non collectés
+	animSpriteCelSystem->events = NULL;
+	animSpriteCelSystem->eventsMax = 0;
+	animSpriteCelSystem->eventsCount = 0;
+	animSpriteCelSystem->eventsLost = 0;
+
+	// Retourne le AnimSpriteCelSystem
+	return animSpriteCelSystem;
+}
+
+// Enregistre un AnimSpriteCel dans le système
+int32 AnimSpriteCelSystemRegister(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel) {
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return -1;
+	}
+
+	// Si l'AnimSpriteCel est inconnu
+	if (animSpriteCel == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel unknow.\n");
+		return -1;
+	}
+
+	// Si le SpriteCel n'est pas défini
+	if (animSpriteCel->spriteCel == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel SpriteCel unknow.\n");
+		return -1;
+	}
+
+	// Si le tableau d'étapes n'est pas défini
+	if ((animSpriteCel->steps == NULL) && (animSpriteCel->packedSteps == NULL)) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel steps unknow.\n");
+		return -1;
+	}
+
+	// Si l'animation a moins de deux étapes
+	if (animSpriteCel->stepsCount < 2) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel needs at least two steps.\n");
+		return -1;
+	}
+
+	// Si l'AnimSpriteCel appartient déjà à un système
+	if (animSpriteCel->system != NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel already registered.\n");
+		return -1;
+	}
+
+	// Une roue temporelle range la fin d'une étape en ticks au début de l'étape
+	if ((animSpriteCelSystem->schedule == WHEEL) && (animSpriteCel->speed != ANIMSPRITECEL_SPEED_NORMAL)) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel speed doesn't apply in WHEEL schedule.\n");
+		return -1;
+	}
+
+	// Si le système est plein
+	if (animSpriteCelSystem->animSpriteCelsCount >= animSpriteCelSystem->animSpriteCelsMax) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem full (%u AnimSpriteCels).\n", animSpriteCelSystem->animSpriteCelsMax);
+		return -1;
+	}
+
+	// Ajoute l'AnimSpriteCel à la fin du tableau
+	animSpriteCelSystem->animSpriteCels[animSpriteCelSystem->animSpriteCelsCount] = animSpriteCel;
+	// Lie l'AnimSpriteCel à son système
+	animSpriteCel->system = animSpriteCelSystem;
+	animSpriteCel->systemIndex = animSpriteCelSystem->animSpriteCelsCount;
+	// Son terme entre dans l'empreinte d'état quand il est planifié
+	animSpriteCel->stateHash = 0;
+	// Un AnimSpriteCel enregistré de plus
+	animSpriteCelSystem->animSpriteCelsCount++;
+	// Ses durées en microsecondes ne sont exécutées que par AnimSpriteCelSystemTimeRun()
+	if (animSpriteCel->timeBase == MICROSECONDS) {
+		animSpriteCelSystem->microsecondsCount++;
+	}
+	// Les analyses du système ne correspondent plus à ses enregistrements
+	animSpriteCelSystem->generation++;
+
+	// Si le système a une graine, lui donne son générateur
+	if (animSpriteCelSystem->seed != 0) {
+		AnimSpriteCelRandomSeed(animSpriteCel, AnimSpriteCelSystemSeedMix(animSpriteCelSystem->seed, animSpriteCel->systemIndex));
+	}
+
+	// Planifie la fin de l'étape en cours
+	AnimSpriteCelSystemSchedule(animSpriteCelSystem, animSpriteCel);
+
+	// Si la liste d'affichage est gardée, lier son CCB
+	if ((animSpriteCelSystem->drawListed == 1) && (animSpriteCel->visible == 1)) {
+		AnimSpriteCelSystemDrawShow(animSpriteCelSystem, animSpriteCel);
+	}
+
+	// Si les changements sont suivis, son CCB est nouveau pour le jeu
+	if (animSpriteCelSystem->dirty != NULL) {
+		AnimSpriteCelSystemDirty(animSpriteCelSystem, animSpriteCel);
+	}
+
+	// Retourne l'index de l'AnimSpriteCel dans le système
+	return (int32)animSpriteCel->systemIndex;
+}
+
+// Retire un AnimSpriteCel du système
+int32 AnimSpriteCelSystemUnregister(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel) {
+
+	// Index du tableau
+	uint32 index = 0;
+	// Trouvé dans l'ensemble actif
+	uint32 removed = 0;
+	// AnimSpriteCel renuméroté
+	AnimSpriteCel *animSpriteCelMoved = NULL;
+	// AnimSpriteCel enregistré avec des étapes compactes
+	AnimSpriteCel *animSpriteCelSender = NULL;
+	// Index d'étape et index du receveur d'une étape compacte
+	uint32 stepIndex = 0;
+	uint32 receiverIndex = 0;
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return -1;
+	}
+
+	// Si l'AnimSpriteCel est inconnu
+	if (animSpriteCel == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel unknow.\n");
+		return -1;
+	}
+
+	// Si l'AnimSpriteCel appartient à un autre système
+	if (animSpriteCel->system != animSpriteCelSystem) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel not registered in this AnimSpriteCelSystem.\n");
+		return -1;
+	}
+
+	// Les étapes compactes désignent leurs receveurs par index : le décalage redirigerait ceux à partir de celui-ci
+	for (index = 0; index < animSpriteCelSystem->animSpriteCelsCount; index++) {
+		animSpriteCelSender = animSpriteCelSystem->animSpriteCels[index];
+		if ((animSpriteCelSender == animSpriteCel) || (animSpriteCelSender->packedSteps == NULL)) {
+			continue;
+		}
+		for (stepIndex = 0; stepIndex < animSpriteCelSender->stepsCount; stepIndex++) {
+			receiverIndex = animSpriteCelSender->packedSteps[stepIndex].receiverIndex;
+			if ((receiverIndex != ANIMSPRITECEL_RECEIVER_NONE) && (receiverIndex >= animSpriteCel->systemIndex)) {
+				// Retourne une erreur
+				printf("Error : AnimSpriteCel %u triggers receiver index %u, unregister the packed senders first.\n", index, receiverIndex);
+				return -1;
+			}
+		}
+	}
+
+	// Si l'AnimSpriteCel est dans la roue
+	if (animSpriteCel->wheelSlot != NULL) {
+		// Met à jour le nombre de cycles restants
+		animSpriteCel->remainingCycles = animSpriteCel->expiryTick - animSpriteCelSystem->tick;
+		AnimSpriteCelSystemWheelUnlink(animSpriteCel);
+	}
+
+	// Si l'AnimSpriteCel est dans l'ensemble actif ou réveillé
+	if (animSpriteCel->systemActive == 1) {
+		// Le retire de l'ensemble actif, en décalant les suivants pour garder l'ordre d'enregistrement
+		for (index = 0; index < animSpriteCelSystem->activeCount; index++) {
+			if (animSpriteCelSystem->active[index] == animSpriteCel) {
+				removed = 1;
+			} else if (removed == 1) {
+				animSpriteCelSystem->active[index - 1] = animSpriteCelSystem->active[index];
+			}
+		}
+		animSpriteCelSystem->activeCount -= removed;
+		// Ou des réveillés, dont l'ordre n'a pas d'importance
+		for (index = 0; index < animSpriteCelSystem->wokenCount; index++) {
+			if (animSpriteCelSystem->woken[index] == animSpriteCel) {
+				animSpriteCelSystem->wokenCount--;
+				animSpriteCelSystem->woken[index] = animSpriteCelSystem->woken[animSpriteCelSystem->wokenCount];
+				break;
+			}
+		}
+		animSpriteCel->systemActive = 0;
+	}
+
+	// Si son CCB est dans la liste d'affichage
+	if ((animSpriteCelSystem->drawListed == 1) && (animSpriteCel->visible == 1)) {
+		AnimSpriteCelSystemDrawHide(animSpriteCelSystem, animSpriteCel);
+	}
+
+	// Abandonne les déclenchements qui lui sont destinés
+	for (index = 0; index < animSpriteCelSystem->triggersCount; index++) {
+		if (animSpriteCelSystem->triggers[(animSpriteCelSystem->triggersFirst + index) % animSpriteCelSystem->triggersMax].animSpriteCel == animSpriteCel) {
+			animSpriteCelSystem->triggers[(animSpriteCelSystem->triggersFirst + index) % animSpriteCelSystem->triggersMax].animSpriteCel = NULL;
+		}
+	}
+
+	// Ses événements restent à lire, sans l'AnimSpriteCel
+	for (index = 0; index < animSpriteCelSystem->eventsCount; index++) {
+		if (animSpriteCelSystem->events[index].animSpriteCel == animSpriteCel) {
+			animSpriteCelSystem->events[index].animSpriteCel = NULL;
+		}
+	}
+
+	// Décale les AnimSpriteCels suivants pour conserver l'ordre d'enregistrement
+	for (index = animSpriteCel->systemIndex + 1; index < animSpriteCelSystem->animSpriteCelsCount; index++) {
+		animSpriteCelSystem->animSpriteCels[index - 1] = animSpriteCelSystem->animSpriteCels[index];
+		animSpriteCelSystem->animSpriteCels[index - 1]->systemIndex = index - 1;
+	}
+
+	// Si l'empreinte d'état est gardée, son terme quitte la somme et les AnimSpriteCels renumérotés reprennent les leurs
+	if (animSpriteCelSystem->hashed == 1) {
+		animSpriteCelSystem->stateHash -= animSpriteCel->stateHash;
+		for (index = animSpriteCel->systemIndex + 1; index < animSpriteCelSystem->animSpriteCelsCount; index++) {
+			animSpriteCelMoved = animSpriteCelSystem->animSpriteCels[index - 1];
+			animSpriteCelSystem->stateHash -= animSpriteCelMoved->stateHash;
+			animSpriteCelMoved->stateHash = AnimSpriteCelSystemHashTerm(animSpriteCelSystem, animSpriteCelMoved);
+			animSpriteCelSystem->stateHash += animSpriteCelMoved->stateHash;
+		}
+	}
+
+	// Si les changements sont suivis, leurs bits les suivent
+	if (animSpriteCelSystem->dirty != NULL) {
+		for (index = animSpriteCel->systemIndex + 1; index < animSpriteCelSystem->animSpriteCelsCount; index++) {
+			if ((animSpriteCelSystem->dirty[index >> 5] & (1u << (index & 31))) != 0) {
+				animSpriteCelSystem->dirty[(index - 1) >> 5] |= 1u << ((index - 1) & 31);
+			} else {
+				animSpriteCelSystem->dirty[(index - 1) >> 5] &= ~(1u << ((index - 1) & 31));
+			}
+		}
+		// Le dernier bit est maintenant au-delà des AnimSpriteCels enregistrés
+		index = animSpriteCelSystem->animSpriteCelsCount - 1;
+		animSpriteCelSystem->dirty[index >> 5] &= ~(1u << (index & 31));
+	}
+
+	// Un AnimSpriteCel enregistré de moins
+	animSpriteCelSystem->animSpriteCelsCount--;
+	if (animSpriteCel->timeBase == MICROSECONDS) {
+		animSpriteCelSystem->microsecondsCount--;
+	}
+	// Les analyses du système ne correspondent plus à ses enregistrements
+	animSpriteCelSystem->generation++;
+	// Détache l'AnimSpriteCel
+	animSpriteCel->system = NULL;
+	animSpriteCel->systemIndex = 0;
+
+	// Retourne un succès
+	return 1;
+}
+
+// Configuration de la distribution des déclenchements
+int32 AnimSpriteCelSystemTriggerConfiguration(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCelDelivery delivery, uint32 triggersMax, uint32 triggersBudget) {
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return -1;
+	}
+
+	// Si des déclenchements sont encore en attente
+	if (animSpriteCelSystem->triggersCount > 0) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem has %u pending triggers.\n", animSpriteCelSystem->triggersCount);
+		return -1;
+	}
+
+	// Si une distribution différée n'a pas de place
+	if ((delivery != IMMEDIATE) && (triggersMax == 0)) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem trigger queue needs at least one trigger.\n");
+		return -1;
+	}
+
+	// Si il y a une file précédente
+	if (animSpriteCelSystem->triggers != NULL) {
+		FreeMem(animSpriteCelSystem->triggers, animSpriteCelSystem->triggersMax * sizeof(AnimSpriteCelSystemTrigger));
+		animSpriteCelSystem->triggers = NULL;
+		animSpriteCelSystem->triggersMax = 0;
+	}
+
+	// Si les déclenchements sont mis en file
+	if (delivery != IMMEDIATE) {
+		// Alloue de la mémoire pour la file
+		animSpriteCelSystem->triggers = (AnimSpriteCelSystemTrigger *)AllocMem(triggersMax * sizeof(AnimSpriteCelSystemTrigger), MEMTYPE_DRAM);
+		// Si c'est un échec
+		if (animSpriteCelSystem->triggers == NULL) {
+			// Revient à la distribution immédiate
+			animSpriteCelSystem->delivery = IMMEDIATE;
+			// Retourne une erreur
+			printf("Error : Failed to allocate memory for AnimSpriteCelSystem triggers.\n");
+			return -1;
+		}
+		animSpriteCelSystem->triggersMax = triggersMax;
+	}
+
+	// Paramètres de distribution
+	animSpriteCelSystem->delivery = delivery;
+	animSpriteCelSystem->triggersFirst = 0;
+	animSpriteCelSystem->triggersBudget = triggersBudget;
+
+	// Retourne un succès
+	return 1;
+}
+
+// Met en file un déclenchement envoyé par un AnimSpriteCel enregistré
+void AnimSpriteCelSystemTriggerPush(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel) {
+
+	// Index dans la file
+	uint32 index = 0;
+
+	// Si la file est pleine
+	if (animSpriteCelSystem->triggersCount == animSpriteCelSystem->triggersMax) {
+		// Avertit une seule fois
+		if (animSpriteCelSystem->triggersDropped == 0) {
+			printf("Warning : AnimSpriteCelSystem trigger queue full (%u triggers).\n", animSpriteCelSystem->triggersMax);
+		}
+		animSpriteCelSystem->triggersDropped++;
+		return;
+	}
+
+	// Ajoute après le dernier déclenchement en attente
+	index = animSpriteCelSystem->triggersFirst + animSpriteCelSystem->triggersCount;
+	if (index >= animSpriteCelSystem->triggersMax) {
+		index -= animSpriteCelSystem->triggersMax;
+	}
+	animSpriteCelSystem->triggers[index].animSpriteCel = animSpriteCel;
+	// Un maillon plus loin que le déclenchement en cours de distribution
+	animSpriteCelSystem->triggers[index].depth = animSpriteCelSystem->triggerDepth + 1;
+	animSpriteCelSystem->triggersCount++;
+}
+
+// Donne une graine aux générateurs aléatoires des AnimSpriteCels enregistrés
+int32 AnimSpriteCelSystemSeed(AnimSpriteCelSystem *animSpriteCelSystem, uint32 seed) {
+
+	// Index du tableau
+	uint32 index = 0;
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return -1;
+	}
+
+	// Graine des prochains enregistrements
+	animSpriteCelSystem->seed = seed;
+
+	// Donne une graine à chaque AnimSpriteCel enregistré et tire son étape aléatoire en cours (0 = retour au matériel)
+	for (index = 0; index < animSpriteCelSystem->animSpriteCelsCount; index++) {
+		AnimSpriteCelRandomSeed(animSpriteCelSystem->animSpriteCels[index], (seed != 0) ? AnimSpriteCelSystemSeedMix(seed, index) : 0);
+	}
+
+	// Retourne un succès
+	return 1;
+}
+
+// Planifie un AnimSpriteCel selon son étape en cours
+void AnimSpriteCelSystemSchedule(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel) {
+
+	// Si l'empreinte d'état est gardée, la nouvelle tête de lecture y prend sa place
+	if (animSpriteCelSystem->hashed == 1) {
+		AnimSpriteCelSystemHashUpdate(animSpriteCelSystem, animSpriteCel);
+	}
+
+	// Si seules les animations capables d'avancer sont visitées
+	if (animSpriteCelSystem->schedule == ACTIVE) {
+
+		// S'il est déjà dans l'ensemble actif, ou attend un déclenchement, ou est terminé
+		if ((animSpriteCel->systemActive == 1) || (ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) == 0) || (animSpriteCel->iterationsCount == 0)) {
+			return;
+		}
+
+		// Le réveille : il rejoint l'ensemble actif au prochain tick
+		animSpriteCel->systemActive = 1;
+		animSpriteCelSystem->woken[animSpriteCelSystem->wokenCount] = animSpriteCel;
+		animSpriteCelSystem->wokenCount++;
+		return;
+	}
+
+	// Rien à faire lorsque chaque animation est visitée
+	if (animSpriteCelSystem->schedule != WHEEL) {
+		return;
+	}
+
+	// Si l'AnimSpriteCel est déjà dans la roue
+	if (animSpriteCel->wheelSlot != NULL) {
+		AnimSpriteCelSystemWheelUnlink(animSpriteCel);
+	}
+
+	// Si l'animation est en attente d'un déclencheur
+	if (ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) == 0) {
+		// Reste en dehors de la roue jusqu'au déclenchement
+		return;
+	}
+
+	// Si toutes les itérations ont été réalisées
+	if (animSpriteCel->iterationsCount == 0) {
+		// Reste en dehors de la roue
+		return;
+	}
+
+	// L'étape se termine après ses cycles restants
+	animSpriteCel->expiryTick = animSpriteCelSystem->tick + animSpriteCel->remainingCycles;
+	AnimSpriteCelSystemWheelLink(animSpriteCelSystem, animSpriteCel);
+}
+
+// Exécute un tick des animations enregistrées
+static void AnimSpriteCelSystemTick(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+	// AnimSpriteCel en cours
+	AnimSpriteCel *animSpriteCel = NULL;
+	// Cycle d'affichage en cours d'exécution
+	uint32 tick = 0;
+	// Case de la roue du cycle d'affichage
+	AnimSpriteCel **slot = NULL;
+	// Liste détachée de la case
+	AnimSpriteCel *list = NULL;
+
+	// Cycle d'affichage en cours d'exécution
+	tick = animSpriteCelSystem->tick;
+
+	// Les déclenchements du tick précédent passent en premier
+	if (animSpriteCelSystem->delivery == NEXT_TICK) {
+		AnimSpriteCelSystemTriggerDispatch(animSpriteCelSystem, animSpriteCelSystem->triggersCount);
+	}
+
+	// Si seules les étapes qui se terminent sont visitées
+	if (animSpriteCelSystem->schedule == WHEEL) {
+
+		// Descend au premier niveau les étapes qui se terminent à ce tick
+		AnimSpriteCelSystemWheelCascade(animSpriteCelSystem, tick - 1);
+		// Les nouvelles étapes sont comptées à partir du tick suivant
+		animSpriteCelSystem->tick = tick + 1;
+
+		// Détache la case de ce tick (une étape de 64 ticks commencée maintenant retourne dans la même case)
+		slot = &animSpriteCelSystem->wheel[0][tick & (ANIMSPRITECELSYSTEM_WHEEL_SLOTS - 1)];
+		list = *slot;
+		*slot = NULL;
+		// Les visite dans l'ordre d'enregistrement, comme en ordonnancement POLLING
+		list = AnimSpriteCelSystemWheelSort(list);
+
+		// Pour chaque AnimSpriteCel dont l'étape se termine à ce tick
+		while (list != NULL) {
+
+			animSpriteCel = list;
+			list = list->wheelNext;
+			animSpriteCel->wheelSlot = NULL;
+			animSpriteCel->wheelPrevious = NULL;
+			animSpriteCel->wheelNext = NULL;
+
+			// Si l'animation a été arrêtée entre temps
+			if ((ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) == 0) || (animSpriteCel->iterationsCount == 0)) {
+				continue;
+			}
+
+			// Passe à l'étape suivante de l'animation (planifie la nouvelle)
+			animSpriteCel->remainingCycles = 0;
+			AnimSpriteCelNextStep(animSpriteCel);
+		}
+
+		// Les déclenchements de ce tick passent en dernier, avec ceux qu'ils envoient (limités par le budget et le contrôle des cycles)
+		if (animSpriteCelSystem->delivery == SAME_TICK) {
+			AnimSpriteCelSystemTriggerDispatch(animSpriteCelSystem, 0xFFFFFFFF);
+		}
+		return;
+	}
+
+	// Cycle d'affichage suivant
+	animSpriteCelSystem->tick = tick + 1;
+
+	// Si seules les animations capables d'avancer sont visitées
+	if (animSpriteCelSystem->schedule == ACTIVE) {
+		// Les AnimSpriteCels réveillés rejoignent l'ensemble actif, qui est ensuite exécuté
+		AnimSpriteCelSystemActiveMerge(animSpriteCelSystem);
+		AnimSpriteCelSystemActiveRun(animSpriteCelSystem);
+	} else {
+		// Pour chaque AnimSpriteCel enregistré
+		AnimSpriteCelSystemRunRange(animSpriteCelSystem, 0, animSpriteCelSystem->animSpriteCelsCount);
+	}
+
+	// Les déclenchements de ce tick passent en dernier, avec ceux qu'ils envoient (limités par le budget et le contrôle des cycles)
+	if (animSpriteCelSystem->delivery == SAME_TICK) {
+		AnimSpriteCelSystemTriggerDispatch(animSpriteCelSystem, 0xFFFFFFFF);
+	}
+}
+
+// Exécution de toutes les animations enregistrées
+int32 AnimSpriteCelSystemRun(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+	// Ticks du cycle d'affichage
+	uint32 ticksCount = 0;
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return -1;
+	}
+
+	// Un tick est un cycle d'affichage, pas les microsecondes écoulées
+	if (animSpriteCelSystem->microsecondsCount > 0) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem runs AnimSpriteCels in MICROSECONDS, use AnimSpriteCelSystemTimeRun().\n");
+		return -1;
+	}
+
+	// Ticks donnés par l'échelle de temps (un à l'échelle normale)
+	ticksCount = AnimSpriteCelSystemTicks(animSpriteCelSystem);
+
+	// Les exécute tour à tour
+	while (ticksCount > 0) {
+		AnimSpriteCelSystemTick(animSpriteCelSystem);
+		ticksCount--;
+	}
+
+	// Retourne un succès
+	return 1;
+}
+
+// Règle l'échelle de temps du système
+int32 AnimSpriteCelSystemTimeScale(AnimSpriteCelSystem *animSpriteCelSystem, uint32 timeScale) {
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return -1;
+	}
+
+	// Corrige l'échelle de temps pour qu'un cycle d'affichage exécute un nombre borné de ticks
+	if (timeScale > ANIMSPRITECELSYSTEM_TIME_SCALE_MAX) {
+		// Affiche un avertissement
+		printf("Warning : AnimSpriteCelSystem time scale 0x%08X too high. Clamped to 0x%08X.\n", timeScale, ANIMSPRITECELSYSTEM_TIME_SCALE_MAX);
+		// Modifie l'échelle de temps à la plus haute
+		timeScale = ANIMSPRITECELSYSTEM_TIME_SCALE_MAX;
+	}
+
+	// Prise en compte au prochain cycle d'affichage, la fraction reportée est gardée
+	animSpriteCelSystem->timeScale = timeScale;
+
+	// Retourne un succès
+	return 1;
+}
+
+// Donne le nombre de ticks d'un cycle d'affichage à l'échelle de temps
+uint32 AnimSpriteCelSystemTicks(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+	// Ticks entiers atteints par l'accumulateur
+	uint32 ticksCount = 0;
+
+	// À l'échelle normale, un tick par cycle d'affichage
+	if (animSpriteCelSystem->timeScale == ANIMSPRITECEL_SPEED_NORMAL) {
+		return 1;
+	}
+
+	// Ajoute l'échelle de temps : les ticks entiers sont exécutés, la fraction est reportée
+	animSpriteCelSystem->timeAccumulator += animSpriteCelSystem->timeScale;
+	ticksCount = animSpriteCelSystem->timeAccumulator >> 16;
+	animSpriteCelSystem->timeAccumulator &= 0xFFFF;
+
+	// Retourne les ticks à exécuter
+	return ticksCount;
+}
+
+// Exécute les animations enregistrées pendant le temps écoulé depuis la dernière exécution
+int32 AnimSpriteCelSystemTimeRun(AnimSpriteCelSystem *animSpriteCelSystem, uint32 elapsedMicroseconds) {
+
+	// AnimSpriteCels enregistrés
+	AnimSpriteCel **animSpriteCels = NULL;
+	// AnimSpriteCel en cours
+	AnimSpriteCel *animSpriteCel = NULL;
+	// Index du tableau
+	uint32 index = 0;
+	// Fraction de l'échelle de temps
+	uint32 fraction = 0;
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return -1;
+	}
+
+	// Les étapes qui se terminent sont trouvées en visitant chaque animation
+	if (animSpriteCelSystem->schedule != POLLING) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem time runs need POLLING schedule.\n");
+		return -1;
+	}
+
+	// Si un tick partitionné est en cours
+	if (animSpriteCelSystem->partitioned == 1) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem partitioned tick running.\n");
+		return -1;
+	}
+
+	// Met le temps écoulé à l'échelle, la fraction de microseconde est reportée (découpé en moitiés de 16 bits pour rester sur 32 bits)
+	if (animSpriteCelSystem->timeScale != ANIMSPRITECEL_SPEED_NORMAL) {
+		fraction = animSpriteCelSystem->timeScale & 0xFFFF;
+		animSpriteCelSystem->timeAccumulator += (elapsedMicroseconds & 0xFFFF) * fraction;
+		elapsedMicroseconds = (elapsedMicroseconds * (animSpriteCelSystem->timeScale >> 16)) + ((elapsedMicroseconds >> 16) * fraction) + (animSpriteCelSystem->timeAccumulator >> 16);
+		animSpriteCelSystem->timeAccumulator &= 0xFFFF;
+	}
+
+	// Les déclenchements de l'exécution précédente passent en premier
+	if (animSpriteCelSystem->delivery == NEXT_TICK) {
+		AnimSpriteCelSystemTriggerDispatch(animSpriteCelSystem, animSpriteCelSystem->triggersCount);
+	}
+
+	// Exécution suivante
+	animSpriteCelSystem->tick++;
+
+	// Pour chaque AnimSpriteCel enregistré
+	animSpriteCels = animSpriteCelSystem->animSpriteCels;
+	for (index = 0; index < animSpriteCelSystem->animSpriteCelsCount; index++) {
+
+		animSpriteCel = animSpriteCels[index];
+
+		// Les durées en microsecondes rattrapent le temps écoulé
+		if (animSpriteCel->timeBase == MICROSECONDS) {
+			AnimSpriteCelAdvance(animSpriteCel, elapsedMicroseconds);
+			continue;
+		}
+
+		// Les durées en cycles d'affichage en exécutent un
+		AnimSpriteCelRun(animSpriteCel);
+	}
+
+	// Les déclenchements de cette exécution passent en dernier, avec ceux qu'ils envoient (bornés par le budget et la détection de cycle)
+	if (animSpriteCelSystem->delivery == SAME_TICK) {
+		AnimSpriteCelSystemTriggerDispatch(animSpriteCelSystem, 0xFFFFFFFF);
+	}
+
+	// Retourne un succès
+	return 1;
+}
+
+// Libère les événements des boîtes d'envoi si présents
+static void AnimSpriteCelSystemOutboxEventsFree(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+	// Index de partition
+	uint32 index = 0;
+
+	// Si les boîtes d'envoi ne gardent pas d'événements
+	if ((animSpriteCelSystem->outboxes == NULL) || (animSpriteCelSystem->outboxes[0].events == NULL)) {
+		return;
+	}
+
+	FreeMem(animSpriteCelSystem->outboxes[0].events, animSpriteCelSystem->partitionsCount * animSpriteCelSystem->partitionSize * sizeof(AnimSpriteCelSystemEvent));
+	for (index = 0; index < animSpriteCelSystem->partitionsCount; index++) {
+		animSpriteCelSystem->outboxes[index].events = NULL;
+		animSpriteCelSystem->outboxes[index].eventsCount = 0;
+	}
+}
+
+// Donne à chaque boîte d'envoi la place des événements de sa partition
+static int32 AnimSpriteCelSystemOutboxEventsAllocation(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+	// Index de partition
+	uint32 index = 0;
+
+	// Une animation change d'étape au plus une fois par tick, une boîte d'envoi contient donc un événement par AnimSpriteCel de sa partition
+	animSpriteCelSystem->outboxes[0].events = (AnimSpriteCelSystemEvent *)AllocMem(animSpriteCelSystem->partitionsCount * animSpriteCelSystem->partitionSize * sizeof(AnimSpriteCelSystemEvent), MEMTYPE_DRAM);
+	// Si c'est un échec
+	if (animSpriteCelSystem->outboxes[0].events == NULL) {
+		// Retourne une erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCelSystem outbox events.\n");
+		return -1;
+	}
+
+	// Côte à côte dans le même bloc
+	for (index = 0; index < animSpriteCelSystem->partitionsCount; index++) {
+		animSpriteCelSystem->outboxes[index].events = animSpriteCelSystem->outboxes[0].events + index * animSpriteCelSystem->partitionSize;
+		animSpriteCelSystem->outboxes[index].eventsCount = 0;
+	}
+
+	// Retourne un succès
+	return 1;
+}
+
+// Ajoute un événement au tampon du système
+static void AnimSpriteCelSystemEventAppend(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel, uint32 eventId, uint32 tick) {
+
+	// Événement ajouté
+	AnimSpriteCelSystemEvent *event = NULL;
+
+	// Si le tampon est plein
+	if (animSpriteCelSystem->eventsCount == animSpriteCelSystem->eventsMax) {
+		// Avertit une seule fois
+		if (animSpriteCelSystem->eventsLost == 0) {
+			printf("Warning : AnimSpriteCelSystem event buffer full (%u events).\n", animSpriteCelSystem->eventsMax);
+		}
+		animSpriteCelSystem->eventsLost++;
+		return;
+	}
+
+	// Après le dernier événement
+	event = &animSpriteCelSystem->events[animSpriteCelSystem->eventsCount];
+	event->animSpriteCel = animSpriteCel;
+	event->eventId = eventId;
+	event->tick = tick;
+	animSpriteCelSystem->eventsCount++;
+}
+
+// Découpe les animations enregistrées en partitions exécutées séparément
+int32 AnimSpriteCelSystemPartitionConfiguration(AnimSpriteCelSystem *animSpriteCelSystem, uint32 partitionSize) {
+
+	// Nombre de partitions
+	uint32 partitionsCount = 0;
+	// Index de partition
+	uint32 index = 0;
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return -1;
+	}
+
+	// Si un tick partitionné est en cours
+	if (animSpriteCelSystem->partitioned == 1) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem partitioned tick running.\n");
+		return -1;
+	}
+
+	// Si les partitions sont vides
+	if (partitionSize == 0) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem partitions need at least one AnimSpriteCel.\n");
+		return -1;
+	}
+
+	// Libère les boîtes d'envoi précédentes si présentes
+	if (animSpriteCelSystem->outboxes != NULL) {
+		AnimSpriteCelSystemOutboxEventsFree(animSpriteCelSystem);
+		FreeMem(animSpriteCelSystem->outboxes[0].receivers, animSpriteCelSystem->partitionsCount * animSpriteCelSystem->partitionSize * sizeof(AnimSpriteCel *));
+		FreeMem(animSpriteCelSystem->outboxes, animSpriteCelSystem->partitionsCount * sizeof(AnimSpriteCelSystemOutbox));
+		animSpriteCelSystem->outboxes = NULL;
+		animSpriteCelSystem->partitionsCount = 0;
+		animSpriteCelSystem->partitionSize = 0;
+	}
+
+	// Assez de partitions pour la capacité du tableau
+	partitionsCount = (animSpriteCelSystem->animSpriteCelsMax + partitionSize - 1) / partitionSize;
+
+	// Alloue la mémoire des boîtes d'envoi
+	animSpriteCelSystem->outboxes = (AnimSpriteCelSystemOutbox *)AllocMem(partitionsCount * sizeof(AnimSpriteCelSystemOutbox), MEMTYPE_DRAM);
+	// Si c'est un échec
+	if (animSpriteCelSystem->outboxes == NULL) {
+		// Retourne une erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCelSystem outboxes.\n");
+		return -1;
+	}
+
+	// Une animation change d'étape au plus une fois par tick, une boîte d'envoi contient donc un déclenchement par AnimSpriteCel de sa partition
+	animSpriteCelSystem->outboxes[0].receivers = (AnimSpriteCel **)AllocMem(partitionsCount * partitionSize * sizeof(AnimSpriteCel *), MEMTYPE_DRAM);
+	// Si c'est un échec
+	if (animSpriteCelSystem->outboxes[0].receivers == NULL) {
+		// Libère les boîtes d'envoi allouées précédemment
+		FreeMem(animSpriteCelSystem->outboxes, partitionsCount * sizeof(AnimSpriteCelSystemOutbox));
+		animSpriteCelSystem->outboxes = NULL;
+		// Retourne une erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCelSystem outbox receivers.\n");
+		return -1;
+	}
+
+	// Boîtes d'envoi vides, côte à côte dans le même bloc
+	for (index = 0; index < partitionsCount; index++) {
+		animSpriteCelSystem->outboxes[index].receivers = animSpriteCelSystem->outboxes[0].receivers + index * partitionSize;
+		animSpriteCelSystem->outboxes[index].receiversCount = 0;
+		animSpriteCelSystem->outboxes[index].events = NULL;
+		animSpriteCelSystem->outboxes[index].eventsCount = 0;
+		animSpriteCelSystem->outboxes[index].stateHash = 0;
+	}
+	animSpriteCelSystem->partitionsCount = partitionsCount;
+	animSpriteCelSystem->partitionSize = partitionSize;
+
+	// Si les événements sont collectés, les boîtes d'envoi gardent ceux de leur partition
+	if ((animSpriteCelSystem->events != NULL) && (AnimSpriteCelSystemOutboxEventsAllocation(animSpriteCelSystem) < 0)) {
+		// Libérer les boîtes d'envoi
+		FreeMem(animSpriteCelSystem->outboxes[0].receivers, partitionsCount * partitionSize * sizeof(AnimSpriteCel *));
+		FreeMem(animSpriteCelSystem->outboxes, partitionsCount * sizeof(AnimSpriteCelSystemOutbox));
+		animSpriteCelSystem->outboxes = NULL;
+		animSpriteCelSystem->partitionsCount = 0;
+		animSpriteCelSystem->partitionSize = 0;
+		// Retourne une erreur
+		return -1;
+	}
+
+	// Retourne un succès
+	return 1;
+}
+
+// Met un déclenchement dans la boîte d'envoi de la partition de l'émetteur
+void AnimSpriteCelSystemOutboxPush(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCelSender, AnimSpriteCel *animSpriteCel) {
+
+	// Boîte d'envoi de la partition qui exécute l'émetteur
+	AnimSpriteCelSystemOutbox *outbox = &animSpriteCelSystem->outboxes[animSpriteCelSender->systemIndex / animSpriteCelSystem->partitionSize];
+
+	// Ajoute dans l'ordre d'envoi (l'étape de l'émetteur change une fois dans le tick, il y a toujours de la place)
+	outbox->receivers[outbox->receiversCount] = animSpriteCel;
+	outbox->receiversCount++;
+}
+
+// Commence un tick partitionné
+int32 AnimSpriteCelSystemPartitionBegin(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+	// Index de partition
+	uint32 index = 0;
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return -1;
+	}
+
+	// Si les partitions ne sont pas configurées
+	if (animSpriteCelSystem->outboxes == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem partitions not configured.\n");
+		return -1;
+	}
+
+	// Si un tick partitionné est déjà en cours
+	if (animSpriteCelSystem->partitioned == 1) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem partitioned tick running.\n");
+		return -1;
+	}
+
+	// Les partitions ne s'exécutent séparément que si chaque animation est visitée et que les déclenchements sont mis en file
+	if ((animSpriteCelSystem->schedule != POLLING) || (animSpriteCelSystem->delivery == IMMEDIATE)) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem partitions need POLLING schedule and queued triggers.\n");
+		return -1;
+	}
+
+	// Un tick est un cycle d'affichage, pas les microsecondes écoulées
+	if (animSpriteCelSystem->microsecondsCount > 0) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem runs AnimSpriteCels in MICROSECONDS, use AnimSpriteCelSystemTimeRun().\n");
+		return -1;
+	}
+
+	// Deux partitions ne doivent pas partager un mot du champ de bits des changements
+	if ((animSpriteCelSystem->dirty != NULL) && ((animSpriteCelSystem->partitionSize & 31) != 0)) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem partitions tracking changes need a multiple of 32 AnimSpriteCels.\n");
+		return -1;
+	}
+
+	// Les changements des partitions ne peuvent pas être enregistrés dans l'ordre d'AnimSpriteCelSystemRun()
+	if (animSpriteCelSystem->hashEntries != NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem partitions can't record the state hash.\n");
+		return -1;
+	}
+
+	// Les déclenchements du tick précédent passent en premier
+	if (animSpriteCelSystem->delivery == NEXT_TICK) {
+		AnimSpriteCelSystemTriggerDispatch(animSpriteCelSystem, animSpriteCelSystem->triggersCount);
+	}
+
+	// Cycle d'affichage suivant
+	animSpriteCelSystem->tick++;
+
+	// Boîtes d'envoi vides, remplies par les partitions
+	for (index = 0; index < animSpriteCelSystem->partitionsCount; index++) {
+		animSpriteCelSystem->outboxes[index].receiversCount = 0;
+		animSpriteCelSystem->outboxes[index].eventsCount = 0;
+		animSpriteCelSystem->outboxes[index].stateHash = 0;
+	}
+	animSpriteCelSystem->partitioned = 1;
+
+	// Retourne le nombre de partitions contenant des AnimSpriteCels enregistrés
+	return (int32)((animSpriteCelSystem->animSpriteCelsCount + animSpriteCelSystem->partitionSize - 1) / animSpriteCelSystem->partitionSize);
+}
+
+// Exécute les animations d'une partition
+void AnimSpriteCelSystemPartitionRun(AnimSpriteCelSystem *animSpriteCelSystem, uint32 partitionIndex) {
+
+	// Plage de la partition
+	uint32 first = 0;
+	uint32 last = 0;
+
+	// Si aucun tick partitionné n'est en cours
+	if ((animSpriteCelSystem == NULL) || (animSpriteCelSystem->partitioned == 0)) {
+		// Affiche une erreur
+		printf("Error : AnimSpriteCelSystem partitioned tick not started.\n");
+		return;
+	}
+
+	// Plage de la partition, la dernière s'arrête aux AnimSpriteCels enregistrés
+	first = partitionIndex * animSpriteCelSystem->partitionSize;
+	if (first >= animSpriteCelSystem->animSpriteCelsCount) {
+		return;
+	}
+	last = first + animSpriteCelSystem->partitionSize;
+	if (last > animSpriteCelSystem->animSpriteCelsCount) {
+		last = animSpriteCelSystem->animSpriteCelsCount;
+	}
+
+	// Même visite qu'AnimSpriteCelSystemRun(), ses déclenchements vont dans la boîte d'envoi de la partition
+	AnimSpriteCelSystemRunRange(animSpriteCelSystem, first, last);
+}
+
+// Termine un tick partitionné
+int32 AnimSpriteCelSystemPartitionEnd(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+	// Boîte d'envoi en cours de fusion
+	AnimSpriteCelSystemOutbox *outbox = NULL;
+	// Index de partition, de déclenchement et d'événement
+	uint32 index = 0;
+	uint32 receiverIndex = 0;
+	uint32 eventIndex = 0;
+
+	// Si aucun tick partitionné n'est en cours
+	if ((animSpriteCelSystem == NULL) || (animSpriteCelSystem->partitioned == 0)) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem partitioned tick not started.\n");
+		return -1;
+	}
+	animSpriteCelSystem->partitioned = 0;
+
+	// Les partitions suivent l'ordre d'enregistrement, leurs boîtes d'envoi l'une après l'autre donnent donc l'ordre d'envoi d'AnimSpriteCelSystemRun()
+	for (index = 0; index < animSpriteCelSystem->partitionsCount; index++) {
+		outbox = &animSpriteCelSystem->outboxes[index];
+		for (receiverIndex = 0; receiverIndex < outbox->receiversCount; receiverIndex++) {
+			AnimSpriteCelSystemTriggerPush(animSpriteCelSystem, outbox->receivers[receiverIndex]);
+		}
+		outbox->receiversCount = 0;
+		// Événements de la partition, après ceux des partitions précédentes
+		for (eventIndex = 0; eventIndex < outbox->eventsCount; eventIndex++) {
+			AnimSpriteCelSystemEventAppend(animSpriteCelSystem, outbox->events[eventIndex].animSpriteCel, outbox->events[eventIndex].eventId, outbox->events[eventIndex].tick);
+		}
+		outbox->eventsCount = 0;
+		// Changement de l'empreinte d'état fait par la partition
+		animSpriteCelSystem->stateHash += outbox->stateHash;
+		outbox->stateHash = 0;
+	}
+
+	// Les déclenchements de ce tick passent en dernier, avec ceux qu'ils envoient (limités par le budget et le contrôle des cycles)
+	if (animSpriteCelSystem->delivery == SAME_TICK) {
+		AnimSpriteCelSystemTriggerDispatch(animSpriteCelSystem, 0xFFFFFFFF);
+	}
+
+	// Retourne un succès
+	return 1;
+}
+
+// Garde les CCB des AnimSpriteCels visibles dans une liste d'affichage
+int32 AnimSpriteCelSystemDrawConfiguration(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCelDrawOrder drawOrder, uint32 drawGroupsMax) {
+
+	// Index du tableau
+	uint32 index = 0;
+	// AnimSpriteCel en cours
+	AnimSpriteCel *animSpriteCel = NULL;
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return -1;
+	}
+
+	// Si les groupes n'ont pas de place
+	if ((drawOrder == SOURCE_ORDER) && (drawGroupsMax == 0)) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem SOURCE_ORDER needs at least one draw group.\n");
+		return -1;
+	}
+
+	// Délier la liste précédente si présente
+	while (animSpriteCelSystem->drawFirst != NULL) {
+		AnimSpriteCelSystemDrawUnlink(animSpriteCelSystem, animSpriteCelSystem->drawFirst);
+	}
+	if (animSpriteCelSystem->drawGroups != NULL) {
+		FreeMem(animSpriteCelSystem->drawGroups, animSpriteCelSystem->drawGroupsMax * sizeof(AnimSpriteCelSystemDrawGroup));
+		animSpriteCelSystem->drawGroups = NULL;
+	}
+	animSpriteCelSystem->drawListed = 0;
+	animSpriteCelSystem->drawGroupsCount = 0;
+	animSpriteCelSystem->drawGroupsMax = 0;
+	animSpriteCelSystem->drawUngroupedCount = 0;
+
+	// Si les CCB sont groupés
+	if (drawOrder == SOURCE_ORDER) {
+		// Allouer la mémoire des groupes
+		animSpriteCelSystem->drawGroups = (AnimSpriteCelSystemDrawGroup *)AllocMem(drawGroupsMax * sizeof(AnimSpriteCelSystemDrawGroup), MEMTYPE_DRAM);
+		// Si l'allocation des groupes échoue
+		if (animSpriteCelSystem->drawGroups == NULL) {
+			// Retourne une erreur
+			printf("Error : Failed to allocate memory for AnimSpriteCelSystem draw groups.\n");
+			return -1;
+		}
+		animSpriteCelSystem->drawGroupsMax = drawGroupsMax;
+	}
+
+	// Lier les AnimSpriteCels visibles dans l'ordre d'enregistrement
+	animSpriteCelSystem->drawListed = 1;
+	animSpriteCelSystem->drawOrder = drawOrder;
+	for (index = 0; index < animSpriteCelSystem->animSpriteCelsCount; index++) {
+		animSpriteCel = animSpriteCelSystem->animSpriteCels[index];
+		if (animSpriteCel->visible == 1) {
+			AnimSpriteCelSystemDrawShow(animSpriteCelSystem, animSpriteCel);
+		}
+	}
+
+	// Retourne un succès
+	return 1;
+}
+
+// Montre ou cache un AnimSpriteCel enregistré
+int32 AnimSpriteCelSystemVisibility(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel, uint32 visible) {
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return -1;
+	}
+
+	// Si l'AnimSpriteCel n'est pas défini ou appartient à un autre système
+	if ((animSpriteCel == NULL) || (animSpriteCel->system != animSpriteCelSystem)) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCel not registered in this AnimSpriteCelSystem.\n");
+		return -1;
+	}
+
+	// Toute valeur non nulle le montre
+	visible = (visible != 0) ? 1 : 0;
+
+	// Si la visibilité ne change pas, rien à relier
+	if (animSpriteCel->visible == visible) {
+		return 1;
+	}
+	animSpriteCel->visible = visible;
+
+	// Lier ou délier son CCB
+	if (animSpriteCelSystem->drawListed == 1) {
+		if (visible == 1) {
+			AnimSpriteCelSystemDrawShow(animSpriteCelSystem, animSpriteCel);
+		} else {
+			AnimSpriteCelSystemDrawHide(animSpriteCelSystem, animSpriteCel);
+		}
+	}
+
+	// Retourne un succès
+	return 1;
+}
+
+// Donne le premier CCB de la liste d'affichage
+CCB *AnimSpriteCelSystemDrawList(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return NULL;
+	}
+
+	// Si rien n'est listé
+	if (animSpriteCelSystem->drawFirst == NULL) {
+		return NULL;
+	}
+
+	// La liste continue par ccb_NextPtr jusqu'au CCB marqué CCB_LAST
+	return animSpriteCelSystem->drawFirst->cel;
+}
+
+// Commence ou arrête le suivi des CCB changés par les étapes
+int32 AnimSpriteCelSystemDirtyConfiguration(AnimSpriteCelSystem *animSpriteCelSystem, uint32 tracked) {
+
+	// Mots du champ de bits
+	uint32 wordsCount = 0;
+	// Index du tableau
+	uint32 index = 0;
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return -1;
+	}
+
+	// Si un tick partitionné est en cours
+	if (animSpriteCelSystem->partitioned == 1) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem partitioned tick running.\n");
+		return -1;
+	}
+
+	// Un bit par AnimSpriteCel que le tableau peut contenir
+	wordsCount = ANIMSPRITECELSYSTEM_DIRTY_WORDS(animSpriteCelSystem->animSpriteCelsMax);
+
+	// Si le suivi s'arrête
+	if (tracked == 0) {
+		// Libérer le champ de bits si présent
+		if (animSpriteCelSystem->dirty != NULL) {
+			FreeMem(animSpriteCelSystem->dirty, wordsCount * sizeof(uint32));
+			animSpriteCelSystem->dirty = NULL;
+		}
+		// Retourne un succès
+		return 1;
+	}
+
+	// Si les changements sont déjà suivis
+	if (animSpriteCelSystem->dirty != NULL) {
+		// Retourne un succès
+		return 1;
+	}
+
+	// Allouer la mémoire du champ de bits
+	animSpriteCelSystem->dirty = (uint32 *)AllocMem(wordsCount * sizeof(uint32), MEMTYPE_DRAM);
+	// Si l'allocation du champ de bits échoue
+	if (animSpriteCelSystem->dirty == NULL) {
+		// Retourne une erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCelSystem dirty bitset.\n");
+		return -1;
+	}
+	memset(animSpriteCelSystem->dirty, 0, wordsCount * sizeof(uint32));
+
+	// Le jeu ne connaît pas encore les CCB actuels : tous les AnimSpriteCels enregistrés sont marqués
+	for (index = 0; index < animSpriteCelSystem->animSpriteCelsCount; index++) {
+		animSpriteCelSystem->dirty[index >> 5] |= 1u << (index & 31);
+	}
+
+	// Retourne un succès
+	return 1;
+}
+
+// Marque le CCB d'un AnimSpriteCel enregistré comme changé
+void AnimSpriteCelSystemDirty(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel) {
+
+	// Bit de son index d'enregistrement
+	animSpriteCelSystem->dirty[animSpriteCel->systemIndex >> 5] |= 1u << (animSpriteCel->systemIndex & 31);
+}
+
+// Donne le prochain AnimSpriteCel dont le CCB a changé, depuis un curseur
+AnimSpriteCel *AnimSpriteCelSystemChanged(AnimSpriteCelSystem *animSpriteCelSystem, uint32 *cursor) {
+
+	// Index d'enregistrement
+	uint32 index = 0;
+	// Mot du champ de bits et ses bits restant à visiter
+	uint32 wordIndex = 0;
+	uint32 bits = 0;
+
+	// Si le système est inconnu
+	if ((animSpriteCelSystem == NULL) || (cursor == NULL)) {
+		// Affiche une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return NULL;
+	}
+
+	// Si les changements ne sont pas suivis ou si tous les AnimSpriteCels ont été visités
+	if ((animSpriteCelSystem->dirty == NULL) || (*cursor >= animSpriteCelSystem->animSpriteCelsCount)) {
+		return NULL;
+	}
+
+	// Bits du mot au curseur, à partir du curseur
+	wordIndex = *cursor >> 5;
+	bits = animSpriteCelSystem->dirty[wordIndex] & (0xFFFFFFFF << (*cursor & 31));
+
+	// Sauter les mots sans changement, 32 AnimSpriteCels à la fois
+	while (bits == 0) {
+		wordIndex++;
+		if ((wordIndex << 5) >= animSpriteCelSystem->animSpriteCelsCount) {
+			*cursor = animSpriteCelSystem->animSpriteCelsCount;
+			return NULL;
+		}
+		bits = animSpriteCelSystem->dirty[wordIndex];
+	}
+
+	// Plus petit bit mis dans le mot
+	index = wordIndex << 5;
+	while ((bits & 1) == 0) {
+		bits >>= 1;
+		index++;
+	}
+
+	// L'appel suivant commence après lui
+	*cursor = index + 1;
+
+	// Renvoyer l'AnimSpriteCel changé
+	return animSpriteCelSystem->animSpriteCels[index];
+}
+
+// Efface les changements, une fois traités
+int32 AnimSpriteCelSystemDirtyClear(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+	// Index du mot
+	uint32 index = 0;
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return -1;
+	}
+
+	// Si les changements ne sont pas suivis
+	if (animSpriteCelSystem->dirty == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem changes not tracked.\n");
+		return -1;
+	}
+
+	// Seuls les mots des AnimSpriteCels enregistrés peuvent contenir un bit
+	for (index = 0; index < ANIMSPRITECELSYSTEM_DIRTY_WORDS(animSpriteCelSystem->animSpriteCelsCount); index++) {
+		animSpriteCelSystem->dirty[index] = 0;
+	}
+
+	// Retourne un succès
+	return 1;
+}
+
+// Démarre ou arrête la collecte des événements des étapes
+int32 AnimSpriteCelSystemEventConfiguration(AnimSpriteCelSystem *animSpriteCelSystem, uint32 eventsMax) {
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return -1;
+	}
+
+	// Si un tick partitionné est en cours
+	if (animSpriteCelSystem->partitioned == 1) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem partitioned tick running.\n");
+		return -1;
+	}
+
+	// Libérer le tampon précédent et les événements des boîtes d'envoi si présents
+	if (animSpriteCelSystem->events != NULL) {
+		AnimSpriteCelSystemOutboxEventsFree(animSpriteCelSystem);
+		FreeMem(animSpriteCelSystem->events, animSpriteCelSystem->eventsMax * sizeof(AnimSpriteCelSystemEvent));
+		animSpriteCelSystem->events = NULL;
+	}
+	animSpriteCelSystem->eventsMax = 0;
+	animSpriteCelSystem->eventsCount = 0;
+	animSpriteCelSystem->eventsLost = 0;
+
+	// Si les événements ne sont plus collectés
+	if (eventsMax == 0) {
+		// Retourne un succès
+		return 1;
+	}
+
+	// Allouer la mémoire du tampon
+	animSpriteCelSystem->events = (AnimSpriteCelSystemEvent *)AllocMem(eventsMax * sizeof(AnimSpriteCelSystemEvent), MEMTYPE_DRAM);
+	// Si l'allocation du tampon échoue
+	if (animSpriteCelSystem->events == NULL) {
+		// Retourne une erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCelSystem events.\n");
+		return -1;
+	}
+	animSpriteCelSystem->eventsMax = eventsMax;
+
+	// Si le système est partitionné, les boîtes d'envoi gardent les événements de leur partition
+	if ((animSpriteCelSystem->outboxes != NULL) && (AnimSpriteCelSystemOutboxEventsAllocation(animSpriteCelSystem) < 0)) {
+		// Libérer le tampon
+		FreeMem(animSpriteCelSystem->events, eventsMax * sizeof(AnimSpriteCelSystemEvent));
+		animSpriteCelSystem->events = NULL;
+		animSpriteCelSystem->eventsMax = 0;
+		// Retourne une erreur
+		return -1;
+	}
+
+	// Retourne un succès
+	return 1;
+}
+
+// Ajoute l'événement de l'étape qu'un AnimSpriteCel enregistré a commencée
+void AnimSpriteCelSystemEventPush(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel, uint32 eventId) {
+
+	// Boîte d'envoi de la partition qui exécute l'AnimSpriteCel
+	AnimSpriteCelSystemOutbox *outbox = NULL;
+	// Événement gardé par la boîte d'envoi
+	AnimSpriteCelSystemEvent *event = NULL;
+
+	// Si aucun tick partitionné n'est en cours, l'événement va directement dans le tampon
+	if (animSpriteCelSystem->partitioned == 0) {
+		AnimSpriteCelSystemEventAppend(animSpriteCelSystem, animSpriteCel, eventId, animSpriteCelSystem->tick);
+		return;
+	}
+
+	// Gardé par la partition jusqu'à la fin du tick (son étape change une fois dans le tick, il y a toujours de la place)
+	outbox = &animSpriteCelSystem->outboxes[animSpriteCel->systemIndex / animSpriteCelSystem->partitionSize];
+	event = &outbox->events[outbox->eventsCount];
+	event->animSpriteCel = animSpriteCel;
+	event->eventId = eventId;
+	event->tick = animSpriteCelSystem->tick;
+	outbox->eventsCount++;
+}
+
+// Donne les événements collectés et leur nombre
+AnimSpriteCelSystemEvent *AnimSpriteCelSystemEvents(AnimSpriteCelSystem *animSpriteCelSystem, uint32 *eventsCount) {
+
+	// Si le système ou le nombre est indéfini
+	if ((animSpriteCelSystem == NULL) || (eventsCount == NULL)) {
+		// Affiche une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return NULL;
+	}
+
+	// Dans l'ordre des changements d'étape (NULL et 0 si les événements ne sont pas collectés)
+	*eventsCount = animSpriteCelSystem->eventsCount;
+	return animSpriteCelSystem->events;
+}
+
+// Vide le tampon d'événements, une fois lu
+int32 AnimSpriteCelSystemEventsClear(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return -1;
+	}
+
+	// Si les événements ne sont pas collectés
+	if (animSpriteCelSystem->events == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem events not collected.\n");
+		return -1;
+	}
+
+	// Les événements suivants repartent du début du tampon
+	animSpriteCelSystem->eventsCount = 0;
+
+	// Retourne un succès
+	return 1;
+}
+
+// Donne le prochain tick auquel une étape se termine
+int32 AnimSpriteCelSystemNextTick(AnimSpriteCelSystem *animSpriteCelSystem, uint32 *tick) {
+
+	// AnimSpriteCels à examiner et leur nombre
+	AnimSpriteCel **animSpriteCels = NULL;
+	uint32 animSpriteCelsCount = 0;
+	// AnimSpriteCel en cours
+	AnimSpriteCel *animSpriteCel = NULL;
+	// Index du tableau
+	uint32 index = 0;
+	// Niveau de la roue
+	uint32 level = 0;
+	// Décalage de case depuis la case courante
+	uint32 offset = 0;
+	// Décalage en bits du niveau
+	uint32 shift = 0;
+	// Masque des cases
+	uint32 mask = ANIMSPRITECELSYSTEM_WHEEL_SLOTS - 1;
+	// Plus court délai trouvé
+	uint32 delay = 0;
+	// Témoin de découverte
+	uint32 found = 0;
+	// Délai d'un AnimSpriteCel et cycles qu'il doit atteindre
+	uint32 animSpriteCelDelay = 0;
+	uint32 cycles = 0;
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return -1;
+	}
+
+	// Un tick est un cycle d'affichage, pas les microsecondes écoulées
+	if (animSpriteCelSystem->microsecondsCount > 0) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem runs AnimSpriteCels in MICROSECONDS, use AnimSpriteCelSystemTimeRun().\n");
+		return -1;
+	}
+
+	// Si des déclenchements sont en attente, le prochain tick les distribue
+	if (animSpriteCelSystem->triggersCount > 0) {
+		*tick = animSpriteCelSystem->tick;
+		return 1;
+	}
+
+	// Si les animations sont visitées depuis un tableau : toutes, ou l'ensemble actif
+	if (animSpriteCelSystem->schedule != WHEEL) {
+		AnimSpriteCelSystemArray(animSpriteCelSystem, &animSpriteCels, &animSpriteCelsCount);
+		// Plus petit nombre de cycles restants des animations en cours
+		for (index = 0; index < animSpriteCelsCount; index++) {
+			animSpriteCel = animSpriteCels[index];
+			if ((ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) == 0) || (animSpriteCel->iterationsCount == 0) || (animSpriteCel->speed == 0)) {
+				continue;
+			}
+			// À vitesse normale, un cycle par tick
+			animSpriteCelDelay = animSpriteCel->remainingCycles;
+			// Sinon, l'étape change au tick où son accumulateur dépasse les cycles restants (plafonnés pour rester sur 32 bits, ce qui donne un tick plus tôt)
+			if (animSpriteCel->speed != ANIMSPRITECEL_SPEED_NORMAL) {
+				cycles = ((animSpriteCel->remainingCycles < 0x7FFF) ? animSpriteCel->remainingCycles : 0x7FFE) + 1;
+				animSpriteCelDelay = (((cycles << 16) - animSpriteCel->speedAccumulator + animSpriteCel->speed - 1) / animSpriteCel->speed) - 1;
+			}
+			if ((found == 0) || (animSpriteCelDelay < delay)) {
+				delay = animSpriteCelDelay;
+				found = 1;
+			}
+		}
+
+	} else {
+
+		// Premier niveau : une case par tick
+		for (offset = 0; offset < ANIMSPRITECELSYSTEM_WHEEL_SLOTS; offset++) {
+			if (animSpriteCelSystem->wheel[0][(animSpriteCelSystem->tick + offset) & mask] != NULL) {
+				delay = offset;
+				found = 1;
+				break;
+			}
+		}
+
+		// Sauf si elle précède la prochaine case du second niveau, les niveaux supérieurs peuvent contenir une étape plus proche
+		if ((found == 0) || ((animSpriteCelSystem->tick & mask) + offset >= ANIMSPRITECELSYSTEM_WHEEL_SLOTS)) {
+
+			// Niveaux supérieurs : la première case utilisée après la case courante contient les étapes les plus proches du niveau
+			for (level = 1; level < ANIMSPRITECELSYSTEM_WHEEL_LEVELS; level++) {
+				shift = level * ANIMSPRITECELSYSTEM_WHEEL_BITS;
+				for (offset = 1; offset <= ANIMSPRITECELSYSTEM_WHEEL_SLOTS; offset++) {
+					animSpriteCel = animSpriteCelSystem->wheel[level][((animSpriteCelSystem->tick >> shift) + offset) & mask];
+					if (animSpriteCel != NULL) {
+						break;
+					}
+				}
+				for (; animSpriteCel != NULL; animSpriteCel = animSpriteCel->wheelNext) {
+					if ((found == 0) || (animSpriteCel->expiryTick - animSpriteCelSystem->tick < delay)) {
+						delay = animSpriteCel->expiryTick - animSpriteCelSystem->tick;
+						found = 1;
+					}
+				}
+			}
+
+			// Liste de débordement
+			for (animSpriteCel = animSpriteCelSystem->wheelOverflow; animSpriteCel != NULL; animSpriteCel = animSpriteCel->wheelNext) {
+				if ((found == 0) || (animSpriteCel->expiryTick - animSpriteCelSystem->tick < delay)) {
+					delay = animSpriteCel->expiryTick - animSpriteCelSystem->tick;
+					found = 1;
+				}
+			}
+		}
+	}
+
+	// Si aucune étape n'est en cours
+	if (found == 0) {
+		return 0;
+	}
+
+	// Tick du prochain changement d'étape
+	*tick = animSpriteCelSystem->tick + delay;
+
+	// Retourne un succès
+	return 1;
+}
+
+// Saute à un tick ultérieur sans exécuter les ticks vides
+int32 AnimSpriteCelSystemSkip(AnimSpriteCelSystem *animSpriteCelSystem, uint32 tick) {
+
+	// AnimSpriteCels à examiner et leur nombre
+	AnimSpriteCel **animSpriteCels = NULL;
+	uint32 animSpriteCelsCount = 0;
+	// AnimSpriteCel en cours
+	AnimSpriteCel *animSpriteCel = NULL;
+	// Index du tableau
+	uint32 index = 0;
+	// Tick du prochain changement d'étape
+	uint32 nextTick = 0;
+	// Ticks sautés
+	uint32 delay = 0;
+	// Dernier tick exécuté
+	uint32 previousTick = 0;
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return -1;
+	}
+
+	// Un tick est un cycle d'affichage, pas les microsecondes écoulées
+	if (animSpriteCelSystem->microsecondsCount > 0) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem runs AnimSpriteCels in MICROSECONDS, use AnimSpriteCelSystemTimeRun().\n");
+		return -1;
+	}
+
+	// Ticks sautés
+	delay = tick - animSpriteCelSystem->tick;
+
+	// Ne saute jamais un changement d'étape
+	if (AnimSpriteCelSystemNextTick(animSpriteCelSystem, &nextTick) == 1) {
+		if (nextTick - animSpriteCelSystem->tick < delay) {
+			delay = nextTick - animSpriteCelSystem->tick;
+		}
+	}
+
+	// Si il n'y a rien à sauter
+	if (delay == 0) {
+		return 1;
+	}
+
+	// Si les animations sont visitées depuis un tableau : toutes, ou l'ensemble actif
+	if (animSpriteCelSystem->schedule != WHEEL) {
+		AnimSpriteCelSystemArray(animSpriteCelSystem, &animSpriteCels, &animSpriteCelsCount);
+		// Consomme les ticks sautés sur les animations en cours
+		for (index = 0; index < animSpriteCelsCount; index++) {
+			animSpriteCel = animSpriteCels[index];
+			if ((ANIMSPRITECEL_STEP_DURATION(animSpriteCel, animSpriteCel->stepIndex) == 0) || (animSpriteCel->iterationsCount == 0)) {
+				continue;
+			}
+			// À une autre vitesse, les ticks sautés passent par l'accumulateur (avant le prochain changement d'étape, donc sur 32 bits)
+			if (animSpriteCel->speed != ANIMSPRITECEL_SPEED_NORMAL) {
+				animSpriteCel->speedAccumulator += delay * animSpriteCel->speed;
+				animSpriteCel->remainingCycles -= animSpriteCel->speedAccumulator >> 16;
+				animSpriteCel->speedAccumulator &= 0xFFFF;
+				continue;
+			}
+			animSpriteCel->remainingCycles -= delay;
+		}
+		animSpriteCelSystem->tick += delay;
+
+	} else {
+		// Avance la roue et redescend les cases du tick atteint
+		previousTick = animSpriteCelSystem->tick - 1;
+		animSpriteCelSystem->tick += delay;
+		AnimSpriteCelSystemWheelCascade(animSpriteCelSystem, previousTick);
+	}
+
+	// Retourne un succès
+	return 1;
+}
+
+// Donne la taille du tampon d'une sauvegarde
+uint32 AnimSpriteCelSystemSnapshotSize(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return 0;
+	}
+
+	// En-tête, têtes de lecture et place pour une file de déclenchements pleine
+	return sizeof(AnimSpriteCelSystemSnapshotHeader) + (animSpriteCelSystem->animSpriteCelsCount * sizeof(AnimSpriteCelSystemPlayhead)) + (animSpriteCelSystem->triggersMax * sizeof(AnimSpriteCelSystemSnapshotTrigger));
+}
+
+// Copie les têtes de lecture des AnimSpriteCels enregistrés dans un tampon
+int32 AnimSpriteCelSystemSnapshot(AnimSpriteCelSystem *animSpriteCelSystem, void *buffer, uint32 bufferSize) {
+
+	// Parties du tampon
+	AnimSpriteCelSystemSnapshotHeader *header = NULL;
+	AnimSpriteCelSystemPlayhead *playheads = NULL;
+	AnimSpriteCelSystemSnapshotTrigger *triggers = NULL;
+	// AnimSpriteCel en cours
+	AnimSpriteCel *animSpriteCel = NULL;
+	// Octets écrits
+	uint32 size = 0;
+	// Index du tableau
+	uint32 index = 0;
+	// Index dans la file
+	uint32 queueIndex = 0;
+	// Déclenchement en attente
+	AnimSpriteCelSystemTrigger *trigger = NULL;
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return -1;
+	}
+
+	// Si le tampon est inconnu
+	if (buffer == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem snapshot buffer unknow.\n");
+		return -1;
+	}
+
+	// Si un tick partitionné est en cours
+	if (animSpriteCelSystem->partitioned == 1) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem partitioned tick running.\n");
+		return -1;
+	}
+
+	// En-tête, têtes de lecture et déclenchements réellement en attente
+	size = sizeof(AnimSpriteCelSystemSnapshotHeader) + (animSpriteCelSystem->animSpriteCelsCount * sizeof(AnimSpriteCelSystemPlayhead)) + (animSpriteCelSystem->triggersCount * sizeof(AnimSpriteCelSystemSnapshotTrigger));
+
+	// Si le tampon est trop petit
+	if (bufferSize < size) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem snapshot needs %u bytes (%u given).\n", size, bufferSize);
+		return -1;
+	}
+
+	header = (AnimSpriteCelSystemSnapshotHeader *)buffer;
+	playheads = (AnimSpriteCelSystemPlayhead *)(header + 1);
+	triggers = (AnimSpriteCelSystemSnapshotTrigger *)(playheads + animSpriteCelSystem->animSpriteCelsCount);
+
+	// Déclenchements en attente depuis le plus ancien, les receveurs désignés par leur index d'enregistrement
+	queueIndex = animSpriteCelSystem->triggersFirst;
+	for (index = 0; index < animSpriteCelSystem->triggersCount; index++) {
+
+		trigger = &animSpriteCelSystem->triggers[queueIndex];
+		queueIndex++;
+		if (queueIndex == animSpriteCelSystem->triggersMax) {
+			queueIndex = 0;
+		}
+
+		// Si le receveur a été retiré entre-temps
+		if (trigger->animSpriteCel == NULL) {
+			triggers[index].receiverIndex = ANIMSPRITECELSYSTEM_SNAPSHOT_NONE;
+		// Si le receveur ne peut pas être désigné par un index
+		} else if (trigger->animSpriteCel->system != animSpriteCelSystem) {
+			// Retourne une erreur
+			printf("Error : AnimSpriteCelSystem pending trigger to an AnimSpriteCel outside the system.\n");
+			return -1;
+		} else {
+			triggers[index].receiverIndex = trigger->animSpriteCel->systemIndex;
+		}
+		triggers[index].depth = trigger->depth;
+	}
+
+	// État du système
+	header->magic = ANIMSPRITECELSYSTEM_SNAPSHOT_MAGIC;
+	header->animSpriteCelsCount = animSpriteCelSystem->animSpriteCelsCount;
+	header->triggersCount = animSpriteCelSystem->triggersCount;
+	header->tick = animSpriteCelSystem->tick;
+	header->timeAccumulator = animSpriteCelSystem->timeAccumulator;
+
+	// Pour chaque AnimSpriteCel enregistré
+	for (index = 0; index < animSpriteCelSystem->animSpriteCelsCount; index++) {
+
+		animSpriteCel = animSpriteCelSystem->animSpriteCels[index];
+
+		playheads[index].stepIndex = (uint32)animSpriteCel->stepIndex;
+		playheads[index].remainingCycles = animSpriteCel->remainingCycles;
+		playheads[index].iterationsCount = animSpriteCel->iterationsCount;
+		playheads[index].randomState = animSpriteCel->randomState;
+		playheads[index].stateHash = animSpriteCel->stateHash;
+		playheads[index].speedAccumulator = (uint16)animSpriteCel->speedAccumulator;
+		playheads[index].flags = (animSpriteCel->direction == -1) ? ANIMSPRITECELSYSTEM_PLAYHEAD_BACKWARD : 0;
+
+		// Les champs d'ordonnancement ne sont lus que par leur ordonnancement
+		if (animSpriteCelSystem->schedule == WHEEL) {
+			// La fin d'une étape tenue par la roue est comptée depuis le tick suivant
+			if (animSpriteCel->wheelSlot != NULL) {
+				playheads[index].remainingCycles = animSpriteCel->expiryTick - animSpriteCelSystem->tick;
+			}
+		} else if ((animSpriteCelSystem->schedule == ACTIVE) && (animSpriteCel->systemActive == 1)) {
+			playheads[index].flags |= ANIMSPRITECELSYSTEM_PLAYHEAD_ACTIVE;
+		}
+	}
+
+	// Retourne les octets écrits
+	return (int32)size;
+}
+
+// Réécrit les têtes de lecture d'une sauvegarde
+int32 AnimSpriteCelSystemRestore(AnimSpriteCelSystem *animSpriteCelSystem, const void *buffer, uint32 bufferSize) {
+
+	// Parties du tampon
+	const AnimSpriteCelSystemSnapshotHeader *header = NULL;
+	const AnimSpriteCelSystemPlayhead *playheads = NULL;
+	const AnimSpriteCelSystemSnapshotTrigger *triggers = NULL;
+	// AnimSpriteCel en cours
+	AnimSpriteCel *animSpriteCel = NULL;
+	// Octets à lire
+	uint32 size = 0;
+	// Index du tableau et de la file
+	uint32 index = 0;
+	// Empreinte d'état gardée
+	uint32 hashed = 0;
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return -1;
+	}
+
+	// Si le tampon est inconnu
+	if (buffer == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem snapshot buffer unknow.\n");
+		return -1;
+	}
+
+	// Si un tick partitionné est en cours
+	if (animSpriteCelSystem->partitioned == 1) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem partitioned tick running.\n");
+		return -1;
+	}
+
+	// Si le tampon ne peut pas contenir d'en-tête ou ne commence pas par un en-tête
+	header = (const AnimSpriteCelSystemSnapshotHeader *)buffer;
+	if ((bufferSize < sizeof(AnimSpriteCelSystemSnapshotHeader)) || (header->magic != ANIMSPRITECELSYSTEM_SNAPSHOT_MAGIC)) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem snapshot invalid.\n");
+		return -1;
+	}
+
+	// Si les enregistrements ont changé
+	if (header->animSpriteCelsCount != animSpriteCelSystem->animSpriteCelsCount) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem snapshot of %u AnimSpriteCels (%u registered).\n", header->animSpriteCelsCount, animSpriteCelSystem->animSpriteCelsCount);
+		return -1;
+	}
+
+	// Si les déclenchements en attente ne tiennent pas dans la file
+	if (header->triggersCount > animSpriteCelSystem->triggersMax) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem snapshot holds %u triggers (queue of %u).\n", header->triggersCount, animSpriteCelSystem->triggersMax);
+		return -1;
+	}
+
+	// Si le tampon est plus court que la sauvegarde
+	size = sizeof(AnimSpriteCelSystemSnapshotHeader) + (header->animSpriteCelsCount * sizeof(AnimSpriteCelSystemPlayhead)) + (header->triggersCount * sizeof(AnimSpriteCelSystemSnapshotTrigger));
+	if (bufferSize < size) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem snapshot invalid.\n");
+		return -1;
+	}
+
+	playheads = (const AnimSpriteCelSystemPlayhead *)(header + 1);
+	triggers = (const AnimSpriteCelSystemSnapshotTrigger *)(playheads + header->animSpriteCelsCount);
+
+	// Vérifie chaque index avant de modifier quoi que ce soit, une mauvaise sauvegarde laisse ainsi le système tel quel
+	for (index = 0; index < header->animSpriteCelsCount; index++) {
+		if (playheads[index].stepIndex >= animSpriteCelSystem->animSpriteCels[index]->stepsCount) {
+			// Retourne une erreur
+			printf("Error : AnimSpriteCelSystem snapshot invalid.\n");
+			return -1;
+		}
+	}
+	for (index = 0; index < header->triggersCount; index++) {
+		if ((triggers[index].receiverIndex != ANIMSPRITECELSYSTEM_SNAPSHOT_NONE) && (triggers[index].receiverIndex >= header->animSpriteCelsCount)) {
+			// Retourne une erreur
+			printf("Error : AnimSpriteCelSystem snapshot invalid.\n");
+			return -1;
+		}
+	}
+
+	// État du système (les étapes sont ordonnancées depuis ce tick)
+	animSpriteCelSystem->tick = header->tick;
+	animSpriteCelSystem->timeAccumulator = header->timeAccumulator;
+
+	// L'ensemble actif est reconstruit dans l'ordre d'enregistrement
+	animSpriteCelSystem->activeCount = 0;
+	animSpriteCelSystem->wokenCount = 0;
+
+	// Les termes reviennent avec les têtes de lecture, la roue les rechaîne sans les reprendre
+	hashed = animSpriteCelSystem->hashed;
+	animSpriteCelSystem->hashed = 0;
+	animSpriteCelSystem->stateHash = 0;
+
+	// Pour chaque AnimSpriteCel enregistré
+	for (index = 0; index < header->animSpriteCelsCount; index++) {
+
+		animSpriteCel = animSpriteCelSystem->animSpriteCels[index];
+
+		animSpriteCel->stepIndex = (int32)playheads[index].stepIndex;
+		animSpriteCel->direction = ((playheads[index].flags & ANIMSPRITECELSYSTEM_PLAYHEAD_BACKWARD) != 0) ? -1 : 1;
+		animSpriteCel->remainingCycles = playheads[index].remainingCycles;
+		animSpriteCel->iterationsCount = playheads[index].iterationsCount;
+		animSpriteCel->randomState = playheads[index].randomState;
+		animSpriteCel->speedAccumulator = playheads[index].speedAccumulator;
+		animSpriteCel->stateHash = playheads[index].stateHash;
+		animSpriteCelSystem->stateHash += animSpriteCel->stateHash;
+
+		// Image de l'étape, un CCB changé est noté par le système qui les suit
+		if ((animSpriteCel->stepDisplay(animSpriteCel) == 1) && (animSpriteCelSystem->dirty != NULL)) {
+			AnimSpriteCelSystemDirty(animSpriteCelSystem, animSpriteCel);
+		}
+
+		// Si seules les animations capables d'avancer sont visitées
+		if (animSpriteCelSystem->schedule == ACTIVE) {
+			// De retour dans l'ensemble actif s'il y était ou a été réveillé
+			animSpriteCel->systemActive = ((playheads[index].flags & ANIMSPRITECELSYSTEM_PLAYHEAD_ACTIVE) != 0) ? 1 : 0;
+			if (animSpriteCel->systemActive == 1) {
+				animSpriteCelSystem->active[animSpriteCelSystem->activeCount] = animSpriteCel;
+				animSpriteCelSystem->activeCount++;
+			}
+		} else if (animSpriteCelSystem->schedule == WHEEL) {
+			// Relie la fin de l'étape depuis le tick restauré
+			AnimSpriteCelSystemSchedule(animSpriteCelSystem, animSpriteCel);
+		}
+	}
+	animSpriteCelSystem->hashed = hashed;
+
+	// Déclenchements en attente, dans le même ordre
+	animSpriteCelSystem->triggersFirst = 0;
+	animSpriteCelSystem->triggersCount = header->triggersCount;
+	for (index = 0; index < header->triggersCount; index++) {
+		animSpriteCelSystem->triggers[index].animSpriteCel = (triggers[index].receiverIndex == ANIMSPRITECELSYSTEM_SNAPSHOT_NONE) ? NULL : animSpriteCelSystem->animSpriteCels[triggers[index].receiverIndex];
+		animSpriteCelSystem->triggers[index].depth = triggers[index].depth;
+	}
+
+	// Retourne un succès
+	return 1;
+}
+
+// Commence ou arrête de garder l'empreinte d'état, et d'enregistrer ses changements
+int32 AnimSpriteCelSystemHashConfiguration(AnimSpriteCelSystem *animSpriteCelSystem, uint32 hashed, uint32 entriesMax) {
+
+	// AnimSpriteCel en cours
+	AnimSpriteCel *animSpriteCel = NULL;
+	// Index du tableau
+	uint32 index = 0;
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return -1;
+	}
+
+	// Si un tick partitionné est en cours
+	if (animSpriteCelSystem->partitioned == 1) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem partitioned tick running.\n");
+		return -1;
+	}
+
+	// Libérer l'enregistrement précédent si présent
+	if (animSpriteCelSystem->hashEntries != NULL) {
+		FreeMem(animSpriteCelSystem->hashEntries, animSpriteCelSystem->hashEntriesMax * sizeof(AnimSpriteCelSystemHashEntry));
+		animSpriteCelSystem->hashEntries = NULL;
+		animSpriteCelSystem->hashEntriesMax = 0;
+	}
+
+	// Si l'empreinte d'état n'est plus gardée
+	if (hashed == 0) {
+		animSpriteCelSystem->hashed = 0;
+		animSpriteCelSystem->stateHash = 0;
+		// Retourne un succès
+		return 1;
+	}
+
+	// Si les changements sont enregistrés
+	if (entriesMax > 0) {
+		// Allouer la mémoire de l'enregistrement
+		animSpriteCelSystem->hashEntries = (AnimSpriteCelSystemHashEntry *)AllocMem(entriesMax * sizeof(AnimSpriteCelSystemHashEntry), MEMTYPE_DRAM);
+		// Si l'allocation de l'enregistrement échoue
+		if (animSpriteCelSystem->hashEntries == NULL) {
+			// Retourne une erreur
+			printf("Error : Failed to allocate memory for AnimSpriteCelSystem hash entries.\n");
+			return -1;
+		}
+		animSpriteCelSystem->hashEntriesMax = entriesMax;
+	}
+	animSpriteCelSystem->hashEntriesCount = 0;
+	animSpriteCelSystem->hashEntriesLost = 0;
+
+	// Si l'empreinte commence à être gardée, chaque AnimSpriteCel enregistré prend son terme (le seul parcours du tableau)
+	if (animSpriteCelSystem->hashed == 0) {
+		animSpriteCelSystem->stateHash = 0;
+		for (index = 0; index < animSpriteCelSystem->animSpriteCelsCount; index++) {
+			animSpriteCel = animSpriteCelSystem->animSpriteCels[index];
+			animSpriteCel->stateHash = AnimSpriteCelSystemHashTerm(animSpriteCelSystem, animSpriteCel);
+			animSpriteCelSystem->stateHash += animSpriteCel->stateHash;
+		}
+		animSpriteCelSystem->hashed = 1;
+	}
+
+	// L'enregistrement part de l'état actuel
+	animSpriteCelSystem->hashOriginTick = animSpriteCelSystem->tick;
+	animSpriteCelSystem->hashOrigin = animSpriteCelSystem->stateHash;
+
+	// Retourne un succès
+	return 1;
+}
+
+// Donne l'empreinte d'état des AnimSpriteCels enregistrés
+uint32 AnimSpriteCelSystemHash(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return 0;
+	}
+
+	// Tenue à jour par les changements d'étape (0 si non gardée)
+	return animSpriteCelSystem->stateHash;
+}
+
+// Écrit les changements enregistrés de l'empreinte d'état dans un tampon
+int32 AnimSpriteCelSystemHashCopy(AnimSpriteCelSystem *animSpriteCelSystem, void *buffer, uint32 bufferSize) {
+
+	// En-tête au début du tampon
+	AnimSpriteCelSystemHashHeader *header = (AnimSpriteCelSystemHashHeader *)buffer;
+	// Nombre de changements copiés
+	uint32 entriesCount = 0;
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return -1;
+	}
+
+	// Si les changements ne sont pas enregistrés
+	if (animSpriteCelSystem->hashEntries == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem hash not recorded.\n");
+		return -1;
+	}
+
+	// Si le tampon est inconnu
+	if (buffer == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem hash buffer unknow.\n");
+		return -1;
+	}
+
+	// Si l'en-tête ne tient pas
+	if (bufferSize < sizeof(AnimSpriteCelSystemHashHeader)) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelSystem hash buffer too small.\n");
+		return -1;
+	}
+
+	// Changements depuis le premier, limités à la taille du tampon
+	entriesCount = animSpriteCelSystem->hashEntriesCount;
+	if (entriesCount > (bufferSize - sizeof(AnimSpriteCelSystemHashHeader)) / sizeof(AnimSpriteCelSystemHashEntry)) {
+		entriesCount = (bufferSize - sizeof(AnimSpriteCelSystemHashHeader)) / sizeof(AnimSpriteCelSystemHashEntry);
+	}
+
+	// En-tête de l'enregistrement
+	header->magic = ANIMSPRITECELSYSTEM_HASH_MAGIC;
+	header->entriesCount = entriesCount;
+	header->entriesLost = animSpriteCelSystem->hashEntriesLost + (animSpriteCelSystem->hashEntriesCount - entriesCount);
+	header->tick = animSpriteCelSystem->hashOriginTick;
+	header->stateHash = animSpriteCelSystem->hashOrigin;
+
+	// Changements après l'en-tête
+	memcpy(header + 1, animSpriteCelSystem->hashEntries, entriesCount * sizeof(AnimSpriteCelSystemHashEntry));
+
+	// Retourne le nombre d'octets écrits
+	return (int32)(sizeof(AnimSpriteCelSystemHashHeader) + entriesCount * sizeof(AnimSpriteCelSystemHashEntry));
+}
+
+// Supprime le AnimSpriteCelSystem
+int32 AnimSpriteCelSystemCleanup(AnimSpriteCelSystem *animSpriteCelSystem) {
+
+	// Index du tableau
+	uint32 index = 0;
+
+	// Si le système est inconnu
+	if (animSpriteCelSystem == NULL) {
+		printf("Error : AnimSpriteCelSystem unknow.\n");
+		return -1;
+	}
+
+	// Si il y a un tableau, supprime les AnimSpriteCels dont le système est propriétaire
+	if (animSpriteCelSystem->animSpriteCels != NULL) {
+		for (index = 0; index < animSpriteCelSystem->animSpriteCelsCount; index++) {
+			// Détache d'abord pour que la suppression ne décale pas le tableau
+			animSpriteCelSystem->animSpriteCels[index]->system = NULL;
+			AnimSpriteCelCleanup(animSpriteCelSystem->animSpriteCels[index]);
+		}
+		FreeMem(animSpriteCelSystem->animSpriteCels, animSpriteCelSystem->animSpriteCelsMax * sizeof(AnimSpriteCel *));
+		animSpriteCelSystem->animSpriteCels = NULL;
+	}
+
+	// Libère l'ensemble actif et les AnimSpriteCels réveillés s'ils existent
+	if (animSpriteCelSystem->active != NULL) {
+		FreeMem(animSpriteCelSystem->active, animSpriteCelSystem->animSpriteCelsMax * sizeof(AnimSpriteCel *));
+		FreeMem(animSpriteCelSystem->woken, animSpriteCelSystem->animSpriteCelsMax * sizeof(AnimSpriteCel *));
+		animSpriteCelSystem->active = NULL;
+		animSpriteCelSystem->woken = NULL;
+	}
+
+	// Libérer les groupes d'affichage si présents
+	if (animSpriteCelSystem->drawGroups != NULL) {
+		FreeMem(animSpriteCelSystem->drawGroups, animSpriteCelSystem->drawGroupsMax * sizeof(AnimSpriteCelSystemDrawGroup));
+		animSpriteCelSystem->drawGroups = NULL;
+	}
+
+	// Libérer le champ de bits des changements si présent
+	if (animSpriteCelSystem->dirty != NULL) {
+		FreeMem(animSpriteCelSystem->dirty, ANIMSPRITECELSYSTEM_DIRTY_WORDS(animSpriteCelSystem->animSpriteCelsMax) * sizeof(uint32));
+		animSpriteCelSystem->dirty = NULL;
+	}
+
+	// Libérer l'enregistrement de l'empreinte d'état si présent
+	if (animSpriteCelSystem->hashEntries != NULL) {
+		FreeMem(animSpriteCelSystem->hashEntries, animSpriteCelSystem->hashEntriesMax * sizeof(AnimSpriteCelSystemHashEntry));
+		animSpriteCelSystem->hashEntries = NULL;
+	}
+
+	// Si il y a une file de déclenchements
+	if (animSpriteCelSystem->triggers != NULL) {
+		FreeMem(animSpriteCelSystem->triggers, animSpriteCelSystem->triggersMax * sizeof(AnimSpriteCelSystemTrigger));
+		animSpriteCelSystem->triggers = NULL;
+	}
+
+	// Libérer le tampon d'événements si présent
+	if (animSpriteCelSystem->events != NULL) {
+		FreeMem(animSpriteCelSystem->events, animSpriteCelSystem->eventsMax * sizeof(AnimSpriteCelSystemEvent));
+		animSpriteCelSystem->events = NULL;
+	}
+
+	// Libérer les boîtes d'envoi et leurs événements si présents
+	if (animSpriteCelSystem->outboxes != NULL) {
+		AnimSpriteCelSystemOutboxEventsFree(animSpriteCelSystem);
+		FreeMem(animSpriteCelSystem->outboxes[0].receivers, animSpriteCelSystem->partitionsCount * animSpriteCelSystem->partitionSize * sizeof(AnimSpriteCel *));
+		FreeMem(animSpriteCelSystem->outboxes, animSpriteCelSystem->partitionsCount * sizeof(AnimSpriteCelSystemOutbox));
+		animSpriteCelSystem->outboxes = NULL;
+	}
+
+	// Libère la mémoire utilisée pour le AnimSpriteCelSystem
+	FreeMem(animSpriteCelSystem, sizeof(AnimSpriteCelSystem));
+
+	// Retourne un succès
+	return 1;
+}
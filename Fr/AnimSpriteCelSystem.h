@@ -0,0 +1,909 @@
+#ifndef ANIMSPRITECELSYSTEM_H
+#define ANIMSPRITECELSYSTEM_H
+
+/******************************************************************************
+**
+**  AnimSpriteCelSystem - Exécution groupée d'AnimSpriteCels (3DO Cel Engine)
+**
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 17-10-2026
+**
+**  Ce module regroupe de nombreux AnimSpriteCels dans un même conteneur afin
+**  de tous les faire évoluer avec un seul appel par cycle d'affichage. Chaque
+**  AnimSpriteCel est validé une seule fois lors de son enregistrement
+**  (AnimSpriteCel, SpriteCel et étapes définis, au moins deux étapes).
+**  AnimSpriteCelSystemRun() parcourt ensuite le tableau contigu des
+**  AnimSpriteCels enregistrés sans répéter ces contrôles et sans passer par
+**  AnimSpriteCelRun() pour chaque animation.
+**
+**  L'évolution de chaque AnimSpriteCel est strictement identique à un appel
+**  à AnimSpriteCelRun() : même comportement NORMAL / REVERSE / ALTERNATE,
+**  même décompte des itérations et mêmes déclenchements, dans l'ordre
+**  d'enregistrement.
+**
+**  Trois ordonnancements sont disponibles :
+**
+**    - POLLING : chaque AnimSpriteCel est visité à chaque cycle d'affichage,
+**      comme avec AnimSpriteCelRun().
+**
+**    - WHEEL : les AnimSpriteCels sont rangés dans une roue temporelle
+**      hiérarchique indexée par le cycle d'affichage ("tick") auquel leur
+**      étape en cours se termine. Chaque cycle d'affichage ne visite que les
+**      AnimSpriteCels dont l'étape se termine réellement, le coût dépend donc
+**      du nombre de transitions et non du nombre d'animations. Les
+**      AnimSpriteCels d'un même tick sont visités dans l'ordre d'enregistrement,
+**      comme en ordonnancement POLLING. Les AnimSpriteCels en attente ou
+**      terminés ne sont pas rangés du tout. La roue comporte 4 niveaux de 64
+**      cases (2^24 ticks) ; les délais plus longs vont dans une liste de
+**      débordement répartie tous les 2^24 ticks.
+**
+**    - ACTIVE : seuls les AnimSpriteCels capables d'avancer sont visités,
+**      depuis un tableau compact gardé dans l'ordre d'enregistrement
+**      (l'ensemble actif). Un AnimSpriteCel qui attend un déclenchement ou a
+**      terminé ses itérations quitte l'ensemble lors de sa visite, il ne
+**      coûte donc plus rien jusqu'à son réveil. AnimSpriteCelSystemSchedule(),
+**      appelée à chaque changement d'étape, le réveille en O(1) en l'ajoutant
+**      à une liste d'AnimSpriteCels réveillés. Cette liste est triée et
+**      fusionnée dans l'ensemble actif au début du tick suivant. La visite de
+**      chaque AnimSpriteCel est celle de l'ordonnancement POLLING, le coût
+**      suit donc le nombre d'animations qui peuvent avancer.
+**
+**  Les déclenchements sont distribués de l'une de ces trois façons :
+**
+**    - IMMEDIATE (par défaut) : AnimSpriteCelNextStep() déclenche le receveur
+**      immédiatement, comme sans système. Une chaîne de déclenchements
+**      s'empile sur la pile d'appels et son résultat dépend de l'ordre
+**      d'enregistrement.
+**
+**    - SAME_TICK : AnimSpriteCelNextStep() met le déclenchement en file. La
+**      file est vidée de manière itérative, dans l'ordre d'envoi, une fois
+**      toutes les animations du tick exécutées. Les déclenchements envoyés
+**      par les receveurs sont ajoutés à la suite et distribués dans le même
+**      tick.
+**
+**    - NEXT_TICK : les déclenchements mis en file pendant un tick sont
+**      distribués au début du suivant. Une chaîne avance d'un maillon par tick.
+**
+**  La distribution s'arrête au budget de déclenchements par tick, le reste
+**  est conservé pour le tick suivant. En distribution SAME_TICK, un
+**  déclenchement atteint par plus de déclenchements chaînés qu'il n'y a
+**  d'AnimSpriteCels enregistrés a fait le tour d'un cycle de receveurs : la
+**  distribution s'arrête et le cycle reprend au tick suivant au lieu de ne
+**  jamais se stabiliser.
+**
+**  AnimSpriteCelSystemSeed() donne à chaque AnimSpriteCel enregistré son
+**  propre générateur xorshift, dérivé de la graine du système et de son index
+**  d'enregistrement, et tire toutes les étapes aléatoires en cours en une
+**  seule passe. Les AnimSpriteCels enregistrés ensuite reçoivent leur graine
+**  de la même façon. La même graine et les mêmes enregistrements donnent
+**  alors les mêmes durées aléatoires à chaque exécution.
+**
+**  AnimSpriteCelSystemTimeScale() ralentit ou accélère tout le système en
+**  une seule écriture : l'échelle de temps, en virgule fixe 16.16, est
+**  ajoutée à un accumulateur à chaque AnimSpriteCelSystemRun(), qui exécute
+**  autant de ticks que l'accumulateur en contient d'entiers (0x8000 exécute
+**  un tick un cycle d'affichage sur deux, 0x18000 exécute 1 et 2 ticks tour
+**  à tour). Les visites suivent aussi la vitesse de chaque AnimSpriteCel
+**  (AnimSpriteCelSpeed()), depuis son propre accumulateur. Aucun des deux
+**  n'utilise de virgule flottante ni de division par tick.
+**
+**  Quand la fréquence d'affichage varie, AnimSpriteCelSystemTimeRun()
+**  remplace AnimSpriteCelSystemRun() : avec les microsecondes écoulées depuis
+**  le dernier cycle d'affichage, elle les rattrape sur chaque AnimSpriteCel
+**  compté en MICROSECONDS (AnimSpriteCelTimeBaseConfiguration()) et exécute
+**  les autres pendant un cycle d'affichage. L'échelle de temps s'applique au
+**  temps écoulé, la fraction de microseconde est reportée à l'exécution
+**  suivante.
+**
+**  Un tick POLLING peut aussi être découpé en partitions : des plages
+**  contiguës du tableau, exécutées l'une après l'autre ou depuis plusieurs
+**  threads sur l'hôte (voir AnimSpriteCelParallel).
+**  AnimSpriteCelSystemPartitionBegin() fait ce qu'AnimSpriteCelSystemRun()
+**  fait avant la visite, chaque partition est ensuite visitée par
+**  AnimSpriteCelSystemPartitionRun(), et AnimSpriteCelSystemPartitionEnd()
+**  fait ce qui vient après. Une partition ne touche que ses propres
+**  AnimSpriteCels : les déclenchements qu'elle envoie vont dans sa boîte
+**  d'envoi au lieu de la file partagée, et les boîtes d'envoi sont fusionnées
+**  dans l'ordre des partitions. La file contient alors les déclenchements
+**  dans l'ordre d'AnimSpriteCelSystemRun(), quel que soit l'ordre dans lequel
+**  les partitions ont été exécutées, et le tick donne exactement le même
+**  résultat.
+**
+**  Le système peut aussi garder les CCB de ses AnimSpriteCels visibles liés
+**  en une seule liste (AnimSpriteCelSystemDrawConfiguration()), dessinée en
+**  un seul appel à DrawCels() depuis AnimSpriteCelSystemDrawList(). La liste
+**  n'est reliée que lorsqu'un AnimSpriteCel est enregistré, retiré ou change
+**  de visibilité, jamais par les étapes :
+**
+**    - SPAWN_ORDER : un CCB est ajouté à la fin de la liste, ceux montrés en
+**      dernier sont donc dessinés par-dessus.
+**
+**    - SOURCE_ORDER : les CCB sont groupés par SpriteCel et PLUT, ainsi des
+**      cels consécutifs lisent la même planche avec la même palette. Un CCB
+**      est inséré après le dernier de son groupe ; un nouveau groupe va à la
+**      fin de la liste. L'ordre des groupes et l'ordre dans un groupe sont
+**      l'ordre dans lequel ils ont été montrés.
+**
+**  Avec AnimSpriteCelSystemDirtyConfiguration(), le système garde un bit
+**  par AnimSpriteCel enregistré, mis lorsque son CCB est écrit. Une étape
+**  qui montre la frame déjà dans le CCB ne l'écrit pas, seuls les CCB
+**  réellement changés sont donc marqués. Après un tick,
+**  AnimSpriteCelSystemChanged() les liste dans l'ordre d'enregistrement,
+**  pour un moteur de rendu ou une couche réseau qui ne veut que les
+**  différences, et AnimSpriteCelSystemDirtyClear() commence l'ensemble
+**  suivant :
+**
+**    uint32 cursor = 0;
+**    AnimSpriteCel *animSpriteCel = NULL;
+**
+**    AnimSpriteCelSystemRun(animSpriteCelSystem);
+**    while ((animSpriteCel = AnimSpriteCelSystemChanged(animSpriteCelSystem, &cursor)) != NULL) {
+**        // animSpriteCel->cel a changé
+**    }
+**    AnimSpriteCelSystemDirtyClear(animSpriteCelSystem);
+**
+**  Avec AnimSpriteCelSystemEventConfiguration(), le système collecte les
+**  événements des étapes (AnimSpriteCelStepEvent()) dans un tampon alloué
+**  une fois : quand un AnimSpriteCel enregistré commence une étape portant
+**  un événement, l'AnimSpriteCel, l'événement et le tick sont ajoutés. Le
+**  jeu lit le tampon une fois par image au lieu de scruter les étapes de
+**  chaque AnimSpriteCel, puis AnimSpriteCelSystemEventsClear() le vide :
+**
+**    uint32 eventsCount = 0;
+**    uint32 index = 0;
+**    AnimSpriteCelSystemEvent *events = NULL;
+**
+**    AnimSpriteCelSystemRun(animSpriteCelSystem);
+**    events = AnimSpriteCelSystemEvents(animSpriteCelSystem, &eventsCount);
+**    for (index = 0; index < eventsCount; index++) {
+**        // events[index].eventId envoyé par events[index].animSpriteCel
+**    }
+**    AnimSpriteCelSystemEventsClear(animSpriteCelSystem);
+**
+**  AnimSpriteCelSystemNextTick() donne le prochain tick auquel une étape se
+**  termine, et AnimSpriteCelSystemSkip() saute les ticks vides qui le
+**  précèdent. Une simulation sans affichage peut ainsi aller d'événement en
+**  événement.
+**
+**  Pour le retour en arrière et les sauvegardes, AnimSpriteCelSystemSnapshot()
+**  copie les têtes de lecture des AnimSpriteCels enregistrés (étape,
+**  direction, cycles restants, itérations, générateur aléatoire, fraction de
+**  vitesse) dans un tampon donné par l'appelant, avec le tick, la fraction de
+**  l'échelle de temps et les déclenchements en attente. Le tampon ne contient
+**  aucun pointeur : les AnimSpriteCels sont désignés par leur index
+**  d'enregistrement, il reste donc valide si le système est déplacé ou
+**  reconstruit avec les mêmes enregistrements. AnimSpriteCelSystemRestore()
+**  les réécrit sans allocation, écrit le CCB de chaque AnimSpriteCel depuis
+**  son étape et reconstruit la roue ou l'ensemble actif. Une tête de lecture
+**  occupe 24 octets et les deux fonctions ne font que copier des champs,
+**  elles peuvent donc être appelées à chaque cycle d'affichage :
+**
+**    uint32 size = AnimSpriteCelSystemSnapshotSize(animSpriteCelSystem);
+**    void *frames = AllocMem(size * 8, MEMTYPE_DRAM);
+**
+**    AnimSpriteCelSystemSnapshot(animSpriteCelSystem, (uint8 *)frames + (frame % 8) * size, size);
+**    ...
+**    AnimSpriteCelSystemRestore(animSpriteCelSystem, (uint8 *)frames + (confirmed % 8) * size, size);
+**
+**  Pour le lockstep et les rejeux, AnimSpriteCelSystemHashConfiguration()
+**  garde une empreinte des têtes de lecture. Chaque AnimSpriteCel enregistré
+**  détient un terme, mélangé à partir de son index d'enregistrement, de sa
+**  tête de lecture et du tick auquel elle a été fixée, et l'empreinte d'état
+**  est la somme des termes. AnimSpriteCelSystemSchedule(), appelée à chaque
+**  changement d'étape, remplace le terme de l'AnimSpriteCel dans la somme :
+**  le tableau n'est jamais reparcouru, et AnimSpriteCelSystemHash() donne
+**  l'empreinte après chaque tick, à comparer avec un pair ou un rejeu. Une
+**  durée tirée des nombres aléatoires matériels ou un déclenchement distribué
+**  dans un autre ordre change le terme de l'étape qu'il commence, et donc
+**  l'empreinte de ce tick.
+**
+**  Avec un nombre d'entrées, la configuration enregistre aussi chaque
+**  changement d'un terme (tick, index d'enregistrement, tête de lecture et
+**  empreinte d'état après lui) jusqu'à ce que l'enregistrement soit plein.
+**  AnimSpriteCelSystemHashCopy() écrit l'enregistrement dans un tampon, et
+**  AnimSpriteCelHashTool (programme hôte, voir AnimSpriteCelHashTool.c)
+**  recherche par dichotomie dans deux enregistrements sauvegardés le premier
+**  changement qui diffère : son tick, son AnimSpriteCel et les deux têtes de
+**  lecture.
+**
+**  Notes importantes :
+**
+**    - Le système est propriétaire des AnimSpriteCels enregistrés.
+**      AnimSpriteCelSystemCleanup() les supprime avec le système. Un
+**      AnimSpriteCel peut être rendu à l'appelant avec AnimSpriteCelSystemUnregister().
+**
+**    - Appeler AnimSpriteCelCleanup() sur un AnimSpriteCel enregistré le
+**      retire d'abord de son système.
+**
+**    - Une étape compacte désigne son receveur par son index d'enregistrement.
+**      Retirer un AnimSpriteCel décale ceux qui le suivent, donc
+**      AnimSpriteCelSystemUnregister() (et AnimSpriteCelCleanup()) le refusent
+**      tant qu'une étape compacte enregistrée désigne son index ou un suivant.
+**      Désenregistrez d'abord les émetteurs compacts, ou supprimez le
+**      système avec eux.
+**
+**    - L'ordre d'enregistrement est conservé lorsqu'un AnimSpriteCel est retiré.
+**
+**    - En ordonnancement WHEEL, "remainingCycles" n'est pas décrémenté à chaque
+**      tick : la fin de l'étape est portée par "expiryTick". Il est remis à
+**      jour lorsque l'AnimSpriteCel est retiré du système. Une étape lancée par
+**      un déclenchement dure toujours sa durée complète à partir du tick
+**      suivant, quel que soit l'ordre d'enregistrement de l'émetteur et du
+**      receveur.
+**
+**    - Les déclenchements en file sont abandonnés lorsqu'un AnimSpriteCel est
+**      retiré. Un receveur qui n'est pas enregistré dans le système doit
+**      survivre aux déclenchements qui lui sont envoyés.
+**
+**    - Un tick partitionné demande l'ordonnancement POLLING et une
+**      distribution en file (SAME_TICK ou NEXT_TICK) : un déclenchement
+**      IMMEDIATE modifierait une autre partition, et les emplacements de la
+**      roue WHEEL sont partagés. Entre AnimSpriteCelSystemPartitionBegin() et
+**      AnimSpriteCelSystemPartitionEnd(), rien ne doit être enregistré,
+**      retiré ou déclenché. Les partitions exécutées depuis plusieurs threads
+**      demandent aussi des étapes aléatoires avec graine (les nombres
+**      aléatoires matériels sont partagés) et aucune trace en enregistrement.
+**
+**    - Les ticks d'AnimSpriteCelSystemNextTick() et d'AnimSpriteCelSystemSkip()
+**      sont des ticks du système, quelle que soit son échelle de temps. Les
+**      ticks partitionnés et les îlots d'AnimSpriteCelGraph sont exécutés un
+**      tick à la fois : pour suivre l'échelle de temps, ils sont exécutés
+**      autant de fois que le donne AnimSpriteCelSystemTicks() à chaque cycle
+**      d'affichage.
+**
+**    - AnimSpriteCelSystemTimeRun() demande l'ordonnancement POLLING : les
+**      étapes en microsecondes sont rattrapées par AnimSpriteCelAdvance(). Les
+**      autres exécutions comptent des cycles d'affichage, donc
+**      AnimSpriteCelSystemRun(), AnimSpriteCelSystemNextTick(),
+**      AnimSpriteCelSystemSkip(), AnimSpriteCelSystemPartitionBegin() et
+**      AnimSpriteCelGraphBegin() retournent une erreur tant qu'un
+**      AnimSpriteCel compté en MICROSECONDS est enregistré.
+**
+**    - En ordonnancement WHEEL, la fin d'une étape est rangée en ticks au
+**      début de l'étape, la vitesse des AnimSpriteCels ne peut donc pas
+**      s'appliquer : AnimSpriteCelSystemRegister() et AnimSpriteCelSpeed()
+**      refusent une vitesse autre que normale. L'échelle de temps s'applique à
+**      tous les ordonnancements.
+**
+**    - En ordonnancement ACTIVE, le résultat est celui de l'ordonnancement
+**      POLLING avec une distribution en file. Avec la distribution IMMEDIATE,
+**      un AnimSpriteCel réveillé pendant la visite par un AnimSpriteCel
+**      enregistré avant lui commence son étape au tick suivant, comme en
+**      ordonnancement WHEEL, au lieu d'être visité au tick en cours.
+**
+**    - La liste d'affichage possède le "ccb_NextPtr" des CCB listés et leurs
+**      drapeaux CCB_LAST et CCB_NPABS. Le groupe d'un CCB est choisi lorsqu'il
+**      est montré : après un changement de sa PLUT, le cacher puis le montrer
+**      de nouveau. Au-delà du nombre maximal de groupes, les nouveaux CCB
+**      sont ajoutés à la fin sans groupe (drawUngroupedCount).
+**
+**    - Les bits ne sont effacés que par AnimSpriteCelSystemDirtyClear() : les
+**      changements faits par le jeu entre deux ticks (déclenchements,
+**      positionnements) sont gardés avec ceux du tick. Un AnimSpriteCel
+**      nouvellement enregistré est marqué, comme tous ceux enregistrés
+**      lorsque le suivi commence. Les changements du CCB faits par le jeu
+**      lui-même (position, PLUT) sont marqués avec AnimSpriteCelSystemDirty().
+**      Un tick partitionné qui suit les changements a besoin de partitions
+**      d'un multiple de 32 AnimSpriteCels, pour que deux partitions ne
+**      partagent jamais un mot du champ de bits.
+**
+**    - Une sauvegarde ne contient que ce que les étapes modifient. Les étapes,
+**      les enregistrements, la visibilité et la configuration du système
+**      doivent être les mêmes à la restauration, ce qui est vérifié pour le
+**      nombre d'AnimSpriteCels. Un déclenchement en attente vers un
+**      AnimSpriteCel hors du système ne peut pas être sauvegardé. Le tampon
+**      est dans l'ordre des octets de la machine et doit être aligné sur 4
+**      octets. Après une restauration, les îlots d'un AnimSpriteCelGraph sont
+**      réveillés par AnimSpriteCelGraphAnalysis().
+**
+**    - L'empreinte d'état couvre les têtes de lecture, pas les étapes ni la
+**      configuration : deux exécutions se comparent si leurs enregistrements,
+**      étapes, ordonnancement et distribution sont les mêmes. Les cycles
+**      décomptés par les ticks et les fractions de vitesse ne sont pas
+**      inclus, ils découlent de la tête de lecture. Un désenregistrement
+**      renumérote les AnimSpriteCels suivants, dont les termes sont repris à
+**      ce tick. Une restauration reprend les termes de la sauvegarde, qui
+**      doit avoir été prise avec l'empreinte gardée, et n'enregistre rien. Un
+**      tick partitionné ajoute les changements de chaque partition à sa fin
+**      mais ne peut pas être enregistré, et les îlots d'un AnimSpriteCelGraph
+**      exécutés depuis plusieurs threads demandent l'empreinte non gardée.
+**
+**    - Les événements sont ajoutés dans l'ordre des changements d'étape, qui
+**      ne dépend que des enregistrements, des étapes, de l'ordonnancement et
+**      de la distribution : deux exécutions d'une scène donnent le même
+**      tampon. Une étape envoie son événement avant son déclenchement, donc
+**      en distribution IMMEDIATE l'événement d'un receveur suit celui de son
+**      émetteur. Pendant un tick partitionné, chaque partition garde ses
+**      événements dans sa boîte d'envoi et les boîtes d'envoi sont ajoutées
+**      dans l'ordre des partitions à la fin du tick, comme
+**      AnimSpriteCelSystemRun() l'aurait fait. Une fois le tampon plein, les
+**      événements sont comptés comme perdus jusqu'à ce qu'il soit vidé. Les
+**      événements d'un AnimSpriteCel désenregistré restent dans le tampon
+**      sans leur AnimSpriteCel. Une restauration ne touche pas au tampon, et
+**      les îlots d'un AnimSpriteCelGraph exécutés depuis plusieurs threads
+**      demandent les événements non collectés.
+**
+**    - Un AnimSpriteCel enregistré ne doit évoluer qu'à travers son système.
+**      Si le jeu le modifie directement (ex : remet "iterationsCount" à jour),
+**      il doit appeler AnimSpriteCelSystemSchedule() pour que la roue ou
+**      l'ensemble actif en tienne compte.
+**
+**  Rôle des structures :
+**
+**    AnimSpriteCelSystem
+**      - animSpriteCels : tableau contigu des AnimSpriteCels enregistrés
+**      - animSpriteCelsCount : nombre d'AnimSpriteCels enregistrés
+**      - animSpriteCelsMax : capacité du tableau
+**      - microsecondsCount : AnimSpriteCels enregistrés comptés en MICROSECONDS
+**      - generation : changée par chaque enregistrement, désenregistrement et
+**        configuration d'étape d'un AnimSpriteCel enregistré (AnimSpriteCelGraph)
+**      - schedule : POLLING, WHEEL ou ACTIVE
+**      - tick : prochain cycle d'affichage à exécuter
+**      - wheel : cases de la roue temporelle, par niveau
+**      - wheelOverflow : AnimSpriteCels au-delà de la portée de la roue
+**      - active, activeCount : ensemble actif, dans l'ordre d'enregistrement
+**      - woken, wokenCount : AnimSpriteCels réveillés depuis le dernier tick
+**      - delivery : IMMEDIATE, SAME_TICK ou NEXT_TICK
+**      - triggers : file circulaire des déclenchements en attente
+**      - triggersMax, triggersFirst, triggersCount : capacité, plus ancien, en attente
+**      - triggersBudget : nombre maximal de déclenchements distribués par tick (0 = sans limite)
+**      - triggerDepth : profondeur dans la chaîne du déclenchement en cours
+**      - triggersDeferred, triggersDropped, cyclesCount : statistiques
+**      - seed : graine des générateurs aléatoires (0 = nombres aléatoires matériels)
+**      - outboxes : déclenchements et événements envoyés par chaque partition pendant un tick partitionné
+**      - partitionsCount, partitionSize : nombre et taille des partitions
+**      - partitioned : un tick partitionné est en cours
+**      - drawListed, drawOrder : liste d'affichage gardée, SPAWN_ORDER ou SOURCE_ORDER
+**      - drawFirst, drawLast, drawCount : AnimSpriteCels visibles, dans l'ordre d'affichage
+**      - drawGroups, drawGroupsCount, drawGroupsMax : groupes de SOURCE_ORDER
+**      - drawUngroupedCount : CCB montrés sans groupe (statistiques)
+**      - dirty : bit par AnimSpriteCel enregistré dont le CCB a changé (NULL si non suivi)
+**      - timeScale : ticks par cycle d'affichage en virgule fixe 16.16 (0x10000 = 1.0)
+**      - timeAccumulator : fraction de tick (de microseconde en exécution au temps) reportée au cycle d'affichage suivant
+**      - hashed, stateHash : empreinte d'état gardée, somme des termes des AnimSpriteCels enregistrés
+**      - hashEntries : changements enregistrés de l'empreinte d'état (NULL si non enregistrés)
+**      - hashEntriesMax, hashEntriesCount, hashEntriesLost : capacité, enregistrés, perdus une fois plein
+**      - hashOriginTick, hashOrigin : tick et empreinte d'état au début de l'enregistrement
+**      - events : événements envoyés par les étapes, dans l'ordre des changements d'étape (NULL si non collectés)
+**      - eventsMax, eventsCount, eventsLost : capacité, à lire, perdus une fois plein
+**
+**    AnimSpriteCelSystemEvent
+**      - animSpriteCel : AnimSpriteCel qui a commencé l'étape (NULL une fois désenregistré)
+**      - eventId : événement de l'étape
+**      - tick : tick du changement d'étape
+**
+**    AnimSpriteCelSystemDrawGroup
+**      - spriteCel, plutPtr : planche et palette partagées par le groupe
+**      - last : dernier AnimSpriteCel du groupe dans la liste
+**      - count : nombre d'AnimSpriteCels du groupe (0 = libre)
+**
+**    AnimSpriteCelSystemSnapshotHeader
+**      - magic : ANIMSPRITECELSYSTEM_SNAPSHOT_MAGIC
+**      - animSpriteCelsCount : nombre de têtes de lecture qui suivent
+**      - triggersCount : nombre de déclenchements en attente après les têtes de lecture
+**      - tick, timeAccumulator : tick et fraction de l'échelle de temps du système
+**
+**    AnimSpriteCelSystemPlayhead
+**      - stepIndex, remainingCycles, iterationsCount, randomState : tête de lecture
+**      - stateHash : terme de l'AnimSpriteCel dans l'empreinte d'état
+**      - speedAccumulator : fraction de cycle d'affichage reportée par la vitesse
+**      - flags : ANIMSPRITECELSYSTEM_PLAYHEAD_BACKWARD (direction -1),
+**        ANIMSPRITECELSYSTEM_PLAYHEAD_ACTIVE (dans l'ensemble actif)
+**
+**    AnimSpriteCelSystemSnapshotTrigger
+**      - receiverIndex : index d'enregistrement du receveur
+**        (ANIMSPRITECELSYSTEM_SNAPSHOT_NONE une fois désenregistré)
+**      - depth : profondeur du déclenchement dans sa chaîne
+**
+**    AnimSpriteCelSystemHashHeader
+**      - magic : ANIMSPRITECELSYSTEM_HASH_MAGIC
+**      - entriesCount : nombre de changements qui suivent
+**      - entriesLost : changements non enregistrés une fois l'enregistrement plein
+**      - tick, stateHash : tick et empreinte d'état au début de l'enregistrement
+**
+**    AnimSpriteCelSystemHashEntry
+**      - tick : tick du changement
+**      - animationIndex : index d'enregistrement de l'AnimSpriteCel
+**      - stepIndex, remainingCycles, iterationsCount, randomState : nouvelle tête de lecture
+**      - flags : ANIMSPRITECELSYSTEM_PLAYHEAD_BACKWARD (direction -1)
+**      - stateHash : empreinte d'état après le changement
+**
+**  Fonctions principales :
+**
+**    AnimSpriteCelSystemInitialization()
+**      -> Crée un système pouvant contenir un nombre donné d'AnimSpriteCels.
+**
+**    AnimSpriteCelSystemRegister()
+**      -> Valide un AnimSpriteCel et l'ajoute au système.
+**
+**    AnimSpriteCelSystemUnregister()
+**      -> Retire un AnimSpriteCel du système sans le supprimer.
+**
+**    AnimSpriteCelSystemTriggerConfiguration()
+**      -> Choisit la distribution des déclenchements, la taille de la file et
+**         le budget de distribution par tick.
+**
+**    AnimSpriteCelSystemTriggerPush()
+**      -> Met un déclenchement en file. Appelée par AnimSpriteCelNextStep() et
+**         AnimSpriteCelAdvance() pour les AnimSpriteCels enregistrés.
+**
+**    AnimSpriteCelSystemSeed()
+**      -> Donne une graine aux générateurs aléatoires de tous les AnimSpriteCels
+**         et tire leurs étapes aléatoires en cours en une seule passe.
+**
+**    AnimSpriteCelSystemSchedule()
+**      -> Range un AnimSpriteCel dans la roue selon son étape en cours, ou le
+**         réveille dans l'ensemble actif. Appelée par AnimSpriteCelNextStep()
+**         pour les AnimSpriteCels enregistrés.
+**
+**    AnimSpriteCelSystemVisit()
+**      -> Exécute un AnimSpriteCel enregistré pour un cycle d'affichage, sauf
+**         s'il est en attente ou terminé. Partagée par les visites POLLING et
+**         ACTIVE et par AnimSpriteCelGraphIslandRun().
+**
+**    AnimSpriteCelSystemRun()
+**      -> Fonction d'évolution à appeler à chaque cycle d'affichage.
+**         Fait évoluer tous les AnimSpriteCels enregistrés (POLLING),
+**         seulement ceux dont l'étape se termine à ce tick (WHEEL) ou
+**         seulement ceux capables d'avancer (ACTIVE).
+**
+**    AnimSpriteCelSystemTimeScale()
+**      -> Ralentit ou accélère tout le système (virgule fixe 16.16).
+**
+**    AnimSpriteCelSystemTicks()
+**      -> Donne le nombre de ticks qu'exécute un cycle d'affichage à l'échelle
+**         de temps.
+**
+**    AnimSpriteCelSystemTimeRun()
+**      -> Exécute les animations enregistrées pendant les microsecondes
+**         écoulées depuis le dernier cycle d'affichage (ordonnancement POLLING).
+**
+**    AnimSpriteCelSystemPartitionConfiguration()
+**      -> Découpe le tableau en partitions d'une taille donnée et alloue leurs
+**         boîtes d'envoi.
+**
+**    AnimSpriteCelSystemPartitionBegin()
+**      -> Commence un tick partitionné (distribution NEXT_TICK, tick suivant)
+**         et donne le nombre de partitions à exécuter.
+**
+**    AnimSpriteCelSystemPartitionRun()
+**      -> Exécute les animations d'une partition. Les partitions d'un tick
+**         peuvent être exécutées dans n'importe quel ordre, depuis plusieurs
+**         threads.
+**
+**    AnimSpriteCelSystemOutboxPush()
+**      -> Met un déclenchement dans la boîte d'envoi de la partition de
+**         l'émetteur. Appelée par AnimSpriteCelNextStep() pendant un tick
+**         partitionné.
+**
+**    AnimSpriteCelSystemPartitionEnd()
+**      -> Fusionne les boîtes d'envoi dans l'ordre des partitions et
+**         distribue SAME_TICK.
+**
+**    AnimSpriteCelSystemDrawConfiguration()
+**      -> Garde les CCB des AnimSpriteCels visibles dans une liste
+**         d'affichage, en SPAWN_ORDER ou SOURCE_ORDER.
+**
+**    AnimSpriteCelSystemVisibility()
+**      -> Montre ou cache un AnimSpriteCel, en liant ou déliant son CCB.
+**
+**    AnimSpriteCelSystemDrawList()
+**      -> Donne le premier CCB de la liste d'affichage, pour DrawCels().
+**
+**    AnimSpriteCelSystemDirtyConfiguration()
+**      -> Commence ou arrête le suivi des CCB changés par les étapes.
+**
+**    AnimSpriteCelSystemDirty()
+**      -> Marque le CCB d'un AnimSpriteCel enregistré comme changé.
+**
+**    AnimSpriteCelSystemChanged()
+**      -> Donne le prochain AnimSpriteCel dont le CCB a changé, depuis un curseur.
+**
+**    AnimSpriteCelSystemDirtyClear()
+**      -> Efface les changements, une fois traités.
+**
+**    AnimSpriteCelSystemEventConfiguration()
+**      -> Démarre ou arrête la collecte des événements des étapes, dans un
+**         tampon d'une taille donnée.
+**
+**    AnimSpriteCelSystemEventPush()
+**      -> Ajoute l'événement de l'étape qu'un AnimSpriteCel enregistré a
+**         commencée. Appelée par AnimSpriteCelNextStep() et
+**         AnimSpriteCelAdvance().
+**
+**    AnimSpriteCelSystemEvents()
+**      -> Donne les événements collectés et leur nombre.
+**
+**    AnimSpriteCelSystemEventsClear()
+**      -> Vide le tampon, une fois lu.
+**
+**    AnimSpriteCelSystemNextTick()
+**      -> Donne le prochain tick auquel une étape se termine.
+**
+**    AnimSpriteCelSystemSkip()
+**      -> Saute à un tick ultérieur sans exécuter les ticks vides.
+**
+**    AnimSpriteCelSystemSnapshotSize()
+**      -> Donne la taille du tampon d'une sauvegarde, déclenchements en
+**         attente compris.
+**
+**    AnimSpriteCelSystemSnapshot()
+**      -> Copie les têtes de lecture et les déclenchements en attente dans un
+**         tampon.
+**
+**    AnimSpriteCelSystemRestore()
+**      -> Réécrit une sauvegarde, sans allocation.
+**
+**    AnimSpriteCelSystemHashConfiguration()
+**      -> Commence ou arrête de garder l'empreinte d'état, et d'enregistrer
+**         ses changements.
+**
+**    AnimSpriteCelSystemHash()
+**      -> Donne l'empreinte d'état des AnimSpriteCels enregistrés.
+**
+**    AnimSpriteCelSystemHashCopy()
+**      -> Écrit les changements enregistrés de l'empreinte d'état dans un
+**         tampon.
+**
+**    AnimSpriteCelSystemCleanup()
+**      -> Libère le système et les AnimSpriteCels dont il est propriétaire.
+**
+******************************************************************************/
+
+// int32
+#include "types.h"
+// AnimSpriteCel
+#include "AnimSpriteCel.h"
+
+// Dimensions de la roue temporelle
+#define ANIMSPRITECELSYSTEM_WHEEL_LEVELS 4
+#define ANIMSPRITECELSYSTEM_WHEEL_BITS 6
+#define ANIMSPRITECELSYSTEM_WHEEL_SLOTS (1 << ANIMSPRITECELSYSTEM_WHEEL_BITS)
+
+// Groupe d'un CCB montré alors que tous les groupes d'affichage étaient pris
+#define ANIMSPRITECELSYSTEM_DRAW_UNGROUPED 0xFFFFFFFF
+
+// Échelle de temps la plus haute en virgule fixe 16.16 (16 ticks par cycle d'affichage)
+#define ANIMSPRITECELSYSTEM_TIME_SCALE_MAX 0x00100000
+
+// Tampons de sauvegarde ("SNAP")
+#define ANIMSPRITECELSYSTEM_SNAPSHOT_MAGIC 0x534E4150
+// Receveur d'un déclenchement sauvegardé qui a été désenregistré
+#define ANIMSPRITECELSYSTEM_SNAPSHOT_NONE 0xFFFFFFFF
+// Drapeaux d'une tête de lecture sauvegardée
+#define ANIMSPRITECELSYSTEM_PLAYHEAD_BACKWARD 0x0001
+#define ANIMSPRITECELSYSTEM_PLAYHEAD_ACTIVE 0x0002
+
+// Enregistrements de l'empreinte d'état ("HASH")
+#define ANIMSPRITECELSYSTEM_HASH_MAGIC 0x48415348
+
+// Mots du champ de bits des changements pour un nombre d'AnimSpriteCels
+#define ANIMSPRITECELSYSTEM_DIRTY_WORDS(count) (((count) + 31) >> 5)
+
+// Ordonnancement des animations enregistrées
+typedef enum {
+	// Chaque animation est visitée à chaque cycle d'affichage
+	POLLING,
+	// Seules les animations dont l'étape se termine sont visitées
+	WHEEL,
+	// Seules les animations capables d'avancer sont visitées
+	ACTIVE
+} AnimSpriteCelSchedule;
+
+// Distribution des déclenchements envoyés par les animations enregistrées
+typedef enum {
+	// Le receveur est déclenché immédiatement, pendant le changement d'étape de l'émetteur
+	IMMEDIATE,
+	// Les déclenchements sont mis en file et distribués à la fin du tick
+	SAME_TICK,
+	// Les déclenchements sont mis en file et distribués au début du tick suivant
+	NEXT_TICK
+} AnimSpriteCelDelivery;
+
+// Ordre de la liste d'affichage
+typedef enum {
+	// CCB dans l'ordre où ils ont été montrés
+	SPAWN_ORDER,
+	// CCB groupés par SpriteCel et PLUT
+	SOURCE_ORDER
+} AnimSpriteCelDrawOrder;
+
+// Déclenchement en attente
+typedef struct {
+	// Receveur à déclencher (NULL une fois retiré)
+	AnimSpriteCel *animSpriteCel;
+	// Nombre de déclenchements chaînés pour l'atteindre dans le tick
+	uint32 depth;
+} AnimSpriteCelSystemTrigger;
+
+// Événement envoyé par l'étape qu'un AnimSpriteCel a commencée
+typedef struct {
+	// AnimSpriteCel qui a commencé l'étape (NULL une fois désenregistré)
+	AnimSpriteCel *animSpriteCel;
+	// Événement de l'étape
+	uint32 eventId;
+	// Tick du changement d'étape
+	uint32 tick;
+} AnimSpriteCelSystemEvent;
+
+// Déclenchements et événements envoyés par une partition pendant un tick partitionné
+typedef struct {
+	// Receveurs, dans l'ordre d'envoi
+	AnimSpriteCel **receivers;
+	// Nombre de déclenchements
+	uint32 receiversCount;
+	// Événements, dans l'ordre des changements d'étape (NULL si non collectés)
+	AnimSpriteCelSystemEvent *events;
+	// Nombre d'événements
+	uint32 eventsCount;
+	// Changement de l'empreinte d'état fait par la partition
+	uint32 stateHash;
+} AnimSpriteCelSystemOutbox;
+
+// CCB de la liste d'affichage partageant une planche et une palette (SOURCE_ORDER)
+typedef struct {
+	// Planche du groupe
+	SpriteCel *spriteCel;
+	// Palette du groupe
+	void *plutPtr;
+	// Dernier AnimSpriteCel du groupe dans la liste
+	AnimSpriteCel *last;
+	// Nombre d'AnimSpriteCels du groupe (0 = libre)
+	uint32 count;
+} AnimSpriteCelSystemDrawGroup;
+
+// En-tête d'une sauvegarde, suivi des têtes de lecture et des déclenchements en attente
+typedef struct {
+	// ANIMSPRITECELSYSTEM_SNAPSHOT_MAGIC
+	uint32 magic;
+	// Nombre de têtes de lecture
+	uint32 animSpriteCelsCount;
+	// Nombre de déclenchements en attente
+	uint32 triggersCount;
+	// Prochain cycle d'affichage à exécuter
+	uint32 tick;
+	// Fraction de tick reportée par l'échelle de temps
+	uint32 timeAccumulator;
+} AnimSpriteCelSystemSnapshotHeader;
+
+// Tête de lecture d'un AnimSpriteCel enregistré dans une sauvegarde
+typedef struct {
+	// Étape en cours
+	uint32 stepIndex;
+	// Cycles restants avant le prochain changement
+	uint32 remainingCycles;
+	// Itérations restantes
+	uint32 iterationsCount;
+	// État du générateur xorshift
+	uint32 randomState;
+	// Terme de l'AnimSpriteCel dans l'empreinte d'état
+	uint32 stateHash;
+	// Fraction de cycle d'affichage reportée par la vitesse
+	uint16 speedAccumulator;
+	// Drapeaux ANIMSPRITECELSYSTEM_PLAYHEAD_*
+	uint16 flags;
+} AnimSpriteCelSystemPlayhead;
+
+// Déclenchement en attente dans une sauvegarde
+typedef struct {
+	// Index d'enregistrement du receveur (ANIMSPRITECELSYSTEM_SNAPSHOT_NONE une fois désenregistré)
+	uint32 receiverIndex;
+	// Nombre de déclenchements chaînés pour l'atteindre dans le tick
+	uint32 depth;
+} AnimSpriteCelSystemSnapshotTrigger;
+
+// En-tête d'un enregistrement de l'empreinte d'état, suivi des changements
+typedef struct {
+	// ANIMSPRITECELSYSTEM_HASH_MAGIC
+	uint32 magic;
+	// Nombre de changements
+	uint32 entriesCount;
+	// Changements non enregistrés une fois l'enregistrement plein
+	uint32 entriesLost;
+	// Tick au début de l'enregistrement
+	uint32 tick;
+	// Empreinte d'état au début de l'enregistrement
+	uint32 stateHash;
+} AnimSpriteCelSystemHashHeader;
+
+// Changement enregistré de l'empreinte d'état
+typedef struct {
+	// Tick du changement
+	uint32 tick;
+	// Index d'enregistrement de l'AnimSpriteCel
+	uint32 animationIndex;
+	// Étape en cours
+	uint16 stepIndex;
+	// ANIMSPRITECELSYSTEM_PLAYHEAD_BACKWARD
+	uint16 flags;
+	// Cycles restants avant le prochain changement
+	uint32 remainingCycles;
+	// Itérations restantes
+	uint32 iterationsCount;
+	// État du générateur xorshift
+	uint32 randomState;
+	// Empreinte d'état après le changement
+	uint32 stateHash;
+} AnimSpriteCelSystemHashEntry;
+
+struct AnimSpriteCelSystem {
+	// AnimSpriteCels enregistrés
+	AnimSpriteCel **animSpriteCels;
+	// Nombre d'AnimSpriteCels enregistrés
+	uint32 animSpriteCelsCount;
+	// Nombre maximal d'AnimSpriteCels
+	uint32 animSpriteCelsMax;
+	// AnimSpriteCels enregistrés comptés en MICROSECONDS (seul AnimSpriteCelSystemTimeRun() les exécute)
+	uint32 microsecondsCount;
+	// Changée par chaque enregistrement, désenregistrement et configuration d'étape d'un AnimSpriteCel enregistré
+	uint32 generation;
+	// Ordonnancement des animations
+	AnimSpriteCelSchedule schedule;
+	// Prochain cycle d'affichage à exécuter
+	uint32 tick;
+	// Cases de la roue temporelle (ordonnancement WHEEL)
+	AnimSpriteCel *wheel[ANIMSPRITECELSYSTEM_WHEEL_LEVELS][ANIMSPRITECELSYSTEM_WHEEL_SLOTS];
+	// AnimSpriteCels au-delà de la portée de la roue
+	AnimSpriteCel *wheelOverflow;
+	// AnimSpriteCels capables d'avancer, dans l'ordre d'enregistrement (ordonnancement ACTIVE)
+	AnimSpriteCel **active;
+	// Nombre d'AnimSpriteCels dans l'ensemble actif
+	uint32 activeCount;
+	// AnimSpriteCels réveillés depuis le dernier tick
+	AnimSpriteCel **woken;
+	// Nombre d'AnimSpriteCels réveillés
+	uint32 wokenCount;
+	// Distribution des déclenchements
+	AnimSpriteCelDelivery delivery;
+	// File des déclenchements en attente (tampon circulaire)
+	AnimSpriteCelSystemTrigger *triggers;
+	// Capacité de la file
+	uint32 triggersMax;
+	// Plus ancien déclenchement en attente
+	uint32 triggersFirst;
+	// Nombre de déclenchements en attente
+	uint32 triggersCount;
+	// Nombre maximal de déclenchements distribués par tick (0 = sans limite)
+	uint32 triggersBudget;
+	// Profondeur du déclenchement en cours de distribution (0 hors distribution)
+	uint32 triggerDepth;
+	// Déclenchements laissés au tick suivant par le budget
+	uint32 triggersDeferred;
+	// Déclenchements perdus car la file était pleine
+	uint32 triggersDropped;
+	// Cycles de déclenchements interrompus en fin de tick
+	uint32 cyclesCount;
+	// Graine des générateurs aléatoires (0 = nombres aléatoires matériels)
+	uint32 seed;
+	// Boîtes d'envoi des partitions (NULL sans partitions)
+	AnimSpriteCelSystemOutbox *outboxes;
+	// Nombre de partitions
+	uint32 partitionsCount;
+	// AnimSpriteCels par partition
+	uint32 partitionSize;
+	// Un tick partitionné est en cours
+	uint32 partitioned;
+	// Les CCB des AnimSpriteCels visibles sont gardés dans une liste d'affichage
+	uint32 drawListed;
+	// Ordre de la liste d'affichage
+	AnimSpriteCelDrawOrder drawOrder;
+	// Premier et dernier AnimSpriteCels visibles, dans l'ordre d'affichage
+	AnimSpriteCel *drawFirst;
+	AnimSpriteCel *drawLast;
+	// Nombre de CCB listés
+	uint32 drawCount;
+	// Groupes de la liste (SOURCE_ORDER)
+	AnimSpriteCelSystemDrawGroup *drawGroups;
+	// Groupes utilisés, libres compris
+	uint32 drawGroupsCount;
+	// Capacité des groupes
+	uint32 drawGroupsMax;
+	// CCB montrés sans groupe, les groupes étant pleins
+	uint32 drawUngroupedCount;
+	// Bit par AnimSpriteCel enregistré dont le CCB a changé depuis le dernier effacement (NULL si non suivi)
+	uint32 *dirty;
+	// Ticks par cycle d'affichage en virgule fixe 16.16 (0x10000 = 1.0)
+	uint32 timeScale;
+	// Fraction de tick (de microseconde en exécution au temps) reportée au cycle d'affichage suivant
+	uint32 timeAccumulator;
+	// L'empreinte d'état est tenue à jour
+	uint32 hashed;
+	// Somme des termes des AnimSpriteCels enregistrés
+	uint32 stateHash;
+	// Changements enregistrés de l'empreinte d'état (NULL si non enregistrés)
+	AnimSpriteCelSystemHashEntry *hashEntries;
+	// Capacité de l'enregistrement
+	uint32 hashEntriesMax;
+	// Changements enregistrés
+	uint32 hashEntriesCount;
+	// Changements perdus une fois l'enregistrement plein
+	uint32 hashEntriesLost;
+	// Tick et empreinte d'état au début de l'enregistrement
+	uint32 hashOriginTick;
+	uint32 hashOrigin;
+	// Événements envoyés par les étapes, dans l'ordre des changements d'étape (NULL si non collectés)
+	AnimSpriteCelSystemEvent *events;
+	// Capacité du tampon
+	uint32 eventsMax;
+	// Événements à lire
+	uint32 eventsCount;
+	// Événements perdus une fois le tampon plein
+	uint32 eventsLost;
+};
+
+// Initialisation d'un AnimSpriteCelSystem
+AnimSpriteCelSystem *AnimSpriteCelSystemInitialization(uint32 animSpriteCelsMax, AnimSpriteCelSchedule schedule);
+// Enregistre un AnimSpriteCel dans le système
+int32 AnimSpriteCelSystemRegister(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel);
+// Retire un AnimSpriteCel du système
+int32 AnimSpriteCelSystemUnregister(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel);
+// Configuration de la distribution des déclenchements
+int32 AnimSpriteCelSystemTriggerConfiguration(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCelDelivery delivery, uint32 triggersMax, uint32 triggersBudget);
+// Met en file un déclenchement envoyé par un AnimSpriteCel enregistré
+void AnimSpriteCelSystemTriggerPush(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel);
+// Donne une graine aux générateurs aléatoires des AnimSpriteCels enregistrés
+int32 AnimSpriteCelSystemSeed(AnimSpriteCelSystem *animSpriteCelSystem, uint32 seed);
+// Planifie un AnimSpriteCel selon son étape en cours
+void AnimSpriteCelSystemSchedule(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel);
+// Visite un AnimSpriteCel enregistré pour un cycle d'affichage, retourne 0 s'il est en attente ou terminé
+uint32 AnimSpriteCelSystemVisit(AnimSpriteCel *animSpriteCel);
+// Exécution de toutes les animations enregistrées
+int32 AnimSpriteCelSystemRun(AnimSpriteCelSystem *animSpriteCelSystem);
+// Règle l'échelle de temps du système
+int32 AnimSpriteCelSystemTimeScale(AnimSpriteCelSystem *animSpriteCelSystem, uint32 timeScale);
+// Donne le nombre de ticks d'un cycle d'affichage à l'échelle de temps
+uint32 AnimSpriteCelSystemTicks(AnimSpriteCelSystem *animSpriteCelSystem);
+// Exécute les animations enregistrées pendant le temps écoulé depuis la dernière exécution
+int32 AnimSpriteCelSystemTimeRun(AnimSpriteCelSystem *animSpriteCelSystem, uint32 elapsedMicroseconds);
+// Découpe les animations enregistrées en partitions exécutées séparément
+int32 AnimSpriteCelSystemPartitionConfiguration(AnimSpriteCelSystem *animSpriteCelSystem, uint32 partitionSize);
+// Met un déclenchement dans la boîte d'envoi de la partition de l'émetteur
+void AnimSpriteCelSystemOutboxPush(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCelSender, AnimSpriteCel *animSpriteCel);
+// Commence un tick partitionné
+int32 AnimSpriteCelSystemPartitionBegin(AnimSpriteCelSystem *animSpriteCelSystem);
+// Exécute les animations d'une partition
+void AnimSpriteCelSystemPartitionRun(AnimSpriteCelSystem *animSpriteCelSystem, uint32 partitionIndex);
+// Termine un tick partitionné
+int32 AnimSpriteCelSystemPartitionEnd(AnimSpriteCelSystem *animSpriteCelSystem);
+// Garde les CCB des AnimSpriteCels visibles dans une liste d'affichage
+int32 AnimSpriteCelSystemDrawConfiguration(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCelDrawOrder drawOrder, uint32 drawGroupsMax);
+// Montre ou cache un AnimSpriteCel enregistré
+int32 AnimSpriteCelSystemVisibility(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel, uint32 visible);
+// Donne le premier CCB de la liste d'affichage
+CCB *AnimSpriteCelSystemDrawList(AnimSpriteCelSystem *animSpriteCelSystem);
+// Commence ou arrête le suivi des CCB changés par les étapes
+int32 AnimSpriteCelSystemDirtyConfiguration(AnimSpriteCelSystem *animSpriteCelSystem, uint32 tracked);
+// Marque le CCB d'un AnimSpriteCel enregistré comme changé
+void AnimSpriteCelSystemDirty(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel);
+// Donne le prochain AnimSpriteCel dont le CCB a changé, depuis un curseur
+AnimSpriteCel *AnimSpriteCelSystemChanged(AnimSpriteCelSystem *animSpriteCelSystem, uint32 *cursor);
+// Efface les changements, une fois traités
+int32 AnimSpriteCelSystemDirtyClear(AnimSpriteCelSystem *animSpriteCelSystem);
+// Démarre ou arrête la collecte des événements des étapes
+int32 AnimSpriteCelSystemEventConfiguration(AnimSpriteCelSystem *animSpriteCelSystem, uint32 eventsMax);
+// Ajoute l'événement de l'étape qu'un AnimSpriteCel enregistré a commencée
+void AnimSpriteCelSystemEventPush(AnimSpriteCelSystem *animSpriteCelSystem, AnimSpriteCel *animSpriteCel, uint32 eventId);
+// Donne les événements collectés et leur nombre
+AnimSpriteCelSystemEvent *AnimSpriteCelSystemEvents(AnimSpriteCelSystem *animSpriteCelSystem, uint32 *eventsCount);
+// Vide le tampon d'événements, une fois lu
+int32 AnimSpriteCelSystemEventsClear(AnimSpriteCelSystem *animSpriteCelSystem);
+// Donne le prochain tick auquel une étape se termine
+int32 AnimSpriteCelSystemNextTick(AnimSpriteCelSystem *animSpriteCelSystem, uint32 *tick);
+// Saute à un tick ultérieur sans exécuter les ticks vides
+int32 AnimSpriteCelSystemSkip(AnimSpriteCelSystem *animSpriteCelSystem, uint32 tick);
+// Donne la taille du tampon d'une sauvegarde
+uint32 AnimSpriteCelSystemSnapshotSize(AnimSpriteCelSystem *animSpriteCelSystem);
+// Copie les têtes de lecture des AnimSpriteCels enregistrés dans un tampon
+int32 AnimSpriteCelSystemSnapshot(AnimSpriteCelSystem *animSpriteCelSystem, void *buffer, uint32 bufferSize);
+// Réécrit les têtes de lecture d'une sauvegarde
+int32 AnimSpriteCelSystemRestore(AnimSpriteCelSystem *animSpriteCelSystem, const void *buffer, uint32 bufferSize);
+// Commence ou arrête de garder l'empreinte d'état, et d'enregistrer ses changements
+int32 AnimSpriteCelSystemHashConfiguration(AnimSpriteCelSystem *animSpriteCelSystem, uint32 hashed, uint32 entriesMax);
+// Donne l'empreinte d'état des AnimSpriteCels enregistrés
+uint32 AnimSpriteCelSystemHash(AnimSpriteCelSystem *animSpriteCelSystem);
+// Écrit les changements enregistrés de l'empreinte d'état dans un tampon
+int32 AnimSpriteCelSystemHashCopy(AnimSpriteCelSystem *animSpriteCelSystem, void *buffer, uint32 bufferSize);
+// Supprime le AnimSpriteCelSystem
+int32 AnimSpriteCelSystemCleanup(AnimSpriteCelSystem *animSpriteCelSystem);
+
+#endif // ANIMSPRITECELSYSTEM_H
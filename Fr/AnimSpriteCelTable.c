@@ -0,0 +1,75 @@
+#include "AnimSpriteCelTable.h"
+
+// AllocMem(), MEMTYPE_DRAM
+#include "mem.h"
+// CloneCel()
+#include "celutils.h"
+// printf()
+#include "stdio.h"
+
+// Crée un AnimSpriteCel jouant une table générée
+AnimSpriteCel *AnimSpriteCelTableInstance(AnimSpriteCelTable *animSpriteCelTable, SpriteCel *spriteCel, int32 direction, uint32 stepIndex) {
+
+	// Instance de l'AnimSpriteCel
+	AnimSpriteCel *animSpriteCel = NULL;
+
+	// Si l'AnimSpriteCelTable n'est pas défini
+	if (animSpriteCelTable == NULL) {
+		// Affiche un message d'erreur
+		printf("Error : AnimSpriteCelTable unknow.\n");
+		return NULL;
+	}
+
+	// Si la planche de sprites n'existe pas
+	if (spriteCel == NULL) {
+		// Affiche un message d'erreur
+		printf("Error : SpriteCel unknow.\n");
+		return NULL;
+	}
+
+	// Si la table joue déjà une autre sprite sheet
+	if ((animSpriteCelTable->spriteCel != NULL) && (animSpriteCelTable->spriteCel != spriteCel)) {
+		// Affiche un message d'erreur
+		printf("Error : AnimSpriteCelTable already uses another SpriteCel.\n");
+		return NULL;
+	}
+
+	// À la première instance, résout le descripteur de chaque frame une fois pour toutes les instances
+	if (animSpriteCelTable->spriteCel == NULL) {
+		AnimSpriteCelFramesResolve(spriteCel, animSpriteCelTable->frames, animSpriteCelTable->framesCount);
+		animSpriteCelTable->spriteCel = spriteCel;
+	}
+
+	// Alloue la mémoire pour AnimSpriteCel (les étapes, les frames et la ligne de temps sont partagées)
+	animSpriteCel = (AnimSpriteCel *)AllocMem(sizeof(AnimSpriteCel), MEMTYPE_DRAM);
+	// Si c'est un échec
+	if (animSpriteCel == NULL) {
+		// Affiche un message d'erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCel.\n");
+		return NULL;
+	}
+
+	// Pas issu d'un pool, étapes compactes dans la table
+	animSpriteCel->pool = NULL;
+	animSpriteCel->sequence = NULL;
+	animSpriteCel->file = NULL;
+	animSpriteCel->table = animSpriteCelTable;
+	animSpriteCel->release = NULL;
+	animSpriteCel->steps = NULL;
+	// Les étapes sont seulement lues, AnimSpriteCelPackedStepConfiguration() les refuse
+	animSpriteCel->packedSteps = (AnimSpriteCelPackedStep *)animSpriteCelTable->steps;
+	animSpriteCel->frames = animSpriteCelTable->frames;
+	animSpriteCel->framesCount = animSpriteCelTable->framesCount;
+	animSpriteCel->timeline = animSpriteCelTable->timeline;
+
+	// Copie le CCB du SpriteCel
+	animSpriteCel->cel = CloneCel(spriteCel->cel, CLONECEL_CCB_ONLY);
+
+	// Initialise la tête de lecture, les étapes restent intactes
+	AnimSpriteCelSetup(animSpriteCel, spriteCel, animSpriteCelTable->loop, animSpriteCelTable->range, animSpriteCelTable->iterations, direction, stepIndex, animSpriteCelTable->stepsCount);
+	// Affiche l'étape de départ
+	AnimSpriteCelUpdate(animSpriteCel);
+
+	// Retourne le AnimSpriteCel créé
+	return animSpriteCel;
+}
@@ -0,0 +1,91 @@
+#ifndef ANIMSPRITECELTABLE_H
+#define ANIMSPRITECELTABLE_H
+
+/******************************************************************************
+**
+**  AnimSpriteCelTable - Tables d'étapes constantes générées à la compilation (3DO Cel Engine)
+**
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 17-10-2026
+**
+**  AnimSpriteCelStepsConfiguration() lit ses étapes avec va_arg : les
+**  arguments ne sont pas vérifiés par le compilateur, chaque étape est
+**  revérifiée à chaque démarrage et chacune est écrite en DRAM.
+**
+**  AnimSpriteCelCompiler (programme hôte, voir AnimSpriteCelCompiler.c)
+**  transforme une description texte des animations en un en-tête C contenant,
+**  pour chaque animation, un tableau constant d'étapes compactes
+**  ("AnimSpriteCelPackedStep") et un AnimSpriteCelTable. Les index de frames
+**  sont vérifiés selon le nombre de frames déclaré pour chaque SpriteCel et
+**  les receveurs, désignés par leur étiquette, sont résolus pendant la
+**  construction du jeu. Le compilateur C vérifie ensuite les types des
+**  tableaux générés.
+**
+**  AnimSpriteCelTableInstance() crée un AnimSpriteCel dont les étapes
+**  compactes pointent vers le tableau constant : aucune étape n'est
+**  configurée, vérifiée ou écrite à l'exécution.
+**
+**  Notes importantes :
+**
+**    - L'en-tête généré définit ses données : l'inclure dans un seul fichier C.
+**
+**    - Le receveur d'une étape est l'animation enregistrée dans le système à
+**      l'index de son étiquette. Les animations d'un en-tête doivent être les
+**      premières enregistrées, dans l'ordre de l'en-tête.
+**
+**    - Les descripteurs de frames et la ligne de temps d'une table sont
+**      partagés par ses instances et construits à la première. Toutes les
+**      instances d'une table doivent donc utiliser le même SpriteCel.
+**
+**    - Les étapes d'une table sont en lecture seule :
+**      AnimSpriteCelPackedStepConfiguration() et AnimSpriteCelStepEvent() sont
+**      refusées sur une instance.
+**
+**  Rôle des structures :
+**
+**    AnimSpriteCelTable
+**      - steps : étapes compactes constantes
+**      - stepsCount : nombre d'étapes
+**      - framesCount : nombre de frames du SpriteCel que les étapes peuvent afficher
+**      - loop, range, iterations : comme pour AnimSpriteCelInitialization()
+**      - frames : descripteurs de frames partagés par les instances
+**      - timeline : durées cumulées partagées par les instances
+**      - spriteCel : SpriteCel des instances (NULL jusqu'à la première)
+**
+**  Fonctions principales :
+**
+**    AnimSpriteCelTableInstance()
+**      -> Crée un AnimSpriteCel jouant une table générée.
+**
+******************************************************************************/
+
+// int32
+#include "types.h"
+// AnimSpriteCel
+#include "AnimSpriteCel.h"
+
+struct AnimSpriteCelTable {
+	// Étapes compactes constantes
+	const AnimSpriteCelPackedStep *steps;
+	// Nombre total d'étapes
+	uint32 stepsCount;
+	// Nombre de frames du SpriteCel
+	uint32 framesCount;
+	// Type de boucle d'animation
+	AnimSpriteCelLoop loop;
+	// Plage de valeurs de l'aléatoire
+	AnimSpriteCelRange range;
+	// Nombre de répétitions du cycle
+	uint32 iterations;
+	// Descripteurs de frames partagés par les instances
+	AnimSpriteCelFrame *frames;
+	// Durées cumulées partagées par les instances
+	uint32 *timeline;
+	// SpriteCel des instances (NULL jusqu'à la première)
+	SpriteCel *spriteCel;
+};
+
+// Crée un AnimSpriteCel jouant une table générée
+AnimSpriteCel *AnimSpriteCelTableInstance(AnimSpriteCelTable *animSpriteCelTable, SpriteCel *spriteCel, int32 direction, uint32 stepIndex);
+
+#endif // ANIMSPRITECELTABLE_H
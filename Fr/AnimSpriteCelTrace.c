@@ -0,0 +1,170 @@
+#include "AnimSpriteCelTrace.h"
+
+// AnimSpriteCelSystem
+#include "AnimSpriteCelSystem.h"
+// AllocMem(), FreeMem(), MEMTYPE_DRAM
+#include "mem.h"
+// memcpy()
+#include "string.h"
+// printf()
+#include "stdio.h"
+
+// Trace partagée par tous les AnimSpriteCels
+AnimSpriteCelTrace animSpriteCelTrace = { NULL, 0, 0, 0 };
+
+// Alloue le tampon circulaire et commence l'enregistrement
+int32 AnimSpriteCelTraceInitialization(uint32 eventsMax) {
+
+	// Capacité arrondie à la puissance de 2 supérieure
+	uint32 eventsCount = 1;
+
+	// Si la trace enregistre déjà
+	if (animSpriteCelTrace.events != NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelTrace already initialized.\n");
+		return -1;
+	}
+
+	// La position dans le tampon est un masque du nombre d'événements
+	while ((eventsCount < eventsMax) && (eventsCount < 0x80000000)) {
+		eventsCount <<= 1;
+	}
+
+	// Alloue la mémoire du tampon circulaire
+	animSpriteCelTrace.events = (AnimSpriteCelTraceEvent *)AllocMem(eventsCount * sizeof(AnimSpriteCelTraceEvent), MEMTYPE_DRAM);
+	// Si c'est un échec
+	if (animSpriteCelTrace.events == NULL) {
+		// Retourne une erreur
+		printf("Error : Failed to allocate memory for AnimSpriteCelTrace events.\n");
+		return -1;
+	}
+
+	// Tampon vide
+	animSpriteCelTrace.eventsMask = eventsCount - 1;
+	animSpriteCelTrace.eventsWritten = 0;
+
+	// Retourne un succès
+	return 1;
+}
+
+// Enregistre un événement
+void AnimSpriteCelTraceWrite(AnimSpriteCelTraceType type, AnimSpriteCel *animSpriteCel, int32 value) {
+
+	// Événement enregistré
+	AnimSpriteCelTraceEvent *event = NULL;
+
+	// Si la trace n'enregistre pas
+	if (animSpriteCelTrace.events == NULL) {
+		return;
+	}
+
+	// Prend la case suivante, en écrasant l'événement le plus ancien si le tampon est plein
+	event = &animSpriteCelTrace.events[animSpriteCelTrace.eventsWritten & animSpriteCelTrace.eventsMask];
+	animSpriteCelTrace.eventsWritten++;
+
+	// Remplit l'événement
+	event->tick = (animSpriteCel->system != NULL) ? animSpriteCel->system->tick : 0;
+#if ANIMSPRITECEL_TRACE == 1
+	event->animationId = animSpriteCel->traceId;
+#else
+	event->animationId = 0;
+#endif
+	event->type = (uint16)type;
+	event->stepIndex = (uint16)animSpriteCel->stepIndex;
+	event->value = value;
+}
+
+// Enregistre les compteurs d'un AnimSpriteCel
+void AnimSpriteCelTraceCounters(AnimSpriteCel *animSpriteCel) {
+
+	// Si l'AnimSpriteCel est inconnu
+	if (animSpriteCel == NULL) {
+		printf("Error : AnimSpriteCel unknow.\n");
+		return;
+	}
+
+	// Les compteurs n'existent que dans une version tracée
+#if ANIMSPRITECEL_TRACE == 1
+	AnimSpriteCelTraceWrite(TRACE_COUNT_STEPS, animSpriteCel, (int32)animSpriteCel->traceSteps);
+	AnimSpriteCelTraceWrite(TRACE_COUNT_IDLE, animSpriteCel, (int32)animSpriteCel->traceIdleCycles);
+	AnimSpriteCelTraceWrite(TRACE_COUNT_SENT, animSpriteCel, (int32)animSpriteCel->traceTriggersSent);
+	AnimSpriteCelTraceWrite(TRACE_COUNT_RECEIVED, animSpriteCel, (int32)animSpriteCel->traceTriggersReceived);
+#endif
+}
+
+// Écrit l'en-tête et les événements dans un tampon
+int32 AnimSpriteCelTraceCopy(void *buffer, uint32 bufferSize) {
+
+	// En-tête au début du tampon
+	AnimSpriteCelTraceHeader *header = (AnimSpriteCelTraceHeader *)buffer;
+	// Événements après l'en-tête
+	AnimSpriteCelTraceEvent *events = NULL;
+	// Nombre d'événements gardés et le plus ancien
+	uint32 eventsCount = 0;
+	uint32 eventIndex = 0;
+	// Événements avant la fin du tampon circulaire
+	uint32 firstCount = 0;
+
+	// Si la trace n'enregistre pas
+	if (animSpriteCelTrace.events == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelTrace not initialized.\n");
+		return -1;
+	}
+
+	// Si le tampon est inconnu
+	if (buffer == NULL) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelTrace buffer unknow.\n");
+		return -1;
+	}
+
+	// Si l'en-tête ne tient pas
+	if (bufferSize < sizeof(AnimSpriteCelTraceHeader)) {
+		// Retourne une erreur
+		printf("Error : AnimSpriteCelTrace buffer too small.\n");
+		return -1;
+	}
+
+	// Événements encore dans le tampon circulaire, limités à la taille du tampon
+	eventsCount = (animSpriteCelTrace.eventsWritten <= animSpriteCelTrace.eventsMask) ? animSpriteCelTrace.eventsWritten : animSpriteCelTrace.eventsMask + 1;
+	if (eventsCount > (bufferSize - sizeof(AnimSpriteCelTraceHeader)) / sizeof(AnimSpriteCelTraceEvent)) {
+		eventsCount = (bufferSize - sizeof(AnimSpriteCelTraceHeader)) / sizeof(AnimSpriteCelTraceEvent);
+	}
+
+	// En-tête de la trace
+	header->magic = ANIMSPRITECELTRACE_MAGIC;
+	header->version = ANIMSPRITECELTRACE_VERSION;
+	header->eventsCount = eventsCount;
+	header->eventsLost = animSpriteCelTrace.eventsWritten - eventsCount;
+
+	// Les événements gardés sont les plus récents, copiés à partir du plus ancien en deux parties
+	events = (AnimSpriteCelTraceEvent *)(header + 1);
+	eventIndex = (animSpriteCelTrace.eventsWritten - eventsCount) & animSpriteCelTrace.eventsMask;
+	firstCount = animSpriteCelTrace.eventsMask + 1 - eventIndex;
+	firstCount = (firstCount < eventsCount) ? firstCount : eventsCount;
+	memcpy(events, &animSpriteCelTrace.events[eventIndex], firstCount * sizeof(AnimSpriteCelTraceEvent));
+	memcpy(events + firstCount, animSpriteCelTrace.events, (eventsCount - firstCount) * sizeof(AnimSpriteCelTraceEvent));
+
+	// Retourne le nombre d'octets écrits
+	return (int32)(sizeof(AnimSpriteCelTraceHeader) + eventsCount * sizeof(AnimSpriteCelTraceEvent));
+}
+
+// Arrête l'enregistrement et libère le tampon circulaire
+int32 AnimSpriteCelTraceCleanup(void) {
+
+	// Si la trace n'enregistre pas
+	if (animSpriteCelTrace.events == NULL) {
+		printf("Error : AnimSpriteCelTrace not initialized.\n");
+		return -1;
+	}
+
+	// Libère le tampon circulaire
+	FreeMem(animSpriteCelTrace.events, (animSpriteCelTrace.eventsMask + 1) * sizeof(AnimSpriteCelTraceEvent));
+	animSpriteCelTrace.events = NULL;
+	animSpriteCelTrace.eventsMask = 0;
+	animSpriteCelTrace.eventsWritten = 0;
+
+	// Retourne un succès
+	return 1;
+}
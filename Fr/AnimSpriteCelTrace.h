@@ -0,0 +1,200 @@
+#ifndef ANIMSPRITECELTRACE_H
+#define ANIMSPRITECELTRACE_H
+
+/******************************************************************************
+**
+**  AnimSpriteCelTrace - Trace binaire des événements des AnimSpriteCels (3DO Cel Engine)
+**
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 17-10-2026
+**
+**  Un printf() à chaque changement d'étape prend plus de temps que
+**  l'animation elle-même : une scène tracée ainsi ne tourne plus à sa vitesse
+**  réelle. Ce module enregistre à la place des événements binaires de taille
+**  fixe ("AnimSpriteCelTraceEvent", 16 octets) dans un tampon circulaire :
+**  enregistrer un événement coûte quelques écritures, sans formatage, sans
+**  appel au système et sans verrou.
+**
+**  La trace est choisie à la compilation du jeu, avec l'interrupteur
+**  ANIMSPRITECEL_TRACE de AnimSpriteCel.h (ou -DANIMSPRITECEL_TRACE=1 sur la
+**  ligne de commande). À 0 (par défaut), les macros d'enregistrement sont
+**  vides et les compteurs ne font pas partie d'AnimSpriteCel : le code et la
+**  mémoire sont les mêmes que sans trace. À 1, chaque AnimSpriteCel
+**  enregistre :
+**
+**    - TRACE_INIT : initialisé (valeur : nombre d'étapes)
+**    - TRACE_CONFIGURATION : étape configurée (valeur : étape configurée)
+**    - TRACE_STEP : changement d'étape (valeur : cycles avant le prochain changement)
+**    - TRACE_TRIGGER_SENT : déclencheur envoyé (valeur : identifiant du receveur)
+**    - TRACE_TRIGGER_RECEIVED : déclencheur reçu (valeur : 1 s'il a lancé
+**      l'étape suivante, 0 si l'animation n'attendait pas)
+**    - TRACE_ITERATION_END : fin de cycle (valeur : itérations restantes)
+**    - TRACE_CLEANUP : supprimé ou rendu à son pool
+**
+**  et tient quatre compteurs : étapes avancées, cycles d'attente (cycles
+**  d'affichage pendant lesquels une étape minutée est tenue avant le
+**  changement suivant), déclencheurs envoyés et déclencheurs reçus.
+**  AnimSpriteCelTraceCounters() les enregistre sous forme d'événements
+**  TRACE_COUNT_* ; la suppression d'un AnimSpriteCel le fait avant
+**  TRACE_CLEANUP.
+**
+**  AnimSpriteCelTraceCopy() écrit la trace (en-tête, puis les événements à
+**  partir du plus ancien) dans un tampon, à sauvegarder ou à lire depuis le
+**  débogueur. AnimSpriteCelTraceTool (programme hôte, voir
+**  AnimSpriteCelTraceTool.c) la décode et résume chaque AnimSpriteCel.
+**
+**  Notes importantes :
+**
+**    - Tous les fichiers du jeu doivent être compilés avec la même valeur de
+**      ANIMSPRITECEL_TRACE : elle change la taille d'AnimSpriteCel.
+**
+**    - Rien n'est enregistré avant AnimSpriteCelTraceInitialization(). Quand
+**      le tampon est plein, les événements les plus anciens sont écrasés.
+**
+**    - La trace n'a qu'un seul écrivain : la tâche qui exécute les
+**      animations. Les événements ne sont lus qu'avec AnimSpriteCelTraceCopy(),
+**      depuis cette tâche.
+**
+**    - Les périodes de boucle sautées par calcul direct dans
+**      AnimSpriteCelAdvance() ne sont ni enregistrées ni comptées, et
+**      AnimSpriteCelSeek() n'enregistre rien.
+**
+**    - Un AnimSpriteCel reçoit un nouvel identifiant à chaque mise en place :
+**      un AnimSpriteCel rendu à un pool puis repris est un nouvel AnimSpriteCel.
+**
+**  Rôle des structures :
+**
+**    AnimSpriteCelTraceEvent
+**      - tick : tick du système de l'AnimSpriteCel (0 s'il n'est pas enregistré)
+**      - animationId : identifiant de l'AnimSpriteCel
+**      - type : TRACE_INIT, TRACE_STEP, ...
+**      - stepIndex : étape en cours de l'AnimSpriteCel
+**      - value : argument de l'événement
+**
+**    AnimSpriteCelTraceHeader
+**      - magic : ANIMSPRITECELTRACE_MAGIC ("TRCE" dans l'ordre des octets de la cible)
+**      - version : ANIMSPRITECELTRACE_VERSION
+**      - eventsCount : nombre d'événements qui suivent l'en-tête
+**      - eventsLost : événements plus anciens écrasés dans le tampon circulaire
+**
+**    AnimSpriteCelTrace
+**      - events : tampon circulaire des événements
+**      - eventsMask : capacité du tampon moins 1 (puissance de 2)
+**      - eventsWritten : nombre d'événements enregistrés depuis l'initialisation
+**      - nextId : identifiant du prochain AnimSpriteCel mis en place
+**
+**  Fonctions principales :
+**
+**    AnimSpriteCelTraceInitialization()
+**      -> Alloue le tampon circulaire et commence l'enregistrement.
+**
+**    AnimSpriteCelTraceWrite()
+**      -> Fonction interne qui enregistre un événement. Appelée par
+**         ANIMSPRITECEL_TRACE_EVENT().
+**
+**    AnimSpriteCelTraceCounters()
+**      -> Enregistre les compteurs d'un AnimSpriteCel. Appelée par
+**         AnimSpriteCelCleanup() avec ANIMSPRITECEL_TRACE_COUNTERS().
+**
+**    AnimSpriteCelTraceCopy()
+**      -> Écrit l'en-tête et les événements dans un tampon.
+**
+**    AnimSpriteCelTraceCleanup()
+**      -> Arrête l'enregistrement et libère le tampon circulaire.
+**
+******************************************************************************/
+
+// int32
+#include "types.h"
+// AnimSpriteCel, ANIMSPRITECEL_TRACE
+#include "AnimSpriteCel.h"
+
+// "TRCE"
+#define ANIMSPRITECELTRACE_MAGIC 0x54524345
+// Version de la disposition de la trace
+#define ANIMSPRITECELTRACE_VERSION 1
+
+// Macros d'enregistrement, vides sans trace
+#if ANIMSPRITECEL_TRACE == 1
+#define ANIMSPRITECEL_TRACE_EVENT(type, animSpriteCel, value) AnimSpriteCelTraceWrite((type), (animSpriteCel), (int32)(value))
+#define ANIMSPRITECEL_TRACE_COUNT(counter, count) ((counter) += (count))
+#define ANIMSPRITECEL_TRACE_COUNTERS(animSpriteCel) AnimSpriteCelTraceCounters((animSpriteCel))
+#else
+#define ANIMSPRITECEL_TRACE_EVENT(type, animSpriteCel, value)
+#define ANIMSPRITECEL_TRACE_COUNT(counter, count)
+#define ANIMSPRITECEL_TRACE_COUNTERS(animSpriteCel)
+#endif
+
+// Types d'événements
+typedef enum {
+	// AnimSpriteCel initialisé
+	TRACE_INIT,
+	// Étape configurée
+	TRACE_CONFIGURATION,
+	// Changement d'étape
+	TRACE_STEP,
+	// Déclencheur envoyé à un receveur
+	TRACE_TRIGGER_SENT,
+	// Déclencheur reçu
+	TRACE_TRIGGER_RECEIVED,
+	// Fin d'un cycle d'animation
+	TRACE_ITERATION_END,
+	// Compteurs de l'AnimSpriteCel
+	TRACE_COUNT_STEPS,
+	TRACE_COUNT_IDLE,
+	TRACE_COUNT_SENT,
+	TRACE_COUNT_RECEIVED,
+	// AnimSpriteCel supprimé
+	TRACE_CLEANUP
+} AnimSpriteCelTraceType;
+
+typedef struct {
+	// Tick du système (0 si non enregistré)
+	uint32 tick;
+	// Identifiant de l'AnimSpriteCel
+	uint32 animationId;
+	// Type d'événement
+	uint16 type;
+	// Étape en cours
+	uint16 stepIndex;
+	// Argument de l'événement
+	int32 value;
+} AnimSpriteCelTraceEvent;
+
+typedef struct {
+	// "TRCE"
+	uint32 magic;
+	// Version de la disposition
+	uint32 version;
+	// Nombre d'événements qui suivent l'en-tête
+	uint32 eventsCount;
+	// Événements plus anciens écrasés dans le tampon circulaire
+	uint32 eventsLost;
+} AnimSpriteCelTraceHeader;
+
+typedef struct {
+	// Tampon circulaire des événements (NULL sans enregistrement)
+	AnimSpriteCelTraceEvent *events;
+	// Capacité du tampon moins 1
+	uint32 eventsMask;
+	// Nombre d'événements enregistrés
+	uint32 eventsWritten;
+	// Identifiant du prochain AnimSpriteCel
+	uint32 nextId;
+} AnimSpriteCelTrace;
+
+// Trace partagée par tous les AnimSpriteCels
+extern AnimSpriteCelTrace animSpriteCelTrace;
+
+// Alloue le tampon circulaire et commence l'enregistrement
+int32 AnimSpriteCelTraceInitialization(uint32 eventsMax);
+// Enregistre un événement
+void AnimSpriteCelTraceWrite(AnimSpriteCelTraceType type, AnimSpriteCel *animSpriteCel, int32 value);
+// Enregistre les compteurs d'un AnimSpriteCel
+void AnimSpriteCelTraceCounters(AnimSpriteCel *animSpriteCel);
+// Écrit l'en-tête et les événements dans un tampon
+int32 AnimSpriteCelTraceCopy(void *buffer, uint32 bufferSize);
+// Arrête l'enregistrement et libère le tampon circulaire
+int32 AnimSpriteCelTraceCleanup(void);
+
+#endif // ANIMSPRITECELTRACE_H
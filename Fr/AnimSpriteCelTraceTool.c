@@ -0,0 +1,240 @@
+/******************************************************************************
+**
+**  AnimSpriteCelTraceTool - Décode les traces d'AnimSpriteCelTrace (outil hôte)
+**
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 17-10-2026
+**
+**  Programme hors ligne, compilé et exécuté sur l'ordinateur de développement
+**  avec n'importe quel compilateur C (il n'utilise pas le SDK 3DO) :
+**
+**    cc -o AnimSpriteCelTraceTool AnimSpriteCelTraceTool.c
+**    AnimSpriteCelTraceTool [-summary] trace.bin
+**
+**  L'entrée est le tampon écrit par AnimSpriteCelTraceCopy(), sauvegardé tel
+**  quel (depuis le débogueur sur la 3DO, avec fwrite() sur l'hôte). Son ordre
+**  des octets est déduit du nombre magique : les traces de la 3DO
+**  (big-endian) et de l'hôte (little-endian) sont toutes deux lues.
+**
+**  Chaque événement est affiché sur une ligne :
+**
+**    tick  animation  étape  événement  valeur
+**
+**  puis chaque AnimSpriteCel est résumé : étapes avancées, fins de cycle,
+**  déclencheurs envoyés et reçus, et les compteurs qu'il a enregistrés à sa
+**  suppression (ou "-" sinon). "-summary" n'affiche que le résumé.
+**
+**  La disposition doit correspondre à AnimSpriteCelTrace.h.
+**
+******************************************************************************/
+
+// printf(), fopen()
+#include <stdio.h>
+// malloc(), realloc(), free()
+#include <stdlib.h>
+// strcmp(), memset()
+#include <string.h>
+
+// Valeurs de AnimSpriteCelTrace.h
+#define TOOL_MAGIC 0x54524345UL
+#define TOOL_VERSION 1UL
+#define TOOL_HEADER_SIZE 16UL
+#define TOOL_EVENT_SIZE 16UL
+#define TOOL_STEP 2
+#define TOOL_TRIGGER_SENT 3
+#define TOOL_TRIGGER_RECEIVED 4
+#define TOOL_ITERATION_END 5
+#define TOOL_COUNT_STEPS 6
+#define TOOL_COUNT_RECEIVED 9
+#define TOOL_TYPES_COUNT 11
+
+// Noms des types d'événements, dans l'ordre de AnimSpriteCelTraceType
+static const char *toolTypeNames[TOOL_TYPES_COUNT] = {
+	"INIT", "CONFIGURATION", "STEP", "TRIGGER_SENT", "TRIGGER_RECEIVED", "ITERATION_END",
+	"COUNT_STEPS", "COUNT_IDLE", "COUNT_SENT", "COUNT_RECEIVED", "CLEANUP"
+};
+
+// Résumé d'un AnimSpriteCel
+typedef struct {
+	// Événements de chaque type
+	unsigned long eventsCount[TOOL_TYPES_COUNT];
+	// Compteurs enregistrés à la suppression
+	long counters[4];
+	// Indicateur de compteurs enregistrés
+	int countersRecorded;
+	// Indicateur de présence dans la trace
+	int seen;
+} ToolAnimation;
+
+// Ordre des octets de la trace
+static int toolLittleEndian = 0;
+
+// Lit une valeur de 32 bits dans l'ordre des octets de la trace
+static unsigned long ToolRead32(const unsigned char *bytes) {
+
+	// Si la trace est little-endian
+	if (toolLittleEndian == 1) {
+		return (unsigned long)bytes[0] | ((unsigned long)bytes[1] << 8) | ((unsigned long)bytes[2] << 16) | ((unsigned long)bytes[3] << 24);
+	}
+	return ((unsigned long)bytes[0] << 24) | ((unsigned long)bytes[1] << 16) | ((unsigned long)bytes[2] << 8) | (unsigned long)bytes[3];
+}
+
+// Lit une valeur de 16 bits dans l'ordre des octets de la trace
+static unsigned long ToolRead16(const unsigned char *bytes) {
+
+	// Si la trace est little-endian
+	if (toolLittleEndian == 1) {
+		return (unsigned long)bytes[0] | ((unsigned long)bytes[1] << 8);
+	}
+	return ((unsigned long)bytes[0] << 8) | (unsigned long)bytes[1];
+}
+
+// Donne une valeur signée de 32 bits
+static long ToolSigned32(unsigned long value) {
+	return (value & 0x80000000UL) ? (long)(value - 0x80000000UL) - 0x7FFFFFFFL - 1 : (long)value;
+}
+
+int main(int argc, char *argv[]) {
+
+	// Index de l'argument
+	int argumentIndex = 1;
+	// Résumé seulement
+	int summaryOnly = 0;
+	// Fichier de trace
+	FILE *input = NULL;
+	unsigned char header[TOOL_HEADER_SIZE];
+	unsigned char event[TOOL_EVENT_SIZE];
+	// Valeurs de l'en-tête
+	unsigned long eventsCount = 0;
+	unsigned long eventsLost = 0;
+	// Valeurs de l'événement
+	unsigned long eventIndex = 0;
+	unsigned long tick = 0;
+	unsigned long animationId = 0;
+	unsigned long type = 0;
+	unsigned long stepIndex = 0;
+	long value = 0;
+	// Résumés, indexés par identifiant
+	ToolAnimation *animations = NULL;
+	ToolAnimation *grown = NULL;
+	unsigned long animationsMax = 0;
+	unsigned long animationIndex = 0;
+	unsigned long counterIndex = 0;
+
+	// Options
+	while ((argumentIndex < argc) && (argv[argumentIndex][0] == '-')) {
+		if (strcmp(argv[argumentIndex], "-summary") == 0) {
+			summaryOnly = 1;
+		} else {
+			break;
+		}
+		argumentIndex++;
+	}
+
+	// Si le fichier manque
+	if (argc - argumentIndex != 1) {
+		printf("Usage: AnimSpriteCelTraceTool [-summary] trace.bin\n");
+		return 1;
+	}
+
+	// Ouvre la trace
+	input = fopen(argv[argumentIndex], "rb");
+	if (input == NULL) {
+		printf("Error : can't open %s.\n", argv[argumentIndex]);
+		return 1;
+	}
+
+	// En-tête, dans l'un ou l'autre ordre des octets
+	if (fread(header, 1, TOOL_HEADER_SIZE, input) != TOOL_HEADER_SIZE) {
+		printf("Error : %s is not a trace.\n", argv[argumentIndex]);
+		fclose(input);
+		return 1;
+	}
+	if (ToolRead32(header) != TOOL_MAGIC) {
+		toolLittleEndian = 1;
+	}
+	if ((ToolRead32(header) != TOOL_MAGIC) || (ToolRead32(header + 4) != TOOL_VERSION)) {
+		printf("Error : %s is not a trace of version %lu.\n", argv[argumentIndex], TOOL_VERSION);
+		fclose(input);
+		return 1;
+	}
+	eventsCount = ToolRead32(header + 8);
+	eventsLost = ToolRead32(header + 12);
+
+	printf("%lu events (%s), %lu older events lost\n\n", eventsCount, (toolLittleEndian == 1) ? "little-endian" : "big-endian", eventsLost);
+	if (summaryOnly == 0) {
+		printf("%10s %9s %5s %-16s %11s\n", "tick", "animation", "step", "event", "value");
+	}
+
+	// Décode chaque événement
+	for (eventIndex = 0; eventIndex < eventsCount; eventIndex++) {
+
+		if (fread(event, 1, TOOL_EVENT_SIZE, input) != TOOL_EVENT_SIZE) {
+			printf("Error : trace cut after %lu events.\n", eventIndex);
+			break;
+		}
+
+		// Champs de l'événement
+		tick = ToolRead32(event);
+		animationId = ToolRead32(event + 4);
+		type = ToolRead16(event + 8);
+		stepIndex = ToolRead16(event + 10);
+		value = ToolSigned32(ToolRead32(event + 12));
+
+		// Si le type est inconnu
+		if (type >= TOOL_TYPES_COUNT) {
+			printf("Error : unknown event type %lu.\n", type);
+			continue;
+		}
+
+		// Affiche l'événement
+		if (summaryOnly == 0) {
+			printf("%10lu %9lu %5lu %-16s %11ld\n", tick, animationId, stepIndex, toolTypeNames[type], value);
+		}
+
+		// Fait de la place pour l'identifiant
+		if (animationId >= animationsMax) {
+			grown = (ToolAnimation *)realloc(animations, (animationId + 1) * sizeof(ToolAnimation));
+			if (grown == NULL) {
+				printf("Error : out of memory.\n");
+				break;
+			}
+			animations = grown;
+			memset(&animations[animationsMax], 0, (animationId + 1 - animationsMax) * sizeof(ToolAnimation));
+			animationsMax = animationId + 1;
+		}
+
+		// Résume l'événement
+		animations[animationId].seen = 1;
+		animations[animationId].eventsCount[type]++;
+		if ((type >= TOOL_COUNT_STEPS) && (type <= TOOL_COUNT_RECEIVED)) {
+			animations[animationId].counters[type - TOOL_COUNT_STEPS] = value;
+			animations[animationId].countersRecorded = 1;
+		}
+	}
+	fclose(input);
+
+	// Résumé de chaque AnimSpriteCel présent dans la trace
+	printf("\n%9s %9s %9s %9s %9s | %9s %9s %9s %9s\n", "animation", "steps", "cycles", "sent", "received", "steps", "idle", "sent", "received");
+	for (animationIndex = 0; animationIndex < animationsMax; animationIndex++) {
+
+		// Identifiant sans événement
+		if (animations[animationIndex].seen == 0) {
+			continue;
+		}
+
+		printf("%9lu %9lu %9lu %9lu %9lu |", animationIndex, animations[animationIndex].eventsCount[TOOL_STEP], animations[animationIndex].eventsCount[TOOL_ITERATION_END],
+			animations[animationIndex].eventsCount[TOOL_TRIGGER_SENT], animations[animationIndex].eventsCount[TOOL_TRIGGER_RECEIVED]);
+		for (counterIndex = 0; counterIndex < 4; counterIndex++) {
+			if (animations[animationIndex].countersRecorded == 1) {
+				printf(" %9ld", animations[animationIndex].counters[counterIndex]);
+			} else {
+				printf(" %9s", "-");
+			}
+		}
+		printf("\n");
+	}
+
+	free(animations);
+	return 0;
+}
@@ -0,0 +1,186 @@
+/******************************************************************************
+**
+**  Host - Remplacement des fonctions du SDK 3DO utilisées par AnimSpriteCel
+**
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 17-10-2026
+**
+**  Permet de construire et de mesurer AnimSpriteCel sur un ordinateur de
+**  développement. Les en-têtes de ce répertoire remplacent ceux du SDK 3DO :
+**  le placer en premier dans le chemin d'inclusion (voir
+**  AnimSpriteCelBenchmark.c).
+**
+******************************************************************************/
+
+// calloc(), malloc(), free()
+#include <stdlib.h>
+// fopen()
+#include <stdio.h>
+
+// AllocMem(), FreeMem()
+#include "mem.h"
+// CloneCel(), DeleteCel()
+#include "celutils.h"
+// ReadHardwareRandomNumber()
+#include "hardware.h"
+// LoadFile(), UnloadFile()
+#include "utils3do.h"
+// SpriteCel
+#include "SpriteCel.h"
+
+// Allocations faites depuis le départ
+uint32 hostAllocationsCount = 0;
+uint32 hostAllocatedBytes = 0;
+
+// État du générateur aléatoire de remplacement
+static uint32 hostRandomState = 12345;
+
+// Données source vers lesquelles pointent les descripteurs de frames
+static CelData hostCelData[256];
+
+// Alloue un bloc de mémoire mis à zéro
+void *AllocMem(int32 size, uint32 type) {
+
+	(void)type;
+
+	// Compte l'allocation
+	hostAllocationsCount++;
+	hostAllocatedBytes += (uint32)size;
+
+	return calloc(1, (size_t)size);
+}
+
+// Libère un bloc de mémoire
+void FreeMem(void *p, int32 size) {
+
+	(void)size;
+
+	free(p);
+}
+
+// Copie un CCB
+CCB *CloneCel(CCB *cel, int32 options) {
+
+	// Copie du CCB
+	CCB *clone = (CCB *)AllocMem(sizeof(CCB), MEMTYPE_DRAM);
+
+	(void)options;
+
+	if (clone != NULL) {
+		*clone = *cel;
+	}
+	return clone;
+}
+
+// Libère un CCB créé par CloneCel()
+void DeleteCel(CCB *cel) {
+
+	FreeMem(cel, sizeof(CCB));
+}
+
+// Charge un fichier Cel (un CCB vierge sur l'hôte)
+CCB *LoadCel(char *fileName, uint32 memTypeBits) {
+
+	(void)fileName;
+
+	return (CCB *)AllocMem(sizeof(CCB), memTypeBits);
+}
+
+// Libère un CCB créé par LoadCel()
+void UnloadCel(CCB *cel) {
+
+	FreeMem(cel, sizeof(CCB));
+}
+
+// Lit le générateur aléatoire de remplacement (congruentiel linéaire, graine fixe)
+uint32 ReadHardwareRandomNumber(void) {
+
+	hostRandomState = (hostRandomState * 1103515245UL) + 12345UL;
+	return hostRandomState >> 1;
+}
+
+// Charge un fichier entier en mémoire
+void *LoadFile(char *fileName, int32 *fileSize, uint32 memTypeBits) {
+
+	// Fichier et sa taille
+	FILE *file = NULL;
+	long size = 0;
+	// Octets chargés
+	void *buffer = NULL;
+
+	(void)memTypeBits;
+
+	file = fopen(fileName, "rb");
+	if (file == NULL) {
+		return NULL;
+	}
+
+	// Taille du fichier
+	fseek(file, 0, SEEK_END);
+	size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	// Le lit en un seul bloc
+	buffer = malloc((size > 0) ? (size_t)size : 1);
+	if ((buffer != NULL) && (fread(buffer, 1, (size_t)size, file) != (size_t)size)) {
+		free(buffer);
+		buffer = NULL;
+	}
+	fclose(file);
+
+	*fileSize = (int32)size;
+	return buffer;
+}
+
+// Libère un fichier chargé par LoadFile()
+void UnloadFile(void *buffer) {
+
+	free(buffer);
+}
+
+// Crée un SpriteCel d'un nombre donné de frames sur un CCB
+SpriteCel *SpriteCelInitialization(CCB *cel, uint32 width, uint32 height, uint32 framesCount) {
+
+	// Instance de SpriteCel
+	SpriteCel *spriteCel = (SpriteCel *)AllocMem(sizeof(SpriteCel), MEMTYPE_DRAM);
+
+	(void)width;
+	(void)height;
+
+	if (spriteCel != NULL) {
+		spriteCel->cel = cel;
+		spriteCel->framesCount = framesCount;
+		spriteCel->frameIndex = 0;
+	}
+	return spriteCel;
+}
+
+// Définit la position des frames dans la planche (ignorée sur l'hôte)
+int32 SpriteCelFramesConfiguration(SpriteCel *spriteCel, int32 start, ...) {
+
+	(void)spriteCel;
+	(void)start;
+
+	return 1;
+}
+
+// Affiche une frame (un descripteur distinct par frame)
+void SpriteCelSetFrame(SpriteCel *spriteCel, uint32 frameIndex) {
+
+	spriteCel->frameIndex = frameIndex;
+	spriteCel->cel->ccb_PRE0 = (frameIndex * 3) + 1;
+	spriteCel->cel->ccb_PRE1 = (frameIndex * 5) + 2;
+	spriteCel->cel->ccb_SourcePtr = &hostCelData[frameIndex % 256];
+}
+
+// Affiche la frame suivante
+void SpriteCelNextFrame(SpriteCel *spriteCel) {
+
+	SpriteCelSetFrame(spriteCel, (spriteCel->frameIndex + 1) % spriteCel->framesCount);
+}
+
+// Libère le SpriteCel (pas son CCB)
+void SpriteCelCleanup(SpriteCel *spriteCel) {
+
+	FreeMem(spriteCel, sizeof(SpriteCel));
+}
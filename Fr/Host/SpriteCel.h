@@ -0,0 +1,37 @@
+#ifndef HOST_SPRITECEL_H
+#define HOST_SPRITECEL_H
+
+/******************************************************************************
+**
+**  Remplacement hôte de SpriteCel
+**
+**  Une sprite sheet de framesCount frames. SpriteCelSetFrame() écrit dans le
+**  CCB un descripteur (PRE0, PRE1, SourcePtr) distinct pour chaque frame,
+**  comme le vrai SpriteCel avec les décalages des frames.
+**
+******************************************************************************/
+
+// CCB
+#include "graphics.h"
+
+typedef struct {
+	// CCB affichant la frame en cours
+	CCB *cel;
+	// Nombre de frames
+	uint32 framesCount;
+	// Frame affichée
+	uint32 frameIndex;
+} SpriteCel;
+
+// Crée un SpriteCel d'un nombre donné de frames sur un CCB
+SpriteCel *SpriteCelInitialization(CCB *cel, uint32 width, uint32 height, uint32 framesCount);
+// Définit la position des frames dans la planche (ignorée sur l'hôte)
+int32 SpriteCelFramesConfiguration(SpriteCel *spriteCel, int32 start, ...);
+// Affiche une frame
+void SpriteCelSetFrame(SpriteCel *spriteCel, uint32 frameIndex);
+// Affiche la frame suivante
+void SpriteCelNextFrame(SpriteCel *spriteCel);
+// Libère le SpriteCel (pas son CCB)
+void SpriteCelCleanup(SpriteCel *spriteCel);
+
+#endif // HOST_SPRITECEL_H
@@ -0,0 +1,27 @@
+#ifndef HOST_CELUTILS_H
+#define HOST_CELUTILS_H
+
+/******************************************************************************
+**
+**  Remplacement hôte du "celutils.h" du SDK 3DO
+**
+******************************************************************************/
+
+// CCB
+#include "graphics.h"
+// MEMTYPE_DRAM
+#include "mem.h"
+
+// Options de CloneCel()
+#define CLONECEL_CCB_ONLY 0x00000000
+
+// Copie un CCB
+CCB *CloneCel(CCB *cel, int32 options);
+// Libère un CCB créé par CloneCel()
+void DeleteCel(CCB *cel);
+// Charge un fichier Cel (un CCB vierge sur l'hôte)
+CCB *LoadCel(char *fileName, uint32 memTypeBits);
+// Libère un CCB créé par LoadCel()
+void UnloadCel(CCB *cel);
+
+#endif // HOST_CELUTILS_H
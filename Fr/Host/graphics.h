@@ -0,0 +1,45 @@
+#ifndef HOST_GRAPHICS_H
+#define HOST_GRAPHICS_H
+
+/******************************************************************************
+**
+**  Remplacement hôte du "graphics.h" du SDK 3DO
+**
+**  CCB (Command Control Block) avec les champs de la 3DO dans le même ordre,
+**  et les drapeaux utilisés par AnimSpriteCel. Rien n'est dessiné.
+**
+******************************************************************************/
+
+// int32
+#include "types.h"
+
+// Drapeaux du CCB
+#define CCB_SKIP 0x80000000
+#define CCB_LAST 0x40000000
+#define CCB_NPABS 0x20000000
+#define CCB_CCBPRE 0x00400000
+
+// Données source du Cel
+typedef uint32 CelData;
+
+typedef struct CCB {
+	uint32 ccb_Flags;
+	struct CCB *ccb_NextPtr;
+	CelData *ccb_SourcePtr;
+	void *ccb_PLUTPtr;
+	Coord ccb_XPos;
+	Coord ccb_YPos;
+	int32 ccb_HDX;
+	int32 ccb_HDY;
+	int32 ccb_VDX;
+	int32 ccb_VDY;
+	int32 ccb_HDDX;
+	int32 ccb_HDDY;
+	uint32 ccb_PIXC;
+	uint32 ccb_PRE0;
+	uint32 ccb_PRE1;
+	int32 ccb_Width;
+	int32 ccb_Height;
+} CCB;
+
+#endif // HOST_GRAPHICS_H
@@ -0,0 +1,19 @@
+#ifndef HOST_HARDWARE_H
+#define HOST_HARDWARE_H
+
+/******************************************************************************
+**
+**  Remplacement hôte du "hardware.h" du SDK 3DO
+**
+**  ReadHardwareRandomNumber() est un générateur à graine fixe, pour que les
+**  exécutions sur l'hôte soient reproductibles.
+**
+******************************************************************************/
+
+// uint32
+#include "types.h"
+
+// Lit le générateur matériel de nombres aléatoires
+uint32 ReadHardwareRandomNumber(void);
+
+#endif // HOST_HARDWARE_H
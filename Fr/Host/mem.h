@@ -0,0 +1,29 @@
+#ifndef HOST_MEM_H
+#define HOST_MEM_H
+
+/******************************************************************************
+**
+**  Remplacement hôte du "mem.h" du SDK 3DO
+**
+**  AllocMem() retourne une mémoire mise à zéro, comme MEMTYPE_FILL sur la 3DO,
+**  et compte les allocations pour que le banc d'essai puisse les afficher.
+**
+******************************************************************************/
+
+// int32
+#include "types.h"
+
+// Types de mémoire
+#define MEMTYPE_DRAM 0x00000001
+#define MEMTYPE_FILL 0x00000100
+
+// Allocations faites depuis le départ (appels à AllocMem() et octets)
+extern uint32 hostAllocationsCount;
+extern uint32 hostAllocatedBytes;
+
+// Alloue un bloc de mémoire
+void *AllocMem(int32 size, uint32 type);
+// Libère un bloc de mémoire
+void FreeMem(void *p, int32 size);
+
+#endif // HOST_MEM_H
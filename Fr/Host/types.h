@@ -0,0 +1,29 @@
+#ifndef HOST_TYPES_H
+#define HOST_TYPES_H
+
+/******************************************************************************
+**
+**  Remplacement hôte du "types.h" du SDK 3DO
+**
+**  Seulement ce qu'utilise AnimSpriteCel, avec les tailles de la 3DO (int32 de
+**  32 bits). Voir AnimSpriteCelBenchmark.c pour la construction hôte.
+**
+******************************************************************************/
+
+// Entiers de taille fixe
+#include <stdint.h>
+// NULL, size_t
+#include <stddef.h>
+// va_list
+#include <stdarg.h>
+
+typedef int8_t int8;
+typedef uint8_t uint8;
+typedef int16_t int16;
+typedef uint16_t uint16;
+typedef int32_t int32;
+typedef uint32_t uint32;
+typedef int32 Err;
+typedef int32 Coord;
+
+#endif // HOST_TYPES_H
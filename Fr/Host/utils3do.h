@@ -0,0 +1,18 @@
+#ifndef HOST_UTILS3DO_H
+#define HOST_UTILS3DO_H
+
+/******************************************************************************
+**
+**  Remplacement hôte du "utils3do.h" de Lib3DO
+**
+******************************************************************************/
+
+// int32
+#include "types.h"
+
+// Charge un fichier entier en mémoire
+void *LoadFile(char *fileName, int32 *fileSize, uint32 memTypeBits);
+// Libère un fichier chargé par LoadFile()
+void UnloadFile(void *buffer);
+
+#endif // HOST_UTILS3DO_H
@@ -7,17 +7,55 @@
 // Obtient une valeur alatoire entre start et end
 int32 GetRandomValue(int32 start, int32 end) {
 	
-	// Plage de valeurs
-    int32 range;
 	// Nombre alatoire
     uint32 randomNumber;
 	
 	// printf("*GetRandomValue()*\n");	
 	
-	// Initialise la plage de valeurs attendue
-    range = end - start + 1;
 	// Obtient un nombre alatoire
     randomNumber = ReadHardwareRandomNumber();
+	// Renvoie le rsultat (multiplication et dcalage au lieu d'un modulo biais)
+    return GetRandomRangeValue(randomNumber, start, end);
+}
+
+// Obtient la valeur suivante d'un gnrateur xorshift (l'tat ne doit pas tre 0)
+uint32 GetRandomXorshift(uint32 *state) {
+	
+	// tat du gnrateur
+	uint32 x = *state;
+	
+	// Trois dcalages et ou exclusifs (priode 2^32 - 1)
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	
+	// Conserve le nouvel tat
+	*state = x;
+	return x;
+}
+
+// Ramne un nombre alatoire  une valeur entre start et end, sans division
+int32 GetRandomRangeValue(uint32 randomNumber, int32 start, int32 end) {
+	
+	// Plage de valeurs
+	uint32 range;
+	// Moitis de 16 bits des facteurs
+	uint32 randomHigh, randomLow, rangeHigh, rangeLow;
+	// Produits partiels
+	uint32 lowLow, lowHigh, highLow;
+	
+	// Initialise la plage de valeurs attendue
+	range = (uint32)(end - start) + 1;
+	
+	// 32 bits de poids fort de randomNumber * range, par moitis de 16 bits (l'ARM60 n'a pas de multiplication longue)
+	randomHigh = randomNumber >> 16;
+	randomLow = randomNumber & 0xFFFF;
+	rangeHigh = range >> 16;
+	rangeLow = range & 0xFFFF;
+	lowLow = randomLow * rangeLow;
+	lowHigh = randomLow * rangeHigh;
+	highLow = randomHigh * rangeLow;
+	
 	// Renvoie le rsultat
-    return start + (randomNumber % range);
+	return start + (int32)((randomHigh * rangeHigh) + (lowHigh >> 16) + (highLow >> 16) + (((lowLow >> 16) + (lowHigh & 0xFFFF) + (highLow & 0xFFFF)) >> 16));
 }
\ No newline at end of file
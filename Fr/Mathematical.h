@@ -6,5 +6,9 @@
 
 // Obtient une valeur aléatoire entre start et end
 int32 GetRandomValue(int32 start, int32 end);
+// Obtient la valeur suivante d'un générateur xorshift (l'état ne doit pas être 0)
+uint32 GetRandomXorshift(uint32 *state);
+// Ramène un nombre aléatoire à une valeur entre start et end, sans division
+int32 GetRandomRangeValue(uint32 randomNumber, int32 start, int32 end);
 
 #endif // LIBRARY_MATHEMATICAL_H
\ No newline at end of file